@@ -33,6 +33,17 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <chrono>
+#include <thread>
+#include <atomic>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 
 #ifdef _DEBUG
@@ -41,7 +52,7 @@
 #define DBG_BREAK()
 #endif
 
-#define FATAL(x, ...) do { printf(x "\n", __VA_ARGS__); DBG_BREAK(); exit(-1); } while (0)
+#define FATAL(x, ...) do { FlushOutput(); printf(x "\n", __VA_ARGS__); DBG_BREAK(); exit(-1); } while (0)
 #define FATAL_IF(conditional, x, ...) do { if (conditional) { FATAL(x, __VA_ARGS__); } } while (0)
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -49,14 +60,207 @@
 static const char ArgumentNoContext[] = "--no-context";
 static const char ArgumentLinearContext[] = "--linear";
 static const char ArgumentLoopMode[] = "--loop";
+static const char ArgumentCfgMode[] = "--cfg";
+static const char ArgumentDefUse[] = "--def-use";
+static const char ArgumentDefUseDot[] = "dot";
+static const char ArgumentDefUseJson[] = "json";
+static const char ArgumentMicroarchitecture[] = "--uarch";
 static const char ArgumentNoSimplification[] = "--no-simplify";
 static const char ArgumentIsaSet[] = "--isa";
+static const char ArgumentUniformIntrinsics[] = "--uniform-intrinsics";
 static const char ArgumentAfterCallRegisterRetentionWindows[] = "--register-retention=windows";
 static const char ArgumentAfterCallRegisterRetentionLinux[] = "--register-retention=linux";
+static const char ArgumentBenchmark[] = "--benchmark";
+static const char ArgumentBatch[] = "--batch";
+static const char ArgumentTokens[] = "--tokens";
+static const char ArgumentLazy[] = "--lazy";
+static const char ArgumentSeek[] = "--seek";
+static const char ArgumentAddressSeededNames[] = "--address-seeded-names";
+static const char ArgumentThreads[] = "--threads";
+static const char ArgumentSplitSweep[] = "--split-sweep";
+static const char ArgumentPipeline[] = "--pipeline";
+static const char ArgumentSection[] = "--section";
+static const char ArgumentFunction[] = "--function";
 
 static bool LinearMode = true;
 static bool LoopMode = false;
+static bool CfgMode = false;
+static bool DefUseMode = false;
+static bool DefUseJson = false;
+static bool HasMicroarchitecture = false;
+static ZydecMicroarchitecture Microarchitecture = zma_skylake;
 static bool ShowIsaSet = false;
+static bool BenchmarkMode = false;
+static bool BatchMode = false;
+static bool TokenMode = false;
+static bool LazyMode = false;
+static bool SeekMode = false;
+static size_t SeekOffset = 0;
+static bool ParallelMode = false;
+static size_t ThreadCount = 0;
+static bool SplitSweep = false;
+static bool PipelineMode = false;
+static const char *SectionName = ".text";
+static const char *FunctionName = nullptr;
+
+static constexpr size_t BenchmarkRepetitions = 5;
+static constexpr size_t BenchmarkCorpusRepetitions = 4096;
+static constexpr size_t BenchmarkBatchSize = 4096;
+static constexpr size_t LazyViewportLines = 256;
+static constexpr size_t SeekCheckpointInterval = 256;
+static constexpr size_t LoopMaxIterations = 8;
+static constexpr size_t CfgMaxPasses = 8;
+static constexpr size_t ParallelMinRangeSize = 16 * 1024;
+static constexpr size_t PipelineBatchSize = 256;
+static constexpr size_t PipelineBatchCount = 8;
+static constexpr size_t PipelineBlockSize = 256 * 1024;
+static constexpr size_t PipelineBlockCount = 8;
+static constexpr size_t MaxLineLength = 4096;
+static constexpr size_t OutputBufferSize = 1024 * 1024;
+static constexpr size_t InputReadSize = 1024 * 1024;
+
+// Mixed SSE / AVX / AVX-512 loads, stores, arithmetic, shuffles, masked & broadcast operations and a bit of scalar loop bookkeeping.
+static const uint8_t BenchmarkCorpus[] =
+{
+  0x0F, 0x28, 0x06, 0x0F, 0x10, 0x4E, 0x10, 0x0F, 0x58, 0xC1, 0x0F, 0x59, 0xC2, 0x66, 0x0F, 0x5C,
+  0xDC, 0x66, 0x0F, 0xEF, 0xED, 0x66, 0x0F, 0x70, 0xF0, 0x1B, 0x66, 0x0F, 0xDB, 0x0D, 0x00, 0x01,
+  0x00, 0x00, 0xF3, 0x0F, 0x5B, 0xD0, 0x0F, 0x29, 0x07, 0xC5, 0xFC, 0x28, 0x06, 0xC5, 0xFC, 0x10,
+  0x4C, 0x8E, 0x20, 0xC5, 0xFC, 0x58, 0xD1, 0xC4, 0xE2, 0x7D, 0xB8, 0xD9, 0xC4, 0xE2, 0x55, 0x16,
+  0xE2, 0xC5, 0xCD, 0xEF, 0xF6, 0xC4, 0xE2, 0x7D, 0x18, 0x3A, 0xC4, 0xE3, 0x75, 0x4A, 0xC2, 0x30,
+  0xC4, 0xE2, 0x6D, 0x00, 0xCB, 0xC5, 0xFC, 0x5F, 0xC4, 0xC5, 0xFC, 0x11, 0x47, 0x20, 0x62, 0xF1,
+  0x7C, 0x48, 0x28, 0x06, 0x62, 0xF1, 0x7C, 0x48, 0x58, 0x4E, 0x01, 0x62, 0xF1, 0x7C, 0x49, 0x58,
+  0xCA, 0x62, 0xF1, 0x7C, 0xC9, 0x58, 0xCA, 0x62, 0xF2, 0x7D, 0x48, 0xA8, 0xD1, 0x62, 0xF3, 0x75,
+  0x48, 0x25, 0xDA, 0x96, 0x62, 0xF3, 0x7D, 0x48, 0x1F, 0xD1, 0x01, 0xC5, 0xEC, 0x41, 0xCB, 0x62,
+  0xF2, 0x55, 0x48, 0x77, 0xE6, 0x62, 0xF2, 0x7D, 0x49, 0x8A, 0xC7, 0x62, 0xF1, 0x7E, 0x4A, 0x6F,
+  0x0F, 0x62, 0xF1, 0x65, 0x58, 0xFE, 0x10, 0x62, 0xF1, 0x7C, 0x48, 0x11, 0x4F, 0x01, 0x48, 0x83,
+  0xC0, 0x40, 0x48, 0x83, 0xE9, 0x01, 0x48, 0x39, 0xD1, 0x4C, 0x8B, 0x44, 0x24, 0x08, 0x4C, 0x8D,
+  0x0C, 0xC8,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+struct InputFile
+{
+  uint8_t *pData;
+  size_t size;
+  bool isMapped;
+};
+
+// Maps regular files, and reads anything else (like `-` for stdin or pipes) as a stream.
+static bool OpenInput(const char *filename, InputFile *pFile);
+
+static char OutputBuffer[OutputBufferSize];
+static size_t OutputLength = 0;
+
+// Lines are collected in `OutputBuffer` and written in bulk, bypassing `stdout` buffering.
+static void WriteOutput(const char *text, const size_t length);
+static void FlushOutput();
+
+// Returns space for a line of up to `MaxLineLength` characters at the end of the output.
+static char * BeginOutputLine();
+static void EndOutputLine(const size_t length);
+
+// Writes `% 8X | %-64s | [%-12s | ]%s\n` without going through `printf`. `line` must fit `MaxLineLength` characters, `disasm` & `decomp` must be shorter than 1024 characters.
+static size_t FormatLine(char *line, const uint64_t address, const char *disasm, const char *isaSet, const char *decomp);
+
+////////////////////////////////////////////////////////////////////////////////
+
+struct BenchmarkBatch
+{
+  ZydisDecodedInstruction *pInstructions;
+  ZydisDecodedOperand *pOperands;
+  size_t *pVirtualAddresses;
+  char *pArena;
+  size_t arenaCapacity;
+  uint32_t *pOffsets;
+  uint32_t *pLengths;
+  uint64_t *pHasTranslation;
+};
+
+// Translates the entire file `BenchmarkRepetitions` times and prints the fastest run alongside a checksum of the generated output, so different builds can be compared for speed and identical output.
+static void RunBenchmark(const uint8_t *pData, const size_t fileSize, const ZydisDecoder *pDecoder, ZydecFormattingInfo *pInfo);
+static uint64_t HashBenchmarkBatch(uint64_t hash, ZydecLinearContext *pContext, const BenchmarkBatch *pBatch, const size_t instructionCount, ZydecFormattingInfo *pInfo);
+
+// Analyzes the entire file into `pListing`, growing its storage as needed.
+static void AnalyzeListing(ZydecListing *pListing, ZydecLinearSession *pSession, const ZydisDecoder *pDecoder, const uint8_t *pData, const size_t fileSize, const size_t virtualAddress);
+
+struct ParallelOutput
+{
+  const ZydisFormatter *pFormatter;
+};
+
+// Translates the file in ranges split at function boundaries (of `pImage` if it lists any, or evenly sized ranges with `SplitSweep`) on `ThreadCount` threads. Every range starts with a fresh linear context.
+static void TranslateParallel(const char *filename, const char *codeName, const ZydecImage *pImage, const uint8_t *pData, const size_t fileSize, const ZydisDecoder *pDecoder, const ZydisFormatter *pFormatter, const size_t virtualAddress, ZydecFormattingInfo *pInfo);
+static bool ParallelWriteLine(char **pBufferPos, size_t *pRemainingSize, const ZydisDecodedInstruction *pInstruction, const ZydisDecodedOperand *pOperands, const size_t virtualAddress, const char *translation, const bool hasTranslation, void *pUserData);
+static bool ParallelEmitRange(const size_t rangeIndex, const char *text, const size_t length, void *pUserData);
+
+// Single producer, single consumer queue of `capacity` preallocated items, that are filled & consumed in place.
+template <typename T>
+struct SpscRing
+{
+  T *pItems;
+  size_t capacity;
+  std::atomic<size_t> readIndex;
+  std::atomic<size_t> writeIndex;
+};
+
+struct PipelineBatch
+{
+  size_t count;
+  bool isLast;
+  bool hasFailed; // the instruction after the batch failed to decode.
+  size_t offsets[PipelineBatchSize];
+  ZydisDecodedInstruction instructions[PipelineBatchSize];
+  ZydisDecodedOperand operands[PipelineBatchSize][ZYDIS_MAX_OPERAND_COUNT];
+};
+
+struct PipelineBlock
+{
+  size_t length;
+  bool isLast;
+  char text[PipelineBlockSize];
+};
+
+// Decodes on one thread, translates & formats on the calling thread, and writes the output on another one, with the stages connected by `SpscRing`s.
+static void RunPipeline(const uint8_t *pData, const size_t fileSize, const size_t startOffset, const ZydisDecoder *pDecoder, const ZydisFormatter *pFormatter, const size_t virtualAddress, ZydecLinearSession *pSession, ZydecFormattingInfo *pInfo);
+static void PipelineDecode(SpscRing<PipelineBatch> *pBatches, const uint8_t *pData, const size_t fileSize, const size_t startOffset, const ZydisDecoder *pDecoder);
+static void PipelineWrite(SpscRing<PipelineBlock> *pBlocks);
+
+// Loads the sections, symbols & functions of an ELF64 or PE32+ image into `pImage`, growing its storage as needed.
+static void LoadImage(ZydecImage *pImage, const uint8_t *pFile, const size_t fileSize);
+
+// Indexes the symbols of `pImage` into `pIndex`, growing its storage as needed.
+static void BuildSymbolIndex(ZydecSymbolIndex *pIndex, const ZydecImage *pImage);
+
+// Writes `// <filename> (<codeName>)`, followed by an empty line.
+static void WriteHeader(const char *filename, const char *codeName);
+
+// Indexes the entire file into `pIndex`, growing its storage as needed.
+static void BuildCheckpointIndex(ZydecCheckpointIndex *pIndex, ZydecLinearSession *pSession, const ZydisDecoder *pDecoder, const uint8_t *pData, const size_t fileSize, const size_t virtualAddress);
+
+// Splits the entire file into the basic blocks of `pGraph`, growing its storage as needed.
+static void BuildControlFlowGraph(ZydecControlFlowGraph *pGraph, const ZydisDecoder *pDecoder, const uint8_t *pData, const size_t fileSize);
+
+// Builds the def-use graph of the entire file into `pGraph`, growing its storage as needed.
+static void BuildDefUseGraph(ZydecDefUseGraph *pGraph, const ZydecControlFlowGraph *pControlFlow, ZydecLinearSession *pSession, const ZydisDecoder *pDecoder, const uint8_t *pData, const size_t fileSize, const size_t virtualAddress);
+
+// Finds the loops of `pGraph`, growing the storage of `pForest` as needed.
+static void DetectLoops(ZydecLoopForest *pForest, const ZydecControlFlowGraph *pGraph);
+
+// Finds the critical path of the loop into `pPath`, growing its storage as needed.
+static void FindCriticalPath(ZydecCriticalPath *pPath, const ZydecDefUseGraph *pDefUse, const ZydecControlFlowGraph *pControlFlow, const ZydecLoopForest *pForest, const size_t loopIndex, const ZydisDecoder *pDecoder, const uint8_t *pData, const size_t fileSize);
+
+// Estimates the throughput of the blocks into `pThroughput`, aborting on failure.
+static void EstimateThroughput(ZydecThroughput *pThroughput, const ZydecControlFlowGraph *pGraph, const uint32_t *pBlocks, const size_t blockCount, const ZydisDecoder *pDecoder, const uint8_t *pData, const size_t fileSize);
+
+// Writes `<cycles> cycles<unit>, <uops> uops, bound by <port / issue width>` into `line`, returning the length.
+static int FormatThroughput(char *line, const size_t capacity, const ZydecThroughput *pThroughput, const char *unit);
+
+// Writes `// block at <address>: <throughput>` in front of the first instruction of a block.
+static void WriteBlockThroughput(const ZydecControlFlowGraph *pGraph, const uint32_t blockIndex, const ZydisDecoder *pDecoder, const uint8_t *pData, const size_t fileSize, const size_t virtualAddress);
+
+// Writes `// loop at <address> (depth <depth>, <blockCount> blocks, exits to <address>, ...)`, followed by `// critical path on <uarch>: ...` if `pCriticalPath` isn't `nullptr`, `// throughput on <uarch>: ...` if `pThroughput` isn't `nullptr` & an empty line.
+static void WriteLoopHeader(const ZydecLoopForest *pForest, const ZydecLoop *pLoop, const ZydecControlFlowGraph *pGraph, const ZydecCriticalPath *pCriticalPath, const ZydecThroughput *pThroughput, const size_t virtualAddress);
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -64,14 +268,18 @@ int main(int argc, char **pArgv)
 {
   if (argc == 1)
   {
-    printf("Usage: example <RawAssembledBinaryFile>\n\t[%s / %s / %s]\n\t[%s]\n\t[%s]\n\t[%s / %s]\n", ArgumentNoContext, ArgumentLinearContext, ArgumentLoopMode, ArgumentNoSimplification, ArgumentIsaSet, ArgumentAfterCallRegisterRetentionWindows, ArgumentAfterCallRegisterRetentionLinux);
+    printf("Usage: example <RawAssembledBinaryFile / ELF64Image / PE32+Image (or - for stdin)>\n\t[%s <SectionName> / %s <SymbolName / 0xAddress>] (for images)\n\t[%s / %s / %s / %s / %s <%s / %s>]\n\t[%s <%s / %s / %s / %s>] (with %s or %s)\n\t[%s]\n\t[%s]\n\t[%s]\n\t[%s / %s]\n\t[%s / %s]\n\t[%s] (names restart after every ret / jmp, even inside a function)\n\t[%s]\n\t[%s <HexOffset> / %s <ThreadCount (0 for all)> [%s]]\n\t[%s [%s / %s / %s]]\n\nor:    example %s [%s / %s / %s] (to benchmark a built-in SSE / AVX / AVX-512 corpus)\n", ArgumentSection, ArgumentFunction, ArgumentNoContext, ArgumentLinearContext, ArgumentLoopMode, ArgumentCfgMode, ArgumentDefUse, ArgumentDefUseDot, ArgumentDefUseJson, ArgumentMicroarchitecture, zydec_Microarchitecture_GetName(zma_skylake), zydec_Microarchitecture_GetName(zma_iceLake), zydec_Microarchitecture_GetName(zma_zen3), zydec_Microarchitecture_GetName(zma_zen4), ArgumentLoopMode, ArgumentCfgMode, ArgumentNoSimplification, ArgumentIsaSet, ArgumentUniformIntrinsics, ArgumentAfterCallRegisterRetentionWindows, ArgumentAfterCallRegisterRetentionLinux, ArgumentTokens, ArgumentLazy, ArgumentAddressSeededNames, ArgumentPipeline, ArgumentSeek, ArgumentThreads, ArgumentSplitSweep, ArgumentBenchmark, ArgumentBatch, ArgumentTokens, ArgumentLazy, ArgumentBenchmark, ArgumentBatch, ArgumentTokens, ArgumentLazy);
     return 0;
   }
 
   const char *filename = pArgv[1];
+  const bool useBenchmarkCorpus = strncmp(filename, ArgumentBenchmark, sizeof(ArgumentBenchmark)) == 0;
+
+  if (useBenchmarkCorpus)
+    BenchmarkMode = true;
 
   ZydecFormattingInfo info;
-  ZydecLinearContext linearContext;
+  ZydecLinearSession linearSession;
 
   // Parse additional arguments.
   if (argc > 2)
@@ -100,6 +308,41 @@ int main(int argc, char **pArgv)
         LinearMode = true;
         LoopMode = true;
       }
+      else if (argsRemaining >= 1 && strncmp(pArgv[argIndex], ArgumentCfgMode, sizeof(ArgumentCfgMode)) == 0)
+      {
+        argIndex++;
+        argsRemaining--;
+        LinearMode = true;
+        CfgMode = true;
+      }
+      else if (argsRemaining >= 2 && strncmp(pArgv[argIndex], ArgumentMicroarchitecture, sizeof(ArgumentMicroarchitecture)) == 0)
+      {
+        if (!zydec_Microarchitecture_FromName(pArgv[argIndex + 1], &Microarchitecture))
+        {
+          printf("Invalid %s '%s'. Aborting.", ArgumentMicroarchitecture, pArgv[argIndex + 1]);
+          return 1;
+        }
+
+        argIndex += 2;
+        argsRemaining -= 2;
+        HasMicroarchitecture = true;
+      }
+      else if (argsRemaining >= 2 && strncmp(pArgv[argIndex], ArgumentDefUse, sizeof(ArgumentDefUse)) == 0)
+      {
+        if (strncmp(pArgv[argIndex + 1], ArgumentDefUseJson, sizeof(ArgumentDefUseJson)) == 0)
+        {
+          DefUseJson = true;
+        }
+        else if (strncmp(pArgv[argIndex + 1], ArgumentDefUseDot, sizeof(ArgumentDefUseDot)) != 0)
+        {
+          printf("Invalid %s format '%s'. Aborting.", ArgumentDefUse, pArgv[argIndex + 1]);
+          return 1;
+        }
+
+        argIndex += 2;
+        argsRemaining -= 2;
+        DefUseMode = true;
+      }
       else if (argsRemaining >= 1 && strncmp(pArgv[argIndex], ArgumentIsaSet, sizeof(ArgumentIsaSet)) == 0)
       {
         argIndex++;
@@ -113,6 +356,12 @@ int main(int argc, char **pArgv)
         info.simplifyCommonShorthands = false;
         info.simplifyValueSelfModification = false;
       }
+      else if (argsRemaining >= 1 && strncmp(pArgv[argIndex], ArgumentUniformIntrinsics, sizeof(ArgumentUniformIntrinsics)) == 0)
+      {
+        argIndex++;
+        argsRemaining--;
+        info.widthCorrectIntrinsics = false;
+      }
       else if (argsRemaining >= 1 && strncmp(pArgv[argIndex], ArgumentAfterCallRegisterRetentionWindows, sizeof(ArgumentAfterCallRegisterRetentionWindows)) == 0)
       {
         argIndex++;
@@ -125,6 +374,75 @@ int main(int argc, char **pArgv)
         argsRemaining--;
         info.afterCallRegisterRetentionMode = ZydecFormattingInfo::AfterCallRegisterRetentionMode::Linux;
       }
+      else if (argsRemaining >= 1 && strncmp(pArgv[argIndex], ArgumentBenchmark, sizeof(ArgumentBenchmark)) == 0)
+      {
+        argIndex++;
+        argsRemaining--;
+        BenchmarkMode = true;
+      }
+      else if (argsRemaining >= 1 && strncmp(pArgv[argIndex], ArgumentBatch, sizeof(ArgumentBatch)) == 0)
+      {
+        argIndex++;
+        argsRemaining--;
+        BatchMode = true;
+      }
+      else if (argsRemaining >= 1 && strncmp(pArgv[argIndex], ArgumentTokens, sizeof(ArgumentTokens)) == 0)
+      {
+        argIndex++;
+        argsRemaining--;
+        TokenMode = true;
+      }
+      else if (argsRemaining >= 1 && strncmp(pArgv[argIndex], ArgumentLazy, sizeof(ArgumentLazy)) == 0)
+      {
+        argIndex++;
+        argsRemaining--;
+        LazyMode = true;
+      }
+      else if (argsRemaining >= 1 && strncmp(pArgv[argIndex], ArgumentAddressSeededNames, sizeof(ArgumentAddressSeededNames)) == 0)
+      {
+        argIndex++;
+        argsRemaining--;
+        info.registerNamingMode = ZydecFormattingInfo::RegisterNamingMode::AddressSeeded;
+      }
+      else if (argsRemaining >= 2 && strncmp(pArgv[argIndex], ArgumentThreads, sizeof(ArgumentThreads)) == 0)
+      {
+        ThreadCount = (size_t)strtoull(pArgv[argIndex + 1], nullptr, 10);
+        argIndex += 2;
+        argsRemaining -= 2;
+        ParallelMode = true;
+      }
+      else if (argsRemaining >= 1 && strncmp(pArgv[argIndex], ArgumentPipeline, sizeof(ArgumentPipeline)) == 0)
+      {
+        argIndex++;
+        argsRemaining--;
+        PipelineMode = true;
+      }
+      else if (argsRemaining >= 1 && strncmp(pArgv[argIndex], ArgumentSplitSweep, sizeof(ArgumentSplitSweep)) == 0)
+      {
+        argIndex++;
+        argsRemaining--;
+        SplitSweep = true;
+      }
+      else if (argsRemaining >= 2 && strncmp(pArgv[argIndex], ArgumentSection, sizeof(ArgumentSection)) == 0)
+      {
+        SectionName = pArgv[argIndex + 1];
+        argIndex += 2;
+        argsRemaining -= 2;
+      }
+      else if (argsRemaining >= 2 && strncmp(pArgv[argIndex], ArgumentFunction, sizeof(ArgumentFunction)) == 0)
+      {
+        FunctionName = pArgv[argIndex + 1];
+        argIndex += 2;
+        argsRemaining -= 2;
+      }
+      else if (argsRemaining >= 2 && strncmp(pArgv[argIndex], ArgumentSeek, sizeof(ArgumentSeek)) == 0)
+      {
+        SeekOffset = (size_t)strtoull(pArgv[argIndex + 1], nullptr, 16);
+        argIndex += 2;
+        argsRemaining -= 2;
+        LinearMode = true;
+        SeekMode = true;
+      }
       else
       {
         printf("Invalid Parameter '%s'. Aborting.", pArgv[argIndex]);
@@ -133,18 +451,103 @@ int main(int argc, char **pArgv)
     }
   }
 
-  FILE *pFile = fopen(filename, "rb");
-  FATAL_IF(pFile == nullptr, "Failed to open file. Aborting.");
+  size_t fileSize;
+  uint8_t *pData;
 
-  fseek(pFile, 0, SEEK_END);
-  const size_t fileSize = _ftelli64(pFile);
-  FATAL_IF(fileSize == 0, "The specified file is empty. Aborting.");
+  if (useBenchmarkCorpus)
+  {
+    fileSize = sizeof(BenchmarkCorpus) * BenchmarkCorpusRepetitions;
+
+    pData = reinterpret_cast<uint8_t *>(malloc(fileSize));
+    FATAL_IF(pData == nullptr, "Memory allocation failure. Aborting.");
+
+    for (size_t i = 0; i < BenchmarkCorpusRepetitions; i++)
+      memcpy(pData + i * sizeof(BenchmarkCorpus), BenchmarkCorpus, sizeof(BenchmarkCorpus));
+  }
+  else
+  {
+    InputFile input;
+    FATAL_IF(!OpenInput(filename, &input), "Failed to read file contents. Aborting.");
+    FATAL_IF(input.size == 0, "The specified file is empty. Aborting.");
+
+    fileSize = input.size;
+    pData = input.pData;
+  }
+
+  size_t addressDisplayOffset = 0x140000000;
+  const char *codeName = nullptr;
+  ZydecImage image;
+  ZydecSymbolIndex symbolIndex;
+
+  // Only translate the requested section or function of images, at their actual addresses.
+  if (!useBenchmarkCorpus && (zydec_Image_IsElf64(pData, fileSize) || zydec_Image_IsPe64(pData, fileSize)))
+  {
+    LoadImage(&image, pData, fileSize);
+    BuildSymbolIndex(&symbolIndex, &image);
+    zydec_SymbolIndex_AttachToFormattingInfo(&symbolIndex, &info);
+
+    info.pReadConstantMemory = zydec_Image_ReadConstantMemory;
+    info.pMemoryUserData = &image;
+
+    if (FunctionName != nullptr)
+    {
+      size_t functionAddress;
+      size_t functionSize = 0;
+
+      if (strncmp(FunctionName, "0x", 2) == 0)
+      {
+        functionAddress = (size_t)strtoull(FunctionName, nullptr, 16);
+      }
+      else
+      {
+        const ZydecImageSymbol *pSymbol = zydec_Image_FindSymbolByName(&image, FunctionName);
+        FATAL_IF(pSymbol == nullptr, "Symbol '%s' not found. Aborting.", FunctionName);
+
+        functionAddress = pSymbol->virtualAddress;
+        functionSize = pSymbol->size;
+      }
+
+      // Exports & addresses don't come with a size, but the function boundaries of the image may know it.
+      if (functionSize == 0)
+      {
+        const ZydecImageFunction *pFunction = zydec_Image_FindFunction(&image, functionAddress);
+
+        if (pFunction != nullptr && pFunction->virtualAddress == functionAddress)
+          functionSize = pFunction->size;
+      }
+
+      const ZydecImageSection *pSection = zydec_Image_FindSection(&image, functionAddress);
+      FATAL_IF(pSection == nullptr || !pSection->isExecutable, "'%s' isn't in a section containing code. Aborting.", FunctionName);
+
+      const size_t offset = functionAddress - pSection->virtualAddress;
+      const size_t remainingSize = pSection->size - offset;
+
+      pData = const_cast<uint8_t *>(pSection->pData) + offset;
+      fileSize = (functionSize != 0 && functionSize < remainingSize) ? functionSize : remainingSize;
+      addressDisplayOffset = functionAddress;
+      codeName = FunctionName;
+    }
+    else
+    {
+      const ZydecImageSection *pSection = nullptr;
+
+      for (size_t i = 0; i < image.sectionCount; i++)
+      {
+        if (image.pSections[i].isExecutable && strcmp(image.pSections[i].name, SectionName) == 0)
+        {
+          pSection = &image.pSections[i];
+          break;
+        }
+      }
 
-  fseek(pFile, 0, SEEK_SET);
+      FATAL_IF(pSection == nullptr, "Section '%s' not found or doesn't contain code. Aborting.", SectionName);
 
-  uint8_t *pData = reinterpret_cast<uint8_t *>(malloc(fileSize));
-  FATAL_IF(pData == nullptr, "Memory allocation failure. Aborting.");
-  FATAL_IF(fileSize != fread(pData, 1, fileSize, pFile), "Failed to read file contents. Aborting.");
+      pData = const_cast<uint8_t *>(pSection->pData);
+      fileSize = pSection->size;
+      addressDisplayOffset = pSection->virtualAddress;
+      codeName = pSection->name;
+    }
+  }
 
   ZydisDecoder decoder;
   ZydisFormatter formatter;
@@ -152,56 +555,244 @@ int main(int argc, char **pArgv)
   FATAL_IF(!ZYAN_SUCCESS(ZydisDecoderInit(&decoder, ZYDIS_MACHINE_MODE_LONG_64, ZYDIS_STACK_WIDTH_64)), "Failed to initialize disassembler.");
   FATAL_IF(!ZYAN_SUCCESS(ZydisFormatterInit(&formatter, ZYDIS_FORMATTER_STYLE_INTEL)) || !ZYAN_SUCCESS(ZydisFormatterSetProperty(&formatter, ZYDIS_FORMATTER_PROP_FORCE_SEGMENT, ZYAN_TRUE)) || !ZYAN_SUCCESS(ZydisFormatterSetProperty(&formatter, ZYDIS_FORMATTER_PROP_FORCE_SIZE, ZYAN_TRUE)), "Failed to initialize instruction formatter.");
 
+  FATAL_IF(SeekMode && (LazyMode || BenchmarkMode), "%s can't be combined with %s or %s. Aborting.", ArgumentSeek, ArgumentLazy, ArgumentBenchmark);
+
+  if (BenchmarkMode)
+  {
+    RunBenchmark(pData, fileSize, &decoder, &info);
+    return 0;
+  }
+
+  if (ParallelMode)
+  {
+    FATAL_IF(LoopMode || CfgMode || DefUseMode || LazyMode || SeekMode || TokenMode, "%s can't be combined with %s, %s, %s, %s, %s or %s. Aborting.", ArgumentThreads, ArgumentLoopMode, ArgumentCfgMode, ArgumentDefUse, ArgumentLazy, ArgumentSeek, ArgumentTokens);
+
+    // Sequential names depend on everything translated before them, so ranges translated on their own would name registers differently than the serial translation.
+    FATAL_IF(LinearMode && info.registerNamingMode != ZydecFormattingInfo::RegisterNamingMode::AddressSeeded, "%s requires %s or %s. Aborting.", ArgumentThreads, ArgumentAddressSeededNames, ArgumentNoContext);
+
+    TranslateParallel(filename, codeName, codeName != nullptr ? &image : nullptr, pData, fileSize, &decoder, &formatter, addressDisplayOffset, &info);
+    return 0;
+  }
+
+  FATAL_IF(LazyMode && !LinearMode, "%s can't be combined with %s. Aborting.", ArgumentLazy, ArgumentNoContext);
+  FATAL_IF(PipelineMode && (LazyMode || TokenMode), "%s can't be combined with %s or %s. Aborting.", ArgumentPipeline, ArgumentLazy, ArgumentTokens);
+  FATAL_IF(CfgMode && (LoopMode || LazyMode || SeekMode || PipelineMode || !LinearMode), "%s can't be combined with %s, %s, %s, %s or %s. Aborting.", ArgumentCfgMode, ArgumentLoopMode, ArgumentLazy, ArgumentSeek, ArgumentPipeline, ArgumentNoContext);
+  FATAL_IF(LoopMode && (LazyMode || SeekMode || PipelineMode), "%s can't be combined with %s, %s or %s. Aborting.", ArgumentLoopMode, ArgumentLazy, ArgumentSeek, ArgumentPipeline);
+  FATAL_IF(HasMicroarchitecture && !LoopMode && !CfgMode, "%s requires %s or %s. Aborting.", ArgumentMicroarchitecture, ArgumentLoopMode, ArgumentCfgMode);
+  FATAL_IF(DefUseMode && (LoopMode || LazyMode || SeekMode || PipelineMode), "%s can't be combined with %s, %s, %s or %s. Aborting.", ArgumentDefUse, ArgumentLoopMode, ArgumentLazy, ArgumentSeek, ArgumentPipeline);
+
+  zydec_LinearSession_Init(&linearSession, &info);
+
   ZydisDecodedInstruction instruction;
   ZydisDecodedOperand operands[10];
 
   size_t virtualAddress = 0;
-  constexpr size_t addressDisplayOffset = 0x140000000;
 
   char disasmBuffer[1024] = "";
   char decompBuffer[1024] = "";
+  ZydecToken tokens[ZydecTokenInstructionCapacity];
+  size_t tokenCount = 0;
+
+  ZydecControlFlowGraph graph;
+  ZydecLoopForest loops;
+  const ZydecLoop *pLoop = nullptr;
+  ZydecCriticalPath criticalPath;
+  const ZydecCriticalPath *pCriticalPath = nullptr; // chain members are marked if set.
+  ZydecThroughput loopThroughput;
+  const ZydecThroughput *pLoopThroughput = nullptr;
+  ZydecDefUseGraph loopDefUse;
+  const uint32_t *pRenderedBlocks = nullptr; // only these blocks are rendered if set.
+  size_t nextBlock = 0;
+  size_t blockEnd = 0;
+
+  if (CfgMode || LoopMode || DefUseMode)
+  {
+    BuildControlFlowGraph(&graph, &decoder, pData, fileSize);
 
-  if (LoopMode && LinearMode)
+    graph.pContexts = reinterpret_cast<ZydecLinearContext *>(malloc(sizeof(ZydecLinearContext) * graph.blockCapacity));
+    FATAL_IF(graph.pContexts == nullptr, "Memory allocation failure. Aborting.");
+  }
+
+  // Renders just the innermost loop, with the names that the back-edges carry into it, so no text is produced until they have settled.
+  if (LoopMode)
   {
-    const uint64_t hashStateBefore = linearContext.hashState;
-    size_t addr = 0;
+    DetectLoops(&loops, &graph);
 
-    while (addr < fileSize)
+    const uint32_t hotLoop = zydec_LoopForest_FindHotLoop(&loops);
+
+    if (hotLoop != ZydecBasicBlockNone)
     {
-      if (!(ZYAN_SUCCESS(ZydisDecoderDecodeFull(&decoder, pData + addr, fileSize - addr, &instruction, operands))))
-      {
-        puts("Failed to decode instruction in loop pre-run. Aborting pre-run.");
-        break;
-      }
+      pLoop = &loops.pLoops[hotLoop];
+      pRenderedBlocks = loops.pLoopBlocks + pLoop->firstBlock;
+      virtualAddress = blockEnd = graph.pBlocks[pRenderedBlocks[0]].offset;
+    }
+    else
+    {
+      puts("No loop found, treating the entire code as one loop.");
+    }
+
+    if (LinearMode)
+    {
+      bool reachedFixedPoint = false;
 
-      bool hasTranslation;
+      if (pLoop != nullptr)
+        FATAL_IF(!zydec_LoopForest_PropagateLoopNames(&loops, hotLoop, &graph, &linearSession, &decoder, pData, fileSize, addressDisplayOffset, LoopMaxIterations, nullptr, &reachedFixedPoint), "Failed to analyze loop. Aborting.");
+      else
+        FATAL_IF(!zydec_LinearSession_AnalyzeLoop(&linearSession, &decoder, pData, fileSize, addressDisplayOffset, LoopMaxIterations, nullptr, &reachedFixedPoint), "Failed to analyze loop. Aborting.");
 
-      zydec_TranslateInstructionWithLinearContext(&linearContext, &instruction, operands, sizeof(operands) / sizeof(operands[0]), addr + addressDisplayOffset, decompBuffer, sizeof(decompBuffer), &hasTranslation, &info);
+      if (!reachedFixedPoint)
+        puts("Loop names didn't settle in the loop pre-run.");
+    }
 
-      if (instruction.length == 0)
-      {
-        puts("Invalid instruction length in loop pre-run. Aborting pre-run.");
-        break;
-      }
+    // Chains through values kept on the stack count as well, as they're common in unoptimized code.
+    if (pLoop != nullptr && HasMicroarchitecture)
+    {
+      loopDefUse.memoryTracking = ZydecDefUseGraph::MemoryTracking::StackSlots;
+
+      BuildDefUseGraph(&loopDefUse, &graph, nullptr, &decoder, pData, fileSize, addressDisplayOffset);
+      FindCriticalPath(&criticalPath, &loopDefUse, &graph, &loops, hotLoop, &decoder, pData, fileSize);
+      EstimateThroughput(&loopThroughput, &graph, loops.pLoopBlocks + pLoop->firstBlock, pLoop->blockCount, &decoder, pData, fileSize);
 
-      addr += instruction.length;
+      pCriticalPath = &criticalPath;
+      pLoopThroughput = &loopThroughput;
     }
+  }
+
+  // Every block starts with the names that the blocks leading into it agree on, rather than with whatever the instruction before it left behind.
+  if (CfgMode || (DefUseMode && LinearMode))
+  {
+    bool reachedFixedPoint = false;
+    FATAL_IF(!zydec_ControlFlowGraph_PropagateNames(&graph, &linearSession, &decoder, pData, fileSize, addressDisplayOffset, CfgMaxPasses, nullptr, &reachedFixedPoint), "Failed to propagate names through the control flow graph. Aborting.");
+
+    if (!reachedFixedPoint)
+      puts("Block names didn't settle in the control flow pre-run.");
+  }
+
+  // Writes the values flowing between the instructions instead of the listing.
+  if (DefUseMode)
+  {
+    ZydecDefUseGraph defUse;
+    defUse.memoryTracking = ZydecDefUseGraph::MemoryTracking::StackSlots;
+
+    BuildDefUseGraph(&defUse, &graph, LinearMode ? &linearSession : nullptr, &decoder, pData, fileSize, addressDisplayOffset);
 
-    linearContext.hashState = hashStateBefore;
+    size_t bufferCapacity = 64 * 1024;
+    size_t length = 0;
+    char *buffer = nullptr;
+
+    do
+    {
+      bufferCapacity *= 2;
+      buffer = reinterpret_cast<char *>(realloc(buffer, bufferCapacity));
+      FATAL_IF(buffer == nullptr, "Memory allocation failure. Aborting.");
+    } while (!(DefUseJson ? zydec_DefUseGraph_WriteJson : zydec_DefUseGraph_WriteDot)(&defUse, addressDisplayOffset, buffer, bufferCapacity, &length));
+
+    WriteOutput(buffer, length);
+    FlushOutput();
+
+    free(buffer);
+    return 0;
+  }
+
+  ZydecListing listing;
+  char viewportArena[LazyViewportLines * 64 + ZydecBatchInstructionCapacity];
+  uint32_t viewportOffsets[LazyViewportLines];
+  uint32_t viewportLengths[LazyViewportLines];
+  uint64_t viewportHasTranslation[(LazyViewportLines + 63) / 64];
+  size_t viewportBegin = 0;
+  size_t viewportEnd = 0;
+  size_t lineIndex = 0;
+
+  // Only the names are determined up front, the text is rendered one viewport at a time.
+  if (LazyMode)
+    AnalyzeListing(&listing, &linearSession, &decoder, pData, fileSize, addressDisplayOffset);
+
+  // Continues from the nearest checkpoint, rather than replaying everything before the requested offset.
+  if (SeekMode)
+  {
+    ZydecCheckpointIndex checkpointIndex;
+    checkpointIndex.interval = SeekCheckpointInterval;
+    checkpointIndex.atBlockStarts = true;
+
+    BuildCheckpointIndex(&checkpointIndex, &linearSession, &decoder, pData, fileSize, addressDisplayOffset);
+    FATAL_IF(!zydec_CheckpointIndex_Seek(&checkpointIndex, &linearSession, &decoder, pData, fileSize, addressDisplayOffset, SeekOffset < fileSize ? SeekOffset : fileSize, &virtualAddress), "Failed to seek to 0x%" PRIX64 ". Aborting.", (uint64_t)SeekOffset);
+
+    free(checkpointIndex.pCheckpoints);
   }
 
-  printf("// %s\n\n", filename);
+  WriteHeader(filename, codeName);
+
+  if (pLoop != nullptr)
+    WriteLoopHeader(&loops, pLoop, &graph, pCriticalPath, pLoopThroughput, addressDisplayOffset);
+
+  if (PipelineMode)
+  {
+    RunPipeline(pData, fileSize, virtualAddress, &decoder, &formatter, addressDisplayOffset, &linearSession, &info);
+    return 0;
+  }
   
   while (virtualAddress < fileSize)
   {
+    // Blocks within the range of the loop that aren't part of it are skipped.
+    if (pRenderedBlocks != nullptr && virtualAddress == blockEnd)
+    {
+      if (nextBlock == pLoop->blockCount)
+        break;
+
+      const uint32_t blockIndex = pRenderedBlocks[nextBlock++];
+      virtualAddress = graph.pBlocks[blockIndex].offset;
+      blockEnd = virtualAddress + graph.pBlocks[blockIndex].size;
+
+      if (LinearMode)
+        zydec_ControlFlowGraph_BeginBlock(&graph, blockIndex, &linearSession);
+
+      if (HasMicroarchitecture && pLoop->blockCount > 1)
+        WriteBlockThroughput(&graph, blockIndex, &decoder, pData, fileSize, addressDisplayOffset);
+    }
+    else if (CfgMode && nextBlock < graph.blockCount && graph.pBlocks[nextBlock].offset == virtualAddress)
+    {
+      if (HasMicroarchitecture)
+        WriteBlockThroughput(&graph, (uint32_t)nextBlock, &decoder, pData, fileSize, addressDisplayOffset);
+
+      zydec_ControlFlowGraph_BeginBlock(&graph, nextBlock++, &linearSession);
+    }
+
     FATAL_IF(!(ZYAN_SUCCESS(ZydisDecoderDecodeFull(&decoder, pData + virtualAddress, fileSize - virtualAddress, &instruction, operands))), "Invalid Instruction at 0x%" PRIX64 ".", virtualAddress);
     FATAL_IF(!ZYAN_SUCCESS(ZydisFormatterFormatInstruction(&formatter, &instruction, operands, sizeof(operands) / sizeof(operands[0]), disasmBuffer, sizeof(disasmBuffer), virtualAddress + addressDisplayOffset, nullptr)), "Failed to Format Instruction at 0x%" PRIX64 ".", virtualAddress);
 
     bool hasTranslation = false;
 
-    if (LinearMode)
+    if (LazyMode)
+    {
+      if (lineIndex == viewportEnd)
+      {
+        size_t renderedCount = 0;
+        zydec_Listing_Render(&listing, lineIndex, lineIndex + LazyViewportLines < listing.instructionCount ? lineIndex + LazyViewportLines : listing.instructionCount, &decoder, pData, addressDisplayOffset, viewportArena, sizeof(viewportArena), viewportOffsets, viewportLengths, viewportHasTranslation, &renderedCount, &info);
+        FATAL_IF(renderedCount == 0, "Failed to render instructions at 0x%" PRIX64 ".", virtualAddress);
+
+        viewportBegin = lineIndex;
+        viewportEnd = lineIndex + renderedCount;
+      }
+
+      const size_t viewportLine = lineIndex - viewportBegin;
+      memcpy(decompBuffer, viewportArena + viewportOffsets[viewportLine], viewportLengths[viewportLine] + 1);
+    }
+    else if (TokenMode)
+    {
+      ZydecFormattingInfo *pInfo = LinearMode ? &linearSession.info : &info;
+      bool success;
+
+      if (LinearMode)
+        success = zydec_LinearSession_TranslateInstructionToTokens(&linearSession, &instruction, operands, sizeof(operands) / sizeof(operands[0]), virtualAddress + addressDisplayOffset, tokens, ZydecTokenInstructionCapacity, &tokenCount, &hasTranslation);
+      else
+        success = zydec_TranslateInstructionToTokens(&instruction, operands, sizeof(operands) / sizeof(operands[0]), virtualAddress + addressDisplayOffset, tokens, ZydecTokenInstructionCapacity, &tokenCount, &hasTranslation, &info);
+
+      if (!success || !hasTranslation || !zydec_RenderTokens(tokens, tokenCount, decompBuffer, sizeof(decompBuffer), pInfo))
+        decompBuffer[0] = '\0';
+    }
+    else if (LinearMode)
     {
-      if (!zydec_TranslateInstructionWithLinearContext(&linearContext, &instruction, operands, sizeof(operands) / sizeof(operands[0]), virtualAddress + addressDisplayOffset, decompBuffer, sizeof(decompBuffer), &hasTranslation, &info) || !hasTranslation)
+      if (!zydec_LinearSession_TranslateInstruction(&linearSession, &instruction, operands, sizeof(operands) / sizeof(operands[0]), virtualAddress + addressDisplayOffset, decompBuffer, sizeof(decompBuffer), &hasTranslation) || !hasTranslation)
         decompBuffer[0] = '\0';
     }
     else
@@ -210,20 +801,912 @@ int main(int argc, char **pArgv)
         decompBuffer[0] = '\0';
     }
 
-    if (ShowIsaSet)
+    if (pCriticalPath != nullptr)
     {
-      const char *isaSet = ZydisISASetGetString(instruction.meta.isa_set);
-
-      printf("% 8" PRIX64 " | %-64s | %-12s | %s\n", virtualAddress + addressDisplayOffset, disasmBuffer, isaSet ? isaSet : "", decompBuffer);
-    }
-    else
-    {
-      printf("% 8" PRIX64 " | %-64s | %s\n", virtualAddress + addressDisplayOffset, disasmBuffer, decompBuffer);
+      for (size_t i = 0; i < pCriticalPath->linkCount; i++)
+      {
+        if (loopDefUse.pInstructions[pCriticalPath->pLinks[i].instruction].offset == virtualAddress)
+        {
+          const size_t decompLength = strlen(decompBuffer);
+          snprintf(decompBuffer + decompLength, sizeof(decompBuffer) - decompLength, "%s// [critical %" PRIu32 "c]", decompLength == 0 ? "" : " ", pCriticalPath->pLinks[i].latency);
+          break;
+        }
+      }
     }
 
+    const char *isaSet = ShowIsaSet ? ZydisISASetGetString(instruction.meta.isa_set) : nullptr;
+
+    EndOutputLine(FormatLine(BeginOutputLine(), virtualAddress + addressDisplayOffset, disasmBuffer, ShowIsaSet ? (isaSet ? isaSet : "") : nullptr, decompBuffer));
+
     FATAL_IF(instruction.length == 0, "Invalid instruction length. Aborting.");
     virtualAddress += instruction.length;
+    lineIndex++;
   }
 
+  FlushOutput();
+
   return 0;
 }
+
+////////////////////////////////////////////////////////////////////////////////
+
+static void RunBenchmark(const uint8_t *pData, const size_t fileSize, const ZydisDecoder *pDecoder, ZydecFormattingInfo *pInfo)
+{
+  constexpr size_t addressDisplayOffset = 0x140000000;
+
+  ZydisDecodedInstruction instruction;
+  ZydisDecodedOperand operands[10];
+  char decompBuffer[1024] = "";
+  ZydecToken tokens[ZydecTokenInstructionCapacity];
+
+  ZydecLinearSession *pLinearSession = new ZydecLinearSession();
+  ZydecListing listing;
+
+  BenchmarkBatch batch;
+  batch.pInstructions = reinterpret_cast<ZydisDecodedInstruction *>(malloc(sizeof(ZydisDecodedInstruction) * BenchmarkBatchSize));
+  batch.pOperands = reinterpret_cast<ZydisDecodedOperand *>(malloc(sizeof(ZydisDecodedOperand) * ZYDIS_MAX_OPERAND_COUNT * BenchmarkBatchSize));
+  batch.pVirtualAddresses = reinterpret_cast<size_t *>(malloc(sizeof(size_t) * BenchmarkBatchSize));
+  batch.arenaCapacity = BenchmarkBatchSize * 64 + ZydecBatchInstructionCapacity;
+  batch.pArena = reinterpret_cast<char *>(malloc(batch.arenaCapacity));
+  batch.pOffsets = reinterpret_cast<uint32_t *>(malloc(sizeof(uint32_t) * BenchmarkBatchSize));
+  batch.pLengths = reinterpret_cast<uint32_t *>(malloc(sizeof(uint32_t) * BenchmarkBatchSize));
+  batch.pHasTranslation = reinterpret_cast<uint64_t *>(malloc(sizeof(uint64_t) * (BenchmarkBatchSize + 63) / 64));
+  FATAL_IF(batch.pInstructions == nullptr || batch.pOperands == nullptr || batch.pVirtualAddresses == nullptr || batch.pArena == nullptr || batch.pOffsets == nullptr || batch.pLengths == nullptr || batch.pHasTranslation == nullptr, "Memory allocation failure. Aborting.");
+
+  size_t instructionCount = 0;
+  uint64_t checksum = 0;
+  double bestDecodeNs = 0;
+  double bestTotalNs = 0;
+
+  for (size_t repetition = 0; repetition < BenchmarkRepetitions; repetition++)
+  {
+    // Decoding alone, so that the translation cost can be isolated.
+    {
+      const auto before = std::chrono::steady_clock::now();
+
+      size_t virtualAddress = 0;
+
+      while (virtualAddress < fileSize)
+      {
+        if (ZYAN_SUCCESS(ZydisDecoderDecodeFull(pDecoder, pData + virtualAddress, fileSize - virtualAddress, &instruction, operands)) && instruction.length != 0)
+          virtualAddress += instruction.length;
+        else
+          virtualAddress++;
+      }
+
+      const double decodeNs = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - before).count();
+
+      if (repetition == 0 || decodeNs < bestDecodeNs)
+        bestDecodeNs = decodeNs;
+    }
+
+    // Decoding & Translation.
+    {
+      zydec_LinearSession_Init(pLinearSession, pInfo);
+
+      uint64_t hash = 0xCBF29CE484222325; // FNV-1a.
+      size_t count = 0;
+
+      const auto before = std::chrono::steady_clock::now();
+
+      size_t virtualAddress = 0;
+      size_t batchCount = 0;
+
+      // Only the analysis, which is what has to happen up front when opening a file.
+      if (LazyMode)
+      {
+        listing.instructionCount = 0;
+        listing.nameCount = 0;
+        listing.analyzedSize = 0;
+
+        AnalyzeListing(&listing, pLinearSession, pDecoder, pData, fileSize, addressDisplayOffset);
+
+        for (size_t i = 0; i < listing.nameCount; i++)
+          hash = (hash ^ listing.pNames[i]) * 0x100000001B3;
+
+        count = listing.instructionCount;
+        virtualAddress = fileSize;
+      }
+
+      while (BatchMode && virtualAddress < fileSize)
+      {
+        ZydisDecodedInstruction *pInstruction = &batch.pInstructions[batchCount];
+
+        if (!ZYAN_SUCCESS(ZydisDecoderDecodeFull(pDecoder, pData + virtualAddress, fileSize - virtualAddress, pInstruction, &batch.pOperands[batchCount * ZYDIS_MAX_OPERAND_COUNT])) || pInstruction->length == 0)
+        {
+          virtualAddress++;
+          continue;
+        }
+
+        batch.pVirtualAddresses[batchCount] = virtualAddress + addressDisplayOffset;
+        batchCount++;
+        count++;
+        virtualAddress += pInstruction->length;
+
+        if (batchCount == BenchmarkBatchSize || virtualAddress >= fileSize)
+        {
+          hash = HashBenchmarkBatch(hash, LinearMode ? &pLinearSession->context : nullptr, &batch, batchCount, pInfo);
+          batchCount = 0;
+        }
+      }
+
+      while (!BatchMode && virtualAddress < fileSize)
+      {
+        if (!ZYAN_SUCCESS(ZydisDecoderDecodeFull(pDecoder, pData + virtualAddress, fileSize - virtualAddress, &instruction, operands)) || instruction.length == 0)
+        {
+          virtualAddress++;
+          continue;
+        }
+
+        bool hasTranslation = false;
+        bool success;
+
+        // Only emits tokens, without rendering any text.
+        if (TokenMode)
+        {
+          size_t tokenCount = 0;
+
+          if (LinearMode)
+            success = zydec_LinearSession_TranslateInstructionToTokens(pLinearSession, &instruction, operands, sizeof(operands) / sizeof(operands[0]), virtualAddress + addressDisplayOffset, tokens, ZydecTokenInstructionCapacity, &tokenCount, &hasTranslation);
+          else
+            success = zydec_TranslateInstructionToTokens(&instruction, operands, sizeof(operands) / sizeof(operands[0]), virtualAddress + addressDisplayOffset, tokens, ZydecTokenInstructionCapacity, &tokenCount, &hasTranslation, pInfo);
+
+          if (success && hasTranslation)
+          {
+            for (size_t i = 0; i < tokenCount; i++)
+            {
+              const uint64_t value = tokens[i].type <= ztt_comment ? tokens[i].length : tokens[i].value; // text is only hashed by length, as the pointers differ between runs.
+              hash = (hash ^ (tokens[i].type | ((uint64_t)tokens[i].reg << 8) | ((uint64_t)tokens[i].id << 24))) * 0x100000001B3;
+              hash = (hash ^ value) * 0x100000001B3;
+            }
+          }
+
+          hash = (hash ^ '\n') * 0x100000001B3;
+
+          count++;
+          virtualAddress += instruction.length;
+          continue;
+        }
+
+        if (LinearMode)
+          success = zydec_LinearSession_TranslateInstruction(pLinearSession, &instruction, operands, sizeof(operands) / sizeof(operands[0]), virtualAddress + addressDisplayOffset, decompBuffer, sizeof(decompBuffer), &hasTranslation);
+        else
+          success = zydec_TranslateInstructionWithoutContext(&instruction, operands, sizeof(operands) / sizeof(operands[0]), virtualAddress + addressDisplayOffset, decompBuffer, sizeof(decompBuffer), &hasTranslation, pInfo);
+
+        if (success && hasTranslation)
+          for (const char *c = decompBuffer; *c != '\0'; c++)
+            hash = (hash ^ (uint8_t)*c) * 0x100000001B3;
+
+        hash = (hash ^ '\n') * 0x100000001B3;
+
+        count++;
+        virtualAddress += instruction.length;
+      }
+
+      const double totalNs = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - before).count();
+
+      if (repetition == 0 || totalNs < bestTotalNs)
+        bestTotalNs = totalNs;
+
+      instructionCount = count;
+      checksum = hash;
+    }
+  }
+
+  delete pLinearSession;
+  free(listing.pInstructions);
+  free(listing.pNames);
+  free(batch.pInstructions);
+  free(batch.pOperands);
+  free(batch.pVirtualAddresses);
+  free(batch.pArena);
+  free(batch.pOffsets);
+  free(batch.pLengths);
+  free(batch.pHasTranslation);
+
+  FATAL_IF(instructionCount == 0, "No instructions decoded. Aborting.");
+
+  printf("%" PRIu64 " instructions, best of %" PRIu64 " runs:\n", (uint64_t)instructionCount, (uint64_t)BenchmarkRepetitions);
+  printf("decode:    %8.2f ns/instruction\n", bestDecodeNs / instructionCount);
+  printf("translate: %8.2f ns/instruction\n", (bestTotalNs - bestDecodeNs) / instructionCount);
+  printf("checksum:  %016" PRIX64 "\n", checksum);
+}
+
+static uint64_t HashBenchmarkBatch(uint64_t hash, ZydecLinearContext *pContext, const BenchmarkBatch *pBatch, const size_t instructionCount, ZydecFormattingInfo *pInfo)
+{
+  size_t index = 0;
+
+  while (index < instructionCount)
+  {
+    size_t translatedCount = 0;
+
+    zydec_TranslateInstructionBatch(pContext, pBatch->pInstructions + index, pBatch->pOperands + index * ZYDIS_MAX_OPERAND_COUNT, ZYDIS_MAX_OPERAND_COUNT, pBatch->pVirtualAddresses + index, instructionCount - index, pBatch->pArena, pBatch->arenaCapacity, pBatch->pOffsets, pBatch->pLengths, pBatch->pHasTranslation, &translatedCount, pInfo);
+    FATAL_IF(translatedCount == 0, "Failed to translate batch. Aborting.");
+
+    for (size_t i = 0; i < translatedCount; i++)
+    {
+      if (pBatch->pHasTranslation[i / 64] & ((uint64_t)1 << (i & 63)))
+        for (const char *c = pBatch->pArena + pBatch->pOffsets[i]; c < pBatch->pArena + pBatch->pOffsets[i] + pBatch->pLengths[i]; c++)
+          hash = (hash ^ (uint8_t)*c) * 0x100000001B3;
+
+      hash = (hash ^ '\n') * 0x100000001B3;
+    }
+
+    index += translatedCount;
+  }
+
+  return hash;
+}
+
+static void AnalyzeListing(ZydecListing *pListing, ZydecLinearSession *pSession, const ZydisDecoder *pDecoder, const uint8_t *pData, const size_t fileSize, const size_t virtualAddress)
+{
+  size_t previousAnalyzedSize = (size_t)-1;
+
+  while (!zydec_Listing_Analyze(pListing, pSession, pDecoder, pData, fileSize, virtualAddress))
+  {
+    FATAL_IF(pListing->analyzedSize == previousAnalyzedSize, "Failed to analyze listing. Aborting.");
+    previousAnalyzedSize = pListing->analyzedSize;
+
+    pListing->instructionCapacity = pListing->instructionCapacity * 2 + 1024;
+    pListing->nameCapacity = pListing->nameCapacity * 2 + 1024 * ZydecListingInstructionNameCapacity;
+
+    pListing->pInstructions = reinterpret_cast<ZydecListingInstruction *>(realloc(pListing->pInstructions, sizeof(ZydecListingInstruction) * pListing->instructionCapacity));
+    pListing->pNames = reinterpret_cast<uint32_t *>(realloc(pListing->pNames, sizeof(uint32_t) * pListing->nameCapacity));
+    FATAL_IF(pListing->pInstructions == nullptr || pListing->pNames == nullptr, "Memory allocation failure. Aborting.");
+  }
+}
+
+static void LoadImage(ZydecImage *pImage, const uint8_t *pFile, const size_t fileSize)
+{
+  while (!zydec_Image_Load(pImage, pFile, fileSize))
+  {
+    FATAL_IF(pImage->sectionCount <= pImage->sectionCapacity && pImage->symbolCount <= pImage->symbolCapacity && pImage->functionCount <= pImage->functionCapacity, "Failed to load image. Aborting.");
+
+    pImage->sectionCapacity = pImage->sectionCount;
+    pImage->symbolCapacity = pImage->symbolCount;
+    pImage->functionCapacity = pImage->functionCount;
+
+    pImage->pSections = reinterpret_cast<ZydecImageSection *>(realloc(pImage->pSections, sizeof(ZydecImageSection) * pImage->sectionCapacity));
+    pImage->pSymbols = reinterpret_cast<ZydecImageSymbol *>(realloc(pImage->pSymbols, sizeof(ZydecImageSymbol) * pImage->symbolCapacity));
+    pImage->pFunctions = reinterpret_cast<ZydecImageFunction *>(realloc(pImage->pFunctions, sizeof(ZydecImageFunction) * pImage->functionCapacity));
+    FATAL_IF((pImage->sectionCapacity != 0 && pImage->pSections == nullptr) || (pImage->symbolCapacity != 0 && pImage->pSymbols == nullptr) || (pImage->functionCapacity != 0 && pImage->pFunctions == nullptr), "Memory allocation failure. Aborting.");
+  }
+}
+
+static void BuildSymbolIndex(ZydecSymbolIndex *pIndex, const ZydecImage *pImage)
+{
+  while (!zydec_SymbolIndex_Build(pIndex, pImage->pSymbols, pImage->symbolCount))
+  {
+    FATAL_IF(pIndex->entryCount <= pIndex->entryCapacity && pIndex->namesSize <= pIndex->namesCapacity, "Failed to index symbols. Aborting.");
+
+    pIndex->entryCapacity = pIndex->entryCount;
+    pIndex->namesCapacity = pIndex->namesSize;
+
+    pIndex->pEntries = reinterpret_cast<ZydecSymbolIndexEntry *>(realloc(pIndex->pEntries, sizeof(ZydecSymbolIndexEntry) * pIndex->entryCapacity));
+    pIndex->pSearchKeys = reinterpret_cast<size_t *>(realloc(pIndex->pSearchKeys, sizeof(size_t) * (pIndex->entryCapacity + 1)));
+    pIndex->pSearchRanks = reinterpret_cast<uint32_t *>(realloc(pIndex->pSearchRanks, sizeof(uint32_t) * (pIndex->entryCapacity + 1)));
+    pIndex->pNames = reinterpret_cast<char *>(realloc(pIndex->pNames, pIndex->namesCapacity));
+    FATAL_IF((pIndex->entryCapacity != 0 && pIndex->pEntries == nullptr) || pIndex->pSearchKeys == nullptr || pIndex->pSearchRanks == nullptr || (pIndex->namesCapacity != 0 && pIndex->pNames == nullptr), "Memory allocation failure. Aborting.");
+  }
+}
+
+static void WriteHeader(const char *filename, const char *codeName)
+{
+  WriteOutput("// ", 3);
+  WriteOutput(filename, strlen(filename));
+
+  if (codeName != nullptr)
+  {
+    WriteOutput(" (", 2);
+    WriteOutput(codeName, strlen(codeName));
+    WriteOutput(")", 1);
+  }
+
+  WriteOutput("\n\n", 2);
+}
+
+static void BuildCheckpointIndex(ZydecCheckpointIndex *pIndex, ZydecLinearSession *pSession, const ZydisDecoder *pDecoder, const uint8_t *pData, const size_t fileSize, const size_t virtualAddress)
+{
+  while (!zydec_CheckpointIndex_Build(pIndex, pSession, pDecoder, pData, fileSize, virtualAddress))
+  {
+    pIndex->checkpointCapacity = pIndex->checkpointCapacity * 2 + 64;
+
+    pIndex->pCheckpoints = reinterpret_cast<ZydecLinearCheckpoint *>(realloc(pIndex->pCheckpoints, sizeof(ZydecLinearCheckpoint) * pIndex->checkpointCapacity));
+    FATAL_IF(pIndex->pCheckpoints == nullptr, "Memory allocation failure. Aborting.");
+  }
+}
+
+static void BuildControlFlowGraph(ZydecControlFlowGraph *pGraph, const ZydisDecoder *pDecoder, const uint8_t *pData, const size_t fileSize)
+{
+  while (!zydec_ControlFlowGraph_Build(pGraph, pDecoder, pData, fileSize))
+  {
+    FATAL_IF(pGraph->blockCount <= pGraph->blockCapacity && pGraph->predecessorCount <= pGraph->predecessorCapacity, "Failed to build control flow graph. Aborting.");
+
+    pGraph->blockCapacity = pGraph->blockCount;
+    pGraph->predecessorCapacity = pGraph->predecessorCount;
+
+    pGraph->pBlocks = reinterpret_cast<ZydecBasicBlock *>(realloc(pGraph->pBlocks, sizeof(ZydecBasicBlock) * pGraph->blockCapacity));
+    pGraph->pOrder = reinterpret_cast<uint32_t *>(realloc(pGraph->pOrder, sizeof(uint32_t) * pGraph->blockCapacity));
+    pGraph->pPredecessors = reinterpret_cast<uint32_t *>(realloc(pGraph->pPredecessors, sizeof(uint32_t) * (pGraph->predecessorCapacity + 1)));
+    FATAL_IF(pGraph->pBlocks == nullptr || pGraph->pOrder == nullptr || pGraph->pPredecessors == nullptr, "Memory allocation failure. Aborting.");
+  }
+}
+
+static void BuildDefUseGraph(ZydecDefUseGraph *pGraph, const ZydecControlFlowGraph *pControlFlow, ZydecLinearSession *pSession, const ZydisDecoder *pDecoder, const uint8_t *pData, const size_t fileSize, const size_t virtualAddress)
+{
+  while (!zydec_DefUseGraph_Build(pGraph, pControlFlow, pSession, pDecoder, pData, fileSize, virtualAddress))
+  {
+    FATAL_IF(pGraph->instructionCount <= pGraph->instructionCapacity && pGraph->valueCount <= pGraph->valueCapacity && pGraph->referenceCount <= pGraph->referenceCapacity && pGraph->useCount <= pGraph->useCapacity && pGraph->stackSlotCount <= pGraph->stackSlotCapacity && pGraph->pInstructions != nullptr, "Failed to build def-use graph. Aborting.");
+
+    pGraph->instructionCapacity = pGraph->instructionCount;
+    pGraph->valueCapacity = pGraph->valueCount;
+    pGraph->referenceCapacity = pGraph->referenceCount;
+    pGraph->useCapacity = pGraph->useCount;
+    pGraph->stackSlotCapacity = pGraph->stackSlotCount;
+
+    pGraph->pInstructions = reinterpret_cast<ZydecDefUseInstruction *>(realloc(pGraph->pInstructions, sizeof(ZydecDefUseInstruction) * (pGraph->instructionCapacity + 1)));
+    pGraph->pValues = reinterpret_cast<ZydecValue *>(realloc(pGraph->pValues, sizeof(ZydecValue) * (pGraph->valueCapacity + 1)));
+    pGraph->pReferences = reinterpret_cast<uint32_t *>(realloc(pGraph->pReferences, sizeof(uint32_t) * (pGraph->referenceCapacity + 1)));
+    pGraph->pUses = reinterpret_cast<uint32_t *>(realloc(pGraph->pUses, sizeof(uint32_t) * (pGraph->useCapacity + 1)));
+    pGraph->pStackSlots = reinterpret_cast<ZydecStackSlot *>(realloc(pGraph->pStackSlots, sizeof(ZydecStackSlot) * (pGraph->stackSlotCapacity + 1)));
+    FATAL_IF(pGraph->pInstructions == nullptr || pGraph->pValues == nullptr || pGraph->pReferences == nullptr || pGraph->pUses == nullptr || pGraph->pStackSlots == nullptr, "Memory allocation failure. Aborting.");
+  }
+}
+
+static void DetectLoops(ZydecLoopForest *pForest, const ZydecControlFlowGraph *pGraph)
+{
+  pForest->pInnermostLoops = reinterpret_cast<uint32_t *>(malloc(sizeof(uint32_t) * pGraph->blockCount));
+  FATAL_IF(pForest->pInnermostLoops == nullptr, "Memory allocation failure. Aborting.");
+
+  while (!zydec_LoopForest_Build(pForest, pGraph))
+  {
+    FATAL_IF(pForest->loopCount <= pForest->loopCapacity && pForest->loopBlockCount <= pForest->loopBlockCapacity && pForest->exitCount <= pForest->exitCapacity && pForest->pLoops != nullptr, "Failed to detect loops. Aborting.");
+
+    pForest->loopCapacity = pForest->loopCount;
+    pForest->loopBlockCapacity = pForest->loopBlockCount;
+    pForest->exitCapacity = pForest->exitCount;
+
+    pForest->pLoops = reinterpret_cast<ZydecLoop *>(realloc(pForest->pLoops, sizeof(ZydecLoop) * (pForest->loopCapacity + 1)));
+    pForest->pLoopBlocks = reinterpret_cast<uint32_t *>(realloc(pForest->pLoopBlocks, sizeof(uint32_t) * (pForest->loopBlockCapacity + 1)));
+    pForest->pExits = reinterpret_cast<uint32_t *>(realloc(pForest->pExits, sizeof(uint32_t) * (pForest->exitCapacity + 1)));
+    FATAL_IF(pForest->pLoops == nullptr || pForest->pLoopBlocks == nullptr || pForest->pExits == nullptr, "Memory allocation failure. Aborting.");
+  }
+}
+
+static void FindCriticalPath(ZydecCriticalPath *pPath, const ZydecDefUseGraph *pDefUse, const ZydecControlFlowGraph *pControlFlow, const ZydecLoopForest *pForest, const size_t loopIndex, const ZydisDecoder *pDecoder, const uint8_t *pData, const size_t fileSize)
+{
+  while (!zydec_CriticalPath_Find(pPath, pDefUse, pControlFlow, pForest, loopIndex, Microarchitecture, pDecoder, pData, fileSize))
+  {
+    FATAL_IF(pPath->linkCount <= pPath->linkCapacity && pPath->pLinks != nullptr, "Failed to find critical path. Aborting.");
+
+    pPath->linkCapacity = pPath->linkCount;
+    pPath->pLinks = reinterpret_cast<ZydecCriticalPathLink *>(realloc(pPath->pLinks, sizeof(ZydecCriticalPathLink) * (pPath->linkCapacity + 1)));
+    FATAL_IF(pPath->pLinks == nullptr, "Memory allocation failure. Aborting.");
+  }
+}
+
+static void EstimateThroughput(ZydecThroughput *pThroughput, const ZydecControlFlowGraph *pGraph, const uint32_t *pBlocks, const size_t blockCount, const ZydisDecoder *pDecoder, const uint8_t *pData, const size_t fileSize)
+{
+  FATAL_IF(!zydec_Throughput_Estimate(pThroughput, pGraph, pBlocks, blockCount, Microarchitecture, pDecoder, pData, fileSize), "Failed to estimate throughput. Aborting.");
+}
+
+static int FormatThroughput(char *line, const size_t capacity, const ZydecThroughput *pThroughput, const char *unit)
+{
+  if (pThroughput->bottleneckPort == ZydecThroughputIssueBound)
+    return snprintf(line, capacity, "%.2f cycles%s, %" PRIu32 " uop%s, bound by issue width (%" PRIu64 " uops per cycle)", pThroughput->cycles, unit, pThroughput->uopCount, pThroughput->uopCount == 1 ? "" : "s", (uint64_t)zydec_Microarchitecture_GetIssueWidth(Microarchitecture));
+  else
+    return snprintf(line, capacity, "%.2f cycles%s, %" PRIu32 " uop%s, bound by %s", pThroughput->cycles, unit, pThroughput->uopCount, pThroughput->uopCount == 1 ? "" : "s", zydec_Microarchitecture_GetPortName(Microarchitecture, pThroughput->bottleneckPort));
+}
+
+static void WriteBlockThroughput(const ZydecControlFlowGraph *pGraph, const uint32_t blockIndex, const ZydisDecoder *pDecoder, const uint8_t *pData, const size_t fileSize, const size_t virtualAddress)
+{
+  ZydecThroughput throughput;
+  EstimateThroughput(&throughput, pGraph, &blockIndex, 1, pDecoder, pData, fileSize);
+
+  char *line = BeginOutputLine();
+  int length = snprintf(line, MaxLineLength, "// block at 0x%" PRIX64 ": ", (uint64_t)(virtualAddress + pGraph->pBlocks[blockIndex].offset));
+
+  if (length > 0 && (size_t)length < MaxLineLength - 2)
+    length += FormatThroughput(line + length, MaxLineLength - 2 - length, &throughput, "");
+
+  if (length > 0 && (size_t)length < MaxLineLength - 1)
+    length += snprintf(line + length, MaxLineLength - length, "\n");
+
+  EndOutputLine(length > 0 ? (size_t)length : 0);
+}
+
+static void WriteLoopHeader(const ZydecLoopForest *pForest, const ZydecLoop *pLoop, const ZydecControlFlowGraph *pGraph, const ZydecCriticalPath *pCriticalPath, const ZydecThroughput *pThroughput, const size_t virtualAddress)
+{
+  char *line = BeginOutputLine();
+  int length = snprintf(line, MaxLineLength, "// loop at 0x%" PRIX64 " (depth %" PRIu32 ", %" PRIu32 " blocks", (uint64_t)(virtualAddress + pGraph->pBlocks[pLoop->header].offset), pLoop->depth, pLoop->blockCount);
+
+  for (size_t i = 0; i < pLoop->exitCount && length > 0 && (size_t)length < MaxLineLength - 64; i++)
+    length += snprintf(line + length, MaxLineLength - length, "%s0x%" PRIX64, i == 0 ? ", exits to " : ", ", (uint64_t)(virtualAddress + pGraph->pBlocks[pForest->pExits[pLoop->firstExit + i]].offset));
+
+  if (length > 0 && (size_t)length < MaxLineLength - 4)
+    length += snprintf(line + length, MaxLineLength - length, ")\n");
+
+  if (pCriticalPath != nullptr && length > 0 && (size_t)length < MaxLineLength - 128)
+  {
+    if (pCriticalPath->join == ZydecValueNone)
+      length += snprintf(line + length, MaxLineLength - length, "// critical path on %s: no loop-carried dependencies\n", zydec_Microarchitecture_GetName(Microarchitecture));
+    else
+      length += snprintf(line + length, MaxLineLength - length, "// critical path on %s: %" PRIu32 " cycle%s per iteration through %" PRIu64 " instruction%s\n", zydec_Microarchitecture_GetName(Microarchitecture), pCriticalPath->cycles, pCriticalPath->cycles == 1 ? "" : "s", (uint64_t)pCriticalPath->linkCount, pCriticalPath->linkCount == 1 ? "" : "s");
+  }
+
+  if (pThroughput != nullptr && length > 0 && (size_t)length < MaxLineLength - 160)
+  {
+    length += snprintf(line + length, MaxLineLength - length, "// throughput on %s (tables v%" PRIu32 "): ", zydec_Microarchitecture_GetName(Microarchitecture), ZydecMicroarchitectureTableVersion);
+    length += FormatThroughput(line + length, MaxLineLength - 2 - length, pThroughput, " per iteration");
+    length += snprintf(line + length, MaxLineLength - length, "\n");
+  }
+
+  if (length > 0 && (size_t)length < MaxLineLength - 1)
+    length += snprintf(line + length, MaxLineLength - length, "\n");
+
+  EndOutputLine(length > 0 ? (size_t)length : 0);
+}
+
+static void TranslateParallel(const char *filename, const char *codeName, const ZydecImage *pImage, const uint8_t *pData, const size_t fileSize, const ZydisDecoder *pDecoder, const ZydisFormatter *pFormatter, const size_t virtualAddress, ZydecFormattingInfo *pInfo)
+{
+  const size_t rangeCapacity = fileSize / ParallelMinRangeSize + 1;
+  size_t rangeCount = 0;
+
+  ZydecCodeRange *pRanges = reinterpret_cast<ZydecCodeRange *>(malloc(sizeof(ZydecCodeRange) * rangeCapacity));
+  FATAL_IF(pRanges == nullptr, "Memory allocation failure. Aborting.");
+  if (pImage != nullptr && pImage->functionCount != 0 && !SplitSweep)
+    FATAL_IF(!zydec_Image_SplitCodeAtFunctions(pImage, virtualAddress, fileSize, ParallelMinRangeSize, pRanges, rangeCapacity, &rangeCount), "Failed to split code into functions. Aborting.");
+  else if (SplitSweep)
+    FATAL_IF(!zydec_SplitCodeParallel(pDecoder, pData, fileSize, ParallelMinRangeSize, ThreadCount, pRanges, rangeCapacity, &rangeCount), "Failed to split code. Aborting.");
+  else
+    FATAL_IF(!zydec_SplitCodeAtFunctionBoundaries(pDecoder, pData, fileSize, ParallelMinRangeSize, pRanges, rangeCapacity, &rangeCount), "Failed to split code into functions. Aborting.");
+
+  ParallelOutput output;
+  output.pFormatter = pFormatter;
+
+  ZydecParallelTranslation translation;
+  translation.pDecoder = pDecoder;
+  translation.pCode = pData;
+  translation.codeSize = fileSize;
+  translation.virtualAddress = virtualAddress;
+  translation.pRanges = pRanges;
+  translation.rangeCount = rangeCount;
+  translation.threadCount = ThreadCount;
+  translation.linearContext = LinearMode;
+  translation.pWriteLine = ParallelWriteLine;
+  translation.pEmitRange = ParallelEmitRange;
+  translation.pUserData = &output;
+
+  WriteHeader(filename, codeName);
+
+  FATAL_IF(!zydec_TranslateParallel(&translation, pInfo), "Failed to translate. Aborting.");
+  FlushOutput();
+
+  free(pRanges);
+}
+
+static bool ParallelWriteLine(char **pBufferPos, size_t *pRemainingSize, const ZydisDecodedInstruction *pInstruction, const ZydisDecodedOperand *pOperands, const size_t virtualAddress, const char *translation, const bool hasTranslation, void *pUserData)
+{
+  const ParallelOutput *pOutput = static_cast<const ParallelOutput *>(pUserData);
+
+  char disasmBuffer[1024] = "(invalid instruction)";
+
+  if (pInstruction != nullptr && !ZYAN_SUCCESS(ZydisFormatterFormatInstruction(pOutput->pFormatter, pInstruction, pOperands, ZYDIS_MAX_OPERAND_COUNT, disasmBuffer, sizeof(disasmBuffer), virtualAddress, nullptr)))
+    disasmBuffer[0] = '\0';
+
+  if (*pRemainingSize < MaxLineLength)
+    return false;
+
+  const char *isaSet = (ShowIsaSet && pInstruction != nullptr) ? ZydisISASetGetString(pInstruction->meta.isa_set) : nullptr;
+  const size_t length = FormatLine(*pBufferPos, virtualAddress, disasmBuffer, ShowIsaSet ? (isaSet ? isaSet : "") : nullptr, hasTranslation ? translation : "");
+
+  *pBufferPos += length;
+  *pRemainingSize -= length;
+
+  return true;
+}
+
+static bool ParallelEmitRange(const size_t /* rangeIndex */, const char *text, const size_t length, void * /* pUserData */)
+{
+  WriteOutput(text, length);
+
+  return true;
+}
+
+template <typename T>
+static void SpscRing_Init(SpscRing<T> *pRing, const size_t capacity)
+{
+  pRing->pItems = new T[capacity];
+  pRing->capacity = capacity;
+  pRing->readIndex = 0;
+  pRing->writeIndex = 0;
+}
+
+// Waits for an item that can be filled.
+template <typename T>
+static T * SpscRing_BeginPush(SpscRing<T> *pRing)
+{
+  const size_t writeIndex = pRing->writeIndex.load(std::memory_order_relaxed);
+
+  while (writeIndex - pRing->readIndex.load(std::memory_order_acquire) == pRing->capacity)
+    std::this_thread::yield();
+
+  return &pRing->pItems[writeIndex % pRing->capacity];
+}
+
+template <typename T>
+static void SpscRing_EndPush(SpscRing<T> *pRing)
+{
+  pRing->writeIndex.store(pRing->writeIndex.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+// Waits for an item that has been filled.
+template <typename T>
+static T * SpscRing_BeginPop(SpscRing<T> *pRing)
+{
+  const size_t readIndex = pRing->readIndex.load(std::memory_order_relaxed);
+
+  while (readIndex == pRing->writeIndex.load(std::memory_order_acquire))
+    std::this_thread::yield();
+
+  return &pRing->pItems[readIndex % pRing->capacity];
+}
+
+template <typename T>
+static void SpscRing_EndPop(SpscRing<T> *pRing)
+{
+  pRing->readIndex.store(pRing->readIndex.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+static void RunPipeline(const uint8_t *pData, const size_t fileSize, const size_t startOffset, const ZydisDecoder *pDecoder, const ZydisFormatter *pFormatter, const size_t virtualAddress, ZydecLinearSession *pSession, ZydecFormattingInfo *pInfo)
+{
+  SpscRing<PipelineBatch> batches;
+  SpscRing<PipelineBlock> blocks;
+  SpscRing_Init(&batches, PipelineBatchCount);
+  SpscRing_Init(&blocks, PipelineBlockCount);
+
+  FlushOutput();
+
+  std::thread decodeThread(PipelineDecode, &batches, pData, fileSize, startOffset, pDecoder);
+  std::thread writeThread(PipelineWrite, &blocks);
+
+  char disasmBuffer[1024] = "";
+  char decompBuffer[1024] = "";
+  PipelineBlock *pBlock = SpscRing_BeginPush(&blocks);
+  pBlock->length = 0;
+  pBlock->isLast = false;
+
+  bool isLast = false;
+  bool hasFailed = false;
+  bool hasFailedToFormat = false;
+  size_t failedOffset = 0;
+
+  while (!isLast)
+  {
+    PipelineBatch *pBatch = SpscRing_BeginPop(&batches);
+
+    for (size_t i = 0; i < pBatch->count && !hasFailed; i++)
+    {
+      const ZydisDecodedInstruction *pInstruction = &pBatch->instructions[i];
+      const ZydisDecodedOperand *pOperands = pBatch->operands[i];
+      const size_t offset = pBatch->offsets[i];
+
+      if (!ZYAN_SUCCESS(ZydisFormatterFormatInstruction(pFormatter, pInstruction, pOperands, ZYDIS_MAX_OPERAND_COUNT, disasmBuffer, sizeof(disasmBuffer), offset + virtualAddress, nullptr)))
+      {
+        hasFailed = true;
+        hasFailedToFormat = true;
+        failedOffset = offset;
+        break;
+      }
+
+      bool hasTranslation = false;
+
+      if (LinearMode)
+      {
+        if (!zydec_LinearSession_TranslateInstruction(pSession, pInstruction, pOperands, ZYDIS_MAX_OPERAND_COUNT, offset + virtualAddress, decompBuffer, sizeof(decompBuffer), &hasTranslation) || !hasTranslation)
+          decompBuffer[0] = '\0';
+      }
+      else
+      {
+        if (!zydec_TranslateInstructionWithoutContext(pInstruction, pOperands, ZYDIS_MAX_OPERAND_COUNT, offset + virtualAddress, decompBuffer, sizeof(decompBuffer), &hasTranslation, pInfo) || !hasTranslation)
+          decompBuffer[0] = '\0';
+      }
+
+      if (PipelineBlockSize - pBlock->length < MaxLineLength)
+      {
+        SpscRing_EndPush(&blocks);
+
+        pBlock = SpscRing_BeginPush(&blocks);
+        pBlock->length = 0;
+        pBlock->isLast = false;
+      }
+
+      const char *isaSet = ShowIsaSet ? ZydisISASetGetString(pInstruction->meta.isa_set) : nullptr;
+
+      pBlock->length += FormatLine(pBlock->text + pBlock->length, offset + virtualAddress, disasmBuffer, ShowIsaSet ? (isaSet ? isaSet : "") : nullptr, decompBuffer);
+    }
+
+    if (!hasFailed && pBatch->hasFailed)
+    {
+      hasFailed = true;
+      failedOffset = pBatch->offsets[pBatch->count];
+    }
+
+    isLast = pBatch->isLast;
+    SpscRing_EndPop(&batches);
+
+    // The decoder only stops at the end of the file or at an invalid instruction, so the remaining batches are skipped.
+    if (hasFailed)
+      while (!isLast)
+      {
+        pBatch = SpscRing_BeginPop(&batches);
+        isLast = pBatch->isLast;
+        SpscRing_EndPop(&batches);
+      }
+  }
+
+  pBlock->isLast = true;
+  SpscRing_EndPush(&blocks);
+
+  decodeThread.join();
+  writeThread.join();
+
+  delete[] batches.pItems;
+  delete[] blocks.pItems;
+
+  FATAL_IF(hasFailedToFormat, "Failed to Format Instruction at 0x%" PRIX64 ".", (uint64_t)failedOffset);
+  FATAL_IF(hasFailed, "Invalid Instruction at 0x%" PRIX64 ".", (uint64_t)failedOffset);
+}
+
+static void PipelineDecode(SpscRing<PipelineBatch> *pBatches, const uint8_t *pData, const size_t fileSize, const size_t startOffset, const ZydisDecoder *pDecoder)
+{
+  size_t offset = startOffset;
+
+  while (true)
+  {
+    PipelineBatch *pBatch = SpscRing_BeginPush(pBatches);
+    pBatch->count = 0;
+    pBatch->hasFailed = false;
+
+    while (pBatch->count < PipelineBatchSize && offset < fileSize)
+    {
+      ZydisDecodedInstruction *pInstruction = &pBatch->instructions[pBatch->count];
+      pBatch->offsets[pBatch->count] = offset;
+
+      if (!ZYAN_SUCCESS(ZydisDecoderDecodeFull(pDecoder, pData + offset, fileSize - offset, pInstruction, pBatch->operands[pBatch->count])) || pInstruction->length == 0)
+      {
+        pBatch->hasFailed = true;
+        break;
+      }
+
+      offset += pInstruction->length;
+      pBatch->count++;
+    }
+
+    pBatch->isLast = pBatch->hasFailed || offset >= fileSize;
+
+    const bool isLast = pBatch->isLast;
+    SpscRing_EndPush(pBatches);
+
+    if (isLast)
+      break;
+  }
+}
+
+static void PipelineWrite(SpscRing<PipelineBlock> *pBlocks)
+{
+  bool isLast = false;
+
+  while (!isLast)
+  {
+    PipelineBlock *pBlock = SpscRing_BeginPop(pBlocks);
+
+    FlushOutput();
+    WriteOutput(pBlock->text, pBlock->length);
+    isLast = pBlock->isLast;
+
+    SpscRing_EndPop(pBlocks);
+  }
+
+  FlushOutput();
+}
+
+static bool OpenInput(const char *filename, InputFile *pFile)
+{
+  pFile->pData = nullptr;
+  pFile->size = 0;
+  pFile->isMapped = false;
+
+  const bool isStdIn = strcmp(filename, "-") == 0;
+
+#ifndef _WIN32
+  if (!isStdIn)
+  {
+    const int fd = open(filename, O_RDONLY);
+
+    if (fd < 0)
+      return false;
+
+    struct stat fileStat;
+
+    if (fstat(fd, &fileStat) == 0 && S_ISREG(fileStat.st_mode) && fileStat.st_size > 0)
+    {
+      void *pMapping = mmap(nullptr, (size_t)fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      close(fd);
+
+      if (pMapping == MAP_FAILED)
+        return false;
+
+      madvise(pMapping, (size_t)fileStat.st_size, MADV_SEQUENTIAL);
+
+      pFile->pData = static_cast<uint8_t *>(pMapping);
+      pFile->size = (size_t)fileStat.st_size;
+      pFile->isMapped = true;
+
+      return true;
+    }
+
+    close(fd);
+  }
+#endif
+
+  FILE *pStream = isStdIn ? stdin : fopen(filename, "rb");
+
+  if (pStream == nullptr)
+    return false;
+
+  size_t capacity = 0;
+
+  while (true)
+  {
+    if (capacity - pFile->size < InputReadSize)
+    {
+      capacity = capacity * 2 + InputReadSize;
+      uint8_t *pData = reinterpret_cast<uint8_t *>(realloc(pFile->pData, capacity));
+
+      if (pData == nullptr)
+        break;
+
+      pFile->pData = pData;
+    }
+
+    const size_t readSize = fread(pFile->pData + pFile->size, 1, capacity - pFile->size, pStream);
+    pFile->size += readSize;
+
+    if (readSize == 0)
+      break;
+  }
+
+  const bool success = !ferror(pStream) && pFile->pData != nullptr;
+
+  if (!isStdIn)
+    fclose(pStream);
+
+  return success;
+}
+
+static void WriteOutput(const char *text, const size_t length)
+{
+  if (OutputBufferSize - OutputLength < length)
+  {
+    FlushOutput();
+
+    // Large enough to not be worth copying.
+    if (length >= OutputBufferSize)
+    {
+      fflush(stdout);
+#ifndef _WIN32
+      size_t written = 0;
+
+      while (written < length)
+      {
+        const ssize_t result = write(STDOUT_FILENO, text + written, length - written);
+
+        if (result <= 0)
+          break;
+
+        written += (size_t)result;
+      }
+#else
+      fwrite(text, 1, length, stdout);
+#endif
+      return;
+    }
+  }
+
+  memcpy(OutputBuffer + OutputLength, text, length);
+  OutputLength += length;
+}
+
+static void FlushOutput()
+{
+  // Anything that has been written through `printf` has to come first.
+  fflush(stdout);
+
+#ifndef _WIN32
+  size_t written = 0;
+
+  while (written < OutputLength)
+  {
+    const ssize_t result = write(STDOUT_FILENO, OutputBuffer + written, OutputLength - written);
+
+    if (result <= 0)
+      break;
+
+    written += (size_t)result;
+  }
+#else
+  fwrite(OutputBuffer, 1, OutputLength, stdout);
+  fflush(stdout);
+#endif
+
+  OutputLength = 0;
+}
+
+static char * BeginOutputLine()
+{
+  if (OutputBufferSize - OutputLength < MaxLineLength)
+    FlushOutput();
+
+  return OutputBuffer + OutputLength;
+}
+
+static void EndOutputLine(const size_t length)
+{
+  OutputLength += length;
+}
+
+// Left aligned, padded with spaces to at least `width` characters.
+static char * AppendPadded(char *line, const char *text, const size_t width)
+{
+  const size_t length = strlen(text);
+  memcpy(line, text, length);
+  line += length;
+
+  if (length < width)
+  {
+    memset(line, ' ', width - length);
+    line += width - length;
+  }
+
+  return line;
+}
+
+static size_t FormatLine(char *line, const uint64_t address, const char *disasm, const char *isaSet, const char *decomp)
+{
+  char *lineStart = line;
+
+  // Right aligned hex, padded with spaces to at least 8 characters.
+  char hex[16];
+  size_t digits = 0;
+  uint64_t value = address;
+
+  do
+  {
+    hex[digits++] = "0123456789ABCDEF"[value & 0xF];
+    value >>= 4;
+  } while (value != 0);
+
+  for (size_t i = digits; i < 8; i++)
+    *line++ = ' ';
+
+  while (digits > 0)
+    *line++ = hex[--digits];
+
+  memcpy(line, " | ", 3);
+  line = AppendPadded(line + 3, disasm, 64);
+  memcpy(line, " | ", 3);
+  line += 3;
+
+  if (isaSet != nullptr)
+  {
+    line = AppendPadded(line, isaSet, 12);
+    memcpy(line, " | ", 3);
+    line += 3;
+  }
+
+  line = AppendPadded(line, decomp, 0);
+  *line++ = '\n';
+
+  return (size_t)(line - lineStart);
+}
@@ -18,3 +18,4 @@ solution "zydec"
 
   dofile "zydec/project.lua"
   dofile "example/project.lua"
+  dofile "tests/project.lua"
@@ -0,0 +1,194 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2023, Christoph Stiller. All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation 
+//    and/or other materials provided with the distribution.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tests.h"
+#include "fixtures.h"
+
+////////////////////////////////////////////////////////////////////////////////
+
+static bool ExpectBlock(const ZydecControlFlowGraph *pGraph, const size_t blockIndex, const uint32_t offset, const uint32_t size, const uint32_t fallThrough, const uint32_t target, const uint32_t predecessorCount)
+{
+  const ZydecBasicBlock *pBlock = &pGraph->pBlocks[blockIndex];
+
+  TEST_ASSERT_EQUAL(offset, pBlock->offset);
+  TEST_ASSERT_EQUAL(size, pBlock->size);
+  TEST_ASSERT_EQUAL(fallThrough, pBlock->successors[0]);
+  TEST_ASSERT_EQUAL(target, pBlock->successors[1]);
+  TEST_ASSERT_EQUAL(predecessorCount, pBlock->predecessorCount);
+
+  return true;
+}
+
+static bool TestBlocksAndEdges()
+{
+  ZydisDecoder decoder;
+  InitDecoder(&decoder);
+
+  ZydecControlFlowGraph graph;
+  TEST_ASSERT(BuildControlFlowGraph(&graph, &decoder, BranchesFixture, sizeof(BranchesFixture)));
+
+  const uint32_t none = ZydecBasicBlockNone;
+
+  TEST_ASSERT_EQUAL(7, graph.blockCount);
+  TEST_ASSERT_EQUAL(7, graph.predecessorCount);
+
+  TEST_ASSERT(ExpectBlock(&graph, 0, 0x00, 0x0A, 1, 2, 0)); // `je` falls through to the `if` branch.
+  TEST_ASSERT(ExpectBlock(&graph, 1, 0x0A, 0x09, none, 3, 1)); // `jmp` has no fall-through successor.
+  TEST_ASSERT(ExpectBlock(&graph, 2, 0x13, 0x07, 3, none, 1));
+  TEST_ASSERT(ExpectBlock(&graph, 3, 0x1A, 0x03, 4, none, 2));
+  TEST_ASSERT(ExpectBlock(&graph, 4, 0x1D, 0x0C, 5, 4, 2));
+  TEST_ASSERT(ExpectBlock(&graph, 5, 0x29, 0x06, none, none, 1)); // the call doesn't end the block, the return does.
+  TEST_ASSERT(ExpectBlock(&graph, 6, 0x2F, 0x08, none, none, 0)); // only reached through the call.
+
+  TEST_ASSERT(HasPredecessor(&graph, 3, 1));
+  TEST_ASSERT(HasPredecessor(&graph, 3, 2));
+  TEST_ASSERT(HasPredecessor(&graph, 4, 3));
+  TEST_ASSERT(HasPredecessor(&graph, 4, 4));
+  TEST_ASSERT(HasPredecessor(&graph, 5, 4));
+
+  FreeControlFlowGraph(&graph);
+
+  return true;
+}
+
+static bool TestReversePostorder()
+{
+  ZydisDecoder decoder;
+  InitDecoder(&decoder);
+
+  ZydecControlFlowGraph graph;
+  TEST_ASSERT(BuildControlFlowGraph(&graph, &decoder, BranchesFixture, sizeof(BranchesFixture)));
+
+  for (size_t i = 0; i < graph.blockCount; i++)
+    TEST_ASSERT_EQUAL(i, graph.pBlocks[graph.pOrder[i]].order);
+
+  // Every block comes after the blocks leading into it, except along back-edges.
+  TEST_ASSERT_EQUAL(0, graph.pOrder[0]);
+  TEST_ASSERT(graph.pBlocks[1].order < graph.pBlocks[3].order);
+  TEST_ASSERT(graph.pBlocks[2].order < graph.pBlocks[3].order);
+  TEST_ASSERT(graph.pBlocks[3].order < graph.pBlocks[4].order);
+  TEST_ASSERT(graph.pBlocks[4].order < graph.pBlocks[5].order);
+
+  // Unreachable blocks follow the ones reachable from the entry.
+  TEST_ASSERT_EQUAL(6, graph.pOrder[6]);
+
+  FreeControlFlowGraph(&graph);
+
+  return true;
+}
+
+static bool TestInsufficientStorage()
+{
+  ZydisDecoder decoder;
+  InitDecoder(&decoder);
+
+  ZydecControlFlowGraph graph;
+  TEST_ASSERT(!zydec_ControlFlowGraph_Build(&graph, &decoder, BranchesFixture, sizeof(BranchesFixture)));
+  TEST_ASSERT_EQUAL(7, graph.blockCount);
+  TEST_ASSERT_EQUAL(7, graph.predecessorCount);
+
+  // Truncating the code in the middle of the loop cuts off its back-edge, so the loop body is no block of its own anymore.
+  TEST_ASSERT(BuildControlFlowGraph(&graph, &decoder, BranchesFixture, 0x24));
+  TEST_ASSERT_EQUAL(4, graph.blockCount);
+  TEST_ASSERT_EQUAL(0x0A, graph.pBlocks[3].size);
+  TEST_ASSERT_EQUAL(ZydecBasicBlockNone, graph.pBlocks[3].successors[0]);
+
+  FreeControlFlowGraph(&graph);
+
+  return true;
+}
+
+static bool TestFindBlock()
+{
+  ZydisDecoder decoder;
+  InitDecoder(&decoder);
+
+  ZydecControlFlowGraph graph;
+  TEST_ASSERT(BuildControlFlowGraph(&graph, &decoder, BranchesFixture, sizeof(BranchesFixture)));
+
+  for (size_t i = 0; i < graph.blockCount; i++)
+    TEST_ASSERT_EQUAL(i, zydec_ControlFlowGraph_FindBlock(&graph, graph.pBlocks[i].offset));
+
+  TEST_ASSERT_EQUAL(ZydecBasicBlockNone, zydec_ControlFlowGraph_FindBlock(&graph, 0x1E));
+  TEST_ASSERT_EQUAL(ZydecBasicBlockNone, zydec_ControlFlowGraph_FindBlock(&graph, sizeof(BranchesFixture)));
+
+  FreeControlFlowGraph(&graph);
+
+  return true;
+}
+
+static bool TestPropagateNames()
+{
+  ZydisDecoder decoder;
+  InitDecoder(&decoder);
+
+  ZydecControlFlowGraph graph;
+  TEST_ASSERT(BuildControlFlowGraph(&graph, &decoder, BranchesFixture, sizeof(BranchesFixture)));
+
+  ZydecFormattingInfo info;
+  ZydecLinearSession session;
+  zydec_LinearSession_Init(&session, &info);
+
+  bool reachedFixedPoint = false;
+  TEST_ASSERT(zydec_ControlFlowGraph_PropagateNames(&graph, &session, &decoder, BranchesFixture, sizeof(BranchesFixture), 0, 16, nullptr, &reachedFixedPoint));
+  TEST_ASSERT(reachedFixedPoint);
+
+  const size_t rax = zydec_LinearContext_GetRegisterIndex(ZYDIS_REGISTER_RAX);
+  const size_t rdx = zydec_LinearContext_GetRegisterIndex(ZYDIS_REGISTER_RDX);
+
+  // Both branches of the diamond start with the names at the end of the entry.
+  TEST_ASSERT(memcmp(graph.pContexts[1].regInfo, graph.pContexts[2].regInfo, sizeof(graph.pContexts[1].regInfo)) == 0);
+
+  const uint32_t raxAfterIf = GetNameAfterBlock(&graph, 1, &session, &decoder, BranchesFixture, ZYDIS_REGISTER_RAX);
+  const uint32_t rdxAfterIf = GetNameAfterBlock(&graph, 1, &session, &decoder, BranchesFixture, ZYDIS_REGISTER_RDX);
+  const uint32_t rdxAfterElse = GetNameAfterBlock(&graph, 2, &session, &decoder, BranchesFixture, ZYDIS_REGISTER_RDX);
+
+  // `rax` is the same along both edges & keeps its name, `rdx` is set differently and gets a fresh one at the join.
+  TEST_ASSERT(rdxAfterIf != rdxAfterElse);
+  TEST_ASSERT_EQUAL(raxAfterIf, graph.pContexts[3].regInfo[rax]);
+  TEST_ASSERT(graph.pContexts[3].regInfo[rdx] != rdxAfterIf);
+  TEST_ASSERT(graph.pContexts[3].regInfo[rdx] != rdxAfterElse);
+
+  // The loop header joins the entry edge with the back-edge, which changes `rax`.
+  TEST_ASSERT(graph.pContexts[4].regInfo[rax] != GetNameAfterBlock(&graph, 3, &session, &decoder, BranchesFixture, ZYDIS_REGISTER_RAX));
+
+  FreeControlFlowGraph(&graph);
+
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void RunControlFlowTests(TestRun *pRun)
+{
+  RUN_TEST(pRun, TestBlocksAndEdges);
+  RUN_TEST(pRun, TestReversePostorder);
+  RUN_TEST(pRun, TestInsufficientStorage);
+  RUN_TEST(pRun, TestFindBlock);
+  RUN_TEST(pRun, TestPropagateNames);
+}
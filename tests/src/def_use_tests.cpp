@@ -0,0 +1,215 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2023, Christoph Stiller. All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation 
+//    and/or other materials provided with the distribution.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tests.h"
+#include "fixtures.h"
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Returns the index of the instruction at `offset`, or of the join at the start of the block at `offset` if `join` is set.
+static uint32_t FindInstruction(const ZydecDefUseGraph *pGraph, const uint32_t offset, const bool join)
+{
+  for (size_t i = 0; i < pGraph->instructionCount; i++)
+    if (pGraph->pInstructions[i].offset == offset && (pGraph->pInstructions[i].length == 0) == join)
+      return (uint32_t)i;
+
+  return ZydecValueNone;
+}
+
+// Returns the value of `location` that the instruction reads, or `ZydecValueNone`.
+static uint32_t FindRead(const ZydecDefUseGraph *pGraph, const uint32_t instruction, const uint32_t location)
+{
+  const ZydecDefUseInstruction *pInstruction = &pGraph->pInstructions[instruction];
+
+  for (size_t i = 0; i < pInstruction->readCount; i++)
+  {
+    const uint32_t value = pGraph->pReferences[pInstruction->firstRead + i];
+
+    if (pGraph->pValues[value].location == location)
+      return value;
+  }
+
+  return ZydecValueNone;
+}
+
+// Returns whether one of the inputs of the join is defined by the instruction at `offset`.
+static bool HasInputFrom(const ZydecDefUseGraph *pGraph, const uint32_t join, const uint32_t offset)
+{
+  const ZydecValue *pJoin = &pGraph->pValues[join];
+
+  for (size_t i = 0; i < pJoin->inputCount; i++)
+  {
+    const ZydecValue *pInput = &pGraph->pValues[pGraph->pReferences[pJoin->firstInput + i]];
+
+    if (pInput->kind == zvk_definition && pGraph->pInstructions[pInput->instruction].offset == offset && pGraph->pInstructions[pInput->instruction].length != 0)
+      return true;
+  }
+
+  return false;
+}
+
+// Returns whether the value is used by the instruction (or join) with the index.
+static bool IsUsedBy(const ZydecDefUseGraph *pGraph, const uint32_t value, const uint32_t instruction)
+{
+  const ZydecValue *pValue = &pGraph->pValues[value];
+
+  for (size_t i = 0; i < pValue->useCount; i++)
+    if (pGraph->pUses[pValue->firstUse + i] == instruction)
+      return true;
+
+  return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+static bool TestJoinAfterDiamond()
+{
+  ZydisDecoder decoder;
+  InitDecoder(&decoder);
+
+  ZydecControlFlowGraph graph;
+  TEST_ASSERT(BuildControlFlowGraph(&graph, &decoder, BranchesFixture, sizeof(BranchesFixture)));
+
+  ZydecDefUseGraph defUse;
+  TEST_ASSERT(BuildDefUseGraph(&defUse, &graph, &decoder, BranchesFixture, sizeof(BranchesFixture)));
+
+  const uint32_t rdx = (uint32_t)zydec_LinearContext_GetRegisterIndex(ZYDIS_REGISTER_RDX);
+
+  // `add rax, rdx` reads the join of both `mov rdx, ...` at the start of its block.
+  const uint32_t add = FindInstruction(&defUse, 0x1A, false);
+  TEST_ASSERT(add != ZydecValueNone);
+  TEST_ASSERT_EQUAL(3, defUse.pInstructions[add].block);
+  TEST_ASSERT_EQUAL(ZYDIS_MNEMONIC_ADD, defUse.pInstructions[add].mnemonic);
+
+  const uint32_t rdxJoin = FindRead(&defUse, add, rdx);
+  TEST_ASSERT(rdxJoin != ZydecValueNone);
+  TEST_ASSERT_EQUAL(zvk_join, defUse.pValues[rdxJoin].kind);
+  TEST_ASSERT_EQUAL(FindInstruction(&defUse, 0x1A, true), defUse.pValues[rdxJoin].instruction);
+  TEST_ASSERT_EQUAL(2, defUse.pValues[rdxJoin].inputCount);
+  TEST_ASSERT(HasInputFrom(&defUse, rdxJoin, 0x0A));
+  TEST_ASSERT(HasInputFrom(&defUse, rdxJoin, 0x13));
+
+  // The joins of a block come right before its first instruction.
+  TEST_ASSERT_EQUAL(add - 1, defUse.pValues[rdxJoin].instruction);
+
+  // `rdi` was never written.
+  const uint32_t mov = FindInstruction(&defUse, 0x00, false);
+  const uint32_t rdi = FindRead(&defUse, mov, (uint32_t)zydec_LinearContext_GetRegisterIndex(ZYDIS_REGISTER_RDI));
+  TEST_ASSERT(rdi != ZydecValueNone);
+  TEST_ASSERT_EQUAL(zvk_unknown, defUse.pValues[rdi].kind);
+  TEST_ASSERT_EQUAL(ZydecValueNone, defUse.pValues[rdi].instruction);
+
+  FreeDefUseGraph(&defUse);
+  FreeControlFlowGraph(&graph);
+
+  return true;
+}
+
+static bool TestLoopCarriedValue()
+{
+  ZydisDecoder decoder;
+  InitDecoder(&decoder);
+
+  ZydecControlFlowGraph graph;
+  TEST_ASSERT(BuildControlFlowGraph(&graph, &decoder, BranchesFixture, sizeof(BranchesFixture)));
+
+  ZydecDefUseGraph defUse;
+  TEST_ASSERT(BuildDefUseGraph(&defUse, &graph, &decoder, BranchesFixture, sizeof(BranchesFixture)));
+
+  const uint32_t rcx = (uint32_t)zydec_LinearContext_GetRegisterIndex(ZYDIS_REGISTER_RCX);
+
+  // The counter of the loop joins the `xor ecx, ecx` before the loop with the increment carried by the back-edge.
+  const uint32_t addCounter = FindInstruction(&defUse, 0x1D, false);
+  const uint32_t rcxJoin = FindRead(&defUse, addCounter, rcx);
+  TEST_ASSERT(rcxJoin != ZydecValueNone);
+  TEST_ASSERT_EQUAL(zvk_join, defUse.pValues[rcxJoin].kind);
+  TEST_ASSERT_EQUAL(2, defUse.pValues[rcxJoin].inputCount);
+  TEST_ASSERT(HasInputFrom(&defUse, rcxJoin, 0x03));
+  TEST_ASSERT(HasInputFrom(&defUse, rcxJoin, 0x20));
+
+  // The increment is used by the `cmp` & the join at the loop header.
+  const uint32_t cmp = FindInstruction(&defUse, 0x24, false);
+  const uint32_t increment = FindRead(&defUse, cmp, rcx);
+  TEST_ASSERT(increment != ZydecValueNone);
+  TEST_ASSERT_EQUAL(zvk_definition, defUse.pValues[increment].kind);
+  TEST_ASSERT_EQUAL(FindInstruction(&defUse, 0x20, false), defUse.pValues[increment].instruction);
+  TEST_ASSERT(IsUsedBy(&defUse, increment, cmp));
+  TEST_ASSERT(IsUsedBy(&defUse, increment, defUse.pValues[rcxJoin].instruction));
+
+  FreeDefUseGraph(&defUse);
+  FreeControlFlowGraph(&graph);
+
+  return true;
+}
+
+static bool TestStackSlots()
+{
+  ZydisDecoder decoder;
+  InitDecoder(&decoder);
+
+  ZydecControlFlowGraph graph;
+  TEST_ASSERT(BuildControlFlowGraph(&graph, &decoder, StackCounterFixture, sizeof(StackCounterFixture)));
+
+  // Memory isn't tracked by default.
+  ZydecDefUseGraph defUse;
+  TEST_ASSERT(BuildDefUseGraph(&defUse, &graph, &decoder, StackCounterFixture, sizeof(StackCounterFixture)));
+  TEST_ASSERT_EQUAL(0, defUse.stackSlotCount);
+
+  FreeDefUseGraph(&defUse);
+
+  defUse.memoryTracking = ZydecDefUseGraph::MemoryTracking::StackSlots;
+  TEST_ASSERT(BuildDefUseGraph(&defUse, &graph, &decoder, StackCounterFixture, sizeof(StackCounterFixture)));
+
+  TEST_ASSERT_EQUAL(1, defUse.stackSlotCount);
+  TEST_ASSERT_EQUAL(ZYDIS_REGISTER_RSP, defUse.pStackSlots[0].base);
+  TEST_ASSERT_EQUAL(4, defUse.pStackSlots[0].size);
+  TEST_ASSERT_EQUAL(-8, defUse.pStackSlots[0].displacement);
+
+  // The load in the loop reads the join of the store before the loop & the one carried by the back-edge.
+  const uint32_t load = FindInstruction(&defUse, 0x08, false);
+  const uint32_t slotJoin = FindRead(&defUse, load, ZydecLinearContextRegisterCount + 0);
+  TEST_ASSERT(slotJoin != ZydecValueNone);
+  TEST_ASSERT_EQUAL(zvk_join, defUse.pValues[slotJoin].kind);
+  TEST_ASSERT_EQUAL(2, defUse.pValues[slotJoin].inputCount);
+  TEST_ASSERT(HasInputFrom(&defUse, slotJoin, 0x00));
+  TEST_ASSERT(HasInputFrom(&defUse, slotJoin, 0x0F));
+
+  FreeDefUseGraph(&defUse);
+  FreeControlFlowGraph(&graph);
+
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void RunDefUseTests(TestRun *pRun)
+{
+  RUN_TEST(pRun, TestJoinAfterDiamond);
+  RUN_TEST(pRun, TestLoopCarriedValue);
+  RUN_TEST(pRun, TestStackSlots);
+}
@@ -0,0 +1,142 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2023, Christoph Stiller. All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation 
+//    and/or other materials provided with the distribution.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef fixtures_h__
+#define fixtures_h__
+
+#include <stdint.h>
+
+// Hand-assembled code that the tests analyze. The offsets in the comments are relative to the start of each fixture.
+
+////////////////////////////////////////////////////////////////////////////////
+
+// An if / else diamond leading into a counted loop, followed by a call to a second function.
+static const uint8_t BranchesFixture[] = {
+  0x48, 0x89, 0xF8, // 0x00: mov rax, rdi
+  0x31, 0xC9, // 0x03: xor ecx, ecx
+  0x48, 0x85, 0xF6, // 0x05: test rsi, rsi
+  0x74, 0x09, // 0x08: je 0x13
+  0x48, 0xC7, 0xC2, 0x05, 0x00, 0x00, 0x00, // 0x0A: mov rdx, 0x5
+  0xEB, 0x07, // 0x11: jmp 0x1A
+  0x48, 0xC7, 0xC2, 0x07, 0x00, 0x00, 0x00, // 0x13: mov rdx, 0x7
+  0x48, 0x01, 0xD0, // 0x1A: add rax, rdx
+  0x48, 0x01, 0xC8, // 0x1D: add rax, rcx
+  0x48, 0x83, 0xC1, 0x01, // 0x20: add rcx, 0x1
+  0x48, 0x39, 0xF1, // 0x24: cmp rcx, rsi
+  0x75, 0xF4, // 0x27: jne 0x1D
+  0xE8, 0x01, 0x00, 0x00, 0x00, // 0x29: call 0x2F
+  0xC3, // 0x2E: ret
+  0x48, 0xC7, 0xC0, 0x01, 0x00, 0x00, 0x00, // 0x2F: mov rax, 0x1
+  0xC3, // 0x36: ret
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Two nested counted loops. The inner one branches to a cold block placed after the end of the function, which jumps back into it.
+static const uint8_t NestedLoopsFixture[] = {
+  0x31, 0xC0, // 0x00: xor eax, eax
+  0x31, 0xC9, // 0x02: xor ecx, ecx
+  0x31, 0xD2, // 0x04: xor edx, edx
+  0x01, 0xD0, // 0x06: add eax, edx
+  0xF7, 0xC2, 0x03, 0x00, 0x00, 0x00, // 0x08: test edx, 0x3
+  0x75, 0x02, // 0x0E: jne 0x12
+  0xEB, 0x0F, // 0x10: jmp 0x21
+  0xFF, 0xC2, // 0x12: inc edx
+  0x83, 0xFA, 0x0A, // 0x14: cmp edx, 0xa
+  0x7C, 0xED, // 0x17: jl 0x6
+  0xFF, 0xC1, // 0x19: inc ecx
+  0x83, 0xF9, 0x14, // 0x1B: cmp ecx, 0x14
+  0x7C, 0xE4, // 0x1E: jl 0x4
+  0xC3, // 0x20: ret
+  0x0F, 0xAF, 0xC0, // 0x21: imul eax, eax
+  0xEB, 0xEC, // 0x24: jmp 0x12
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+// A loop counter kept in a stack slot, like unoptimized code does.
+static const uint8_t StackCounterFixture[] = {
+  0xC7, 0x44, 0x24, 0xF8, 0x00, 0x00, 0x00, 0x00, // 0x00: mov DWORD PTR [rsp-0x8], 0x0
+  0x8B, 0x4C, 0x24, 0xF8, // 0x08: mov ecx, DWORD PTR [rsp-0x8]
+  0x83, 0xC1, 0x01, // 0x0C: add ecx, 0x1
+  0x89, 0x4C, 0x24, 0xF8, // 0x0F: mov DWORD PTR [rsp-0x8], ecx
+  0x48, 0x8D, 0x54, 0x8A, 0x10, // 0x13: lea rdx, [rdx+rcx*4+0x10]
+  0x83, 0xF9, 0x64, // 0x18: cmp ecx, 0x64
+  0x7C, 0xEB, // 0x1B: jl 0x8
+  0xC3, // 0x1D: ret
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+// A masked AVX-512 dot product. The sum is carried around the loop through the FMA & a register to register move.
+static const uint8_t MaskedDotProductFixture[] = {
+  0x31, 0xC0, // 0x00: xor eax, eax
+  0xC5, 0xF8, 0x57, 0xC0, // 0x02: vxorps xmm0, xmm0, xmm0
+  0x62, 0xF1, 0x7C, 0x48, 0x10, 0x1C, 0x87, // 0x06: vmovups zmm3, ZMMWORD PTR [rdi+rax*4]
+  0x62, 0xF1, 0x64, 0x48, 0xC2, 0xC9, 0x01, // 0x0D: vcmpltps k1, zmm3, zmm1
+  0x62, 0xF1, 0x7C, 0x48, 0x28, 0xD3, // 0x14: vmovaps zmm2, zmm3
+  0x62, 0xF2, 0x7D, 0x49, 0x98, 0x14, 0x86, // 0x1A: vfmadd132ps zmm2{k1}, zmm0, ZMMWORD PTR [rsi+rax*4]
+  0x48, 0x83, 0xC0, 0x10, // 0x21: add rax, 0x10
+  0x62, 0xF1, 0x7C, 0x48, 0x28, 0xC2, // 0x25: vmovaps zmm0, zmm2
+  0x39, 0xC2, // 0x2B: cmp edx, eax
+  0x7F, 0xD7, // 0x2D: jg 0x6
+  0xC3, // 0x2F: ret
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Unrelated moves, to be timed one by one. The EVEX encoded ones come before the VEX encoded ones they should be timed like.
+static const uint8_t VectorMovesFixture[] = {
+  0x62, 0xF1, 0x7C, 0x48, 0x28, 0xC2, // 0x00: vmovaps zmm0, zmm2
+  0xC5, 0xFC, 0x28, 0xC2, // 0x06: vmovaps ymm0, ymm2
+  0x62, 0xF1, 0x7C, 0x49, 0x28, 0xC2, // 0x0A: vmovaps zmm0{k1}, zmm2
+  0x62, 0xF1, 0x7C, 0xC9, 0x28, 0xC2, // 0x10: vmovaps zmm0{k1}{z}, zmm2
+  0x62, 0xF1, 0x7C, 0x48, 0x10, 0x07, // 0x16: vmovups zmm0, ZMMWORD PTR [rdi]
+  0xC5, 0xFC, 0x10, 0x07, // 0x1C: vmovups ymm0, YMMWORD PTR [rdi]
+  0x62, 0xE1, 0x7D, 0x08, 0x6E, 0xC0, // 0x20: vmovd xmm16, eax
+  0xC5, 0xF9, 0x6E, 0xC0, // 0x26: vmovd xmm0, eax
+  0x62, 0xA1, 0xFE, 0x48, 0x6F, 0xCA, // 0x2A: vmovdqu64 zmm17, zmm18
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+// AVX-512 write masks, broadcasts & embedded rounding, followed by every fused multiply-add operand order.
+static const uint8_t EvexIntrinsicsFixture[] = {
+  0x62, 0xF1, 0x74, 0x49, 0x58, 0xC2, // 0x00: vaddps zmm0{k1}, zmm1, zmm2
+  0x62, 0xF1, 0x74, 0xD9, 0x58, 0x07, // 0x06: vaddps zmm0{k1}{z}, zmm1, DWORD BCST [rdi]
+  0x62, 0xF1, 0x74, 0x18, 0x58, 0xC2, // 0x0C: vaddps zmm0, zmm1, zmm2{rn-sae}
+  0x62, 0xF2, 0x75, 0x49, 0x98, 0xC2, // 0x12: vfmadd132ps zmm0{k1}, zmm1, zmm2
+  0x62, 0xF2, 0x75, 0xC9, 0xA8, 0xC2, // 0x18: vfmadd213ps zmm0{k1}{z}, zmm1, zmm2
+  0x62, 0xF2, 0x75, 0x59, 0xB8, 0x07, // 0x1E: vfmadd231ps zmm0{k1}, zmm1, DWORD BCST [rdi]
+  0x62, 0xF2, 0x75, 0x19, 0xB8, 0xC2, // 0x24: vfmadd231ps zmm0{k1}, zmm1, zmm2{rn-sae}
+  0xC4, 0xE2, 0x75, 0xB8, 0xC2, // 0x2A: vfmadd231ps ymm0, ymm1, ymm2
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // fixtures_h__
@@ -0,0 +1,296 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2023, Christoph Stiller. All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation 
+//    and/or other materials provided with the distribution.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tests.h"
+
+////////////////////////////////////////////////////////////////////////////////
+
+// A minimal PE32+ image with a `.text` section at 0x1000 & an `.rdata` section at 0x2000 that holds the export, import & exception directories.
+static constexpr size_t PeImageBase = 0x140000000;
+static constexpr size_t PeFileSize = 0x600;
+static constexpr uint32_t PeExportDirectory = 0x2000;
+static constexpr uint32_t PeImportDirectory = 0x2100;
+static constexpr uint32_t PeImportAddressTable = 0x2160;
+static constexpr uint32_t PeExceptionDirectory = 0x21C0;
+
+static void Write16(uint8_t *pFile, const size_t offset, const uint16_t value) { memcpy(pFile + offset, &value, sizeof(value)); }
+static void Write32(uint8_t *pFile, const size_t offset, const uint32_t value) { memcpy(pFile + offset, &value, sizeof(value)); }
+static void Write64(uint8_t *pFile, const size_t offset, const uint64_t value) { memcpy(pFile + offset, &value, sizeof(value)); }
+
+// Returns the offset in the file of an address in `.rdata`.
+static size_t RdataOffset(const uint32_t rva)
+{
+  return rva - 0x2000 + 0x400;
+}
+
+static void WriteSectionHeader(uint8_t *pFile, const size_t offset, const char *name, const uint32_t virtualAddress, const uint32_t rawDataOffset, const uint32_t characteristics)
+{
+  memcpy(pFile + offset, name, strlen(name));
+  Write32(pFile, offset + 8, 0x200); // virtual size
+  Write32(pFile, offset + 12, virtualAddress);
+  Write32(pFile, offset + 16, 0x200); // raw data size
+  Write32(pFile, offset + 20, rawDataOffset);
+  Write32(pFile, offset + 36, characteristics);
+}
+
+static void WriteDirectory(uint8_t *pFile, const size_t index, const uint32_t address, const uint32_t size)
+{
+  const size_t directories = 0x40 + 4 + 20 + 112;
+
+  Write32(pFile, directories + index * 8, address);
+  Write32(pFile, directories + index * 8 + 4, size);
+}
+
+static void BuildPe(uint8_t *pFile)
+{
+  memset(pFile, 0, PeFileSize);
+
+  pFile[0] = 'M';
+  pFile[1] = 'Z';
+  Write32(pFile, 0x3C, 0x40);
+
+  // COFF header.
+  memcpy(pFile + 0x40, "PE\0\0", 4);
+  Write16(pFile, 0x44, 0x8664);
+  Write16(pFile, 0x46, 2); // sections
+  Write16(pFile, 0x54, 112 + 16 * 8); // optional header size
+
+  // Optional header.
+  const size_t optionalHeader = 0x40 + 4 + 20;
+  Write16(pFile, optionalHeader, 0x20B);
+  Write32(pFile, optionalHeader + 16, 0x1000); // entry point
+  Write64(pFile, optionalHeader + 24, PeImageBase);
+  Write32(pFile, optionalHeader + 108, 16); // directories
+
+  const size_t sectionHeaders = optionalHeader + 112 + 16 * 8;
+  WriteSectionHeader(pFile, sectionHeaders, ".text", 0x1000, 0x200, 0x60000020);
+  WriteSectionHeader(pFile, sectionHeaders + 40, ".rdata", 0x2000, 0x400, 0x40000040);
+
+  // `ret` at the exported function.
+  pFile[0x200] = 0xC3;
+
+  // Export directory with a single function.
+  Write32(pFile, RdataOffset(PeExportDirectory) + 16, 1); // ordinal base
+  Write32(pFile, RdataOffset(PeExportDirectory) + 20, 1); // functions
+  Write32(pFile, RdataOffset(PeExportDirectory) + 24, 1); // names
+  Write32(pFile, RdataOffset(PeExportDirectory) + 28, 0x2040);
+  Write32(pFile, RdataOffset(PeExportDirectory) + 32, 0x2044);
+  Write32(pFile, RdataOffset(PeExportDirectory) + 36, 0x2048);
+  Write32(pFile, RdataOffset(0x2040), 0x1000);
+  Write32(pFile, RdataOffset(0x2044), 0x2050);
+  Write16(pFile, RdataOffset(0x2048), 0);
+  memcpy(pFile + RdataOffset(0x2050), "Exported", 9);
+  WriteDirectory(pFile, 0, PeExportDirectory, 0x60);
+
+  // Import descriptor with a single function by name, followed by the terminating one.
+  Write32(pFile, RdataOffset(PeImportDirectory), 0x2140); // lookup table
+  Write32(pFile, RdataOffset(PeImportDirectory) + 12, 0x2180); // module name
+  Write32(pFile, RdataOffset(PeImportDirectory) + 16, PeImportAddressTable);
+  Write64(pFile, RdataOffset(0x2140), 0x21A0);
+  Write64(pFile, RdataOffset(PeImportAddressTable), 0x21A0);
+  memcpy(pFile + RdataOffset(0x2180), "module.dll", 11);
+  memcpy(pFile + RdataOffset(0x21A0) + 2, "Imported", 9);
+  WriteDirectory(pFile, 1, PeImportDirectory, 0x28);
+
+  // A single runtime function covering the exported function.
+  Write32(pFile, RdataOffset(PeExceptionDirectory), 0x1000);
+  Write32(pFile, RdataOffset(PeExceptionDirectory) + 4, 0x1010);
+  WriteDirectory(pFile, 3, PeExceptionDirectory, 12);
+}
+
+struct PeStorage
+{
+  ZydecImageSection sections[8];
+  ZydecImageSymbol symbols[8];
+  ZydecImageFunction functions[8];
+};
+
+static bool LoadPe(ZydecImage *pImage, PeStorage *pStorage, const uint8_t *pFile, const size_t fileSize)
+{
+  *pImage = ZydecImage();
+  pImage->pSections = pStorage->sections;
+  pImage->sectionCapacity = sizeof(pStorage->sections) / sizeof(pStorage->sections[0]);
+  pImage->pSymbols = pStorage->symbols;
+  pImage->symbolCapacity = sizeof(pStorage->symbols) / sizeof(pStorage->symbols[0]);
+  pImage->pFunctions = pStorage->functions;
+  pImage->functionCapacity = sizeof(pStorage->functions) / sizeof(pStorage->functions[0]);
+
+  return zydec_Image_Load(pImage, pFile, fileSize);
+}
+
+static bool ExpectExport(const ZydecImage *pImage, const bool loaded)
+{
+  const ZydecImageSymbol *pSymbol = zydec_Image_FindSymbolByName(pImage, "Exported");
+  TEST_ASSERT(loaded == (pSymbol != nullptr));
+
+  if (pSymbol != nullptr)
+    TEST_ASSERT_EQUAL(PeImageBase + 0x1000, pSymbol->virtualAddress);
+
+  return true;
+}
+
+static bool ExpectImport(const ZydecImage *pImage, const bool loaded)
+{
+  const ZydecImageSymbol *pSymbol = zydec_Image_FindSymbolByName(pImage, "Imported");
+  TEST_ASSERT(loaded == (pSymbol != nullptr));
+
+  if (pSymbol != nullptr)
+    TEST_ASSERT_EQUAL(PeImageBase + PeImportAddressTable, pSymbol->virtualAddress);
+
+  return true;
+}
+
+static bool ExpectRuntimeFunction(const ZydecImage *pImage, const bool loaded)
+{
+  TEST_ASSERT_EQUAL(loaded ? 1 : 0, pImage->functionCount);
+
+  if (loaded)
+  {
+    TEST_ASSERT_EQUAL(PeImageBase + 0x1000, pImage->pFunctions[0].virtualAddress);
+    TEST_ASSERT_EQUAL(0x10, pImage->pFunctions[0].size);
+  }
+
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+static bool TestPeImage()
+{
+  uint8_t file[PeFileSize];
+  BuildPe(file);
+
+  ZydecImage image;
+  PeStorage storage;
+  TEST_ASSERT(LoadPe(&image, &storage, file, sizeof(file)));
+
+  TEST_ASSERT_EQUAL(2, image.sectionCount);
+  TEST_ASSERT(image.pSections[0].isExecutable);
+  TEST_ASSERT(!image.pSections[1].isExecutable);
+  TEST_ASSERT_EQUAL(PeImageBase + 0x1000, image.entryPoint);
+
+  TEST_ASSERT(ExpectExport(&image, true));
+  TEST_ASSERT(ExpectImport(&image, true));
+  TEST_ASSERT(ExpectRuntimeFunction(&image, true));
+
+  return true;
+}
+
+static bool TestTruncatedExports()
+{
+  uint8_t file[PeFileSize];
+  BuildPe(file);
+
+  // The name table lies outside of the image.
+  Write32(file, RdataOffset(PeExportDirectory) + 32, 0x3000);
+
+  ZydecImage image;
+  PeStorage storage;
+  TEST_ASSERT(LoadPe(&image, &storage, file, sizeof(file)));
+
+  TEST_ASSERT(ExpectExport(&image, false));
+  TEST_ASSERT(ExpectImport(&image, true));
+  TEST_ASSERT(ExpectRuntimeFunction(&image, true));
+
+  // The directory itself runs past the end of the section.
+  BuildPe(file);
+  WriteDirectory(file, 0, 0x21F0, 0x60);
+
+  TEST_ASSERT(LoadPe(&image, &storage, file, sizeof(file)));
+  TEST_ASSERT(ExpectExport(&image, false));
+  TEST_ASSERT(ExpectImport(&image, true));
+
+  return true;
+}
+
+static bool TestMalformedImports()
+{
+  uint8_t file[PeFileSize];
+  BuildPe(file);
+
+  // A second descriptor with a lookup table outside of the image, after the first one has already been read. Nothing of the directory is kept.
+  Write32(file, RdataOffset(PeImportDirectory) + 20, 0x5000);
+  Write32(file, RdataOffset(PeImportDirectory) + 36, PeImportAddressTable);
+
+  ZydecImage image;
+  PeStorage storage;
+  TEST_ASSERT(LoadPe(&image, &storage, file, sizeof(file)));
+
+  TEST_ASSERT(ExpectExport(&image, true));
+  TEST_ASSERT(ExpectImport(&image, false));
+  TEST_ASSERT(ExpectRuntimeFunction(&image, true));
+
+  return true;
+}
+
+static bool TestTruncatedRuntimeFunctions()
+{
+  uint8_t file[PeFileSize];
+  BuildPe(file);
+
+  // More runtime functions than `.rdata` has room for.
+  WriteDirectory(file, 3, PeExceptionDirectory, 12 * 16);
+
+  ZydecImage image;
+  PeStorage storage;
+  TEST_ASSERT(LoadPe(&image, &storage, file, sizeof(file)));
+
+  TEST_ASSERT(ExpectExport(&image, true));
+  TEST_ASSERT(ExpectImport(&image, true));
+  TEST_ASSERT(ExpectRuntimeFunction(&image, false));
+
+  return true;
+}
+
+static bool TestTruncatedSections()
+{
+  uint8_t file[PeFileSize];
+  BuildPe(file);
+
+  ZydecImage image;
+  PeStorage storage;
+
+  // Sections that aren't stored in the file still fail the image.
+  TEST_ASSERT(!LoadPe(&image, &storage, file, 0x500));
+
+  // As do truncated headers.
+  TEST_ASSERT(!LoadPe(&image, &storage, file, 0x100));
+
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void RunImageTests(TestRun *pRun)
+{
+  RUN_TEST(pRun, TestPeImage);
+  RUN_TEST(pRun, TestTruncatedExports);
+  RUN_TEST(pRun, TestMalformedImports);
+  RUN_TEST(pRun, TestTruncatedRuntimeFunctions);
+  RUN_TEST(pRun, TestTruncatedSections);
+}
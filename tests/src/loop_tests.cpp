@@ -0,0 +1,206 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2023, Christoph Stiller. All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation 
+//    and/or other materials provided with the distribution.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tests.h"
+#include "fixtures.h"
+
+////////////////////////////////////////////////////////////////////////////////
+
+static bool ExpectLoopBlocks(const ZydecLoopForest *pForest, const size_t loopIndex, const uint32_t *pBlocks, const size_t blockCount)
+{
+  const ZydecLoop *pLoop = &pForest->pLoops[loopIndex];
+
+  TEST_ASSERT_EQUAL(blockCount, pLoop->blockCount);
+
+  for (size_t i = 0; i < blockCount; i++)
+    TEST_ASSERT_EQUAL(pBlocks[i], pForest->pLoopBlocks[pLoop->firstBlock + i]);
+
+  return true;
+}
+
+static bool TestSingleLoop()
+{
+  ZydisDecoder decoder;
+  InitDecoder(&decoder);
+
+  ZydecControlFlowGraph graph;
+  TEST_ASSERT(BuildControlFlowGraph(&graph, &decoder, BranchesFixture, sizeof(BranchesFixture)));
+
+  ZydecLoopForest forest;
+  TEST_ASSERT(DetectLoops(&forest, &graph));
+
+  // The diamond joins without a back-edge, only the counted loop is one.
+  TEST_ASSERT_EQUAL(1, forest.loopCount);
+
+  const ZydecLoop *pLoop = &forest.pLoops[0];
+  TEST_ASSERT_EQUAL(4, pLoop->header);
+  TEST_ASSERT_EQUAL(ZydecBasicBlockNone, pLoop->parent);
+  TEST_ASSERT_EQUAL(1, pLoop->depth);
+  TEST_ASSERT_EQUAL(0x1D, pLoop->offset);
+  TEST_ASSERT_EQUAL(0x0C, pLoop->size);
+
+  const uint32_t blocks[] = { 4 };
+  TEST_ASSERT(ExpectLoopBlocks(&forest, 0, blocks, sizeof(blocks) / sizeof(blocks[0])));
+
+  TEST_ASSERT_EQUAL(1, pLoop->exitCount);
+  TEST_ASSERT_EQUAL(5, forest.pExits[pLoop->firstExit]);
+
+  for (size_t i = 0; i < graph.blockCount; i++)
+    TEST_ASSERT_EQUAL(i == 4 ? 0 : ZydecBasicBlockNone, forest.pInnermostLoops[i]);
+
+  TEST_ASSERT_EQUAL(0, zydec_LoopForest_FindHotLoop(&forest));
+
+  FreeLoopForest(&forest);
+  FreeControlFlowGraph(&graph);
+
+  return true;
+}
+
+static bool TestNestedLoops()
+{
+  ZydisDecoder decoder;
+  InitDecoder(&decoder);
+
+  ZydecControlFlowGraph graph;
+  TEST_ASSERT(BuildControlFlowGraph(&graph, &decoder, NestedLoopsFixture, sizeof(NestedLoopsFixture)));
+  TEST_ASSERT_EQUAL(8, graph.blockCount);
+
+  ZydecLoopForest forest;
+  TEST_ASSERT(DetectLoops(&forest, &graph));
+  TEST_ASSERT_EQUAL(2, forest.loopCount);
+
+  const ZydecLoop *pOuter = &forest.pLoops[0];
+  TEST_ASSERT_EQUAL(1, pOuter->header);
+  TEST_ASSERT_EQUAL(ZydecBasicBlockNone, pOuter->parent);
+  TEST_ASSERT_EQUAL(1, pOuter->depth);
+  TEST_ASSERT_EQUAL(0x04, pOuter->offset);
+  TEST_ASSERT_EQUAL(0x22, pOuter->size);
+
+  // The cold block lies past the `ret`, but jumps back into the inner loop and is part of both.
+  const uint32_t outerBlocks[] = { 1, 2, 3, 4, 5, 7 };
+  TEST_ASSERT(ExpectLoopBlocks(&forest, 0, outerBlocks, sizeof(outerBlocks) / sizeof(outerBlocks[0])));
+  TEST_ASSERT_EQUAL(1, pOuter->exitCount);
+  TEST_ASSERT_EQUAL(6, forest.pExits[pOuter->firstExit]);
+
+  const ZydecLoop *pInner = &forest.pLoops[1];
+  TEST_ASSERT_EQUAL(2, pInner->header);
+  TEST_ASSERT_EQUAL(0, pInner->parent);
+  TEST_ASSERT_EQUAL(2, pInner->depth);
+  TEST_ASSERT_EQUAL(0x06, pInner->offset);
+  TEST_ASSERT_EQUAL(0x20, pInner->size);
+
+  const uint32_t innerBlocks[] = { 2, 3, 4, 7 };
+  TEST_ASSERT(ExpectLoopBlocks(&forest, 1, innerBlocks, sizeof(innerBlocks) / sizeof(innerBlocks[0])));
+  TEST_ASSERT_EQUAL(1, pInner->exitCount);
+  TEST_ASSERT_EQUAL(5, forest.pExits[pInner->firstExit]);
+
+  const uint32_t none = ZydecBasicBlockNone;
+  const uint32_t innermostLoops[] = { none, 0, 1, 1, 1, 0, none, 1 };
+
+  for (size_t i = 0; i < graph.blockCount; i++)
+    TEST_ASSERT_EQUAL(innermostLoops[i], forest.pInnermostLoops[i]);
+
+  TEST_ASSERT(zydec_LoopForest_ContainsBlock(&forest, 0, 7));
+  TEST_ASSERT(!zydec_LoopForest_ContainsBlock(&forest, 1, 5));
+  TEST_ASSERT(!zydec_LoopForest_ContainsBlock(&forest, 0, 0));
+
+  TEST_ASSERT_EQUAL(1, zydec_LoopForest_FindHotLoop(&forest));
+
+  FreeLoopForest(&forest);
+  FreeControlFlowGraph(&graph);
+
+  return true;
+}
+
+static bool TestInsufficientLoopStorage()
+{
+  ZydisDecoder decoder;
+  InitDecoder(&decoder);
+
+  ZydecControlFlowGraph graph;
+  TEST_ASSERT(BuildControlFlowGraph(&graph, &decoder, NestedLoopsFixture, sizeof(NestedLoopsFixture)));
+
+  ZydecLoopForest forest;
+  forest.pInnermostLoops = reinterpret_cast<uint32_t *>(malloc(sizeof(uint32_t) * graph.blockCount));
+  TEST_ASSERT(forest.pInnermostLoops != nullptr);
+
+  TEST_ASSERT(!zydec_LoopForest_Build(&forest, &graph));
+  TEST_ASSERT_EQUAL(2, forest.loopCount);
+  TEST_ASSERT_EQUAL(10, forest.loopBlockCount);
+  TEST_ASSERT_EQUAL(2, forest.exitCount);
+
+  FreeLoopForest(&forest);
+  FreeControlFlowGraph(&graph);
+
+  return true;
+}
+
+static bool TestSteadyStateNames()
+{
+  ZydisDecoder decoder;
+  InitDecoder(&decoder);
+
+  ZydecControlFlowGraph graph;
+  TEST_ASSERT(BuildControlFlowGraph(&graph, &decoder, BranchesFixture, sizeof(BranchesFixture)));
+
+  ZydecLoopForest forest;
+  TEST_ASSERT(DetectLoops(&forest, &graph));
+
+  ZydecFormattingInfo info;
+  ZydecLinearSession session;
+  zydec_LinearSession_Init(&session, &info);
+
+  bool reachedFixedPoint = false;
+  TEST_ASSERT(zydec_LoopForest_PropagateLoopNames(&forest, 0, &graph, &session, &decoder, BranchesFixture, sizeof(BranchesFixture), 0, 16, nullptr, &reachedFixedPoint));
+  TEST_ASSERT(reachedFixedPoint);
+
+  // In the steady state the back-edge carries the names the header starts with back into it.
+  const size_t rax = zydec_LinearContext_GetRegisterIndex(ZYDIS_REGISTER_RAX);
+  const size_t rcx = zydec_LinearContext_GetRegisterIndex(ZYDIS_REGISTER_RCX);
+
+  const uint32_t raxAtHeader = graph.pContexts[4].regInfo[rax];
+  const uint32_t rcxAtHeader = graph.pContexts[4].regInfo[rcx];
+
+  TEST_ASSERT_EQUAL(raxAtHeader, GetNameAfterBlock(&graph, 4, &session, &decoder, BranchesFixture, ZYDIS_REGISTER_RAX));
+  TEST_ASSERT_EQUAL(rcxAtHeader, GetNameAfterBlock(&graph, 4, &session, &decoder, BranchesFixture, ZYDIS_REGISTER_RCX));
+
+  FreeLoopForest(&forest);
+  FreeControlFlowGraph(&graph);
+
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void RunLoopTests(TestRun *pRun)
+{
+  RUN_TEST(pRun, TestSingleLoop);
+  RUN_TEST(pRun, TestNestedLoops);
+  RUN_TEST(pRun, TestInsufficientLoopStorage);
+  RUN_TEST(pRun, TestSteadyStateNames);
+}
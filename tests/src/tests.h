@@ -0,0 +1,220 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2023, Christoph Stiller. All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation 
+//    and/or other materials provided with the distribution.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef tests_h__
+#define tests_h__
+
+#include "zydec.h"
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+struct TestRun
+{
+  size_t testCount = 0;
+  size_t failureCount = 0;
+};
+
+// Returns `false` on the first failed assertion.
+typedef bool TestFunc();
+
+inline void RunTest(TestRun *pRun, const char *name, TestFunc *pTest)
+{
+  pRun->testCount++;
+
+  if (pTest())
+  {
+    printf("[PASS] %s\n", name);
+  }
+  else
+  {
+    printf("[FAIL] %s\n", name);
+    pRun->failureCount++;
+  }
+}
+
+#define RUN_TEST(pRun, test) RunTest(pRun, #test, test)
+
+#define TEST_ASSERT(conditional) do { if (!(conditional)) { printf("  %s:%d: `%s` failed.\n", __FILE__, __LINE__, #conditional); return false; } } while (0)
+#define TEST_ASSERT_EQUAL(expected, actual) do { const uint64_t _expected = (uint64_t)(expected); const uint64_t _actual = (uint64_t)(actual); if (_expected != _actual) { printf("  %s:%d: `%s` is %" PRIu64 ", expected `%s` (%" PRIu64 ").\n", __FILE__, __LINE__, #actual, _actual, #expected, _expected); return false; } } while (0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+void RunTranslationTests(TestRun *pRun);
+void RunControlFlowTests(TestRun *pRun);
+void RunLoopTests(TestRun *pRun);
+void RunDefUseTests(TestRun *pRun);
+void RunTimingTests(TestRun *pRun);
+void RunThroughputTests(TestRun *pRun);
+void RunImageTests(TestRun *pRun);
+
+////////////////////////////////////////////////////////////////////////////////
+
+inline void InitDecoder(ZydisDecoder *pDecoder)
+{
+  ZydisDecoderInit(pDecoder, ZYDIS_MACHINE_MODE_LONG_64, ZYDIS_STACK_WIDTH_64);
+}
+
+// Builds the graph of the code, growing its storage as needed, including storage for the names at the start of every block.
+inline bool BuildControlFlowGraph(ZydecControlFlowGraph *pGraph, const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t codeSize)
+{
+  while (!zydec_ControlFlowGraph_Build(pGraph, pDecoder, pCode, codeSize))
+  {
+    if (pGraph->blockCount <= pGraph->blockCapacity && pGraph->predecessorCount <= pGraph->predecessorCapacity)
+      return false;
+
+    pGraph->blockCapacity = pGraph->blockCount;
+    pGraph->predecessorCapacity = pGraph->predecessorCount;
+
+    pGraph->pBlocks = reinterpret_cast<ZydecBasicBlock *>(realloc(pGraph->pBlocks, sizeof(ZydecBasicBlock) * pGraph->blockCapacity));
+    pGraph->pOrder = reinterpret_cast<uint32_t *>(realloc(pGraph->pOrder, sizeof(uint32_t) * pGraph->blockCapacity));
+    pGraph->pPredecessors = reinterpret_cast<uint32_t *>(realloc(pGraph->pPredecessors, sizeof(uint32_t) * (pGraph->predecessorCapacity + 1)));
+
+    if (pGraph->pBlocks == nullptr || pGraph->pOrder == nullptr || pGraph->pPredecessors == nullptr)
+      return false;
+  }
+
+  pGraph->pContexts = reinterpret_cast<ZydecLinearContext *>(realloc(pGraph->pContexts, sizeof(ZydecLinearContext) * pGraph->blockCapacity));
+
+  return pGraph->pContexts != nullptr;
+}
+
+inline void FreeControlFlowGraph(ZydecControlFlowGraph *pGraph)
+{
+  free(pGraph->pBlocks);
+  free(pGraph->pOrder);
+  free(pGraph->pContexts);
+  free(pGraph->pPredecessors);
+
+  *pGraph = ZydecControlFlowGraph();
+}
+
+// Finds the loops of the graph, growing the storage as needed.
+inline bool DetectLoops(ZydecLoopForest *pForest, const ZydecControlFlowGraph *pGraph)
+{
+  pForest->pInnermostLoops = reinterpret_cast<uint32_t *>(realloc(pForest->pInnermostLoops, sizeof(uint32_t) * pGraph->blockCount));
+
+  if (pForest->pInnermostLoops == nullptr)
+    return false;
+
+  while (!zydec_LoopForest_Build(pForest, pGraph))
+  {
+    if (pForest->loopCount <= pForest->loopCapacity && pForest->loopBlockCount <= pForest->loopBlockCapacity && pForest->exitCount <= pForest->exitCapacity && pForest->pLoops != nullptr)
+      return false;
+
+    pForest->loopCapacity = pForest->loopCount;
+    pForest->loopBlockCapacity = pForest->loopBlockCount;
+    pForest->exitCapacity = pForest->exitCount;
+
+    pForest->pLoops = reinterpret_cast<ZydecLoop *>(realloc(pForest->pLoops, sizeof(ZydecLoop) * (pForest->loopCapacity + 1)));
+    pForest->pLoopBlocks = reinterpret_cast<uint32_t *>(realloc(pForest->pLoopBlocks, sizeof(uint32_t) * (pForest->loopBlockCapacity + 1)));
+    pForest->pExits = reinterpret_cast<uint32_t *>(realloc(pForest->pExits, sizeof(uint32_t) * (pForest->exitCapacity + 1)));
+
+    if (pForest->pLoops == nullptr || pForest->pLoopBlocks == nullptr || pForest->pExits == nullptr)
+      return false;
+  }
+
+  return true;
+}
+
+inline void FreeLoopForest(ZydecLoopForest *pForest)
+{
+  free(pForest->pLoops);
+  free(pForest->pLoopBlocks);
+  free(pForest->pExits);
+  free(pForest->pInnermostLoops);
+
+  *pForest = ZydecLoopForest();
+}
+
+// Records the values of the code, growing the storage as needed.
+inline bool BuildDefUseGraph(ZydecDefUseGraph *pGraph, const ZydecControlFlowGraph *pControlFlow, const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t codeSize)
+{
+  while (!zydec_DefUseGraph_Build(pGraph, pControlFlow, nullptr, pDecoder, pCode, codeSize, 0))
+  {
+    if (pGraph->instructionCount <= pGraph->instructionCapacity && pGraph->valueCount <= pGraph->valueCapacity && pGraph->referenceCount <= pGraph->referenceCapacity && pGraph->useCount <= pGraph->useCapacity && pGraph->stackSlotCount <= pGraph->stackSlotCapacity && pGraph->pInstructions != nullptr)
+      return false;
+
+    pGraph->instructionCapacity = pGraph->instructionCount;
+    pGraph->valueCapacity = pGraph->valueCount;
+    pGraph->referenceCapacity = pGraph->referenceCount;
+    pGraph->useCapacity = pGraph->useCount;
+    pGraph->stackSlotCapacity = pGraph->stackSlotCount;
+
+    pGraph->pInstructions = reinterpret_cast<ZydecDefUseInstruction *>(realloc(pGraph->pInstructions, sizeof(ZydecDefUseInstruction) * (pGraph->instructionCapacity + 1)));
+    pGraph->pValues = reinterpret_cast<ZydecValue *>(realloc(pGraph->pValues, sizeof(ZydecValue) * (pGraph->valueCapacity + 1)));
+    pGraph->pReferences = reinterpret_cast<uint32_t *>(realloc(pGraph->pReferences, sizeof(uint32_t) * (pGraph->referenceCapacity + 1)));
+    pGraph->pUses = reinterpret_cast<uint32_t *>(realloc(pGraph->pUses, sizeof(uint32_t) * (pGraph->useCapacity + 1)));
+    pGraph->pStackSlots = reinterpret_cast<ZydecStackSlot *>(realloc(pGraph->pStackSlots, sizeof(ZydecStackSlot) * (pGraph->stackSlotCapacity + 1)));
+
+    if (pGraph->pInstructions == nullptr || pGraph->pValues == nullptr || pGraph->pReferences == nullptr || pGraph->pUses == nullptr || pGraph->pStackSlots == nullptr)
+      return false;
+  }
+
+  return true;
+}
+
+inline void FreeDefUseGraph(ZydecDefUseGraph *pGraph)
+{
+  free(pGraph->pInstructions);
+  free(pGraph->pValues);
+  free(pGraph->pReferences);
+  free(pGraph->pUses);
+  free(pGraph->pStackSlots);
+
+  *pGraph = ZydecDefUseGraph();
+}
+
+// Returns whether `predecessor` is one of the predecessors of the block.
+inline bool HasPredecessor(const ZydecControlFlowGraph *pGraph, const size_t blockIndex, const uint32_t predecessor)
+{
+  const ZydecBasicBlock *pBlock = &pGraph->pBlocks[blockIndex];
+
+  for (size_t i = 0; i < pBlock->predecessorCount; i++)
+    if (pGraph->pPredecessors[pBlock->firstPredecessor + i] == predecessor)
+      return true;
+
+  return false;
+}
+
+// Returns the name the session gives the register at the end of the block.
+inline uint32_t GetNameAfterBlock(const ZydecControlFlowGraph *pGraph, const size_t blockIndex, ZydecLinearSession *pSession, const ZydisDecoder *pDecoder, const uint8_t *pCode, const ZydisRegister reg)
+{
+  const ZydecBasicBlock *pBlock = &pGraph->pBlocks[blockIndex];
+
+  zydec_ControlFlowGraph_BeginBlock(pGraph, blockIndex, pSession);
+  zydec_LinearSession_AdvanceCode(pSession, pDecoder, pCode + pBlock->offset, pBlock->size, pBlock->offset);
+
+  return pSession->context.regInfo[zydec_LinearContext_GetRegisterIndex(reg)];
+}
+
+#endif // tests_h__
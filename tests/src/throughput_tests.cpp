@@ -0,0 +1,139 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2023, Christoph Stiller. All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation 
+//    and/or other materials provided with the distribution.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tests.h"
+#include "fixtures.h"
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Estimates the throughput of the innermost loop of the code.
+static bool EstimateLoopThroughput(ZydecThroughput *pThroughput, const ZydecMicroarchitecture microarchitecture, const uint8_t *pCode, const size_t codeSize)
+{
+  ZydisDecoder decoder;
+  InitDecoder(&decoder);
+
+  ZydecControlFlowGraph graph;
+  TEST_ASSERT(BuildControlFlowGraph(&graph, &decoder, pCode, codeSize));
+
+  ZydecLoopForest forest;
+  TEST_ASSERT(DetectLoops(&forest, &graph));
+
+  const uint32_t loop = zydec_LoopForest_FindHotLoop(&forest);
+  TEST_ASSERT(loop != ZydecBasicBlockNone);
+
+  const ZydecLoop *pLoop = &forest.pLoops[loop];
+  TEST_ASSERT(zydec_Throughput_Estimate(pThroughput, &graph, forest.pLoopBlocks + pLoop->firstBlock, pLoop->blockCount, microarchitecture, &decoder, pCode, codeSize));
+
+  FreeLoopForest(&forest);
+  FreeControlFlowGraph(&graph);
+
+  return true;
+}
+
+// Returns the cycles per iteration of the port with the name.
+static double GetPortCycles(const ZydecThroughput *pThroughput, const ZydecMicroarchitecture microarchitecture, const char *name)
+{
+  for (size_t i = 0; i < zydec_Microarchitecture_GetPortCount(microarchitecture); i++)
+    if (strcmp(zydec_Microarchitecture_GetPortName(microarchitecture, i), name) == 0)
+      return pThroughput->portCycles[i];
+
+  return -1;
+}
+
+// Compares in hundredths of a cycle, like they're printed.
+#define TEST_ASSERT_CYCLES(expected, actual) TEST_ASSERT_EQUAL((uint64_t)((expected) * 100 + 0.5), (uint64_t)((actual) * 100 + 0.5))
+
+////////////////////////////////////////////////////////////////////////////////
+
+static bool TestMaskedDotProductThroughput()
+{
+  ZydecThroughput throughput;
+
+  // `vmovups`, `vcmpltps`, `vfmadd132ps`, `add`, both moves & the fused `cmp` & `jg` are issued 4 per cycle. The moves don't execute on any port.
+  TEST_ASSERT(EstimateLoopThroughput(&throughput, zma_skylake, MaskedDotProductFixture, sizeof(MaskedDotProductFixture)));
+  TEST_ASSERT_EQUAL(8, throughput.instructionCount);
+  TEST_ASSERT_EQUAL(7, throughput.uopCount);
+  TEST_ASSERT_CYCLES(1.75, throughput.cycles);
+  TEST_ASSERT_EQUAL(ZydecThroughputIssueBound, throughput.bottleneckPort);
+  TEST_ASSERT_CYCLES(1.00, GetPortCycles(&throughput, zma_skylake, "p0"));
+  TEST_ASSERT_CYCLES(1.00, GetPortCycles(&throughput, zma_skylake, "p5"));
+  TEST_ASSERT_CYCLES(1.00, GetPortCycles(&throughput, zma_skylake, "p2"));
+  TEST_ASSERT_CYCLES(1.00, GetPortCycles(&throughput, zma_skylake, "p3"));
+
+  // The 512 bit compare & FMA occupy the two FMA pipes twice each.
+  TEST_ASSERT(EstimateLoopThroughput(&throughput, zma_zen4, MaskedDotProductFixture, sizeof(MaskedDotProductFixture)));
+  TEST_ASSERT_EQUAL(7, throughput.uopCount);
+  TEST_ASSERT_CYCLES(2.00, throughput.cycles);
+  TEST_ASSERT_CYCLES(2.00, GetPortCycles(&throughput, zma_zen4, "fp0"));
+  TEST_ASSERT_CYCLES(2.00, GetPortCycles(&throughput, zma_zen4, "fp1"));
+  TEST_ASSERT_CYCLES(0.00, GetPortCycles(&throughput, zma_zen4, "fp2"));
+  TEST_ASSERT_CYCLES(0.00, GetPortCycles(&throughput, zma_zen4, "fp3"));
+  TEST_ASSERT(throughput.bottleneckPort != ZydecThroughputIssueBound);
+  TEST_ASSERT(strncmp(zydec_Microarchitecture_GetPortName(zma_zen4, throughput.bottleneckPort), "fp", 2) == 0);
+
+  return true;
+}
+
+static bool TestStackCounterThroughput()
+{
+  ZydecThroughput throughput;
+
+  // The store is a single fused uop, the `lea` with base, index & displacement is limited to port 1.
+  TEST_ASSERT(EstimateLoopThroughput(&throughput, zma_skylake, StackCounterFixture, sizeof(StackCounterFixture)));
+  TEST_ASSERT_EQUAL(6, throughput.instructionCount);
+  TEST_ASSERT_EQUAL(5, throughput.uopCount);
+  TEST_ASSERT_CYCLES(1.25, throughput.cycles);
+  TEST_ASSERT_CYCLES(1.00, GetPortCycles(&throughput, zma_skylake, "p1"));
+  TEST_ASSERT_CYCLES(1.00, GetPortCycles(&throughput, zma_skylake, "p4"));
+
+  return true;
+}
+
+static bool TestPortBound()
+{
+  ZydecThroughput throughput;
+
+  // Three uops on the four ALUs are issued faster than they execute.
+  TEST_ASSERT(EstimateLoopThroughput(&throughput, zma_zen3, BranchesFixture, sizeof(BranchesFixture)));
+  TEST_ASSERT_EQUAL(3, throughput.uopCount);
+  TEST_ASSERT_CYCLES(0.50, throughput.issueCycles);
+  TEST_ASSERT_CYCLES(0.75, throughput.cycles);
+  TEST_ASSERT(throughput.bottleneckPort != ZydecThroughputIssueBound);
+  TEST_ASSERT(strncmp(zydec_Microarchitecture_GetPortName(zma_zen3, throughput.bottleneckPort), "alu", 3) == 0);
+
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void RunThroughputTests(TestRun *pRun)
+{
+  RUN_TEST(pRun, TestMaskedDotProductThroughput);
+  RUN_TEST(pRun, TestStackCounterThroughput);
+  RUN_TEST(pRun, TestPortBound);
+}
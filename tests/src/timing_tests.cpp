@@ -0,0 +1,193 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2023, Christoph Stiller. All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation 
+//    and/or other materials provided with the distribution.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tests.h"
+#include "fixtures.h"
+
+////////////////////////////////////////////////////////////////////////////////
+
+static bool GetTiming(const ZydecMicroarchitecture microarchitecture, const uint8_t *pCode, const size_t codeSize, const size_t offset, ZydecInstructionTiming *pTiming)
+{
+  ZydisDecoder decoder;
+  InitDecoder(&decoder);
+
+  ZydisDecodedInstruction instruction;
+  ZydisDecodedOperand operands[ZYDIS_MAX_OPERAND_COUNT];
+
+  if (offset >= codeSize || !ZYAN_SUCCESS(ZydisDecoderDecodeFull(&decoder, pCode + offset, codeSize - offset, &instruction, operands)))
+    return false;
+
+  zydec_Microarchitecture_GetInstructionTiming(microarchitecture, &instruction, operands, pTiming);
+
+  return true;
+}
+
+static bool ExpectSameTiming(const ZydecInstructionTiming *pExpected, const ZydecInstructionTiming *pActual)
+{
+  TEST_ASSERT_EQUAL(pExpected->latency, pActual->latency);
+  TEST_ASSERT_EQUAL(pExpected->loadLatency, pActual->loadLatency);
+  TEST_ASSERT_EQUAL(pExpected->uopCount, pActual->uopCount);
+  TEST_ASSERT_EQUAL(pExpected->portUsageCount, pActual->portUsageCount);
+
+  for (size_t i = 0; i < pExpected->portUsageCount; i++)
+  {
+    TEST_ASSERT_EQUAL(pExpected->portUsages[i].ports, pActual->portUsages[i].ports);
+    TEST_ASSERT_EQUAL(pExpected->portUsages[i].cycles, pActual->portUsages[i].cycles);
+  }
+
+  return true;
+}
+
+// Finds the critical path of the innermost loop of the code.
+static bool FindCriticalPath(ZydecCriticalPath *pPath, const ZydecMicroarchitecture microarchitecture, const ZydecDefUseGraph::MemoryTracking memoryTracking, const uint8_t *pCode, const size_t codeSize)
+{
+  ZydisDecoder decoder;
+  InitDecoder(&decoder);
+
+  ZydecControlFlowGraph graph;
+  TEST_ASSERT(BuildControlFlowGraph(&graph, &decoder, pCode, codeSize));
+
+  ZydecLoopForest forest;
+  TEST_ASSERT(DetectLoops(&forest, &graph));
+
+  const uint32_t loop = zydec_LoopForest_FindHotLoop(&forest);
+  TEST_ASSERT(loop != ZydecBasicBlockNone);
+
+  ZydecDefUseGraph defUse;
+  defUse.memoryTracking = memoryTracking;
+  TEST_ASSERT(BuildDefUseGraph(&defUse, &graph, &decoder, pCode, codeSize));
+
+  while (!zydec_CriticalPath_Find(pPath, &defUse, &graph, &forest, loop, microarchitecture, &decoder, pCode, codeSize))
+  {
+    TEST_ASSERT(pPath->linkCount > pPath->linkCapacity);
+
+    pPath->linkCapacity = pPath->linkCount;
+    pPath->pLinks = reinterpret_cast<ZydecCriticalPathLink *>(realloc(pPath->pLinks, sizeof(ZydecCriticalPathLink) * (pPath->linkCapacity + 1)));
+    TEST_ASSERT(pPath->pLinks != nullptr);
+  }
+
+  FreeDefUseGraph(&defUse);
+  FreeLoopForest(&forest);
+  FreeControlFlowGraph(&graph);
+
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+static bool TestEvexMoves()
+{
+  for (size_t i = 0; i < zma_count; i++)
+  {
+    const ZydecMicroarchitecture microarchitecture = (ZydecMicroarchitecture)i;
+
+    ZydecInstructionTiming evex;
+    ZydecInstructionTiming vex;
+
+    // The writemask operand of `vmovaps zmm0, zmm2` isn't the source of the move, which is eliminated like the VEX encoded one.
+    TEST_ASSERT(GetTiming(microarchitecture, VectorMovesFixture, sizeof(VectorMovesFixture), 0x00, &evex));
+    TEST_ASSERT(GetTiming(microarchitecture, VectorMovesFixture, sizeof(VectorMovesFixture), 0x06, &vex));
+    TEST_ASSERT(ExpectSameTiming(&vex, &evex));
+    TEST_ASSERT_EQUAL(0, evex.latency);
+    TEST_ASSERT_EQUAL(0, evex.portUsageCount);
+
+    TEST_ASSERT(GetTiming(microarchitecture, VectorMovesFixture, sizeof(VectorMovesFixture), 0x2A, &evex));
+    TEST_ASSERT(ExpectSameTiming(&vex, &evex));
+
+    // Loads.
+    TEST_ASSERT(GetTiming(microarchitecture, VectorMovesFixture, sizeof(VectorMovesFixture), 0x16, &evex));
+    TEST_ASSERT(GetTiming(microarchitecture, VectorMovesFixture, sizeof(VectorMovesFixture), 0x1C, &vex));
+    TEST_ASSERT(ExpectSameTiming(&vex, &evex));
+    TEST_ASSERT_EQUAL(1, evex.portUsageCount);
+
+    // Transfers from general purpose registers.
+    TEST_ASSERT(GetTiming(microarchitecture, VectorMovesFixture, sizeof(VectorMovesFixture), 0x20, &evex));
+    TEST_ASSERT(GetTiming(microarchitecture, VectorMovesFixture, sizeof(VectorMovesFixture), 0x26, &vex));
+    TEST_ASSERT(ExpectSameTiming(&vex, &evex));
+    TEST_ASSERT(evex.latency > 0);
+
+    // Masked moves blend into the destination instead of being eliminated.
+    TEST_ASSERT(GetTiming(microarchitecture, VectorMovesFixture, sizeof(VectorMovesFixture), 0x0A, &evex));
+    TEST_ASSERT_EQUAL(1, evex.latency);
+    TEST_ASSERT_EQUAL(1, evex.portUsageCount);
+
+    TEST_ASSERT(GetTiming(microarchitecture, VectorMovesFixture, sizeof(VectorMovesFixture), 0x10, &evex));
+    TEST_ASSERT_EQUAL(1, evex.latency);
+    TEST_ASSERT_EQUAL(1, evex.portUsageCount);
+  }
+
+  return true;
+}
+
+static bool TestMaskedDotProductCriticalPath()
+{
+  const ZydecMicroarchitecture microarchitectures[] = { zma_skylake, zma_zen4 };
+
+  for (size_t i = 0; i < sizeof(microarchitectures) / sizeof(microarchitectures[0]); i++)
+  {
+    ZydecCriticalPath path;
+    TEST_ASSERT(FindCriticalPath(&path, microarchitectures[i], ZydecDefUseGraph::MemoryTracking::None, MaskedDotProductFixture, sizeof(MaskedDotProductFixture)));
+
+    // The FMA, with the move back into the accumulator being free.
+    TEST_ASSERT_EQUAL(4, path.cycles);
+    TEST_ASSERT_EQUAL(2, path.linkCount);
+    TEST_ASSERT_EQUAL(4, path.pLinks[0].latency);
+    TEST_ASSERT_EQUAL(0, path.pLinks[1].latency);
+
+    free(path.pLinks);
+  }
+
+  return true;
+}
+
+static bool TestStackCounterCriticalPath()
+{
+  ZydecCriticalPath path;
+
+  // Without tracking the stack, the counter is reloaded every iteration and only the complex `lea` advancing `rdx` is carried.
+  TEST_ASSERT(FindCriticalPath(&path, zma_skylake, ZydecDefUseGraph::MemoryTracking::None, StackCounterFixture, sizeof(StackCounterFixture)));
+  TEST_ASSERT_EQUAL(3, path.cycles);
+
+  // Store forwarding (5 cycles on Skylake) & the increment.
+  TEST_ASSERT(FindCriticalPath(&path, zma_skylake, ZydecDefUseGraph::MemoryTracking::StackSlots, StackCounterFixture, sizeof(StackCounterFixture)));
+  TEST_ASSERT_EQUAL(6, path.cycles);
+  TEST_ASSERT_EQUAL(3, path.linkCount);
+
+  free(path.pLinks);
+
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void RunTimingTests(TestRun *pRun)
+{
+  RUN_TEST(pRun, TestEvexMoves);
+  RUN_TEST(pRun, TestMaskedDotProductCriticalPath);
+  RUN_TEST(pRun, TestStackCounterCriticalPath);
+}
@@ -0,0 +1,200 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2023, Christoph Stiller. All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation 
+//    and/or other materials provided with the distribution.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tests.h"
+#include "fixtures.h"
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Translates the instruction at `offset` without context as if the code was loaded at `baseAddress`.
+static bool TranslateWithoutContext(const uint8_t *pCode, const size_t codeSize, const size_t offset, const size_t baseAddress, char *buffer, const size_t bufferSize)
+{
+  ZydisDecoder decoder;
+  InitDecoder(&decoder);
+
+  ZydecFormattingInfo info;
+  ZydisDecodedInstruction instruction;
+  ZydisDecodedOperand operands[ZYDIS_MAX_OPERAND_COUNT];
+
+  TEST_ASSERT(ZYAN_SUCCESS(ZydisDecoderDecodeFull(&decoder, pCode + offset, codeSize - offset, &instruction, operands)));
+
+  bool hasTranslation = false;
+  TEST_ASSERT(zydec_TranslateInstructionWithoutContext(&instruction, operands, ZYDIS_MAX_OPERAND_COUNT, baseAddress + offset, buffer, bufferSize, &hasTranslation, &info));
+  TEST_ASSERT(hasTranslation);
+
+  return true;
+}
+
+// Translates the code with two sessions, one into a large buffer & the other one into a buffer that just fits the translation.
+static bool ExpectSameNamesForTightBuffers(const uint8_t *pCode, const size_t codeSize)
+{
+  ZydisDecoder decoder;
+  InitDecoder(&decoder);
+
+  ZydecFormattingInfo info;
+  ZydecLinearSession large;
+  ZydecLinearSession tight;
+  zydec_LinearSession_Init(&large, &info);
+  zydec_LinearSession_Init(&tight, &info);
+
+  ZydisDecodedInstruction instruction;
+  ZydisDecodedOperand operands[ZYDIS_MAX_OPERAND_COUNT];
+
+  for (size_t offset = 0; offset < codeSize; offset += instruction.length)
+  {
+    TEST_ASSERT(ZYAN_SUCCESS(ZydisDecoderDecodeFull(&decoder, pCode + offset, codeSize - offset, &instruction, operands)));
+
+    char largeBuffer[1024];
+    char tightBuffer[1024];
+    bool largeHasTranslation = false;
+    bool tightHasTranslation = false;
+
+    TEST_ASSERT(zydec_LinearSession_TranslateInstruction(&large, &instruction, operands, ZYDIS_MAX_OPERAND_COUNT, offset, largeBuffer, sizeof(largeBuffer), &largeHasTranslation));
+    TEST_ASSERT(zydec_LinearSession_TranslateInstruction(&tight, &instruction, operands, ZYDIS_MAX_OPERAND_COUNT, offset, tightBuffer, strlen(largeBuffer) + 1, &tightHasTranslation));
+
+    TEST_ASSERT(largeHasTranslation == tightHasTranslation);
+    TEST_ASSERT(strcmp(largeBuffer, tightBuffer) == 0);
+    TEST_ASSERT_EQUAL(large.context.hashState, tight.context.hashState);
+    TEST_ASSERT(memcmp(large.context.regInfo, tight.context.regInfo, sizeof(large.context.regInfo)) == 0);
+  }
+
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+static bool TestTightBuffers()
+{
+  ZydisDecoder decoder;
+  InitDecoder(&decoder);
+
+  ZydecFormattingInfo info;
+  ZydisDecodedInstruction instruction;
+  ZydisDecodedOperand operands[ZYDIS_MAX_OPERAND_COUNT];
+
+  // `vfmadd132ps zmm2{k1}, zmm0, [rsi + rax*4]` of the dot product.
+  TEST_ASSERT(ZYAN_SUCCESS(ZydisDecoderDecodeFull(&decoder, MaskedDotProductFixture + 0x1A, sizeof(MaskedDotProductFixture) - 0x1A, &instruction, operands)));
+
+  char buffer[1024];
+  bool hasTranslation = false;
+  TEST_ASSERT(zydec_TranslateInstructionWithoutContext(&instruction, operands, ZYDIS_MAX_OPERAND_COUNT, 0x1A, buffer, sizeof(buffer), &hasTranslation, &info));
+  TEST_ASSERT(hasTranslation);
+
+  const size_t length = strlen(buffer);
+
+  // Fits with the terminating null character, even though the fixed text is reserved for its worst case.
+  char tight[1024];
+  TEST_ASSERT(zydec_TranslateInstructionWithoutContext(&instruction, operands, ZYDIS_MAX_OPERAND_COUNT, 0x1A, tight, length + 1, &hasTranslation, &info));
+  TEST_ASSERT(strcmp(buffer, tight) == 0);
+  TEST_ASSERT(!zydec_TranslateInstructionWithoutContext(&instruction, operands, ZYDIS_MAX_OPERAND_COUNT, 0x1A, tight, length, &hasTranslation, &info));
+
+  return true;
+}
+
+static bool TestTightBufferNames()
+{
+  // Retrying a translation that didn't fit mustn't draw fresh names twice.
+  TEST_ASSERT(ExpectSameNamesForTightBuffers(BranchesFixture, sizeof(BranchesFixture)));
+  TEST_ASSERT(ExpectSameNamesForTightBuffers(MaskedDotProductFixture, sizeof(MaskedDotProductFixture)));
+  TEST_ASSERT(ExpectSameNamesForTightBuffers(StackCounterFixture, sizeof(StackCounterFixture)));
+  TEST_ASSERT(ExpectSameNamesForTightBuffers(EvexIntrinsicsFixture, sizeof(EvexIntrinsicsFixture)));
+
+  return true;
+}
+
+static bool TestRelativeTargets()
+{
+  // Relative operands are relative to the end of the instruction, not its start.
+  const uint8_t ripRelativeLea[] = { 0x48, 0x8D, 0x05, 0x10, 0x00, 0x00, 0x00 }; // lea rax, [rip + 0x10]
+  const size_t baseAddress = 0x1000;
+  char buffer[1024];
+
+  TEST_ASSERT(TranslateWithoutContext(BranchesFixture, sizeof(BranchesFixture), 0x08, baseAddress, buffer, sizeof(buffer)));
+  TEST_ASSERT(strstr(buffer, "goto 0x1013;") != nullptr);
+
+  TEST_ASSERT(TranslateWithoutContext(BranchesFixture, sizeof(BranchesFixture), 0x11, baseAddress, buffer, sizeof(buffer)));
+  TEST_ASSERT(strstr(buffer, "goto 0x101A;") != nullptr);
+
+  TEST_ASSERT(TranslateWithoutContext(BranchesFixture, sizeof(BranchesFixture), 0x27, baseAddress, buffer, sizeof(buffer)));
+  TEST_ASSERT(strstr(buffer, "goto 0x101D;") != nullptr);
+
+  TEST_ASSERT(TranslateWithoutContext(BranchesFixture, sizeof(BranchesFixture), 0x29, baseAddress, buffer, sizeof(buffer)));
+  TEST_ASSERT(strstr(buffer, "(0x102F)();") != nullptr);
+
+  TEST_ASSERT(TranslateWithoutContext(ripRelativeLea, sizeof(ripRelativeLea), 0, baseAddress, buffer, sizeof(buffer)));
+  TEST_ASSERT(strstr(buffer, "0x1017") != nullptr);
+
+  return true;
+}
+
+static bool TestEvexIntrinsics()
+{
+  // Merging passes the destination before the mask, except for the 231 fused multiply-adds, which keep their addend in masked lanes.
+  const char *expected[] =
+  {
+    "(m512)z0 = _mm512_mask_add_ps((m512)z0, mask_k1, (m512)z1, (m512)z2);",
+    "(m512)z0 = _mm512_maskz_add_ps(mask_k1, (m512)z1, _mm512_set1_ps((data_segment: (i64)di)));",
+    "(m512)z0 = _mm512_add_round_ps((m512)z1, (m512)z2, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);",
+    "(m512)z0 = _mm512_mask_fmadd_ps((m512)z0, mask_k1, (m512)z2, (m512)z1); // part 1 / 3",
+    "(m512)z0 = _mm512_maskz_fmadd_ps(mask_k1, (m512)z0, (m512)z1, (m512)z2); // part 2 / 3",
+    "(m512)z0 = _mm512_mask3_fmadd_ps((m512)z1, _mm512_set1_ps((data_segment: (i64)di)), (m512)z0, mask_k1); // part 3 / 3",
+    "(m512)z0 = _mm512_mask3_fmadd_round_ps((m512)z1, (m512)z2, (m512)z0, mask_k1, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); // part 3 / 3",
+    "(m256)y0 = _mm256_fmadd_ps((m256)y1, (m256)y2, (m256)y0); // part 3 / 3",
+  };
+
+  ZydisDecoder decoder;
+  InitDecoder(&decoder);
+
+  ZydisDecodedInstruction instruction;
+  ZydisDecodedOperand operands[ZYDIS_MAX_OPERAND_COUNT];
+  size_t index = 0;
+
+  for (size_t offset = 0; offset < sizeof(EvexIntrinsicsFixture); offset += instruction.length, index++)
+  {
+    TEST_ASSERT(ZYAN_SUCCESS(ZydisDecoderDecodeFull(&decoder, EvexIntrinsicsFixture + offset, sizeof(EvexIntrinsicsFixture) - offset, &instruction, operands)));
+    TEST_ASSERT(index < sizeof(expected) / sizeof(expected[0]));
+
+    char buffer[1024];
+    TEST_ASSERT(TranslateWithoutContext(EvexIntrinsicsFixture, sizeof(EvexIntrinsicsFixture), offset, 0, buffer, sizeof(buffer)));
+    TEST_ASSERT(strcmp(buffer, expected[index]) == 0);
+  }
+
+  TEST_ASSERT_EQUAL(sizeof(expected) / sizeof(expected[0]), index);
+
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void RunTranslationTests(TestRun *pRun)
+{
+  RUN_TEST(pRun, TestTightBuffers);
+  RUN_TEST(pRun, TestTightBufferNames);
+  RUN_TEST(pRun, TestRelativeTargets);
+  RUN_TEST(pRun, TestEvexIntrinsics);
+}
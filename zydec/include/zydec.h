@@ -30,6 +30,7 @@
 #define zydec_h__
 
 #include <stdint.h>
+#include <atomic>
 
 #ifndef ZYDIS_H
 extern "C"
@@ -49,6 +50,12 @@ struct ZydecFormattingInfo
   ResolveAddressToFriendlyName *pResolveAddressToFriendlyName = nullptr;
   void *pUserData = nullptr;
 
+  // Returns `true` if all `size` bytes at `virtualAddress` were read from memory that doesn't change at runtime, like the read-only sections of an image.
+  typedef bool ReadConstantMemoryFunc(const size_t virtualAddress, void *pData, const size_t size, void *pMemoryUserData);
+
+  ReadConstantMemoryFunc *pReadConstantMemory = nullptr; // if set, `rip` relative vector constants of vector instructions are rendered as `_mm_set_*` literals in the element type of the intrinsic.
+  void *pMemoryUserData = nullptr;
+
   typedef bool RegisterAppendStringFunc(char **pBufferPos, size_t *pRemainingSize, const ZydisRegister reg, void *pRegUserData);
   
   enum HintOperation
@@ -109,6 +116,11 @@ struct ZydecFormattingInfo
   SetResultHintOp *pSetHintOp = nullptr; // only available with `zydec_TranslateInstructionWithoutContext`.
   void *pRegUserData = nullptr; // only available with `zydec_TranslateInstructionWithoutContext`.
 
+  typedef uint32_t RegisterNameFunc(const ZydisRegister reg, void *pRegUserData);
+
+  RegisterNameFunc *pGetRegisterName = nullptr; // replaces `pWriteRegister` for token output, see `ZydecToken`.
+  RegisterNameFunc *pGetResultRegisterName = nullptr; // replaces `pWriteResultRegister` for token output, see `ZydecToken`.
+
   typedef void AfterCallFunc(void *pUserData);
 
   AfterCallFunc *pAfterCall = nullptr; // only available with `zydec_TranslateInstructionWithoutContext`.
@@ -117,6 +129,7 @@ struct ZydecFormattingInfo
   bool simplifyCommonShorthands = true;
   bool simplifyValueSelfModification = true; // only available with `zydec_TranslateInstructionWithoutContext`.
   bool acceptHints = true;
+  bool widthCorrectIntrinsics = true; // if `false`, every vector width is written with the `_mm_` prefix & `si` without a width suffix.
   
   enum class AfterCallRegisterRetentionMode
   {
@@ -132,22 +145,674 @@ struct ZydecFormattingInfo
   };
   
   AfterCallRegisterRetentionMode afterCallRegisterRetentionMode = AfterCallRegisterRetentionMode::Default;
+
+  enum class RegisterNamingMode
+  {
+    Sequential, // fresh names are drawn from `ZydecLinearContext::hashState`, so they depend on every name assigned before.
+    AddressSeeded, // fresh names only depend on the address of the instruction & the order of its results, and the linear context starts over at every function boundary (the first instruction after a return or unconditional jump and its `int3` / `nop` padding). Names therefore only depend on the code since the last boundary, so separately translated ranges name them like a serial translation, see `zydec_TranslateParallel`. The boundaries are a heuristic: a jump over the `else` branch of an `if` starts over as well, so registers that are live across the join lose their names.
+  };
+
+  RegisterNamingMode registerNamingMode = RegisterNamingMode::Sequential; // only used by the linear context.
 };
 
 ////////////////////////////////////////////////////////////////////////////////
 
 // Currently requires all 10 operands.
+// Fails only if the translation including its terminating null character doesn't fit into `bufferCapacity`.
 bool zydec_TranslateInstructionWithoutContext(const ZydisDecodedInstruction *pInstruction, const ZydisDecodedOperand *pOperands, const size_t operandCount, const size_t virtualAddress, char *buffer, const size_t bufferCapacity, bool *pHasTranslation, ZydecFormattingInfo *pInfo);
 
 ////////////////////////////////////////////////////////////////////////////////
 
+enum ZydecTokenType : uint8_t
+{
+  ztt_punctuation, // `text`: operators, parentheses, separators & casts.
+  ztt_intrinsic, // `text`, with `id` being the `ZydisMnemonic` it belongs to & `reg` the vector width its `_mm_` prefix is rendered for (128, 256 or 512, plus 1 if `si(` is suffixed with the width, 2 / 4 for the `mask_` / `maskz_` variant of AVX-512 write masks & 8 for the `_round` variant of embedded rounding) or 0 to render `text` as is.
+  ztt_comment, // `text`, with `id` being the `ZydisMnemonic` it belongs to.
+  ztt_register, // `reg` (the base register), with `id` being the name from `pGetRegisterName` / `pGetResultRegisterName` or 0.
+  ztt_signedImmediate, // `value` (as `int64_t`), rendered in decimal.
+  ztt_unsignedImmediate, // `value`, rendered in decimal.
+  ztt_address, // `value`, rendered in hex. Also used for offsets from symbols.
+  ztt_symbol, // `value` is the address that was resolved by `pResolveAddressToFriendlyName`.
+  ztt_floatImmediate, // `value` is the bit pattern of a `float` (with `id` being 32) or a `double` (with `id` being 64).
+};
+
+struct ZydecToken
+{
+  ZydecTokenType type;
+  uint16_t reg;
+  uint32_t id;
+  uint32_t length; // of `text`, which is not null terminated.
+
+  union
+  {
+    const char *text; // static, so tokens stay valid after translation.
+    uint64_t value;
+  };
+};
+
+// Enough tokens for any single instruction.
+static constexpr size_t ZydecTokenInstructionCapacity = 256;
+
+// Currently requires all 10 operands.
+// Emits the translation as tokens instead of text, so that text only has to be rendered (see `zydec_RenderTokens`) for the instructions that are actually displayed. `pWriteRegister` & `pWriteResultRegister` are not used.
+// Returns `false` if more than `tokenCapacity` tokens would be required.
+bool zydec_TranslateInstructionToTokens(const ZydisDecodedInstruction *pInstruction, const ZydisDecodedOperand *pOperands, const size_t operandCount, const size_t virtualAddress, ZydecToken *pTokens, const size_t tokenCapacity, size_t *pTokenCount, bool *pHasTranslation, ZydecFormattingInfo *pInfo);
+
+// Produces the same text as the text translation functions would have. Register names are rendered the way the linear context names them.
+// `pInfo` is only needed to resolve `ztt_symbol` tokens and may be `nullptr` otherwise.
+bool zydec_RenderTokens(const ZydecToken *pTokens, const size_t tokenCount, char *buffer, const size_t bufferCapacity, ZydecFormattingInfo *pInfo);
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Names are tracked for the 64 bit general purpose registers, the flags, the vector, mask, MMX & x87 registers. Other registers are never named.
+static constexpr size_t ZydecLinearContextRegisterCount = 16 + 1 + 32 * 3 + 8 + 8 + 8;
+
 struct ZydecLinearContext
 {
   uint64_t hashState = 0xBADC0FFEECA7F00D;
-  uint32_t regInfo[ZYDIS_REGISTER_MAX_VALUE] = {};
+  uint32_t regInfo[ZydecLinearContextRegisterCount] = {}; // indexed by `zydec_LinearContext_GetRegisterIndex`.
+  bool isAfterUnconditionalBranch = false; // only tracked in `ZydecFormattingInfo::RegisterNamingMode::AddressSeeded`, the context starts over at the next instruction that isn't `int3` / `nop` padding.
 };
 
+// Returns the index of the name of the base register `reg` in `ZydecLinearContext::regInfo` or `ZydecLinearContextRegisterCount` if the register isn't tracked.
+size_t zydec_LinearContext_GetRegisterIndex(const ZydisRegister reg);
+
+// Copies the naming state of `pContext` to `pSnapshot`, e.g. to restore it at the start of a basic block.
+void zydec_LinearContext_Snapshot(const ZydecLinearContext *pContext, ZydecLinearContext *pSnapshot);
+
+void zydec_LinearContext_Restore(ZydecLinearContext *pContext, const ZydecLinearContext *pSnapshot);
+
+// Keeps the names that `pContext` & `pOther` agree on and gives every other register of `pContext` a fresh name, e.g. where control flow joins.
+void zydec_LinearContext_Merge(ZydecLinearContext *pContext, const ZydecLinearContext *pOther);
+
 // Currently requires all 10 operands.
+// Sets up the linear context callbacks on every call, prefer `ZydecLinearSession` when translating many instructions.
 bool zydec_TranslateInstructionWithLinearContext(ZydecLinearContext *pContext, const ZydisDecodedInstruction *pInstruction, const ZydisDecodedOperand *pOperands, const size_t operandCount, const size_t virtualAddress, char *buffer, const size_t bufferCapacity, bool *pHasTranslation, ZydecFormattingInfo *pInfo);
 
+////////////////////////////////////////////////////////////////////////////////
+
+// Per-instruction state of the linear context callbacks.
+struct ZydecLinearContextFormatInfo
+{
+  ZydecLinearContext *pContext = nullptr;
+  ZydecFormattingInfo *pOriginalInfo = nullptr;
+  size_t virtualAddress = 0; // of the instruction that is being translated.
+  size_t resultNameCount = 0;
+  size_t assignedRegisterCount = 0;
+  size_t assignedRegister[ZydecLinearContextRegisterCount]; // indices into `ZydecLinearContext::regInfo`.
+  uint32_t assignedRegisterValue[ZydecLinearContextRegisterCount];
+
+  ZydisRegister regHint = ZYDIS_REGISTER_NONE;
+  ZydecFormattingInfo::HintOperation opHint = ZydecFormattingInfo::None;
+
+  bool hasValHint = false;
+  int64_t valHint = 0;
+};
+
+// Owns a linear context and the formatting info hooked up to it, so that they only have to be configured once.
+// Must not be copied or moved after `zydec_LinearSession_Init`, as the hooked formatting info refers back into the session.
+struct ZydecLinearSession
+{
+  ZydecLinearContext context;
+  ZydecFormattingInfo originalInfo;
+  ZydecFormattingInfo info;
+  ZydecLinearContextFormatInfo formatContextInfo;
+};
+
+// Resets the context and hooks a copy of `pInfo` up to it. Later changes to `*pInfo` are not reflected in the session.
+void zydec_LinearSession_Init(ZydecLinearSession *pSession, const ZydecFormattingInfo *pInfo);
+
+// Currently requires all 10 operands.
+bool zydec_LinearSession_TranslateInstruction(ZydecLinearSession *pSession, const ZydisDecodedInstruction *pInstruction, const ZydisDecodedOperand *pOperands, const size_t operandCount, const size_t virtualAddress, char *buffer, const size_t bufferCapacity, bool *pHasTranslation);
+
+// Currently requires all 10 operands.
+// See `zydec_TranslateInstructionToTokens`. Render with `&pSession->info` to resolve symbols.
+bool zydec_LinearSession_TranslateInstructionToTokens(ZydecLinearSession *pSession, const ZydisDecodedInstruction *pInstruction, const ZydisDecodedOperand *pOperands, const size_t operandCount, const size_t virtualAddress, ZydecToken *pTokens, const size_t tokenCapacity, size_t *pTokenCount, bool *pHasTranslation);
+
+// Currently requires all 10 operands.
+// Runs the translation without producing any text, only advancing the context & recording the name of every register in the order the translation would write them in.
+// Pass the names to `zydec_RenderAnalyzedInstruction` to get the text later on without having to replay the context up to this instruction.
+bool zydec_LinearSession_AnalyzeInstruction(ZydecLinearSession *pSession, const ZydisDecodedInstruction *pInstruction, const ZydisDecodedOperand *pOperands, const size_t operandCount, const size_t virtualAddress, uint32_t *pNames, const size_t nameCapacity, size_t *pNameCount, bool *pHasTranslation);
+
+// Currently requires all 10 operands.
+// Only advances the context like translating the instruction would, without producing any text or recording any names.
+bool zydec_LinearSession_AdvanceInstruction(ZydecLinearSession *pSession, const ZydisDecodedInstruction *pInstruction, const ZydisDecodedOperand *pOperands, const size_t operandCount, const size_t virtualAddress);
+
+// Decodes `pCode` (starting at `virtualAddress`) and advances the context across all of it. Bytes that fail to decode are skipped.
+bool zydec_LinearSession_AdvanceCode(ZydecLinearSession *pSession, const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t codeSize, const size_t virtualAddress);
+
+// Treats `pCode` as the body of a loop and advances the context across it until the names at the end of the body are the ones it started with, or `maxIterations` passes have been made.
+// The hash state is restored afterwards, so translating the body continues with the names carried in by the back-edge. `pIterationCount` & `pReachedFixedPoint` may be `nullptr`.
+bool zydec_LinearSession_AnalyzeLoop(ZydecLinearSession *pSession, const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t codeSize, const size_t virtualAddress, const size_t maxIterations, size_t *pIterationCount, bool *pReachedFixedPoint);
+
+// Currently requires all 10 operands.
+// `pInfo` has to be configured like the one the session has been initialized with.
+bool zydec_RenderAnalyzedInstruction(const ZydisDecodedInstruction *pInstruction, const ZydisDecodedOperand *pOperands, const size_t operandCount, const size_t virtualAddress, const uint32_t *pNames, const size_t nameCount, char *buffer, const size_t bufferCapacity, bool *pHasTranslation, ZydecFormattingInfo *pInfo);
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Compact per-instruction record of an analyzed listing. The operands are decoded again from the original code when rendering.
+struct ZydecListingInstruction
+{
+  uint32_t offset; // of the instruction in the code.
+  uint32_t firstName; // index into `ZydecListing::pNames`.
+  uint8_t length; // 1 for bytes that failed to decode.
+  uint8_t nameCount;
+  bool hasTranslation;
+};
+
+// Caller owned storage of an analyzed listing.
+struct ZydecListing
+{
+  ZydecListingInstruction *pInstructions = nullptr;
+  size_t instructionCount = 0;
+  size_t instructionCapacity = 0;
+
+  uint32_t *pNames = nullptr;
+  size_t nameCount = 0;
+  size_t nameCapacity = 0;
+
+  size_t analyzedSize = 0; // bytes of the code that have been analyzed so far.
+};
+
+// No instruction records more names than this.
+static constexpr size_t ZydecListingInstructionNameCapacity = 64;
+
+// Decodes & analyzes `pCode` (starting at `virtualAddress`) with the session, appending to the listing.
+// Stops & returns `false` once the listing runs out of instruction storage or has fewer than `ZydecListingInstructionNameCapacity` names left. Grow the storage and call again with the same code and session to continue.
+bool zydec_Listing_Analyze(ZydecListing *pListing, ZydecLinearSession *pSession, const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t codeSize, const size_t virtualAddress);
+
+// Renders the instructions [`begin`, `end`) of the listing, laid out like the results of `zydec_TranslateInstructionBatch`, with indices relative to `begin`.
+// `pInfo` has to be configured like the one the session has been initialized with. Stops & returns `false` once fewer than `ZydecBatchInstructionCapacity` characters of the arena remain; `*pRenderedCount` is the number of instructions that have been rendered.
+bool zydec_Listing_Render(const ZydecListing *pListing, const size_t begin, const size_t end, const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t virtualAddress, char *arena, const size_t arenaCapacity, uint32_t *pOffsets, uint32_t *pLengths, uint64_t *pHasTranslation, size_t *pRenderedCount, ZydecFormattingInfo *pInfo);
+
+////////////////////////////////////////////////////////////////////////////////
+
+struct ZydecLinearCheckpoint
+{
+  size_t offset; // of the instruction in the code that is translated next with `context`.
+  ZydecLinearContext context;
+};
+
+// Caller owned storage of context snapshots, so that a listing can be resumed anywhere without replaying it from the start.
+struct ZydecCheckpointIndex
+{
+  ZydecLinearCheckpoint *pCheckpoints = nullptr;
+  size_t checkpointCount = 0;
+  size_t checkpointCapacity = 0;
+
+  size_t interval = 1024; // instructions between checkpoints.
+  bool atBlockStarts = false; // also take a checkpoint after every branch, call & return (at most one per instruction).
+
+  size_t analyzedSize = 0; // bytes of the code that have been indexed so far.
+  size_t instructionsSinceCheckpoint = 0;
+};
+
+// Decodes & analyzes `pCode` (starting at `virtualAddress`) with the session, appending checkpoints to the index. When starting a new index, the session has to be in the state that translation of the code starts from (e.g. freshly initialized).
+// Stops & returns `false` once the index runs out of checkpoint storage. Grow the storage and call again with the same code and session to continue.
+bool zydec_CheckpointIndex_Build(ZydecCheckpointIndex *pIndex, ZydecLinearSession *pSession, const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t codeSize, const size_t virtualAddress);
+
+// Restores the session to the nearest checkpoint at or before `targetOffset` and analyzes the instructions from there up to `targetOffset`.
+// `*pResumeOffset` is the offset of the first instruction starting at or after `targetOffset`. Translating from there with the session produces the same output as translating everything before it would have.
+bool zydec_CheckpointIndex_Seek(const ZydecCheckpointIndex *pIndex, ZydecLinearSession *pSession, const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t codeSize, const size_t virtualAddress, const size_t targetOffset, size_t *pResumeOffset);
+
+////////////////////////////////////////////////////////////////////////////////
+
+static constexpr uint32_t ZydecBasicBlockNone = UINT32_MAX;
+
+struct ZydecBasicBlock
+{
+  uint32_t offset; // of the first instruction in the code.
+  uint32_t size;
+  uint32_t successors[2]; // block indices or `ZydecBasicBlockNone`, the fall-through successor first. Indirect branches & returns have none.
+  uint32_t firstPredecessor; // index into `ZydecControlFlowGraph::pPredecessors`.
+  uint32_t predecessorCount;
+  uint32_t order; // position of the block in `ZydecControlFlowGraph::pOrder`.
+};
+
+// Caller owned storage of the basic blocks of a range of code.
+struct ZydecControlFlowGraph
+{
+  ZydecBasicBlock *pBlocks = nullptr; // in the order of the code, the first one being the entry.
+  uint32_t *pOrder = nullptr; // `blockCapacity` block indices: reverse postorder from the entry, followed by the reverse postorder of every block that isn't reachable from it (e.g. other functions) in the order of the code.
+  ZydecLinearContext *pContexts = nullptr; // `blockCapacity` names at the start of every block, see `zydec_ControlFlowGraph_PropagateNames`. Not needed to build the graph.
+  size_t blockCount = 0;
+  size_t blockCapacity = 0;
+
+  uint32_t *pPredecessors = nullptr; // block indices, grouped by block.
+  size_t predecessorCount = 0;
+  size_t predecessorCapacity = 0;
+};
+
+// Decodes `pCode` like a linear sweep and splits it into basic blocks, starting a block at the entry, every jump & call target inside the code and after every branch & return.
+// Targets that aren't on an instruction boundary of the sweep are ignored. Returns `false` if the storage is insufficient, with `blockCount` and `predecessorCount` being the required capacity. Grow the storage and call again to continue.
+bool zydec_ControlFlowGraph_Build(ZydecControlFlowGraph *pGraph, const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t codeSize);
+
+// Returns the index of the block starting at `offset`, or `ZydecBasicBlockNone`.
+uint32_t zydec_ControlFlowGraph_FindBlock(const ZydecControlFlowGraph *pGraph, const size_t offset);
+
+// Determines the names at the start of every block, the entry (and every block without predecessors) starting with the names of the session. Registers keep their name along the edges and get a fresh name where the predecessors of a block disagree.
+// Blocks are advanced in `pOrder` until no names change anymore (`*pReachedFixedPoint`) or `maxPasses` passes have been made. `pPassCount` & `pReachedFixedPoint` may be `nullptr`. The session is left as it was.
+bool zydec_ControlFlowGraph_PropagateNames(ZydecControlFlowGraph *pGraph, ZydecLinearSession *pSession, const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t codeSize, const size_t virtualAddress, const size_t maxPasses, size_t *pPassCount, bool *pReachedFixedPoint);
+
+// Restores the session to the names at the start of the block, so that translating its instructions names them like the control flow leading into it does.
+// As every block starts from its own names, blocks can be translated in any order (or on separate sessions).
+bool zydec_ControlFlowGraph_BeginBlock(const ZydecControlFlowGraph *pGraph, const size_t blockIndex, ZydecLinearSession *pSession);
+
+////////////////////////////////////////////////////////////////////////////////
+
+// A natural loop: the header & every block that reaches one of the back-edges to it without passing through the header. Loops sharing a header are one loop.
+struct ZydecLoop
+{
+  uint32_t header; // block index of the entry of the loop, which dominates every block of it.
+  uint32_t parent; // index of the innermost loop containing this one, or `ZydecBasicBlockNone`.
+  uint32_t depth; // 1 for outermost loops.
+  uint32_t firstBlock; // index into `ZydecLoopForest::pLoopBlocks`.
+  uint32_t blockCount;
+  uint32_t firstExit; // index into `ZydecLoopForest::pExits`.
+  uint32_t exitCount;
+  uint32_t offset; // of the first instruction of the loop in the code.
+  uint32_t size; // up to the end of the last block of the loop. Blocks that aren't part of the loop may lie in between.
+};
+
+// Caller owned storage of the loops of a `ZydecControlFlowGraph`.
+struct ZydecLoopForest
+{
+  ZydecLoop *pLoops = nullptr; // ordered by the offset of their header.
+  size_t loopCount = 0;
+  size_t loopCapacity = 0;
+
+  uint32_t *pLoopBlocks = nullptr; // block indices in the order of the code, grouped by loop. Blocks of nested loops are listed for every loop containing them.
+  size_t loopBlockCount = 0;
+  size_t loopBlockCapacity = 0;
+
+  uint32_t *pExits = nullptr; // block indices outside of the loop that a block of the loop branches to, in the order of the code, grouped by loop.
+  size_t exitCount = 0;
+  size_t exitCapacity = 0;
+
+  uint32_t *pInnermostLoops = nullptr; // `blockCount` of the graph elements: index of the innermost loop containing each block, or `ZydecBasicBlockNone`.
+};
+
+// Finds the dominators, back-edges & natural loops of the graph. Returns `false` if the storage is insufficient, with `loopCount`, `loopBlockCount` and `exitCount` being the required capacity. Grow the storage and call again.
+// Loops that are only entered from outside of the entry's dominator tree (irreducible control flow) have no dominating header and are not found.
+bool zydec_LoopForest_Build(ZydecLoopForest *pForest, const ZydecControlFlowGraph *pGraph);
+
+// Returns whether the block is part of the loop, including being part of a loop nested in it.
+bool zydec_LoopForest_ContainsBlock(const ZydecLoopForest *pForest, const size_t loopIndex, const size_t blockIndex);
+
+// Returns the index of the innermost loop that is nested deepest, preferring the larger one (in bytes) of equally deep ones, or `ZydecBasicBlockNone` if there are no loops.
+uint32_t zydec_LoopForest_FindHotLoop(const ZydecLoopForest *pForest);
+
+// Determines the names at the start of every block of the loop (in `pGraph->pContexts`) as they are in the steady state of the loop: the header starts with the names the back-edges carry into it, rather than the ones coming from outside of the loop.
+// The first pass starts from the names of the session, which is left as it was. See `zydec_LinearSession_AnalyzeLoop`. `pPassCount` & `pReachedFixedPoint` may be `nullptr`.
+// Translate the blocks of the loop (in `pLoopBlocks`) after `zydec_ControlFlowGraph_BeginBlock` to render just the loop.
+bool zydec_LoopForest_PropagateLoopNames(const ZydecLoopForest *pForest, const size_t loopIndex, ZydecControlFlowGraph *pGraph, ZydecLinearSession *pSession, const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t codeSize, const size_t virtualAddress, const size_t maxPasses, size_t *pPassCount, bool *pReachedFixedPoint);
+
+////////////////////////////////////////////////////////////////////////////////
+
+static constexpr uint32_t ZydecValueNone = UINT32_MAX;
+
+enum ZydecValueKind : uint8_t
+{
+  zvk_definition, // written by `instruction`.
+  zvk_join, // of `inputs`, at the start of a block where the blocks leading into it disagree. `instruction` is the join at the start of the block.
+  zvk_unknown, // whatever the location held on entry, or after a call clobbered it. There is at most one per location.
+};
+
+struct ZydecValue
+{
+  uint32_t instruction; // index into `ZydecDefUseGraph::pInstructions`, `ZydecValueNone` for `zvk_unknown`.
+  uint32_t location; // `zydec_LinearContext_GetRegisterIndex` of the base register (xmm, ymm & zmm registers sharing the index of the xmm register), or `ZydecLinearContextRegisterCount` + the index into `ZydecDefUseGraph::pStackSlots`.
+  uint16_t reg; // `ZydisRegister` as it is named, e.g. the 64 bit register for general purpose registers or the base register of stack slots.
+  ZydecValueKind kind;
+  uint32_t name; // that the linear context gave the register (see `zydec_LinearContext_WriteRegisterName`), or 0 if the translation didn't name it.
+  uint32_t firstInput; // index into `ZydecDefUseGraph::pReferences`, for joins.
+  uint32_t inputCount;
+  uint32_t firstUse; // index into `ZydecDefUseGraph::pUses`.
+  uint32_t useCount;
+};
+
+struct ZydecDefUseInstruction
+{
+  uint32_t offset; // of the instruction in the code.
+  uint32_t block; // index into the control flow graph the def-use graph was built from.
+  uint32_t firstRead; // index into `ZydecDefUseGraph::pReferences`.
+  uint32_t firstDefinition; // index into `ZydecDefUseGraph::pReferences`.
+  uint16_t readCount;
+  uint16_t definitionCount;
+  uint16_t mnemonic; // `ZydisMnemonic`, `ZYDIS_MNEMONIC_INVALID` for joins & bytes that failed to decode.
+  uint8_t length; // 0 for the join of the values at the start of a block, which comes before the first instruction of the block.
+};
+
+// `[base + displacement]` with `size` bytes. Only matches accesses with the same base, displacement & size.
+struct ZydecStackSlot
+{
+  uint16_t base; // `ZydisRegister`, `rsp` or `rbp`.
+  uint16_t size;
+  int32_t displacement;
+};
+
+// Caller owned storage of the values every instruction reads & defines.
+struct ZydecDefUseGraph
+{
+  enum class MemoryTracking
+  {
+    None, // only registers & flags.
+    StackSlots, // `rsp` & `rbp` relative memory operands without index, assuming that they aren't accessed in any other way. Writing to the base register (apart from calls) forgets all of its slots.
+  };
+
+  MemoryTracking memoryTracking = MemoryTracking::None;
+
+  ZydecDefUseInstruction *pInstructions = nullptr; // in the order of the code.
+  size_t instructionCount = 0;
+  size_t instructionCapacity = 0;
+
+  ZydecValue *pValues = nullptr;
+  size_t valueCount = 0;
+  size_t valueCapacity = 0;
+
+  uint32_t *pReferences = nullptr; // value indices.
+  size_t referenceCount = 0;
+  size_t referenceCapacity = 0;
+
+  uint32_t *pUses = nullptr; // instruction indices, grouped by value.
+  size_t useCount = 0;
+  size_t useCapacity = 0;
+
+  ZydecStackSlot *pStackSlots = nullptr;
+  size_t stackSlotCount = 0;
+  size_t stackSlotCapacity = 0;
+};
+
+// Records the values that every instruction of `pCode` reads & defines, following them through the blocks of `pControlFlow` (built from the same code) & joining them where blocks disagree, including across loop back-edges.
+// Reads & writes come from the operands (including hidden ones like the flags), partial writes of general purpose registers & conditional writes also read the previous value. Calls clobber the registers that aren't retained by `afterCallRegisterRetentionMode` of the session.
+// If `pSession` isn't `nullptr`, values are named the way the session names them, starting every block with `pControlFlow->pContexts` if set (see `zydec_ControlFlowGraph_PropagateNames`, `zydec_LoopForest_PropagateLoopNames`). The session is left as it was.
+// Returns `false` if the storage is insufficient, with the counts being the required capacity. Grow the storage and call again.
+bool zydec_DefUseGraph_Build(ZydecDefUseGraph *pGraph, const ZydecControlFlowGraph *pControlFlow, ZydecLinearSession *pSession, const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t codeSize, const size_t virtualAddress);
+
+// Writes the graph as Graphviz DOT, with the instructions as nodes & an edge from the definition to every use of a value, labeled with its name. Returns `false` if `bufferCapacity` is insufficient.
+bool zydec_DefUseGraph_WriteDot(const ZydecDefUseGraph *pGraph, const size_t virtualAddress, char *buffer, const size_t bufferCapacity, size_t *pLength);
+
+// Writes the graph as JSON: `{"instructions": [{"address", "mnemonic", "block", "reads", "defines"}], "values": [{"location", "name", "kind", "instruction", "inputs", "uses"}]}`, referring to values & instructions by index. Returns `false` if `bufferCapacity` is insufficient.
+bool zydec_DefUseGraph_WriteJson(const ZydecDefUseGraph *pGraph, const size_t virtualAddress, char *buffer, const size_t bufferCapacity, size_t *pLength);
+
+////////////////////////////////////////////////////////////////////////////////
+
+enum ZydecMicroarchitecture : uint8_t
+{
+  zma_skylake, // including its client refreshes (Kaby Lake, Coffee Lake, Comet Lake) & Skylake-SP.
+  zma_iceLake, // including Tiger Lake.
+  zma_zen3,
+  zma_zen4,
+  zma_count,
+};
+
+// Returns the lower case name of the microarchitecture, e.g. `"skylake"`, or `nullptr`.
+const char * zydec_Microarchitecture_GetName(const ZydecMicroarchitecture microarchitecture);
+
+// Returns `false` if `name` isn't one of the names of `zydec_Microarchitecture_GetName`.
+bool zydec_Microarchitecture_FromName(const char *name, ZydecMicroarchitecture *pMicroarchitecture);
+
+// Version of the bundled latency & port tables, incremented whenever any of their values change.
+static constexpr uint32_t ZydecMicroarchitectureTableVersion = 1;
+
+static constexpr size_t ZydecMaxPortCount = 16;
+
+// Returns the number of execution ports of the microarchitecture, e.g. 8 for Skylake (`p0` to `p7`) or 11 for Zen 3 (4 integer ALUs, 3 AGUs and 4 floating point pipes).
+size_t zydec_Microarchitecture_GetPortCount(const ZydecMicroarchitecture microarchitecture);
+
+// Returns the name of the execution port, e.g. `"p5"` or `"fp1"`, or `nullptr`.
+const char * zydec_Microarchitecture_GetPortName(const ZydecMicroarchitecture microarchitecture, const size_t port);
+
+// Returns the number of fused domain uops the microarchitecture can issue per cycle.
+size_t zydec_Microarchitecture_GetIssueWidth(const ZydecMicroarchitecture microarchitecture);
+
+struct ZydecPortUsage
+{
+  uint16_t ports; // bit mask of the execution ports that can execute the uops.
+  uint8_t cycles; // that one of these ports is busy for, the number of uops for fully pipelined units.
+};
+
+// Approximate timing of an instruction, from tables of instruction classes (e.g. integer multiplication, floating point addition, lane crossing shuffle) rather than individual instructions.
+struct ZydecInstructionTiming
+{
+  uint8_t latency; // in cycles, from the register inputs to the results.
+  uint8_t loadLatency; // in cycles, added to `latency` for the address registers & the loaded value, 0 if the instruction doesn't read memory.
+  uint8_t storeForwardingLatency; // in cycles, added to `latency` for values that are loaded right after being stored.
+  uint8_t uopCount; // in the fused domain, that the front end has to issue.
+  uint8_t portUsageCount;
+  ZydecPortUsage portUsages[4]; // of the computation, loads & stores. Eliminated moves & zero idioms don't use any ports.
+};
+
+void zydec_Microarchitecture_GetInstructionTiming(const ZydecMicroarchitecture microarchitecture, const ZydisDecodedInstruction *pInstruction, const ZydisDecodedOperand *pOperands, ZydecInstructionTiming *pTiming);
+
+struct ZydecCriticalPathLink
+{
+  uint32_t instruction; // index into `ZydecDefUseGraph::pInstructions`.
+  uint32_t value; // that the instruction reads, continuing the chain.
+  uint32_t latency; // in cycles, that the instruction adds to the chain.
+};
+
+struct ZydecCriticalPath
+{
+  ZydecCriticalPathLink *pLinks = nullptr; // in the order of the chain, starting with the first instruction that reads `join`.
+  size_t linkCount = 0;
+  size_t linkCapacity = 0;
+
+  uint32_t join = ZydecValueNone; // at the start of the loop header, that the chain is carried around the loop through. `ZydecValueNone` if no value depends on itself from the previous iteration.
+  uint32_t cycles = 0; // latency of the chain, bounding how fast iterations of the loop can follow each other.
+};
+
+// Finds the longest chain of dependencies of the loop that is carried from one iteration to the next, through registers, flags and, if `pDefUse` tracks stack slots, values that are stored to & loaded from the stack again.
+// Latencies are taken from `zydec_Microarchitecture_GetInstructionTiming`. Only chains that lead back to the join they started with in a single iteration are considered, inner loops only contribute the path through them without iterating.
+// `pDefUse`, `pControlFlow` & `pForest` have to be built from `pCode`. Returns `false` if `linkCapacity` is insufficient, with `linkCount` being the required capacity. Grow the storage and call again.
+bool zydec_CriticalPath_Find(ZydecCriticalPath *pPath, const ZydecDefUseGraph *pDefUse, const ZydecControlFlowGraph *pControlFlow, const ZydecLoopForest *pForest, const size_t loopIndex, const ZydecMicroarchitecture microarchitecture, const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t codeSize);
+
+static constexpr uint8_t ZydecThroughputIssueBound = 0xFF;
+
+// Lower bound of the cycles a sequence of instructions takes when it's repeated back to back, limited by the execution ports and the width of the front end.
+struct ZydecThroughput
+{
+  double cycles = 0; // per iteration, the larger of `issueCycles` and the pressure on the busiest port.
+  double issueCycles = 0; // `uopCount` divided by the issue width.
+  double portCycles[ZydecMaxPortCount] = {}; // per iteration, with the uops that can execute on multiple ports spread out as evenly as possible.
+  uint32_t instructionCount = 0;
+  uint32_t uopCount = 0; // in the fused domain, with macro-fused compare & branch pairs counted once.
+  uint8_t bottleneckPort = ZydecThroughputIssueBound; // the busiest port, `ZydecThroughputIssueBound` if the front end limits the throughput instead.
+};
+
+// Estimates the throughput of the blocks `pBlocks` of `pControlFlow` as if every one of them executed once per iteration, e.g. a single block or all blocks of a loop (`ZydecLoopForest::pLoopBlocks`).
+// Dependencies aren't considered, see `zydec_CriticalPath_Find` for those. `pControlFlow` has to be built from `pCode`.
+bool zydec_Throughput_Estimate(ZydecThroughput *pThroughput, const ZydecControlFlowGraph *pControlFlow, const uint32_t *pBlocks, const size_t blockCount, const ZydecMicroarchitecture microarchitecture, const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t codeSize);
+
+////////////////////////////////////////////////////////////////////////////////
+
+struct ZydecCodeRange
+{
+  size_t offset; // in the code.
+  size_t size;
+};
+
+// Splits `pCode` into ranges of at least `minRangeSize` bytes (apart from the last one) that end at the start of a function, being the first instruction after a return or unconditional jump and any `int3` / `nop` padding following it.
+// Returns `false` if more than `rangeCapacity` ranges would be required.
+bool zydec_SplitCodeAtFunctionBoundaries(const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t codeSize, const size_t minRangeSize, ZydecCodeRange *pRanges, const size_t rangeCapacity, size_t *pRangeCount);
+
+// Splits `pCode` into ranges of about `rangeSize` bytes that start at the instruction boundaries a linear sweep from the start of the code finds, without having to decode all of the code serially.
+// Every range is decoded speculatively from its nominal start on `threadCount` threads (0 for one per hardware thread). The ranges are then stitched together where the speculative decoding runs into the true instruction boundaries, only decoding the mis-synchronized start of a range again.
+// `rangeSize` has to be at least `ZYDIS_MAX_INSTRUCTION_LENGTH`. Returns `false` if more than `rangeCapacity` ranges would be required, which never happens for at least `codeSize / rangeSize + 1`.
+bool zydec_SplitCodeParallel(const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t codeSize, const size_t rangeSize, const size_t threadCount, ZydecCodeRange *pRanges, const size_t rangeCapacity, size_t *pRangeCount);
+
+struct ZydecParallelTranslation
+{
+  const ZydisDecoder *pDecoder = nullptr;
+  const uint8_t *pCode = nullptr;
+  size_t codeSize = 0;
+  size_t virtualAddress = 0; // of `pCode`.
+
+  const ZydecCodeRange *pRanges = nullptr; // in ascending order.
+  size_t rangeCount = 0;
+
+  size_t threadCount = 0; // 0 for one per hardware thread.
+  bool linearContext = true; // if `true`, every range is translated with a freshly initialized `ZydecLinearSession`, otherwise without context. With `ZydecFormattingInfo::RegisterNamingMode::AddressSeeded`, the session first analyzes the code from the last function boundary before the range, so the output matches a serial translation. `Sequential` names start over in every range and don't match it.
+
+  // Called on the worker threads for every instruction of a range, with `pInstruction` & `pOperands` being `nullptr` for a byte that failed to decode. Appends the text of the instruction to the output of the range.
+  // Returns `false` if the text doesn't fit. If `nullptr`, the translation is written followed by a newline.
+  typedef bool WriteLineFunc(char **pBufferPos, size_t *pRemainingSize, const ZydisDecodedInstruction *pInstruction, const ZydisDecodedOperand *pOperands, const size_t virtualAddress, const char *translation, const bool hasTranslation, void *pUserData);
+  WriteLineFunc *pWriteLine = nullptr;
+
+  // Called on the calling thread with the output of every range, in the order of `pRanges`. Returning `false` stops the translation.
+  typedef bool EmitRangeFunc(const size_t rangeIndex, const char *text, const size_t length, void *pUserData);
+  EmitRangeFunc *pEmitRange = nullptr;
+
+  void *pUserData = nullptr;
+};
+
+// Translates the ranges on a pool of threads, emitting the results in order. Only a few ranges per thread are kept in flight, so memory doesn't grow with the size of the code.
+// The output only depends on the ranges, not on the number of threads. `pInfo->pResolveAddressToFriendlyName` & `pInfo->pReadConstantMemory` may be called from multiple threads at once.
+// With `ZydecFormattingInfo::RegisterNamingMode::AddressSeeded`, names restart at the heuristic function boundaries (after every return or unconditional jump, including the one at the end of an `if` branch), so they match a serial translation with the same naming mode, not one with `Sequential` names.
+bool zydec_TranslateParallel(const ZydecParallelTranslation *pTranslation, const ZydecFormattingInfo *pInfo);
+
+////////////////////////////////////////////////////////////////////////////////
+
+struct ZydecImageSection
+{
+  char name[64]; // null terminated, truncated if longer.
+  size_t virtualAddress;
+  const uint8_t *pData; // points into the image.
+  size_t size; // of the data stored in the image, which may be smaller than the section at runtime.
+  bool isExecutable;
+  bool isWritable;
+};
+
+struct ZydecImageSymbol
+{
+  size_t virtualAddress;
+  size_t size; // 0 if unknown.
+  const char *name; // null terminated, points into the image.
+};
+
+struct ZydecImageFunction
+{
+  size_t virtualAddress;
+  size_t size;
+};
+
+// Caller owned storage of the sections, symbols & function boundaries of an image. Everything points into the image, which has to outlive this.
+struct ZydecImage
+{
+  ZydecImageSection *pSections = nullptr; // in the order of the image.
+  size_t sectionCount = 0;
+  size_t sectionCapacity = 0;
+
+  ZydecImageSymbol *pSymbols = nullptr; // sorted by `virtualAddress`.
+  size_t symbolCount = 0;
+  size_t symbolCapacity = 0;
+
+  ZydecImageFunction *pFunctions = nullptr; // sorted by `virtualAddress`.
+  size_t functionCount = 0;
+  size_t functionCapacity = 0;
+
+  size_t entryPoint = 0;
+};
+
+// Returns `true` if `pFile` starts like an ELF64 x86-64 image.
+bool zydec_Image_IsElf64(const uint8_t *pFile, const size_t fileSize);
+
+// Returns `true` if `pFile` starts like a PE32+ x64 image.
+bool zydec_Image_IsPe64(const uint8_t *pFile, const size_t fileSize);
+
+// The loaders return `false` if the image is malformed or the storage is insufficient, with `sectionCount`, `symbolCount` and `functionCount` being the required capacity in the latter case. Grow the storage and call again to continue.
+
+// Parses an ELF64 x86-64 image (e.g. memory mapped), listing the allocated sections stored in the file and the function & object symbols of `.symtab` and `.dynsym`. Functions are the sized function symbols.
+bool zydec_Image_LoadElf64(ZydecImage *pImage, const uint8_t *pFile, const size_t fileSize);
+
+// Parses a PE32+ x64 image as it's stored on disk (e.g. memory mapped, on any platform), listing the sections stored in the file, the exports and the import address table entries, named after the functions they import.
+// Functions are the `RUNTIME_FUNCTION` entries of the exception directory (`.pdata`), so every function that may unwind is listed with its exact boundaries.
+// Export, import & exception directories that are truncated or malformed are skipped entirely. Only invalid headers & sections fail.
+bool zydec_Image_LoadPe64(ZydecImage *pImage, const uint8_t *pFile, const size_t fileSize);
+
+// Loads either kind of image.
+bool zydec_Image_Load(ZydecImage *pImage, const uint8_t *pFile, const size_t fileSize);
+
+// Returns the section containing `virtualAddress`, or `nullptr`.
+const ZydecImageSection * zydec_Image_FindSection(const ZydecImage *pImage, const size_t virtualAddress);
+
+// Returns the function containing `virtualAddress`, or `nullptr`.
+const ZydecImageFunction * zydec_Image_FindFunction(const ZydecImage *pImage, const size_t virtualAddress);
+
+// Splits the code at `codeVirtualAddress` (e.g. a section) into ranges of at least `minRangeSize` bytes (apart from the last one) that start at the beginning of a function of the image, to be translated with `zydec_TranslateParallel`.
+// Returns `false` if more than `rangeCapacity` ranges would be required, which never happens for at least `functionCount + 1`.
+bool zydec_Image_SplitCodeAtFunctions(const ZydecImage *pImage, const size_t codeVirtualAddress, const size_t codeSize, const size_t minRangeSize, ZydecCodeRange *pRanges, const size_t rangeCapacity, size_t *pRangeCount);
+
+// Returns the symbol containing `virtualAddress` (or starting there, if its size is unknown), or `nullptr`.
+const ZydecImageSymbol * zydec_Image_FindSymbol(const ZydecImage *pImage, const size_t virtualAddress);
+
+// Returns the first symbol called `name`, or `nullptr`.
+const ZydecImageSymbol * zydec_Image_FindSymbolByName(const ZydecImage *pImage, const char *name);
+
+// A `ZydecFormattingInfo::ResolveAddressToFriendlyName` with `pUserData` being the `const ZydecImage *`.
+bool zydec_Image_ResolveAddressToFriendlyName(const size_t virtualAddress, char *friendlyName, const size_t friendlyNameCapacity, size_t *pOffsetFromStart, void *pUserData);
+
+// A `ZydecFormattingInfo::ReadConstantMemoryFunc` with `pMemoryUserData` being the `const ZydecImage *`. Only reads from sections that aren't writable.
+bool zydec_Image_ReadConstantMemory(const size_t virtualAddress, void *pData, const size_t size, void *pMemoryUserData);
+
+// Resolves addresses to the symbols of `pImage` & reads vector constants from its read-only sections when translating with `pInfo`. Replaces `pInfo->pUserData` & `pInfo->pMemoryUserData`.
+void zydec_Image_AttachToFormattingInfo(const ZydecImage *pImage, ZydecFormattingInfo *pInfo);
+
+////////////////////////////////////////////////////////////////////////////////
+
+struct ZydecSymbolIndexEntry
+{
+  size_t virtualAddress;
+  size_t size; // 0 if unknown.
+  uint32_t nameOffset; // into `ZydecSymbolIndex::pNames`.
+  uint32_t nameLength;
+};
+
+// Recently resolved addresses (like loop back-edges & constant pools) that are looked up again skip the search.
+static constexpr size_t ZydecSymbolIndexCacheSize = 64;
+
+// Caller owned storage of an immutable index for resolving addresses to symbols.
+struct ZydecSymbolIndex
+{
+  ZydecSymbolIndexEntry *pEntries = nullptr; // sorted by `virtualAddress`.
+  size_t entryCount = 0;
+  size_t entryCapacity = 0; // `pSearchKeys` & `pSearchRanks` require `entryCapacity + 1` elements.
+
+  // The start addresses of the entries in Eytzinger order (the binary search tree laid out breadth first, starting at index 1), so that the first levels of every search share the same few cache lines.
+  size_t *pSearchKeys = nullptr;
+  uint32_t *pSearchRanks = nullptr; // index of the entry of every search key.
+
+  char *pNames = nullptr; // the null terminated names, every distinct name only being stored once.
+  size_t namesSize = 0;
+  size_t namesCapacity = 0;
+
+  std::atomic<uint64_t> cache[ZydecSymbolIndexCacheSize]; // low 32 bits of the address, entry index + 1.
+};
+
+// Builds the index from `symbolCount` symbols in any order, copying their names. Returns `false` if the storage is insufficient, with `entryCount` and `namesSize` being the required capacity. Grow the storage and call again to continue.
+bool zydec_SymbolIndex_Build(ZydecSymbolIndex *pIndex, const ZydecImageSymbol *pSymbols, const size_t symbolCount);
+
+// Returns the entry containing `virtualAddress` (or starting there, if its size is unknown), or `nullptr`. May be called from multiple threads at once.
+const ZydecSymbolIndexEntry * zydec_SymbolIndex_Find(ZydecSymbolIndex *pIndex, const size_t virtualAddress);
+
+const char * zydec_SymbolIndex_GetName(const ZydecSymbolIndex *pIndex, const ZydecSymbolIndexEntry *pEntry);
+
+// A `ZydecFormattingInfo::ResolveAddressToFriendlyName` with `pUserData` being the `ZydecSymbolIndex *`.
+bool zydec_SymbolIndex_ResolveAddressToFriendlyName(const size_t virtualAddress, char *friendlyName, const size_t friendlyNameCapacity, size_t *pOffsetFromStart, void *pUserData);
+
+// Resolves addresses with `pIndex` when translating with `pInfo`. Replaces `pInfo->pUserData`.
+void zydec_SymbolIndex_AttachToFormattingInfo(ZydecSymbolIndex *pIndex, ZydecFormattingInfo *pInfo);
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Every instruction of a batch may use up to this many characters (including the null terminator) of the arena.
+static constexpr size_t ZydecBatchInstructionCapacity = 1024;
+
+// Translates `instructionCount` instructions, sharing the formatting setup across the whole batch.
+// `pOperands` contains `operandCount` operands per instruction (currently requires all 10). If `pContext` is `nullptr`, the instructions are translated without context.
+// The null terminated translations are written back to back into `arena`, with instruction `i` starting at `arena + pOffsets[i]` and being `pLengths[i]` characters long. Bit `i % 64` of `pHasTranslation[i / 64]` is set if instruction `i` was translated.
+// Stops & returns `false` once fewer than `ZydecBatchInstructionCapacity` characters of the arena remain; `*pTranslatedCount` is the number of instructions that have been processed, so the batch can be continued from there with a fresh arena.
+bool zydec_TranslateInstructionBatch(ZydecLinearContext *pContext, const ZydisDecodedInstruction *pInstructions, const ZydisDecodedOperand *pOperands, const size_t operandCount, const size_t *pVirtualAddresses, const size_t instructionCount, char *arena, const size_t arenaCapacity, uint32_t *pOffsets, uint32_t *pLengths, uint64_t *pHasTranslation, size_t *pTranslatedCount, ZydecFormattingInfo *pInfo);
+
 #endif // zydec_h__
@@ -27,8 +27,17 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "zydec.h"
+#include "zydec_mnemonic_lut.h"
 
 #include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <xmmintrin.h>
+
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -36,24 +45,91 @@ enum ZydecOperandFlags_ : size_t
 {
   zof_none = 0,
   zof_noAddressDeref = 1 << 0,
+
+  // `rip` relative vector constants are rendered as `_mm_set_*` literals with this element type if `pReadConstantMemory` can read them, see `zydec_GetConstantFlags`.
+  zof_constantEpi8 = 1 << 1,
+  zof_constantEpi16 = 1 << 2,
+  zof_constantEpi32 = 1 << 3,
+  zof_constantEpi64 = 1 << 4,
+  zof_constantPs = 1 << 5,
+  zof_constantPd = 1 << 6,
+
+  zof_constantMask = zof_constantEpi8 | zof_constantEpi16 | zof_constantEpi32 | zof_constantEpi64 | zof_constantPs | zof_constantPd,
+
+  // Embedded broadcasts (`{1toN}`) are rendered as `_mm*_set1_*` of the constant element type for vectors of this width, see `zydec_GetBroadcastFlags`.
+  zof_broadcast128 = 1 << 7,
+  zof_broadcast256 = 1 << 8,
+  zof_broadcast512 = 1 << 9,
+
+  zof_broadcastMask = zof_broadcast128 | zof_broadcast256 | zof_broadcast512,
 };
 
 typedef size_t ZydecOperandFlags;
 
+// The translation is written through either of these, so that the text output doesn't have to check for tokens.
+struct ZydecTextWriter
+{
+  char *bufferPos;
+  size_t remainingSize;
+  uint16_t intrinsicStyle; // see `ztt_intrinsic`.
+};
+
+struct ZydecTokenWriter
+{
+  ZydecToken *pTokens;
+  size_t tokenCount; // may exceed `tokenCapacity`, in which case the surplus tokens have been dropped.
+  size_t tokenCapacity;
+  ZydisMnemonic mnemonic;
+  uint16_t intrinsicStyle; // see `ztt_intrinsic`.
+};
+
+// Only records the names of the registers in the order they would be written in, see `zydec_LinearSession_AnalyzeInstruction`. Records nothing if `pNames` is `nullptr`.
+struct ZydecNameWriter
+{
+  uint32_t *pNames;
+  size_t nameCount; // may exceed `nameCapacity`, in which case the surplus names have been dropped.
+  size_t nameCapacity;
+};
+
+// What translating an instruction with the linear context callbacks changes before `zydec_LinearContext_FinishInstruction`, see `zydec_LinearContext_SaveNamingState`.
+struct ZydecLinearContextNamingState
+{
+  ZydecLinearContext context;
+  size_t resultNameCount;
+  size_t assignedRegisterCount;
+  uint32_t assignedRegisterValue[ZydecLinearContextRegisterCount];
+  ZydisRegister regHint;
+  ZydecFormattingInfo::HintOperation opHint;
+  bool hasValHint;
+  int64_t valHint;
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 
 bool zydec_WriteRaw(char **pBufferPos, size_t *pRemainingSize, const char *text);
-bool zydec_WriteOperand(char **pBufferPos, size_t *pRemainingSize, const ZydisDecodedOperand *pOperand, const size_t virtualAddress, ZydecFormattingInfo *pInfo, const ZydecOperandFlags flags = zof_none, const bool isNewResult = false);
-bool zydec_WriteResultOperand(char **pBufferPos, size_t *pRemainingSize, const ZydisDecodedOperand *pOperand, const size_t virtualAddress, ZydecFormattingInfo *pInfo, const ZydecOperandFlags flags = zof_none);
+template <typename Writer> bool zydec_WriteOperand(Writer *pWriter, const ZydisDecodedOperand *pOperand, const size_t virtualAddress, ZydecFormattingInfo *pInfo, const ZydecOperandFlags flags = zof_none, const bool isNewResult = false);
+template <typename Writer> bool zydec_WriteResultOperand(Writer *pWriter, const ZydisDecodedOperand *pOperand, const size_t virtualAddress, ZydecFormattingInfo *pInfo, const ZydecOperandFlags flags = zof_none);
 void zydec_HintOperand(const ZydisDecodedOperand *pOperand, ZydecFormattingInfo *pInfo);
 void zydec_HintValue(const int64_t value, ZydecFormattingInfo *pInfo);
 void zydec_HintOp(const ZydecFormattingInfo::HintOperation op, ZydecFormattingInfo *pInfo);
-bool zydec_WriteRegister(char **pBufferPos, size_t *pRemainingSize, const ZydisRegister reg, ZydecFormattingInfo *pInfo, const bool isNewResult);
+ZydecOperandFlags zydec_GetConstantFlags(const ZydecLiteral intrinsic, const ZydisDecodedOperand *pOperand);
+ZydecOperandFlags zydec_GetBroadcastFlags(const ZydisDecodedInstruction *pInstruction, const ZydisDecodedOperand *pOperand, const ZydecOperandFlags constantFlags);
+bool zydec_ReadConstantOperand(const ZydisDecodedOperand *pOperand, const size_t virtualAddress, ZydecFormattingInfo *pInfo, uint8_t *pConstant);
+bool zydec_ReadVectorConstant(const ZydisDecodedOperand *pOperand, const size_t virtualAddress, ZydecFormattingInfo *pInfo, uint8_t *pConstant);
+template <typename Writer> bool zydec_WriteVectorConstant(Writer *pWriter, const uint8_t *pConstant, const size_t size, const size_t vectorSize, const ZydecOperandFlags flags);
+template <typename Writer> bool zydec_WriteBroadcast(Writer *pWriter, const ZydisDecodedOperand *pOperand, const size_t virtualAddress, ZydecFormattingInfo *pInfo, const ZydecOperandFlags flags);
+template <typename Writer> bool zydec_WriteRegister(Writer *pWriter, const ZydisRegister reg, ZydecFormattingInfo *pInfo, const bool isNewResult);
 bool zydec_WriteRegisterRaw(char **pBufferPos, size_t *pRemainingSize, const ZydisRegister reg);
 bool zydec_WriteHex(char **pBufferPos, size_t *pRemainingSize, const uint64_t value);
 bool zydec_WriteUInt(char **pBufferPos, size_t *pRemainingSize, const uint64_t value);
 bool zydec_WriteInt(char **pBufferPos, size_t *pRemainingSize, const int64_t value);
+bool zydec_WriteFloat(char **pBufferPos, size_t *pRemainingSize, const uint64_t bits, const bool isDouble);
+bool zydec_LinearContext_WriteRegisterName(char **pBufferPos, size_t *pRemainingSize, const ZydisRegister reg, const uint32_t registerName);
+uint32_t zydec_LinearContext_GetResultRegisterName(const ZydisRegister reg, void *pUserData);
+void zydec_LinearContext_SaveNamingState(const ZydecLinearContextFormatInfo *pFormatContextInfo, ZydecLinearContextNamingState *pState);
+void zydec_LinearContext_RestoreNamingState(ZydecLinearContextFormatInfo *pFormatContextInfo, const ZydecLinearContextNamingState *pState);
 ZydisRegister zydec_ResolveBaseRegister(const ZydisRegister reg);
+ZydecLiteral zydec_GetIrregularIntrinsic(const ZydisDecodedInstruction *pInstruction, const ZydisDecodedOperand *pOperands);
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -61,663 +137,619 @@ ZydisRegister zydec_ResolveBaseRegister(const ZydisRegister reg);
 
 ////////////////////////////////////////////////////////////////////////////////
 
-bool zydec_TranslateInstructionWithoutContext(const ZydisDecodedInstruction *pInstruction, const ZydisDecodedOperand *pOperands, const size_t operandCount, const size_t virtualAddress, char *buffer, const size_t bufferCapacity, bool *pHasTranslation, ZydecFormattingInfo *pInfo)
+// The low bits of the intrinsic style, the vector width (128, 256 or 512) is stored above them, see `ztt_intrinsic`.
+enum ZydecIntrinsicStyle : uint16_t
 {
-  if (pInstruction == nullptr || pOperands == nullptr || operandCount < 10 || buffer == nullptr || bufferCapacity == 0 || pHasTranslation == nullptr)
-    return false;
+  zis_widthSuffix = 1 << 0,
+  zis_mask = 1 << 1,
+  zis_maskz = 1 << 2,
+  zis_round = 1 << 3,
+  zis_mask3 = 1 << 4, // the mask is passed last & masked lanes keep the third operand (e.g. `_mm512_mask3_fmadd_ps(`).
+};
 
-  char *bufferPos = buffer;
-  size_t remainingSize = bufferCapacity - 1;
+// Indexed by the vector width (128, 256 or 512 bit).
+static constexpr ZydecLiteral IntrinsicWidthPrefixLut[] = { "_mm_", "_mm256_", "_mm512_" };
+static constexpr ZydecLiteral IntrinsicWidthSuffixLut[] = { "128(", "256(", "512(" };
 
-  *pHasTranslation = true;
-  bufferPos[0] = '\0';
+// Characters the pieces may be longer than the intrinsic: `_mm512_` instead of `_mm_`, `512(` instead of `(`, `maskz_` / `mask3_` and `_round`.
+static constexpr size_t IntrinsicStyleMaxGrowth = 3 + 3 + 6 + 6;
+static constexpr size_t IntrinsicStyleMaxPieces = 6;
 
-  const bool simplifyShorthands = pInfo == nullptr || pInfo->simplifyCommonShorthands;
-  const bool simplifySelfModification = pInfo == nullptr || pInfo->simplifyValueSelfModification;
+// Upper bound of the fixed text `zydec_TranslateInstruction` reserves for any instruction (shape, intrinsic & terminator of at most 68 characters each, operand separators, intrinsic styles & rounding), and the size of the scratch buffer that translations into small buffers are retried in.
+static constexpr size_t TranslationMaxReservedSize = 512;
+static constexpr size_t TranslationScratchCapacity = 1024 + TranslationMaxReservedSize;
 
-  switch (pInstruction->mnemonic)
-  {
-  case ZYDIS_MNEMONIC_MOV:
-  case ZYDIS_MNEMONIC_MOVBE:
-  case ZYDIS_MNEMONIC_MOVDIR64B:
-  case ZYDIS_MNEMONIC_MOVDIRI:
-  case ZYDIS_MNEMONIC_MOVLPD:
-  case ZYDIS_MNEMONIC_MOVLPS:
-  case ZYDIS_MNEMONIC_MOVNTI:
-  case ZYDIS_MNEMONIC_MOVNTQ:
-  case ZYDIS_MNEMONIC_MOVNTSD:
-  case ZYDIS_MNEMONIC_MOVNTSS:
-  case ZYDIS_MNEMONIC_MOVQ2DQ:
-  case ZYDIS_MNEMONIC_MOVSX:
-  case ZYDIS_MNEMONIC_MOVSXD:
-  case ZYDIS_MNEMONIC_MOVZX:
-  case ZYDIS_MNEMONIC_CBW:
-  case ZYDIS_MNEMONIC_CDQ:
-  case ZYDIS_MNEMONIC_CDQE:
-  case ZYDIS_MNEMONIC_CQO:
-  case ZYDIS_MNEMONIC_KMOVB:
-  case ZYDIS_MNEMONIC_KMOVD:
-  case ZYDIS_MNEMONIC_KMOVQ:
-  case ZYDIS_MNEMONIC_KMOVW:
+// Indexed by `ZydisRoundingMode`, `ZYDIS_ROUNDING_MODE_INVALID` being `{sae}` without a rounding mode.
+static constexpr ZydecLiteral RoundingArgumentLut[] =
+{
+  "_MM_FROUND_NO_EXC",
+  "_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC",
+  "_MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC",
+  "_MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC",
+  "_MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC",
+};
+
+// Splits `intrinsic` into the pieces it's rendered as for `style` (see `ztt_intrinsic`) & returns their count: the `_mm_` prefix is replaced with the one of the vector width and followed by the write mask variant, `si(` gets the width suffix if requested and `_round` goes in front of the floating point suffix (e.g. `_mm512_mask_add_round_ps(`) or behind `cvt`.
+inline size_t zydec_StyleIntrinsic(const ZydecLiteral intrinsic, const uint16_t style, ZydecLiteral *pPieces)
+{
+  if (style == 0 || intrinsic.text == nullptr)
   {
-    if (simplifyShorthands)
-    {
-      if (pInstruction->operand_count == 2 && pOperands[0].type == ZYDIS_OPERAND_TYPE_REGISTER && pOperands[1].type == ZYDIS_OPERAND_TYPE_REGISTER && pOperands[0].reg.value == pOperands[1].reg.value)
-      {
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "// nop"));
-        return true;
-      }
-    }
+    pPieces[0] = intrinsic;
+    return 1;
+  }
 
-    zydec_HintOp(ZydecFormattingInfo::Mov, pInfo);
-    zydec_HintOperand(&pOperands[1], pInfo);
+  const bool hasWidth = style >= 128;
+  const size_t widthIndex = (size_t)(style >> 8);
 
-    ERROR_CHECK(zydec_WriteResultOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = "));
-    
-    switch (pInstruction->mnemonic)
-    {
-    case ZYDIS_MNEMONIC_MOVBE:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "__byteswap("));
-      break;
+  ZydecLiteral body = intrinsic;
+  ZydecLiteral suffix = nullptr;
+  size_t count = 0;
 
-    case ZYDIS_MNEMONIC_MOVDIR64B:
-    case ZYDIS_MNEMONIC_MOVDIRI:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "__atomic_write("));
-      break;
+  if (body.length >= 4 && memcmp(body.text, "_mm_", 4) == 0)
+  {
+    pPieces[count++] = hasWidth ? IntrinsicWidthPrefixLut[widthIndex] : ZydecLiteral("_mm_");
+    body.text += 4;
+    body.length -= 4;
+
+    if (style & zis_maskz)
+      pPieces[count++] = "maskz_";
+    else if (style & zis_mask3)
+      pPieces[count++] = "mask3_";
+    else if (style & zis_mask)
+      pPieces[count++] = "mask_";
+  }
 
-    default:
-      break;
-    }
+  if (hasWidth && (style & zis_widthSuffix) && body.length >= 3 && memcmp(body.text + body.length - 3, "si(", 3) == 0)
+  {
+    suffix = IntrinsicWidthSuffixLut[widthIndex];
+    body.length--;
+  }
 
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[1], virtualAddress, pInfo));
+  if (style & zis_round)
+  {
+    size_t split = 0;
 
-    switch (pInstruction->mnemonic)
+    // Conversions name the rounding after `cvt` / `cvtt` (e.g. `_mm512_cvt_roundps_epi32(`), everything else before the floating point suffix.
+    if (body.length >= 4 && memcmp(body.text, "cvtt", 4) == 0)
     {
-    case ZYDIS_MNEMONIC_MOVBE:
-    case ZYDIS_MNEMONIC_MOVDIR64B:
-    case ZYDIS_MNEMONIC_MOVDIRI:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, ")"));
-      break;
-
-    case ZYDIS_MNEMONIC_MOVNTI:
-    case ZYDIS_MNEMONIC_MOVNTQ:
-    case ZYDIS_MNEMONIC_MOVNTSD:
-    case ZYDIS_MNEMONIC_MOVNTSS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "; // move with non-temporal hint"));
-      return true;
-
-    case ZYDIS_MNEMONIC_MOVSX:
-    case ZYDIS_MNEMONIC_MOVSXD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "; // move with sign extension"));
-      return true;
+      split = 4;
+    }
+    else if (body.length >= 3 && memcmp(body.text, "cvt", 3) == 0)
+    {
+      split = 3;
+    }
+    else if (body.length >= 4 && body.text[body.length - 4] == '_' && body.text[body.length - 1] == '(')
+    {
+      const char type = body.text[body.length - 3];
+      const char precision = body.text[body.length - 2];
 
-    default:
-      break;
+      if ((type == 'p' || type == 's') && (precision == 's' || precision == 'd' || precision == 'h'))
+        split = body.length - 4;
     }
-  
-    break;
-  }
-  
-  case ZYDIS_MNEMONIC_CMOVB:
-  case ZYDIS_MNEMONIC_CMOVBE:
-  case ZYDIS_MNEMONIC_CMOVL:
-  case ZYDIS_MNEMONIC_CMOVLE:
-  case ZYDIS_MNEMONIC_CMOVNB:
-  case ZYDIS_MNEMONIC_CMOVNBE:
-  case ZYDIS_MNEMONIC_CMOVNL:
-  case ZYDIS_MNEMONIC_CMOVNLE:
-  case ZYDIS_MNEMONIC_CMOVNO:
-  case ZYDIS_MNEMONIC_CMOVNP:
-  case ZYDIS_MNEMONIC_CMOVNS:
-  case ZYDIS_MNEMONIC_CMOVNZ:
-  case ZYDIS_MNEMONIC_CMOVO:
-  case ZYDIS_MNEMONIC_CMOVP:
-  case ZYDIS_MNEMONIC_CMOVS:
-  case ZYDIS_MNEMONIC_CMOVZ:
-  {
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "if ("));
 
-    switch (pInstruction->mnemonic)
+    if (split != 0)
     {
-    case ZYDIS_MNEMONIC_CMOVB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "carry_flag"));
-      break;
-
-    case ZYDIS_MNEMONIC_CMOVBE:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "carry_flag || zero_flag"));
-      break;
+      pPieces[count++] = ZydecLiteral(body.text, split);
+      pPieces[count++] = "_round";
+      body.text += split;
+      body.length -= split;
+    }
+  }
 
-    case ZYDIS_MNEMONIC_CMOVL:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "sign_flag != overflow_flag"));
-      break;
+  pPieces[count++] = body;
 
-    case ZYDIS_MNEMONIC_CMOVLE:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "zero_flag || sign_flag != overflow_flag"));
-      break;
+  if (suffix.text != nullptr)
+    pPieces[count++] = suffix;
 
-    case ZYDIS_MNEMONIC_CMOVNB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "!carry_flag"));
-      break;
+  return count;
+}
 
-    case ZYDIS_MNEMONIC_CMOVNBE:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "!carry_flag && !zero_flag"));
-      break;
+////////////////////////////////////////////////////////////////////////////////
 
-    case ZYDIS_MNEMONIC_CMOVNL:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "sign_flag == overflow_flag"));
-      break;
+inline bool zydec_WriteRaw(char **pBufferPos, size_t *pRemainingSize, const char *text, const size_t length)
+{
+  if (length > *pRemainingSize)
+    return false;
 
-    case ZYDIS_MNEMONIC_CMOVNLE:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "!zero_flag && sign_flag == overflow_flag"));
-      break;
+  memcpy(*pBufferPos, text, length);
 
-    case ZYDIS_MNEMONIC_CMOVNO:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "!overflow_flag"));
-      break;
+  (*pRemainingSize) -= length;
+  (*pBufferPos) += length;
+  **pBufferPos = '\0';
 
-    case ZYDIS_MNEMONIC_CMOVNP:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "!parity_flag"));
-      break;
+  return true;
+}
 
-    case ZYDIS_MNEMONIC_CMOVNS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "!sign_flag"));
-      break;
+inline bool zydec_WriteLiteral(char **pBufferPos, size_t *pRemainingSize, const ZydecLiteral text)
+{
+  return zydec_WriteRaw(pBufferPos, pRemainingSize, text.text, text.length);
+}
 
-    case ZYDIS_MNEMONIC_CMOVNZ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "!zero_flag"));
-      break;
+// Only for text that has been accounted for in `zydec_Reserve`.
+inline void zydec_WriteReserved(ZydecTextWriter *pWriter, const ZydecLiteral text)
+{
+  memcpy(pWriter->bufferPos, text.text, text.length);
 
-    case ZYDIS_MNEMONIC_CMOVO:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "overflow_flag"));
-      break;
+  pWriter->bufferPos += text.length;
+  *pWriter->bufferPos = '\0';
+}
 
-    case ZYDIS_MNEMONIC_CMOVP:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "parity_flag"));
-      break;
+inline bool zydec_Reserve(ZydecTextWriter *pWriter, const size_t reservedSize)
+{
+  if (reservedSize > pWriter->remainingSize)
+    return false;
 
-    case ZYDIS_MNEMONIC_CMOVS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "sign_flag"));
-      break;
+  pWriter->remainingSize -= reservedSize;
 
-    case ZYDIS_MNEMONIC_CMOVZ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "zero_flag"));
-      break;
+  return true;
+}
 
-    default:
-      break;
-    }
+inline void zydec_WriteIntrinsic(ZydecTextWriter *pWriter, const ZydecLiteral intrinsic)
+{
+  ZydecLiteral pieces[IntrinsicStyleMaxPieces];
+  const size_t pieceCount = zydec_StyleIntrinsic(intrinsic, pWriter->intrinsicStyle, pieces);
 
-    zydec_HintOp(ZydecFormattingInfo::ConditionalMov, pInfo);
-    zydec_HintOperand(&pOperands[1], pInfo);
+  for (size_t i = 0; i < pieceCount; i++)
+    zydec_WriteReserved(pWriter, pieces[i]);
+}
 
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, ") "));
-    ERROR_CHECK(zydec_WriteResultOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = "));
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[1], virtualAddress, pInfo));
+// Returns the previous style.
+inline uint16_t zydec_SetIntrinsicStyle(ZydecTextWriter *pWriter, const uint16_t style)
+{
+  const uint16_t previousStyle = pWriter->intrinsicStyle;
+  pWriter->intrinsicStyle = style;
 
-    switch (pInstruction->mnemonic)
-    {
-    case ZYDIS_MNEMONIC_CMOVB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "; // if below"));
-      break;
+  return previousStyle;
+}
 
-    case ZYDIS_MNEMONIC_CMOVBE:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "; // if below or equal"));
-      break;
+inline bool zydec_WriteLiteral(ZydecTextWriter *pWriter, const ZydecLiteral text)
+{
+  return zydec_WriteRaw(&pWriter->bufferPos, &pWriter->remainingSize, text.text, text.length);
+}
 
-    case ZYDIS_MNEMONIC_CMOVL:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "; // if less"));
-      break;
+inline bool zydec_WriteUInt(ZydecTextWriter *pWriter, const uint64_t value)
+{
+  return zydec_WriteUInt(&pWriter->bufferPos, &pWriter->remainingSize, value);
+}
 
-    case ZYDIS_MNEMONIC_CMOVLE:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "; // if less or equal"));
-      break;
+inline bool zydec_WriteInt(ZydecTextWriter *pWriter, const int64_t value)
+{
+  return zydec_WriteInt(&pWriter->bufferPos, &pWriter->remainingSize, value);
+}
 
-    case ZYDIS_MNEMONIC_CMOVNB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "; // if not below"));
-      break;
+inline bool zydec_WriteHex(ZydecTextWriter *pWriter, const uint64_t value)
+{
+  return zydec_WriteHex(&pWriter->bufferPos, &pWriter->remainingSize, value);
+}
 
-    case ZYDIS_MNEMONIC_CMOVNBE:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "; // if not below or equal"));
-      break;
+inline bool zydec_WriteSymbol(ZydecTextWriter *pWriter, const uint64_t /* address */, const char *friendlyName)
+{
+  return zydec_WriteRaw(&pWriter->bufferPos, &pWriter->remainingSize, friendlyName);
+}
 
-    case ZYDIS_MNEMONIC_CMOVNL:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "; // if not less"));
-      break;
+inline bool zydec_WriteFloat(ZydecTextWriter *pWriter, const uint64_t bits, const bool isDouble)
+{
+  return zydec_WriteFloat(&pWriter->bufferPos, &pWriter->remainingSize, bits, isDouble);
+}
 
-    case ZYDIS_MNEMONIC_CMOVNLE:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "; // if not less or equal"));
-      break;
+////////////////////////////////////////////////////////////////////////////////
 
-    case ZYDIS_MNEMONIC_CMOVNZ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "; // if not zero / not equal"));
-      break;
+inline bool zydec_WriteToken(ZydecTokenWriter *pWriter, const ZydecTokenType type, const uint16_t reg, const uint32_t id, const uint64_t value)
+{
+  if (pWriter->tokenCount < pWriter->tokenCapacity)
+  {
+    ZydecToken *pToken = &pWriter->pTokens[pWriter->tokenCount];
+    pToken->type = type;
+    pToken->reg = reg;
+    pToken->id = id;
+    pToken->length = 0;
+    pToken->value = value;
+  }
 
-    case ZYDIS_MNEMONIC_CMOVZ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "; // if zero / equal"));
-      break;
+  pWriter->tokenCount++;
 
-    default:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, ";"));
-      break;
-    }
+  return pWriter->tokenCount <= pWriter->tokenCapacity;
+}
 
-    return true;
+inline bool zydec_WriteTextToken(ZydecTokenWriter *pWriter, const ZydecTokenType type, const ZydecLiteral text)
+{
+  if (pWriter->tokenCount < pWriter->tokenCapacity)
+  {
+    ZydecToken *pToken = &pWriter->pTokens[pWriter->tokenCount];
+    pToken->type = type;
+    pToken->reg = ZYDIS_REGISTER_NONE;
+    pToken->id = type == ztt_punctuation ? 0 : (uint32_t)pWriter->mnemonic;
+    pToken->length = (uint32_t)text.length;
+    pToken->text = text.text;
   }
 
-  case ZYDIS_MNEMONIC_LEA:
-    zydec_HintOp(ZydecFormattingInfo::AddressOf, pInfo);
-    zydec_HintOperand(&pOperands[1], pInfo);
+  pWriter->tokenCount++;
 
-    ERROR_CHECK(zydec_WriteResultOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = &"));
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[1], virtualAddress, pInfo));
-    break;
+  return pWriter->tokenCount <= pWriter->tokenCapacity;
+}
 
-  case ZYDIS_MNEMONIC_TEST:
-  case ZYDIS_MNEMONIC_CMP:
+// Splits trailing comments off the punctuation, so that they get their own token.
+inline bool zydec_WriteLiteral(ZydecTokenWriter *pWriter, const ZydecLiteral text)
+{
+  for (size_t i = 0; i + 1 < text.length; i++)
   {
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "compare("));
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, ", "));
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[1], virtualAddress, pInfo));
-
-    if (pInstruction->mnemonic == ZYDIS_MNEMONIC_TEST)
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "); // set flags: carry, parity, zero"));
-    else if (pInstruction->mnemonic == ZYDIS_MNEMONIC_CMP)
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "); // set flags: carry, overflow, signed, zero, aux_carry and parity"));
-    else
-      return false;
+    if (text.text[i] == '/' && text.text[i + 1] == '/')
+    {
+      if (i > 0)
+        ERROR_CHECK(zydec_WriteTextToken(pWriter, ztt_punctuation, ZydecLiteral(text.text, i)));
 
-    return true;
+      return zydec_WriteTextToken(pWriter, ztt_comment, ZydecLiteral(text.text + i, text.length - i));
+    }
   }
 
-  case ZYDIS_MNEMONIC_CALL:
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "("));
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, ")()"));
+  return zydec_WriteTextToken(pWriter, ztt_punctuation, text);
+}
 
-    if (pInfo != nullptr && pInfo->pAfterCall != nullptr)
-      pInfo->pAfterCall(pInfo->pCallUserData);
+// Running out of tokens is caught by `zydec_TranslateInstructionToTokens`.
+inline void zydec_WriteReserved(ZydecTokenWriter *pWriter, const ZydecLiteral text)
+{
+  zydec_WriteLiteral(pWriter, text);
+}
 
-    break;
+inline bool zydec_Reserve(ZydecTokenWriter * /* pWriter */, const size_t /* reservedSize */)
+{
+  return true;
+}
 
-  case ZYDIS_MNEMONIC_JMP:
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "goto "));
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-    break;
+inline void zydec_WriteIntrinsic(ZydecTokenWriter *pWriter, const ZydecLiteral intrinsic)
+{
+  if (zydec_WriteTextToken(pWriter, ztt_intrinsic, intrinsic))
+    pWriter->pTokens[pWriter->tokenCount - 1].reg = pWriter->intrinsicStyle;
+}
 
-  case ZYDIS_MNEMONIC_JB:
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "if (carry_flag) goto "));
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "; // if below"));
-    return true;
+inline uint16_t zydec_SetIntrinsicStyle(ZydecTokenWriter *pWriter, const uint16_t style)
+{
+  const uint16_t previousStyle = pWriter->intrinsicStyle;
+  pWriter->intrinsicStyle = style;
 
-  case ZYDIS_MNEMONIC_JBE:
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "if (carry_flag || zero_flag) goto "));
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "; // if below or equal"));
-    return true;
+  return previousStyle;
+}
 
-  case ZYDIS_MNEMONIC_JCXZ:
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "if ((u16)c == 0) goto "));
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-    break;
+inline bool zydec_WriteUInt(ZydecTokenWriter *pWriter, const uint64_t value)
+{
+  return zydec_WriteToken(pWriter, ztt_unsignedImmediate, ZYDIS_REGISTER_NONE, 0, value);
+}
 
-  case ZYDIS_MNEMONIC_JECXZ:
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "if ((u32)c == 0) goto "));
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-    break;
+inline bool zydec_WriteInt(ZydecTokenWriter *pWriter, const int64_t value)
+{
+  return zydec_WriteToken(pWriter, ztt_signedImmediate, ZYDIS_REGISTER_NONE, 0, (uint64_t)value);
+}
 
-  case ZYDIS_MNEMONIC_JL:
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "if (sign_flag != overflow_flag) goto "));
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "; // if less"));
-    return true;
+inline bool zydec_WriteHex(ZydecTokenWriter *pWriter, const uint64_t value)
+{
+  return zydec_WriteToken(pWriter, ztt_address, ZYDIS_REGISTER_NONE, 0, value);
+}
 
-  case ZYDIS_MNEMONIC_JLE:
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "if (zero_flag || sign_flag != overflow_flag) goto "));
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "; // if less or equal"));
-    return true;
+inline bool zydec_WriteSymbol(ZydecTokenWriter *pWriter, const uint64_t address, const char * /* friendlyName */)
+{
+  return zydec_WriteToken(pWriter, ztt_symbol, ZYDIS_REGISTER_NONE, 0, address);
+}
 
-  case ZYDIS_MNEMONIC_JNB:
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "if (!carry_flag) goto "));
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "; // if not below"));
-    return true;
+inline bool zydec_WriteFloat(ZydecTokenWriter *pWriter, const uint64_t bits, const bool isDouble)
+{
+  return zydec_WriteToken(pWriter, ztt_floatImmediate, ZYDIS_REGISTER_NONE, isDouble ? 64 : 32, bits);
+}
 
-  case ZYDIS_MNEMONIC_JNBE:
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "if (!carry_flag && !zero_flag) goto "));
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "; // if not below or equal"));
-    return true;
+////////////////////////////////////////////////////////////////////////////////
 
-  case ZYDIS_MNEMONIC_JNL:
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "if (sign_flag && overflow_flag) goto "));
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "; // if not less"));
-    return true;
+inline void zydec_WriteReserved(ZydecNameWriter * /* pWriter */, const ZydecLiteral /* text */)
+{
+}
 
-  case ZYDIS_MNEMONIC_JNLE:
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "if (!zero_flag && sign_flag == overflow_flag) goto "));
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "; // if not less or equal"));
-    return true;
+inline bool zydec_Reserve(ZydecNameWriter * /* pWriter */, const size_t /* reservedSize */)
+{
+  return true;
+}
 
-  case ZYDIS_MNEMONIC_JNO:
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "if (!overflow_flag) goto "));
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-    break;
+inline void zydec_WriteIntrinsic(ZydecNameWriter * /* pWriter */, const ZydecLiteral /* intrinsic */)
+{
+}
 
-  case ZYDIS_MNEMONIC_JNP:
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "if (!parity_flag) goto "));
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-    break;
+inline uint16_t zydec_SetIntrinsicStyle(ZydecNameWriter * /* pWriter */, const uint16_t /* style */)
+{
+  return 0;
+}
 
-  case ZYDIS_MNEMONIC_JNS:
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "if (!sign_flag) goto "));
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-    break;
+inline bool zydec_WriteLiteral(ZydecNameWriter * /* pWriter */, const ZydecLiteral /* text */)
+{
+  return true;
+}
 
-  case ZYDIS_MNEMONIC_JNZ:
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "if (!zero_flag) goto "));
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "; // if not zero / not equal"));
-    return true;
+inline bool zydec_WriteUInt(ZydecNameWriter * /* pWriter */, const uint64_t /* value */)
+{
+  return true;
+}
 
-  case ZYDIS_MNEMONIC_JO:
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "if (overflow_flag) goto "));
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-    break;
+inline bool zydec_WriteInt(ZydecNameWriter * /* pWriter */, const int64_t /* value */)
+{
+  return true;
+}
 
-  case ZYDIS_MNEMONIC_JP:
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "if (parity_flag) goto "));
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-    break;
+inline bool zydec_WriteHex(ZydecNameWriter * /* pWriter */, const uint64_t /* value */)
+{
+  return true;
+}
 
-  case ZYDIS_MNEMONIC_JS:
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "if (sign_flag) goto "));
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-    break;
+inline bool zydec_WriteSymbol(ZydecNameWriter * /* pWriter */, const uint64_t /* address */, const char * /* friendlyName */)
+{
+  return true;
+}
 
-  case ZYDIS_MNEMONIC_JZ:
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "if (zero_flag) goto "));
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "; // if zero / equal"));
-    return true;
+inline bool zydec_WriteFloat(ZydecNameWriter * /* pWriter */, const uint64_t /* bits */, const bool /* isDouble */)
+{
+  return true;
+}
 
-  case ZYDIS_MNEMONIC_NOP:
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "// nop"));
-    return true;
 
-  case ZYDIS_MNEMONIC_ADD:
-  case ZYDIS_MNEMONIC_ADC:
-  case ZYDIS_MNEMONIC_ADCX:
-  case ZYDIS_MNEMONIC_ADOX:
-  case ZYDIS_MNEMONIC_FADD:
-  case ZYDIS_MNEMONIC_FADDP:
-  case ZYDIS_MNEMONIC_SUB:
-  case ZYDIS_MNEMONIC_AND:
-  case ZYDIS_MNEMONIC_OR:
-  case ZYDIS_MNEMONIC_XOR:
-  case ZYDIS_MNEMONIC_ANDN:
-  case ZYDIS_MNEMONIC_INC:
-  case ZYDIS_MNEMONIC_DEC:
-  case ZYDIS_MNEMONIC_FISUB:
-  case ZYDIS_MNEMONIC_SHL:
-  case ZYDIS_MNEMONIC_SHLX:
-  case ZYDIS_MNEMONIC_SHLD:
-  case ZYDIS_MNEMONIC_SHR:
-  case ZYDIS_MNEMONIC_SHRX:
-  case ZYDIS_MNEMONIC_SHRD:
-  case ZYDIS_MNEMONIC_SALC:
-  case ZYDIS_MNEMONIC_SAR:
-  case ZYDIS_MNEMONIC_SARX:
-  {
-    if (simplifyShorthands)
-    {
-      if (pInstruction->operand_count == 3 /* yes, 3! who knows why. */ && pOperands[0].type == ZYDIS_OPERAND_TYPE_REGISTER && pOperands[1].type == ZYDIS_OPERAND_TYPE_REGISTER && pOperands[0].reg.value == pOperands[1].reg.value)
-      {
-        bool match = false;
+////////////////////////////////////////////////////////////////////////////////
 
-        switch (pInstruction->mnemonic)
-        {
-        case ZYDIS_MNEMONIC_AND:
-        case ZYDIS_MNEMONIC_OR:
-          match = true;
-          ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "// nop"));
-          break;
+template <typename Writer>
+bool zydec_TranslateInstruction(Writer *pWriter, const ZydisDecodedInstruction *pInstruction, const ZydisDecodedOperand *pOperands, const size_t instructionAddress, bool *pHasTranslation, ZydecFormattingInfo *pInfo)
+{
+  *pHasTranslation = true;
 
-        case ZYDIS_MNEMONIC_XOR:
-          zydec_HintValue(0, pInfo);
-          ERROR_CHECK(zydec_WriteResultOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-          ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = 0;"));
-          match = true;
-          break;
+  // Relative operands are relative to the end of the instruction.
+  const size_t virtualAddress = instructionAddress + pInstruction->length;
 
-        default:
-          break;
-        }
+  const bool simplifyShorthands = pInfo == nullptr || pInfo->simplifyCommonShorthands;
+  const bool simplifySelfModification = pInfo == nullptr || pInfo->simplifyValueSelfModification;
 
-        if (match)
-          return true;
-      }
-    }
+  if ((size_t)pInstruction->mnemonic > ZYDIS_MNEMONIC_MAX_VALUE || MnemonicInfoLut[pInstruction->mnemonic].shape == zms_none)
+  {
+    *pHasTranslation = false;
+    return false;
+  }
 
-    switch (pInstruction->mnemonic)
+  const ZydecMnemonicInfo *pMnemonicInfo = &MnemonicInfoLut[pInstruction->mnemonic];
+  ZydecLiteral intrinsic = pMnemonicInfo->intrinsic;
+  ZydecLiteral terminator = pMnemonicInfo->terminator;
+
+  if (intrinsic.text == nullptr && pMnemonicInfo->shape == zms_vector)
+    intrinsic = zydec_GetIrregularIntrinsic(pInstruction, pOperands);
+
+  // Like the intrinsics themselves, the prefix follows the widest vector register.
+  uint16_t intrinsicStyle = 0;
+
+  if (pInfo == nullptr || pInfo->widthCorrectIntrinsics)
+  {
+    for (size_t i = 0; i < pInstruction->operand_count; i++)
     {
-    case ZYDIS_MNEMONIC_ADD:
-    case ZYDIS_MNEMONIC_ADC:
-    case ZYDIS_MNEMONIC_ADCX:
-    case ZYDIS_MNEMONIC_ADOX:
-    case ZYDIS_MNEMONIC_FADD:
-    case ZYDIS_MNEMONIC_FADDP:
-      zydec_HintOp(ZydecFormattingInfo::Add, pInfo);
-      break;
+      if (pOperands[i].type != ZYDIS_OPERAND_TYPE_REGISTER)
+        continue;
 
-    case ZYDIS_MNEMONIC_SUB:
-    case ZYDIS_MNEMONIC_FISUB:
-      zydec_HintOp(ZydecFormattingInfo::Sub, pInfo);
+      const ZydisRegister reg = pOperands[i].reg.value;
 
-    case ZYDIS_MNEMONIC_AND:
-      zydec_HintOp(ZydecFormattingInfo::And, pInfo);
-      break;
+      if (reg >= ZYDIS_REGISTER_ZMM0 && reg <= ZYDIS_REGISTER_ZMM31)
+        intrinsicStyle = 512;
+      else if (reg >= ZYDIS_REGISTER_YMM0 && reg <= ZYDIS_REGISTER_YMM31 && intrinsicStyle < 256)
+        intrinsicStyle = 256;
+      else if (reg >= ZYDIS_REGISTER_XMM0 && reg <= ZYDIS_REGISTER_XMM31 && intrinsicStyle < 128)
+        intrinsicStyle = 128;
+    }
 
-    case ZYDIS_MNEMONIC_ANDN:
-      zydec_HintOp(ZydecFormattingInfo::AndNot, pInfo);
-      break;
+    if (intrinsicStyle != 0 && (pMnemonicInfo->flags & zmf_widthSuffix))
+      intrinsicStyle |= zis_widthSuffix;
+  }
 
-    case ZYDIS_MNEMONIC_OR:
-      zydec_HintOp(ZydecFormattingInfo::Or, pInfo);
-      break;
+  // EVEX encoded instructions list their write mask as the second operand, even if it's `k0` (no masking).
+  const bool isVectorShape = pMnemonicInfo->shape == zms_vector || pMnemonicInfo->shape == zms_vectorMove;
+  const bool hasMaskOperand = isVectorShape && pInstruction->operand_count > 2 && pOperands[1].type == ZYDIS_OPERAND_TYPE_REGISTER && pOperands[1].encoding == ZYDIS_OPERAND_ENCODING_MASK;
+  const size_t sourceOperandIndex = hasMaskOperand ? 2 : 1;
+  uint16_t maskStyle = 0;
+  bool mergesDestination = false;
 
-    case ZYDIS_MNEMONIC_XOR:
-      zydec_HintOp(ZydecFormattingInfo::XOr, pInfo);
-      break;
+  if (hasMaskOperand && pOperands[1].reg.value != ZYDIS_REGISTER_K0)
+  {
+    const bool isMaskDestination = pOperands[0].type == ZYDIS_OPERAND_TYPE_REGISTER && pOperands[0].reg.value >= ZYDIS_REGISTER_K0 && pOperands[0].reg.value <= ZYDIS_REGISTER_K7;
 
-    case ZYDIS_MNEMONIC_INC:
-      zydec_HintOp(ZydecFormattingInfo::Inc, pInfo);
-      return true;
+    switch (pInstruction->avx.mask.mode)
+    {
+    case ZYDIS_MASK_MODE_MERGING:
+      maskStyle = zis_mask;
+      mergesDestination = pOperands[0].type == ZYDIS_OPERAND_TYPE_REGISTER;
+      break;
 
-    case ZYDIS_MNEMONIC_DEC:
-      zydec_HintOp(ZydecFormattingInfo::Dec, pInfo);
-      return true;
+    // Comparisons into mask registers zero the masked bits, but are still the `mask_` variant.
+    case ZYDIS_MASK_MODE_ZEROING:
+      maskStyle = isMaskDestination ? zis_mask : zis_maskz;
+      break;
 
-    case ZYDIS_MNEMONIC_SHL:
-    case ZYDIS_MNEMONIC_SHLX:
-    case ZYDIS_MNEMONIC_SHLD:
-    case ZYDIS_MNEMONIC_SALC:
-      zydec_HintOp(ZydecFormattingInfo::ShL, pInfo);
+    case ZYDIS_MASK_MODE_CONTROL:
+      maskStyle = zis_mask;
       break;
 
-    case ZYDIS_MNEMONIC_SHR:
-    case ZYDIS_MNEMONIC_SHRX:
-    case ZYDIS_MNEMONIC_SHRD:
-    case ZYDIS_MNEMONIC_SAR:
-    case ZYDIS_MNEMONIC_SARX:
-      zydec_HintOp(ZydecFormattingInfo::ShR, pInfo);
+    case ZYDIS_MASK_MODE_CONTROL_ZEROING:
+      maskStyle = zis_maskz;
       break;
 
     default:
       break;
     }
+  }
 
-    ERROR_CHECK(zydec_WriteResultOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
+  // Fused multiply-adds pass their operands in the order of their form. Merging keeps the destination in masked lanes, which is the addend of the 231 form & passed last by the `mask3_` variant.
+  const ZydecFusedOperandOrder fusedOperandOrder = (pMnemonicInfo->shape == zms_vector && pInstruction->operand_count == sourceOperandIndex + 2) ? (ZydecFusedOperandOrder)pMnemonicInfo->param : zfo_none;
 
-    if (simplifySelfModification)
-    {
-      switch (pInstruction->mnemonic)
-      {
-      case ZYDIS_MNEMONIC_ADD:
-      case ZYDIS_MNEMONIC_ADC:
-      case ZYDIS_MNEMONIC_ADCX:
-      case ZYDIS_MNEMONIC_ADOX:
-      case ZYDIS_MNEMONIC_FADD:
-      case ZYDIS_MNEMONIC_FADDP:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " += "));
-        break;
+  if (fusedOperandOrder == zfo_231 && mergesDestination)
+  {
+    maskStyle = zis_mask3;
+    mergesDestination = false;
+  }
 
-      case ZYDIS_MNEMONIC_SUB:
-      case ZYDIS_MNEMONIC_FISUB:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " -= "));
-        break;
+  // Embedded rounding & suppressed exceptions are passed as the last argument of the `_round` variant.
+  ZydecLiteral roundingArgument = nullptr;
 
-      case ZYDIS_MNEMONIC_AND:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " &= "));
-        break;
+  if (isVectorShape && (pInstruction->avx.rounding.mode != ZYDIS_ROUNDING_MODE_INVALID || pInstruction->avx.has_sae) && (size_t)pInstruction->avx.rounding.mode < sizeof(RoundingArgumentLut) / sizeof(RoundingArgumentLut[0]))
+  {
+    roundingArgument = RoundingArgumentLut[pInstruction->avx.rounding.mode];
+    intrinsicStyle |= zis_round;
+  }
 
-      case ZYDIS_MNEMONIC_ANDN:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " &= ~"));
-        break;
+  intrinsicStyle |= maskStyle;
 
-      case ZYDIS_MNEMONIC_OR:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " |= "));
-        break;
+  zydec_SetIntrinsicStyle(pWriter, intrinsicStyle);
 
-      case ZYDIS_MNEMONIC_XOR:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " ^= "));
-        break;
+  // Reserve the worst case for all fixed text up front, so that only operands have to be bounds checked while writing. `zms_vectorMove` may write two styled intrinsics.
+  const size_t separatorCount = (pMnemonicInfo->shape == zms_function && pMnemonicInfo->param != zma_allOperands) ? pMnemonicInfo->param : pInstruction->operand_count;
+  const size_t reservedSize = MnemonicShapeReserveLut[pMnemonicInfo->shape] + intrinsic.length + terminator.length + 2 * separatorCount + (intrinsicStyle != 0 ? 2 * IntrinsicStyleMaxGrowth : 0) + (roundingArgument.length != 0 ? 2 + roundingArgument.length : 0);
 
-      case ZYDIS_MNEMONIC_INC:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "++;"));
-        return true;
+  if (!zydec_Reserve(pWriter, reservedSize))
+    return false;
 
-      case ZYDIS_MNEMONIC_DEC:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "--;"));
-        return true;
+  switch (pMnemonicInfo->shape)
+  {
+  case zms_function:
+  {
+    const size_t arity = pMnemonicInfo->param == zma_allOperands ? pInstruction->operand_count : pMnemonicInfo->param;
 
-      case ZYDIS_MNEMONIC_SHL:
-      case ZYDIS_MNEMONIC_SHLX:
-      case ZYDIS_MNEMONIC_SHLD:
-      case ZYDIS_MNEMONIC_SALC:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " <<= "));
-        break;
+    zydec_WriteIntrinsic(pWriter, intrinsic);
 
-      case ZYDIS_MNEMONIC_SHR:
-      case ZYDIS_MNEMONIC_SHRX:
-      case ZYDIS_MNEMONIC_SHRD:
-      case ZYDIS_MNEMONIC_SAR:
-      case ZYDIS_MNEMONIC_SARX:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " >>= "));
-        break;
+    for (size_t operandIndex = 0; operandIndex < arity; operandIndex++)
+    {
+      if (operandIndex > 0)
+        zydec_WriteReserved(pWriter, ", ");
 
-      default:
-        break;
-      }
+      ERROR_CHECK(zydec_WriteOperand(pWriter, &pOperands[operandIndex], virtualAddress, pInfo));
     }
-    else
-    {
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = "));
-      ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
 
-      switch (pInstruction->mnemonic)
+    if ((pMnemonicInfo->flags & zmf_afterCall) && pInfo != nullptr && pInfo->pAfterCall != nullptr)
+      pInfo->pAfterCall(pInfo->pCallUserData);
+
+    break;
+  }
+
+  case zms_assign:
+  {
+    if (simplifyShorthands && (pMnemonicInfo->flags & zmf_sameRegisterNop))
+    {
+      if (pInstruction->operand_count == 2 && pOperands[0].type == ZYDIS_OPERAND_TYPE_REGISTER && pOperands[1].type == ZYDIS_OPERAND_TYPE_REGISTER && pOperands[0].reg.value == pOperands[1].reg.value)
       {
-      case ZYDIS_MNEMONIC_ADD:
-      case ZYDIS_MNEMONIC_ADC:
-      case ZYDIS_MNEMONIC_ADCX:
-      case ZYDIS_MNEMONIC_ADOX:
-      case ZYDIS_MNEMONIC_FADD:
-      case ZYDIS_MNEMONIC_FADDP:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " + "));
-        break;
+        zydec_WriteReserved(pWriter, "// nop");
+        return true;
+      }
+    }
 
-      case ZYDIS_MNEMONIC_SUB:
-      case ZYDIS_MNEMONIC_FISUB:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " - "));
-        break;
+    zydec_HintOp((ZydecFormattingInfo::HintOperation)pMnemonicInfo->hint, pInfo);
 
-      case ZYDIS_MNEMONIC_AND:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " & "));
-        break;
+    if (pMnemonicInfo->flags & zmf_hintSource)
+      zydec_HintOperand(&pOperands[1], pInfo);
 
-      case ZYDIS_MNEMONIC_ANDN:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " & ~"));
-        break;
+    ERROR_CHECK(zydec_WriteResultOperand(pWriter, &pOperands[0], virtualAddress, pInfo));
+    zydec_WriteReserved(pWriter, " = ");
 
-      case ZYDIS_MNEMONIC_OR:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " | "));
-        break;
+    if (intrinsic.text != nullptr)
+      zydec_WriteIntrinsic(pWriter, intrinsic);
 
-      case ZYDIS_MNEMONIC_XOR:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " ^ "));
-        break;
+    if (pMnemonicInfo->param == 1)
+      ERROR_CHECK(zydec_WriteOperand(pWriter, &pOperands[1], virtualAddress, pInfo));
 
-      case ZYDIS_MNEMONIC_INC:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "+ 1;"));
-        return true;
+    break;
+  }
 
-      case ZYDIS_MNEMONIC_DEC:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "- 1;"));
-        return true;
+  case zms_conditionalMove:
+  {
+    zydec_WriteReserved(pWriter, "if (");
+    zydec_WriteIntrinsic(pWriter, intrinsic);
 
-      case ZYDIS_MNEMONIC_SHL:
-      case ZYDIS_MNEMONIC_SHLX:
-      case ZYDIS_MNEMONIC_SHLD:
-      case ZYDIS_MNEMONIC_SALC:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " << "));
-        break;
+    zydec_HintOp(ZydecFormattingInfo::ConditionalMov, pInfo);
+    zydec_HintOperand(&pOperands[1], pInfo);
 
-      case ZYDIS_MNEMONIC_SHR:
-      case ZYDIS_MNEMONIC_SHRX:
-      case ZYDIS_MNEMONIC_SHRD:
-      case ZYDIS_MNEMONIC_SAR:
-      case ZYDIS_MNEMONIC_SARX:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " >> "));
-        break;
+    zydec_WriteReserved(pWriter, ") ");
+    ERROR_CHECK(zydec_WriteResultOperand(pWriter, &pOperands[0], virtualAddress, pInfo));
+    zydec_WriteReserved(pWriter, " = ");
+    ERROR_CHECK(zydec_WriteOperand(pWriter, &pOperands[1], virtualAddress, pInfo));
+    break;
+  }
 
-      default:
-        break;
+  case zms_arithmetic:
+  {
+    if (simplifyShorthands)
+    {
+      if (pInstruction->operand_count == 3 /* yes, 3! who knows why. */ && pOperands[0].type == ZYDIS_OPERAND_TYPE_REGISTER && pOperands[1].type == ZYDIS_OPERAND_TYPE_REGISTER && pOperands[0].reg.value == pOperands[1].reg.value)
+      {
+        if (pMnemonicInfo->flags & zmf_sameRegisterNop)
+        {
+          zydec_WriteReserved(pWriter, "// nop");
+          return true;
+        }
+        else if (pMnemonicInfo->flags & zmf_sameRegisterZero)
+        {
+          zydec_HintValue(0, pInfo);
+          ERROR_CHECK(zydec_WriteResultOperand(pWriter, &pOperands[0], virtualAddress, pInfo));
+          zydec_WriteReserved(pWriter, " = 0;");
+          return true;
+        }
       }
     }
 
-    if (pInstruction->operand_count > 1)
-      ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[1], virtualAddress, pInfo));
+    zydec_HintOp((ZydecFormattingInfo::HintOperation)pMnemonicInfo->hint, pInfo);
 
-    switch (pInstruction->mnemonic)
+    // INC / DEC only hint the operation for now.
+    if (pMnemonicInfo->param == zop_None)
+      return true;
+
+    const ZydecMnemonicOperatorInfo *pOperator = &MnemonicOperatorLut[pMnemonicInfo->param];
+
+    ERROR_CHECK(zydec_WriteResultOperand(pWriter, &pOperands[0], virtualAddress, pInfo));
+
+    if (simplifySelfModification)
     {
-    case ZYDIS_MNEMONIC_ADC:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " + carry_flag"));
-      break;
+      zydec_WriteReserved(pWriter, pOperator->compoundAssignment);
+    }
+    else
+    {
+      zydec_WriteReserved(pWriter, " = ");
+      ERROR_CHECK(zydec_WriteOperand(pWriter, &pOperands[0], virtualAddress, pInfo));
+      zydec_WriteReserved(pWriter, pOperator->binary);
+    }
 
-    case ZYDIS_MNEMONIC_ADCX:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " + carry_flag; // unsigned integer add with carry_flag"));
-      return true;
+    if (pInstruction->operand_count > 1)
+      ERROR_CHECK(zydec_WriteOperand(pWriter, &pOperands[1], virtualAddress, pInfo));
 
-    case ZYDIS_MNEMONIC_ADOX:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " + overflow_flag; // unsigned integer add with overflow_flag"));
-      return true;
+    break;
+  }
 
-    default:
-      break;
+  case zms_maskArithmetic:
+  {
+    zydec_HintOp((ZydecFormattingInfo::HintOperation)pMnemonicInfo->hint, pInfo);
+
+    if (simplifyShorthands)
+    {
+      if (pInstruction->operand_count == 3 && pOperands[1].type == ZYDIS_OPERAND_TYPE_REGISTER && pOperands[2].type == ZYDIS_OPERAND_TYPE_REGISTER && pOperands[1].reg.value == pOperands[2].reg.value)
+      {
+        if (pMnemonicInfo->flags & zmf_sameRegisterAssign)
+        {
+          zydec_HintOperand(&pOperands[1], pInfo);
+          ERROR_CHECK(zydec_WriteResultOperand(pWriter, &pOperands[0], virtualAddress, pInfo));
+          zydec_WriteReserved(pWriter, " = ");
+          ERROR_CHECK(zydec_WriteResultOperand(pWriter, &pOperands[1], virtualAddress, pInfo));
+          zydec_WriteReserved(pWriter, ";");
+          return true;
+        }
+        else if (pMnemonicInfo->flags & zmf_sameRegisterZero)
+        {
+          zydec_HintValue(0, pInfo);
+          ERROR_CHECK(zydec_WriteResultOperand(pWriter, &pOperands[0], virtualAddress, pInfo));
+          zydec_WriteReserved(pWriter, " = 0;");
+          return true;
+        }
+      }
     }
 
+    ERROR_CHECK(zydec_WriteResultOperand(pWriter, &pOperands[0], virtualAddress, pInfo));
+    zydec_WriteReserved(pWriter, " = ");
+    ERROR_CHECK(zydec_WriteOperand(pWriter, &pOperands[1], virtualAddress, pInfo));
+    zydec_WriteReserved(pWriter, MnemonicOperatorLut[pMnemonicInfo->param].binary);
+    ERROR_CHECK(zydec_WriteOperand(pWriter, &pOperands[2], virtualAddress, pInfo));
     break;
   }
 
-  case ZYDIS_MNEMONIC_MUL:
-  case ZYDIS_MNEMONIC_IMUL:
+  case zms_multiply:
   {
     zydec_HintOp(ZydecFormattingInfo::Mul, pInfo);
 
@@ -725,159 +757,148 @@ bool zydec_TranslateInstructionWithoutContext(const ZydisDecodedInstruction *pIn
     {
       if (pOperands[0].element_size < 16)
       {
-        ERROR_CHECK(zydec_WriteRegister(&bufferPos, &remainingSize, ZYDIS_REGISTER_AX, pInfo, true));
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = "));
-        ERROR_CHECK(zydec_WriteRegister(&bufferPos, &remainingSize, ZYDIS_REGISTER_AL, pInfo, false));
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " * "));
+        ERROR_CHECK(zydec_WriteRegister(pWriter, ZYDIS_REGISTER_AX, pInfo, true));
+        zydec_WriteReserved(pWriter, " = ");
+        ERROR_CHECK(zydec_WriteRegister(pWriter, ZYDIS_REGISTER_AL, pInfo, false));
+        zydec_WriteReserved(pWriter, " * ");
       }
       else if (pOperands[0].element_size < 32)
       {
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "["));
-        ERROR_CHECK(zydec_WriteRegister(&bufferPos, &remainingSize, ZYDIS_REGISTER_DX, pInfo, true));
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, ", "));
-        ERROR_CHECK(zydec_WriteRegister(&bufferPos, &remainingSize, ZYDIS_REGISTER_AX, pInfo, true));
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "] = "));
-        ERROR_CHECK(zydec_WriteRegister(&bufferPos, &remainingSize, ZYDIS_REGISTER_AX, pInfo, false));
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " * "));
+        zydec_WriteReserved(pWriter, "[");
+        ERROR_CHECK(zydec_WriteRegister(pWriter, ZYDIS_REGISTER_DX, pInfo, true));
+        zydec_WriteReserved(pWriter, ", ");
+        ERROR_CHECK(zydec_WriteRegister(pWriter, ZYDIS_REGISTER_AX, pInfo, true));
+        zydec_WriteReserved(pWriter, "] = ");
+        ERROR_CHECK(zydec_WriteRegister(pWriter, ZYDIS_REGISTER_AX, pInfo, false));
+        zydec_WriteReserved(pWriter, " * ");
       }
       else if (pOperands[0].element_size < 64)
       {
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "["));
-        ERROR_CHECK(zydec_WriteRegister(&bufferPos, &remainingSize, ZYDIS_REGISTER_EDX, pInfo, true));
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, ", "));
-        ERROR_CHECK(zydec_WriteRegister(&bufferPos, &remainingSize, ZYDIS_REGISTER_EAX, pInfo, true));
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "] = "));
-        ERROR_CHECK(zydec_WriteRegister(&bufferPos, &remainingSize, ZYDIS_REGISTER_EAX, pInfo, false));
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " * "));
+        zydec_WriteReserved(pWriter, "[");
+        ERROR_CHECK(zydec_WriteRegister(pWriter, ZYDIS_REGISTER_EDX, pInfo, true));
+        zydec_WriteReserved(pWriter, ", ");
+        ERROR_CHECK(zydec_WriteRegister(pWriter, ZYDIS_REGISTER_EAX, pInfo, true));
+        zydec_WriteReserved(pWriter, "] = ");
+        ERROR_CHECK(zydec_WriteRegister(pWriter, ZYDIS_REGISTER_EAX, pInfo, false));
+        zydec_WriteReserved(pWriter, " * ");
       }
       else
       {
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "["));
-        ERROR_CHECK(zydec_WriteRegister(&bufferPos, &remainingSize, ZYDIS_REGISTER_RDX, pInfo, true));
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, ", "));
-        ERROR_CHECK(zydec_WriteRegister(&bufferPos, &remainingSize, ZYDIS_REGISTER_RAX, pInfo, true));
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "] = "));
-        ERROR_CHECK(zydec_WriteRegister(&bufferPos, &remainingSize, ZYDIS_REGISTER_RAX, pInfo, false));
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " * "));
+        zydec_WriteReserved(pWriter, "[");
+        ERROR_CHECK(zydec_WriteRegister(pWriter, ZYDIS_REGISTER_RDX, pInfo, true));
+        zydec_WriteReserved(pWriter, ", ");
+        ERROR_CHECK(zydec_WriteRegister(pWriter, ZYDIS_REGISTER_RAX, pInfo, true));
+        zydec_WriteReserved(pWriter, "] = ");
+        ERROR_CHECK(zydec_WriteRegister(pWriter, ZYDIS_REGISTER_RAX, pInfo, false));
+        zydec_WriteReserved(pWriter, " * ");
       }
 
-      ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
+      ERROR_CHECK(zydec_WriteOperand(pWriter, &pOperands[0], virtualAddress, pInfo));
     }
     else if (pInstruction->operand_count == 2)
     {
-      ERROR_CHECK(zydec_WriteResultOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
+      ERROR_CHECK(zydec_WriteResultOperand(pWriter, &pOperands[0], virtualAddress, pInfo));
       
       if (simplifySelfModification)
       {
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " *= "));
+        zydec_WriteReserved(pWriter, " *= ");
       }
       else
       {
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = "));
-        ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " * "));
+        zydec_WriteReserved(pWriter, " = ");
+        ERROR_CHECK(zydec_WriteOperand(pWriter, &pOperands[0], virtualAddress, pInfo));
+        zydec_WriteReserved(pWriter, " * ");
       }
 
-      ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[1], virtualAddress, pInfo));
+      ERROR_CHECK(zydec_WriteOperand(pWriter, &pOperands[1], virtualAddress, pInfo));
     }
     else
     {
-      ERROR_CHECK(zydec_WriteResultOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = "));
-      ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[1], virtualAddress, pInfo));
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " * "));
-      ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[2], virtualAddress, pInfo));
-    }
-
-    switch (pInstruction->mnemonic)
-    {
-    case ZYDIS_MNEMONIC_DIV:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "; // unsigned integer multiply"));
-    case ZYDIS_MNEMONIC_IDIV:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "; // signed integer multiply"));
-    default:
-      break;
+      ERROR_CHECK(zydec_WriteResultOperand(pWriter, &pOperands[0], virtualAddress, pInfo));
+      zydec_WriteReserved(pWriter, " = ");
+      ERROR_CHECK(zydec_WriteOperand(pWriter, &pOperands[1], virtualAddress, pInfo));
+      zydec_WriteReserved(pWriter, " * ");
+      ERROR_CHECK(zydec_WriteOperand(pWriter, &pOperands[2], virtualAddress, pInfo));
     }
 
     return true;
   }
 
-  case ZYDIS_MNEMONIC_DIV:
-  case ZYDIS_MNEMONIC_IDIV:
+  case zms_divide:
   {
     zydec_HintOp(ZydecFormattingInfo::Div, pInfo);
 
     if (pOperands[0].element_size < 16)
     {
-      ERROR_CHECK(zydec_WriteRegister(&bufferPos, &remainingSize, ZYDIS_REGISTER_AL, pInfo, true));
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = "));
-      ERROR_CHECK(zydec_WriteRegister(&bufferPos, &remainingSize, ZYDIS_REGISTER_AX, pInfo, false));
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " / "));
+      ERROR_CHECK(zydec_WriteRegister(pWriter, ZYDIS_REGISTER_AL, pInfo, true));
+      zydec_WriteReserved(pWriter, " = ");
+      ERROR_CHECK(zydec_WriteRegister(pWriter, ZYDIS_REGISTER_AX, pInfo, false));
+      zydec_WriteReserved(pWriter, " / ");
     }
     else if (pOperands[0].element_size < 32)
     {
-      ERROR_CHECK(zydec_WriteRegister(&bufferPos, &remainingSize, ZYDIS_REGISTER_AX, pInfo, true));
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = "));
-      ERROR_CHECK(zydec_WriteRegister(&bufferPos, &remainingSize, ZYDIS_REGISTER_AX, pInfo, false));
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " / "));
+      ERROR_CHECK(zydec_WriteRegister(pWriter, ZYDIS_REGISTER_AX, pInfo, true));
+      zydec_WriteReserved(pWriter, " = ");
+      ERROR_CHECK(zydec_WriteRegister(pWriter, ZYDIS_REGISTER_AX, pInfo, false));
+      zydec_WriteReserved(pWriter, " / ");
     }
     else if (pOperands[0].element_size < 64)
     {
-      ERROR_CHECK(zydec_WriteRegister(&bufferPos, &remainingSize, ZYDIS_REGISTER_EAX, pInfo, true));
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = "));
-      ERROR_CHECK(zydec_WriteRegister(&bufferPos, &remainingSize, ZYDIS_REGISTER_EAX, pInfo, false));
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " / "));
+      ERROR_CHECK(zydec_WriteRegister(pWriter, ZYDIS_REGISTER_EAX, pInfo, true));
+      zydec_WriteReserved(pWriter, " = ");
+      ERROR_CHECK(zydec_WriteRegister(pWriter, ZYDIS_REGISTER_EAX, pInfo, false));
+      zydec_WriteReserved(pWriter, " / ");
     }
     else
     {
-      ERROR_CHECK(zydec_WriteRegister(&bufferPos, &remainingSize, ZYDIS_REGISTER_RAX, pInfo, true));
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = "));
-      ERROR_CHECK(zydec_WriteRegister(&bufferPos, &remainingSize, ZYDIS_REGISTER_RAX, pInfo, false));
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " / "));
+      ERROR_CHECK(zydec_WriteRegister(pWriter, ZYDIS_REGISTER_RAX, pInfo, true));
+      zydec_WriteReserved(pWriter, " = ");
+      ERROR_CHECK(zydec_WriteRegister(pWriter, ZYDIS_REGISTER_RAX, pInfo, false));
+      zydec_WriteReserved(pWriter, " / ");
     }
 
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "; "));
+    ERROR_CHECK(zydec_WriteOperand(pWriter, &pOperands[0], virtualAddress, pInfo));
+    zydec_WriteReserved(pWriter, "; ");
 
     zydec_HintOp(ZydecFormattingInfo::Mod, pInfo);
 
     if (pOperands[0].element_size < 16)
     {
-      ERROR_CHECK(zydec_WriteRegister(&bufferPos, &remainingSize, ZYDIS_REGISTER_AH, pInfo, true));
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = "));
-      ERROR_CHECK(zydec_WriteRegister(&bufferPos, &remainingSize, ZYDIS_REGISTER_AX, pInfo, false));
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " % "));
+      ERROR_CHECK(zydec_WriteRegister(pWriter, ZYDIS_REGISTER_AH, pInfo, true));
+      zydec_WriteReserved(pWriter, " = ");
+      ERROR_CHECK(zydec_WriteRegister(pWriter, ZYDIS_REGISTER_AX, pInfo, false));
+      zydec_WriteReserved(pWriter, " % ");
     }
     else if (pOperands[0].element_size < 32)
     {
-      ERROR_CHECK(zydec_WriteRegister(&bufferPos, &remainingSize, ZYDIS_REGISTER_DX, pInfo, true));
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = "));
-      ERROR_CHECK(zydec_WriteRegister(&bufferPos, &remainingSize, ZYDIS_REGISTER_AX, pInfo, false));
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " % "));
+      ERROR_CHECK(zydec_WriteRegister(pWriter, ZYDIS_REGISTER_DX, pInfo, true));
+      zydec_WriteReserved(pWriter, " = ");
+      ERROR_CHECK(zydec_WriteRegister(pWriter, ZYDIS_REGISTER_AX, pInfo, false));
+      zydec_WriteReserved(pWriter, " % ");
     }
     else if (pOperands[0].element_size < 64)
     {
-      ERROR_CHECK(zydec_WriteRegister(&bufferPos, &remainingSize, ZYDIS_REGISTER_EDX, pInfo, true));
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = "));
-      ERROR_CHECK(zydec_WriteRegister(&bufferPos, &remainingSize, ZYDIS_REGISTER_EAX, pInfo, false));
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " % "));
+      ERROR_CHECK(zydec_WriteRegister(pWriter, ZYDIS_REGISTER_EDX, pInfo, true));
+      zydec_WriteReserved(pWriter, " = ");
+      ERROR_CHECK(zydec_WriteRegister(pWriter, ZYDIS_REGISTER_EAX, pInfo, false));
+      zydec_WriteReserved(pWriter, " % ");
     }
     else
     {
-      ERROR_CHECK(zydec_WriteRegister(&bufferPos, &remainingSize, ZYDIS_REGISTER_RDX, pInfo, true));
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = "));
-      ERROR_CHECK(zydec_WriteRegister(&bufferPos, &remainingSize, ZYDIS_REGISTER_RAX, pInfo, false));
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " % "));
+      ERROR_CHECK(zydec_WriteRegister(pWriter, ZYDIS_REGISTER_RDX, pInfo, true));
+      zydec_WriteReserved(pWriter, " = ");
+      ERROR_CHECK(zydec_WriteRegister(pWriter, ZYDIS_REGISTER_RAX, pInfo, false));
+      zydec_WriteReserved(pWriter, " % ");
     }
 
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
+    ERROR_CHECK(zydec_WriteOperand(pWriter, &pOperands[0], virtualAddress, pInfo));
 
     switch (pInstruction->mnemonic)
     {
     case ZYDIS_MNEMONIC_DIV:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "; // unsigned integer divide"));
+      zydec_WriteReserved(pWriter, "; // unsigned integer divide");
     case ZYDIS_MNEMONIC_IDIV:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "; // signed integer divide"));
+      zydec_WriteReserved(pWriter, "; // signed integer divide");
     default:
       break;
     }
@@ -885,6083 +906,5876 @@ bool zydec_TranslateInstructionWithoutContext(const ZydisDecodedInstruction *pIn
     return true;
   }
 
-  case ZYDIS_MNEMONIC_RET:
-  {
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "return"));
-    break;
-  }
-
-  case ZYDIS_MNEMONIC_INT3:
+  case zms_vectorMove:
   {
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "__builtin_trap(); // __debugbreak();"));
-    return true;
-  }
+    zydec_HintOp(ZydecFormattingInfo::Mov, pInfo);
+    zydec_HintOperand(&pOperands[sourceOperandIndex], pInfo);
 
-  case ZYDIS_MNEMONIC_SETB:
-  case ZYDIS_MNEMONIC_SETBE:
-  case ZYDIS_MNEMONIC_SETL:
-  case ZYDIS_MNEMONIC_SETLE:
-  case ZYDIS_MNEMONIC_SETNB:
-  case ZYDIS_MNEMONIC_SETNBE:
-  case ZYDIS_MNEMONIC_SETNL:
-  case ZYDIS_MNEMONIC_SETNLE:
-  case ZYDIS_MNEMONIC_SETNO:
-  case ZYDIS_MNEMONIC_SETNP:
-  case ZYDIS_MNEMONIC_SETNS:
-  case ZYDIS_MNEMONIC_SETNZ:
-  case ZYDIS_MNEMONIC_SETO:
-  case ZYDIS_MNEMONIC_SETP:
-  case ZYDIS_MNEMONIC_SETS:
-  case ZYDIS_MNEMONIC_SETZ:
-  {
-    zydec_HintOp(ZydecFormattingInfo::Set, pInfo);
-
-    ERROR_CHECK(zydec_WriteResultOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = ("));
+    const bool aligned = !!(pMnemonicInfo->flags & zmf_aligned);
+    const bool isStore = pOperands[0].type == ZYDIS_OPERAND_TYPE_MEMORY || pOperands[0].type == ZYDIS_OPERAND_TYPE_POINTER;
+    const bool isLoad = !isStore && (pOperands[sourceOperandIndex].type == ZYDIS_OPERAND_TYPE_MEMORY || pOperands[sourceOperandIndex].type == ZYDIS_OPERAND_TYPE_POINTER);
+    const bool isPlainMove = maskStyle == 0 && pInstruction->operand_count == sourceOperandIndex + 1;
 
-    switch (pInstruction->mnemonic)
+    if (isStore)
     {
-    case ZYDIS_MNEMONIC_SETB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "carry_flag"));
-      break;
-
-    case ZYDIS_MNEMONIC_SETBE:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "(carry_flag || zero_flag)"));
-      break;
+      zydec_WriteIntrinsic(pWriter, aligned ? ZydecLiteral("_mm_aligned_store") : ZydecLiteral("_mm_unaligned_store"));
+    }
+    else if (isLoad)
+    {
+      uint8_t constant[64];
 
-    case ZYDIS_MNEMONIC_SETL:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "sign_flag != overflow_flag"));
-      break;
+      // Loading a constant is just an assignment of its value.
+      if (isPlainMove && zydec_ReadVectorConstant(&pOperands[sourceOperandIndex], virtualAddress, pInfo, constant))
+      {
+        ERROR_CHECK(zydec_WriteResultOperand(pWriter, &pOperands[0], virtualAddress, pInfo));
+        zydec_WriteReserved(pWriter, " = ");
+        ERROR_CHECK(zydec_WriteVectorConstant(pWriter, constant, pOperands[sourceOperandIndex].size / 8, pOperands[sourceOperandIndex].size / 8, zydec_GetConstantFlags(intrinsic, &pOperands[sourceOperandIndex])));
+        zydec_WriteReserved(pWriter, ";");
 
-    case ZYDIS_MNEMONIC_SETLE:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "(zero_flag || sign_flag != overflow_flag)"));
-      break;
+        return true;
+      }
 
-    case ZYDIS_MNEMONIC_SETNB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "!carry_flag"));
-      break;
+      ERROR_CHECK(zydec_WriteResultOperand(pWriter, &pOperands[0], virtualAddress, pInfo, zof_noAddressDeref));
+      zydec_WriteReserved(pWriter, " = ");
+      zydec_WriteIntrinsic(pWriter, aligned ? ZydecLiteral("_mm_aligned_load") : ZydecLiteral("_mm_unaligned_load"));
+    }
+    else if (isPlainMove)
+    {
+      ERROR_CHECK(zydec_WriteOperand(pWriter, &pOperands[0], virtualAddress, pInfo, zof_noAddressDeref, true));
+      zydec_WriteReserved(pWriter, " = ");
+      ERROR_CHECK(zydec_WriteOperand(pWriter, &pOperands[sourceOperandIndex], virtualAddress, pInfo, zof_noAddressDeref));
 
-    case ZYDIS_MNEMONIC_SETNBE:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "(!carry_flag && !zero_flag)"));
       break;
+    }
+    else
+    {
+      ERROR_CHECK(zydec_WriteResultOperand(pWriter, &pOperands[0], virtualAddress, pInfo, zof_noAddressDeref));
+      zydec_WriteReserved(pWriter, " = ");
+      zydec_WriteIntrinsic(pWriter, "_mm_mov");
+    }
 
-    case ZYDIS_MNEMONIC_SETNL:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "sign_flag == overflow_flag"));
-      break;
+    zydec_WriteIntrinsic(pWriter, intrinsic);
 
-    case ZYDIS_MNEMONIC_SETNLE:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "(!zero_flag && sign_flag == overflow_flag)"));
-      break;
+    // Stores take the address first, merging masks the previous value of the destination.
+    size_t argumentCount = 0;
 
-    case ZYDIS_MNEMONIC_SETNO:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "!overflow_flag"));
-      break;
+    if (isStore || mergesDestination)
+    {
+      ERROR_CHECK(zydec_WriteOperand(pWriter, &pOperands[0], virtualAddress, pInfo, zof_noAddressDeref));
+      argumentCount++;
+    }
 
-    case ZYDIS_MNEMONIC_SETNP:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "!parity_flag"));
-      break;
+    if (maskStyle != 0)
+    {
+      if (argumentCount++ > 0)
+        zydec_WriteReserved(pWriter, ", ");
 
-    case ZYDIS_MNEMONIC_SETNS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "!sign_flag"));
-      break;
+      ERROR_CHECK(zydec_WriteOperand(pWriter, &pOperands[1], virtualAddress, pInfo));
+    }
 
-    case ZYDIS_MNEMONIC_SETNZ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "!zero_flag"));
-      break;
+    for (size_t operandIndex = sourceOperandIndex; operandIndex < pInstruction->operand_count; operandIndex++)
+    {
+      if (argumentCount++ > 0)
+        zydec_WriteReserved(pWriter, ", ");
 
-    case ZYDIS_MNEMONIC_SETO:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "overflow_flag"));
-      break;
+      ERROR_CHECK(zydec_WriteOperand(pWriter, &pOperands[operandIndex], virtualAddress, pInfo, zof_noAddressDeref));
+    }
 
-    case ZYDIS_MNEMONIC_SETP:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "parity_flag"));
-      break;
+    zydec_WriteReserved(pWriter, ")");
 
-    case ZYDIS_MNEMONIC_SETS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "sign_flag"));
-      break;
+    break;
+  }
 
-    case ZYDIS_MNEMONIC_SETZ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "zero_flag"));
-      break;
+  case zms_vector:
+  {
+    if (simplifyShorthands)
+    {
+      // Masked lanes keep (or zero) their previous value, so only unmasked instructions are shorthands.
+      const ZydisDecodedOperand *pSources = &pOperands[sourceOperandIndex];
 
-    default:
-      break;
+      if (maskStyle == 0 && pInstruction->operand_count == sourceOperandIndex + 2 && pSources[0].type == ZYDIS_OPERAND_TYPE_REGISTER && pSources[1].type == ZYDIS_OPERAND_TYPE_REGISTER && pSources[0].reg.value == pSources[1].reg.value)
+      {
+        if (pMnemonicInfo->flags & zmf_sameRegisterAssign)
+        {
+          zydec_HintOperand(&pSources[0], pInfo);
+          ERROR_CHECK(zydec_WriteResultOperand(pWriter, &pOperands[0], virtualAddress, pInfo));
+          zydec_WriteReserved(pWriter, " = ");
+          ERROR_CHECK(zydec_WriteRegister(pWriter, pSources[0].reg.value, pInfo, false));
+          zydec_WriteReserved(pWriter, ";");
+          return true;
+        }
+        else if (pMnemonicInfo->flags & zmf_sameRegisterZero)
+        {
+          zydec_HintValue(0, pInfo);
+          ERROR_CHECK(zydec_WriteResultOperand(pWriter, &pOperands[0], virtualAddress, pInfo));
+          zydec_WriteReserved(pWriter, " = 0;");
+          return true;
+        }
+        else if (pMnemonicInfo->flags & zmf_sameRegisterAllOnes)
+        {
+          zydec_HintValue((int64_t)-1, pInfo);
+          ERROR_CHECK(zydec_WriteResultOperand(pWriter, &pOperands[0], virtualAddress, pInfo));
+          zydec_WriteReserved(pWriter, " = -1;");
+          return true;
+        }
+      }
     }
 
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " ? 1 : 0);"));
-
-    switch (pInstruction->mnemonic)
+    if (pInstruction->operand_count > 1)
     {
-    case ZYDIS_MNEMONIC_SETB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " // if below"));
-      break;
-
-    case ZYDIS_MNEMONIC_SETBE:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " // if below or equal"));
-      break;
-
-    case ZYDIS_MNEMONIC_SETL:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " // if less"));
-      break;
+      if (pMnemonicInfo->hint != ZydecFormattingInfo::None)
+        zydec_HintOp((ZydecFormattingInfo::HintOperation)pMnemonicInfo->hint, pInfo);
 
-    case ZYDIS_MNEMONIC_SETLE:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " // if less or equal"));
-      break;
+      ERROR_CHECK(zydec_WriteResultOperand(pWriter, &pOperands[0], virtualAddress, pInfo));
+      zydec_WriteReserved(pWriter, " = ");
+    }
 
-    case ZYDIS_MNEMONIC_SETNB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " // if not below"));
-      break;
+    zydec_WriteIntrinsic(pWriter, intrinsic);
 
-    case ZYDIS_MNEMONIC_SETNBE:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " // if not below or equal"));
-      break;
+    const bool addressParam = !!(pMnemonicInfo->flags & zmf_addressParam);
+    const bool maySelfReference = !(pMnemonicInfo->flags & zmf_noSelfReference);
+    const size_t startOperandIndex = hasMaskOperand ? sourceOperandIndex : (pInstruction->operand_count <= 1 || (pInstruction->operand_count == 2 && maySelfReference) ? 0 : 1);
+    size_t argumentCount = 0;
 
-    case ZYDIS_MNEMONIC_SETNL:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " // if not less"));
-      break;
+    uint8_t argumentOperands[ZYDIS_MAX_OPERAND_COUNT];
+    size_t argumentOperandCount = 0;
 
-    case ZYDIS_MNEMONIC_SETNLE:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " // if not less or equal"));
+    switch (fusedOperandOrder)
+    {
+    case zfo_132: // destination * source 2 + source 1, the destination being the first operand of `mask_` variants.
+      argumentOperands[argumentOperandCount++] = 0;
+      argumentOperands[argumentOperandCount++] = (uint8_t)(sourceOperandIndex + 1);
+      argumentOperands[argumentOperandCount++] = (uint8_t)sourceOperandIndex;
       break;
 
-    case ZYDIS_MNEMONIC_SETNZ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " // if not zero / not equal"));
+    case zfo_213: // source 1 * destination + source 2, multiplied the other way around for the same reason.
+      argumentOperands[argumentOperandCount++] = 0;
+      argumentOperands[argumentOperandCount++] = (uint8_t)sourceOperandIndex;
+      argumentOperands[argumentOperandCount++] = (uint8_t)(sourceOperandIndex + 1);
       break;
 
-    case ZYDIS_MNEMONIC_SETZ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " // if zero / equal"));
+    case zfo_231: // source 1 * source 2 + destination.
+      argumentOperands[argumentOperandCount++] = (uint8_t)sourceOperandIndex;
+      argumentOperands[argumentOperandCount++] = (uint8_t)(sourceOperandIndex + 1);
+      argumentOperands[argumentOperandCount++] = 0;
       break;
 
     default:
+      for (size_t operandIndex = startOperandIndex; operandIndex < pInstruction->operand_count; operandIndex++)
+        argumentOperands[argumentOperandCount++] = (uint8_t)operandIndex;
+
       break;
     }
 
-    return true;
-  }
-
-  case ZYDIS_MNEMONIC_BSF:
-  {
-    zydec_HintOp(ZydecFormattingInfo::BitScanF, pInfo);
-
-    ERROR_CHECK(zydec_WriteResultOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = __bitscan_forward("));
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[1], virtualAddress, pInfo));
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, ")"));
-    break;
-  }
-
-  case ZYDIS_MNEMONIC_BSR:
-  {
-    zydec_HintOp(ZydecFormattingInfo::BitScanR, pInfo);
+    size_t firstArgumentOperand = 0;
 
-    ERROR_CHECK(zydec_WriteResultOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = __bitscan_reverse("));
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[1], virtualAddress, pInfo));
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, ")"));
-    break;
-  }
+    // Like the `mask_` intrinsics, merging takes the previous value of the destination & the mask before the sources, zeroing only the mask.
+    if (mergesDestination)
+    {
+      ERROR_CHECK(zydec_WriteOperand(pWriter, &pOperands[0], virtualAddress, pInfo, zof_noAddressDeref));
+      argumentCount++;
 
-  case ZYDIS_MNEMONIC_POPCNT:
-  {
-    zydec_HintOp(ZydecFormattingInfo::PopCnt, pInfo);
+      // The fused multiply-add forms already start with the destination.
+      if (fusedOperandOrder != zfo_none)
+        firstArgumentOperand = 1;
+    }
 
-    ERROR_CHECK(zydec_WriteResultOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = __popcnt("));
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[1], virtualAddress, pInfo));
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, ")"));
-    break;
-  }
+    if (maskStyle != 0 && maskStyle != zis_mask3)
+    {
+      if (argumentCount++ > 0)
+        zydec_WriteReserved(pWriter, ", ");
 
-  case ZYDIS_MNEMONIC_PREFETCH:
-  case ZYDIS_MNEMONIC_PREFETCHNTA:
-  case ZYDIS_MNEMONIC_PREFETCHT0:
-  case ZYDIS_MNEMONIC_PREFETCHT1:
-  case ZYDIS_MNEMONIC_PREFETCHT2:
-  case ZYDIS_MNEMONIC_PREFETCHW:
-  case ZYDIS_MNEMONIC_PREFETCHWT1:
-  {
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_prefetch("));
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, ")"));
-    break;
-  }
+      ERROR_CHECK(zydec_WriteOperand(pWriter, &pOperands[1], virtualAddress, pInfo));
+    }
 
-  case ZYDIS_MNEMONIC_KORTESTB:
-  case ZYDIS_MNEMONIC_KORTESTW:
-  case ZYDIS_MNEMONIC_KORTESTD:
-  case ZYDIS_MNEMONIC_KORTESTQ:
-  case ZYDIS_MNEMONIC_KTESTB:
-  case ZYDIS_MNEMONIC_KTESTW:
-  case ZYDIS_MNEMONIC_KTESTD:
-  case ZYDIS_MNEMONIC_KTESTQ:
-  {
-    switch (pInstruction->mnemonic)
+    for (size_t i = firstArgumentOperand; i < argumentOperandCount; i++)
     {
-    case ZYDIS_MNEMONIC_KORTESTB:
-    case ZYDIS_MNEMONIC_KORTESTW:
-    case ZYDIS_MNEMONIC_KORTESTD:
-    case ZYDIS_MNEMONIC_KORTESTQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_kortest"));
-      break;
+      if (argumentCount++ > 0)
+        zydec_WriteReserved(pWriter, ", ");
 
-    case ZYDIS_MNEMONIC_KTESTB:
-    case ZYDIS_MNEMONIC_KTESTW:
-    case ZYDIS_MNEMONIC_KTESTD:
-    case ZYDIS_MNEMONIC_KTESTQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_ktest"));
-      break;
+      const size_t operandIndex = argumentOperands[i];
+      const ZydecOperandFlags flags = addressParam ? zof_none : (zof_noAddressDeref | zydec_GetBroadcastFlags(pInstruction, &pOperands[operandIndex], zydec_GetConstantFlags(intrinsic, &pOperands[operandIndex])));
 
-    default:
-      break;
+      ERROR_CHECK(zydec_WriteOperand(pWriter, &pOperands[operandIndex], virtualAddress, pInfo, flags));
     }
 
-    switch (pInstruction->mnemonic)
+    if (maskStyle == zis_mask3)
     {
-    case ZYDIS_MNEMONIC_KORTESTB:
-    case ZYDIS_MNEMONIC_KTESTB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_u8"));
-      break;
-
-    case ZYDIS_MNEMONIC_KORTESTW:
-    case ZYDIS_MNEMONIC_KTESTW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_u16"));
-      break;
+      zydec_WriteReserved(pWriter, ", ");
+      ERROR_CHECK(zydec_WriteOperand(pWriter, &pOperands[1], virtualAddress, pInfo));
+    }
 
-    case ZYDIS_MNEMONIC_KORTESTD:
-    case ZYDIS_MNEMONIC_KTESTD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_u32"));
-      break;
+    if (roundingArgument.text != nullptr)
+    {
+      if (argumentCount > 0)
+        zydec_WriteReserved(pWriter, ", ");
 
-    case ZYDIS_MNEMONIC_KORTESTQ:
-    case ZYDIS_MNEMONIC_KTESTQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_u64"));
-      break;
+      zydec_WriteReserved(pWriter, roundingArgument);
+    }
 
-    default:
-      break;
+    if (pMnemonicInfo->flags & zmf_commentOnStore)
+    {
+      if (!(pOperands[0].type == ZYDIS_OPERAND_TYPE_MEMORY || pOperands[0].type == ZYDIS_OPERAND_TYPE_POINTER))
+        terminator = ");";
+    }
+    else if (pMnemonicInfo->flags & zmf_commentOnLoad)
+    {
+      if (!(pInstruction->operand_count > 0 && (pOperands[pInstruction->operand_count - 1].type == ZYDIS_OPERAND_TYPE_MEMORY || pOperands[pInstruction->operand_count - 1].type == ZYDIS_OPERAND_TYPE_POINTER)))
+        terminator = ");";
     }
 
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "("));
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, ", "));
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[1], virtualAddress, pInfo));
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "); // set zero_flag & carry_flag accordingly"));
+    break;
+  }
 
-    return true;
+  default:
+    *pHasTranslation = false;
+    return false;
   }
 
-  case ZYDIS_MNEMONIC_VGATHERPF0DPS:
-  case ZYDIS_MNEMONIC_VGATHERPF1DPS:
-  case ZYDIS_MNEMONIC_VGATHERPF0DPD:
-  case ZYDIS_MNEMONIC_VGATHERPF1DPD:
-  case ZYDIS_MNEMONIC_VGATHERPF0QPS:
-  case ZYDIS_MNEMONIC_VGATHERPF1QPS:
-  case ZYDIS_MNEMONIC_VGATHERPF0QPD:
-  case ZYDIS_MNEMONIC_VGATHERPF1QPD:
-  case ZYDIS_MNEMONIC_VSCATTERPF0QPD:
-  case ZYDIS_MNEMONIC_VSCATTERPF1QPD:
-  case ZYDIS_MNEMONIC_VSCATTERPF0QPS:
-  case ZYDIS_MNEMONIC_VSCATTERPF1QPS:
-  {
-    switch (pInstruction->mnemonic)
-    {
-    case ZYDIS_MNEMONIC_VGATHERPF0DPS:
-    case ZYDIS_MNEMONIC_VGATHERPF1DPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_prefetch_i32extgather_ps("));
-      break;
+  if (terminator.text != nullptr)
+    zydec_WriteReserved(pWriter, terminator);
 
-    case ZYDIS_MNEMONIC_VGATHERPF0DPD:
-    case ZYDIS_MNEMONIC_VGATHERPF1DPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_prefetch_i32extgather_pd("));
-      break;
+  return true;
+}
 
-    case ZYDIS_MNEMONIC_VGATHERPF0QPS:
-    case ZYDIS_MNEMONIC_VGATHERPF1QPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_prefetch_i64gather_ps("));
-      break;
+bool zydec_TranslateInstructionWithoutContext(const ZydisDecodedInstruction *pInstruction, const ZydisDecodedOperand *pOperands, const size_t operandCount, const size_t virtualAddress, char *buffer, const size_t bufferCapacity, bool *pHasTranslation, ZydecFormattingInfo *pInfo)
+{
+  if (pInstruction == nullptr || pOperands == nullptr || operandCount < 10 || buffer == nullptr || bufferCapacity == 0 || pHasTranslation == nullptr)
+    return false;
 
-    case ZYDIS_MNEMONIC_VGATHERPF0QPD:
-    case ZYDIS_MNEMONIC_VGATHERPF1QPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_prefetch_i64gather_pd("));
-      break;
+  ZydecTextWriter writer;
+  writer.bufferPos = buffer;
+  writer.remainingSize = bufferCapacity - 1;
+  writer.intrinsicStyle = 0;
 
-    case ZYDIS_MNEMONIC_VSCATTERPF0QPD:
-    case ZYDIS_MNEMONIC_VSCATTERPF1QPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_prefetch_i64scatter_pd("));
-      break;
+  buffer[0] = '\0';
 
-    case ZYDIS_MNEMONIC_VSCATTERPF0QPS:
-    case ZYDIS_MNEMONIC_VSCATTERPF1QPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_prefetch_i64scatter_ps("));
-      break;
+  // The linear context callbacks draw fresh names while translating, so the retry below has to start with the same names, or they would depend on `bufferCapacity`.
+  ZydecLinearContextFormatInfo *pFormatContextInfo = pInfo->pGetResultRegisterName == zydec_LinearContext_GetResultRegisterName ? static_cast<ZydecLinearContextFormatInfo *>(pInfo->pRegUserData) : nullptr;
+  ZydecLinearContextNamingState namingState;
 
-    default:
-      break;
-    }
+  if (pFormatContextInfo != nullptr)
+    zydec_LinearContext_SaveNamingState(pFormatContextInfo, &namingState);
 
-    for (size_t operandIndex = 0; operandIndex < pInstruction->operand_count; operandIndex++)
-    {
-      if (operandIndex > 0)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, ", "));
+  if (zydec_TranslateInstruction(&writer, pInstruction, pOperands, virtualAddress, pHasTranslation, pInfo))
+    return true;
 
-      ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[operandIndex], virtualAddress, pInfo));
-    }
+  if (pFormatContextInfo != nullptr)
+    zydec_LinearContext_RestoreNamingState(pFormatContextInfo, &namingState);
 
-    switch (pInstruction->mnemonic)
-    {
-    case ZYDIS_MNEMONIC_VGATHERPF0DPS:
-    case ZYDIS_MNEMONIC_VGATHERPF0DPD:
-    case ZYDIS_MNEMONIC_VGATHERPF0QPS:
-    case ZYDIS_MNEMONIC_VGATHERPF0QPD:
-    case ZYDIS_MNEMONIC_VSCATTERPF0QPD:
-    case ZYDIS_MNEMONIC_VSCATTERPF0QPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "); // part 1 / 2"));
-      return true;
+  // The fixed text is reserved for its worst case, so a translation that does fit may still have been rejected. Retry with room for the reservation and keep the result if it fits after all.
+  char stackScratch[TranslationScratchCapacity];
+  const size_t scratchCapacity = bufferCapacity + TranslationMaxReservedSize;
+  char *scratch = scratchCapacity <= sizeof(stackScratch) ? stackScratch : static_cast<char *>(malloc(scratchCapacity));
 
-    case ZYDIS_MNEMONIC_VGATHERPF1DPS:
-    case ZYDIS_MNEMONIC_VGATHERPF1DPD:
-    case ZYDIS_MNEMONIC_VGATHERPF1QPS:
-    case ZYDIS_MNEMONIC_VGATHERPF1QPD:
-    case ZYDIS_MNEMONIC_VSCATTERPF1QPD:
-    case ZYDIS_MNEMONIC_VSCATTERPF1QPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "); // part 2 / 2"));
-      return true;
+  if (scratch == nullptr)
+    return false;
 
-    default:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, ")"));
-      break;
-    }
-  }
+  writer.bufferPos = scratch;
+  writer.remainingSize = scratchCapacity - 1;
+  writer.intrinsicStyle = 0;
+
+  scratch[0] = '\0';
+
+  const size_t length = zydec_TranslateInstruction(&writer, pInstruction, pOperands, virtualAddress, pHasTranslation, pInfo) ? (size_t)(writer.bufferPos - scratch) : bufferCapacity;
+  const bool success = length < bufferCapacity;
 
-  case ZYDIS_MNEMONIC_KADDB:
-  case ZYDIS_MNEMONIC_KADDW:
-  case ZYDIS_MNEMONIC_KADDD:
-  case ZYDIS_MNEMONIC_KADDQ:
-  case ZYDIS_MNEMONIC_KANDB:
-  case ZYDIS_MNEMONIC_KANDW:
-  case ZYDIS_MNEMONIC_KANDD:
-  case ZYDIS_MNEMONIC_KANDQ:
-  case ZYDIS_MNEMONIC_KORB:
-  case ZYDIS_MNEMONIC_KORW:
-  case ZYDIS_MNEMONIC_KORD:
-  case ZYDIS_MNEMONIC_KORQ:
-  case ZYDIS_MNEMONIC_KSHIFTLB:
-  case ZYDIS_MNEMONIC_KSHIFTLW:
-  case ZYDIS_MNEMONIC_KSHIFTLD:
-  case ZYDIS_MNEMONIC_KSHIFTLQ:
-  case ZYDIS_MNEMONIC_KSHIFTRB:
-  case ZYDIS_MNEMONIC_KSHIFTRW:
-  case ZYDIS_MNEMONIC_KSHIFTRD:
-  case ZYDIS_MNEMONIC_KSHIFTRQ:
-  case ZYDIS_MNEMONIC_KXORB:
-  case ZYDIS_MNEMONIC_KXORW:
-  case ZYDIS_MNEMONIC_KXORD:
-  case ZYDIS_MNEMONIC_KXORQ:
+  if (success)
+    memcpy(buffer, scratch, length + 1);
+
+  if (scratch != stackScratch)
+    free(scratch);
+
+  return success;
+}
+
+bool zydec_TranslateInstructionToTokens(const ZydisDecodedInstruction *pInstruction, const ZydisDecodedOperand *pOperands, const size_t operandCount, const size_t virtualAddress, ZydecToken *pTokens, const size_t tokenCapacity, size_t *pTokenCount, bool *pHasTranslation, ZydecFormattingInfo *pInfo)
+{
+  if (pInstruction == nullptr || pOperands == nullptr || operandCount < 10 || pTokens == nullptr || pTokenCount == nullptr || pHasTranslation == nullptr)
+    return false;
+
+  ZydecTokenWriter writer;
+  writer.pTokens = pTokens;
+  writer.tokenCount = 0;
+  writer.tokenCapacity = tokenCapacity;
+  writer.mnemonic = pInstruction->mnemonic;
+  writer.intrinsicStyle = 0;
+
+  const bool result = zydec_TranslateInstruction(&writer, pInstruction, pOperands, virtualAddress, pHasTranslation, pInfo);
+
+  if (writer.tokenCount > tokenCapacity)
   {
-    switch (pInstruction->mnemonic)
-    {
-    case ZYDIS_MNEMONIC_KSHIFTLB:
-    case ZYDIS_MNEMONIC_KSHIFTLW:
-    case ZYDIS_MNEMONIC_KSHIFTLD:
-    case ZYDIS_MNEMONIC_KSHIFTLQ:
-      zydec_HintOp(ZydecFormattingInfo::ShL, pInfo);
-      break;
+    *pTokenCount = tokenCapacity;
+    return false;
+  }
 
-    case ZYDIS_MNEMONIC_KSHIFTRB:
-    case ZYDIS_MNEMONIC_KSHIFTRW:
-    case ZYDIS_MNEMONIC_KSHIFTRD:
-    case ZYDIS_MNEMONIC_KSHIFTRQ:
-      zydec_HintOp(ZydecFormattingInfo::ShR, pInfo);
-      break;
+  *pTokenCount = writer.tokenCount;
 
-    case ZYDIS_MNEMONIC_KADDB:
-    case ZYDIS_MNEMONIC_KADDW:
-    case ZYDIS_MNEMONIC_KADDD:
-    case ZYDIS_MNEMONIC_KADDQ:
-      zydec_HintOp(ZydecFormattingInfo::Add, pInfo);
-      break;
+  return result;
+}
 
-    case ZYDIS_MNEMONIC_KANDB:
-    case ZYDIS_MNEMONIC_KANDW:
-    case ZYDIS_MNEMONIC_KANDD:
-    case ZYDIS_MNEMONIC_KANDQ:
-      zydec_HintOp(ZydecFormattingInfo::And, pInfo);
-      break;
+bool zydec_RenderTokens(const ZydecToken *pTokens, const size_t tokenCount, char *buffer, const size_t bufferCapacity, ZydecFormattingInfo *pInfo)
+{
+  if (pTokens == nullptr || buffer == nullptr || bufferCapacity == 0)
+    return false;
 
-    case ZYDIS_MNEMONIC_KORB:
-    case ZYDIS_MNEMONIC_KORW:
-    case ZYDIS_MNEMONIC_KORD:
-    case ZYDIS_MNEMONIC_KORQ:
-      zydec_HintOp(ZydecFormattingInfo::Or, pInfo);
-      break;
+  char *bufferPos = buffer;
+  size_t remainingSize = bufferCapacity - 1;
 
-    case ZYDIS_MNEMONIC_KXORB:
-    case ZYDIS_MNEMONIC_KXORW:
-    case ZYDIS_MNEMONIC_KXORD:
-    case ZYDIS_MNEMONIC_KXORQ:
-      zydec_HintOp(ZydecFormattingInfo::XOr, pInfo);
-      break;
+  bufferPos[0] = '\0';
 
-    default:
+  for (size_t i = 0; i < tokenCount; i++)
+  {
+    const ZydecToken *pToken = &pTokens[i];
+
+    switch (pToken->type)
+    {
+    case ztt_punctuation:
+    case ztt_comment:
+      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, pToken->text, pToken->length));
       break;
-    }
 
-    if (simplifyShorthands)
+    case ztt_intrinsic:
     {
-      if (pInstruction->operand_count == 3 && pOperands[1].type == ZYDIS_OPERAND_TYPE_REGISTER && pOperands[2].type == ZYDIS_OPERAND_TYPE_REGISTER && pOperands[1].reg.value == pOperands[2].reg.value)
-      {
-        switch (pInstruction->mnemonic)
-        {
-        case ZYDIS_MNEMONIC_KANDB:
-        case ZYDIS_MNEMONIC_KANDW:
-        case ZYDIS_MNEMONIC_KANDD:
-        case ZYDIS_MNEMONIC_KANDQ:
-        case ZYDIS_MNEMONIC_KORB:
-        case ZYDIS_MNEMONIC_KORW:
-        case ZYDIS_MNEMONIC_KORD:
-        case ZYDIS_MNEMONIC_KORQ:
-          zydec_HintOperand(&pOperands[1], pInfo);
-          ERROR_CHECK(zydec_WriteResultOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-          ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = "));
-          ERROR_CHECK(zydec_WriteResultOperand(&bufferPos, &remainingSize, &pOperands[1], virtualAddress, pInfo));
-          ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, ";"));
-          return true;
-          break;
+      ZydecLiteral pieces[IntrinsicStyleMaxPieces];
+      const size_t pieceCount = zydec_StyleIntrinsic(ZydecLiteral(pToken->text, pToken->length), pToken->reg, pieces);
 
-        case ZYDIS_MNEMONIC_KXORB:
-        case ZYDIS_MNEMONIC_KXORW:
-        case ZYDIS_MNEMONIC_KXORD:
-        case ZYDIS_MNEMONIC_KXORQ:
-          zydec_HintValue(0, pInfo);
-          ERROR_CHECK(zydec_WriteResultOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-          ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = 0;"));
-          return true;
+      for (size_t i = 0; i < pieceCount; i++)
+        ERROR_CHECK(zydec_WriteLiteral(&bufferPos, &remainingSize, pieces[i]));
 
-        default:
-          break;
-        }
-      }
+      break;
     }
 
-    ERROR_CHECK(zydec_WriteResultOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-    ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = "));
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[1], virtualAddress, pInfo));
-    
-    switch (pInstruction->mnemonic)
-    {
-    case ZYDIS_MNEMONIC_KSHIFTLB:
-    case ZYDIS_MNEMONIC_KSHIFTLW:
-    case ZYDIS_MNEMONIC_KSHIFTLD:
-    case ZYDIS_MNEMONIC_KSHIFTLQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " << "));
-      break;
-      
-    case ZYDIS_MNEMONIC_KSHIFTRB:
-    case ZYDIS_MNEMONIC_KSHIFTRW:
-    case ZYDIS_MNEMONIC_KSHIFTRD:
-    case ZYDIS_MNEMONIC_KSHIFTRQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " >> "));
+    case ztt_register:
+      ERROR_CHECK(zydec_LinearContext_WriteRegisterName(&bufferPos, &remainingSize, (ZydisRegister)pToken->reg, pToken->id));
       break;
 
-    case ZYDIS_MNEMONIC_KADDB:
-    case ZYDIS_MNEMONIC_KADDW:
-    case ZYDIS_MNEMONIC_KADDD:
-    case ZYDIS_MNEMONIC_KADDQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " + "));
+    case ztt_signedImmediate:
+      ERROR_CHECK(zydec_WriteInt(&bufferPos, &remainingSize, (int64_t)pToken->value));
       break;
 
-    case ZYDIS_MNEMONIC_KANDB:
-    case ZYDIS_MNEMONIC_KANDW:
-    case ZYDIS_MNEMONIC_KANDD:
-    case ZYDIS_MNEMONIC_KANDQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " & "));
+    case ztt_unsignedImmediate:
+      ERROR_CHECK(zydec_WriteUInt(&bufferPos, &remainingSize, pToken->value));
       break;
 
-    case ZYDIS_MNEMONIC_KORB:
-    case ZYDIS_MNEMONIC_KORW:
-    case ZYDIS_MNEMONIC_KORD:
-    case ZYDIS_MNEMONIC_KORQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " | "));
+    case ztt_address:
+      ERROR_CHECK(zydec_WriteHex(&bufferPos, &remainingSize, pToken->value));
       break;
 
-    case ZYDIS_MNEMONIC_KXORB:
-    case ZYDIS_MNEMONIC_KXORW:
-    case ZYDIS_MNEMONIC_KXORD:
-    case ZYDIS_MNEMONIC_KXORQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " ^ "));
-      break;
+    case ztt_symbol:
+    {
+      char friendlyName[1024];
+      size_t friendlyNameOffset = 0;
+
+      if (pInfo != nullptr && pInfo->pResolveAddressToFriendlyName != nullptr && pInfo->pResolveAddressToFriendlyName(pToken->value, friendlyName, sizeof(friendlyName), &friendlyNameOffset, pInfo->pUserData))
+        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, friendlyName));
+      else
+        ERROR_CHECK(zydec_WriteHex(&bufferPos, &remainingSize, pToken->value));
 
-    default:
       break;
     }
 
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[2], virtualAddress, pInfo));
+    case ztt_floatImmediate:
+      ERROR_CHECK(zydec_WriteFloat(&bufferPos, &remainingSize, pToken->value, pToken->id == 64));
+      break;
 
-    break;
+    default:
+      return false;
+    }
   }
 
-  case ZYDIS_MNEMONIC_MOVAPS:
-  case ZYDIS_MNEMONIC_MOVAPD:
-  case ZYDIS_MNEMONIC_MOVDQA:
-  case ZYDIS_MNEMONIC_VMOVAPS:
-  case ZYDIS_MNEMONIC_VMOVAPD:
-  case ZYDIS_MNEMONIC_VMOVDQA:
-  case ZYDIS_MNEMONIC_VMOVDQA32:
-  case ZYDIS_MNEMONIC_VMOVDQA64:
-  case ZYDIS_MNEMONIC_MOVNTDQ:
-  case ZYDIS_MNEMONIC_VMOVNTDQ:
-  case ZYDIS_MNEMONIC_MOVNTPD:
-  case ZYDIS_MNEMONIC_VMOVNTPD:
-  case ZYDIS_MNEMONIC_MOVNTPS:
-  case ZYDIS_MNEMONIC_VMOVNTPS:
-  case ZYDIS_MNEMONIC_MOVNTDQA:
-  case ZYDIS_MNEMONIC_VMOVNTDQA:
-  {
-    zydec_HintOp(ZydecFormattingInfo::Mov, pInfo);
-    zydec_HintOperand(&pOperands[1], pInfo);
+  return true;
+}
 
-    bool isReg2RegMove = false;
-    size_t operandIndex = 0;
+////////////////////////////////////////////////////////////////////////////////
 
+ZydecLiteral zydec_GetIrregularIntrinsic(const ZydisDecodedInstruction *pInstruction, const ZydisDecodedOperand *pOperands)
+{
+  switch (pInstruction->mnemonic)
+  {
+  case ZYDIS_MNEMONIC_MOVHPS:
     if (pOperands[0].type == ZYDIS_OPERAND_TYPE_MEMORY || pOperands[0].type == ZYDIS_OPERAND_TYPE_POINTER)
-    {
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_aligned_store"));
-    }
-    else if (pOperands[1].type == ZYDIS_OPERAND_TYPE_MEMORY || pOperands[1].type == ZYDIS_OPERAND_TYPE_POINTER)
-    {
-      ERROR_CHECK(zydec_WriteResultOperand(&bufferPos, &remainingSize, &pOperands[operandIndex++], virtualAddress, pInfo, zof_noAddressDeref));
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = _mm_aligned_load"));
-    }
-    else if (pInstruction->operand_count == 2)
-    {
-      isReg2RegMove = true;
-    }
+      return "_mm_storeh_pi(";
     else
-    {
-      ERROR_CHECK(zydec_WriteResultOperand(&bufferPos, &remainingSize, &pOperands[operandIndex++], virtualAddress, pInfo, zof_noAddressDeref));
+      return "_mm_loadh_pi(";
 
-      if (pInstruction->operand_count == 3)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = _mm_maskz_mov"));
-      else if (pInstruction->operand_count == 4)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = _mm_mask_mov"));
-      else
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = _mm_mov"));
-    }
+  case ZYDIS_MNEMONIC_MOVHPD:
+    if (pOperands[0].type == ZYDIS_OPERAND_TYPE_MEMORY || pOperands[0].type == ZYDIS_OPERAND_TYPE_POINTER)
+      return "_mm_storeh_pd(";
+    else
+      return "_mm_loadh_pd(";
 
-    if (!isReg2RegMove)
-    {
-      switch (pInstruction->mnemonic)
-      {
-      case ZYDIS_MNEMONIC_MOVAPS:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_ps("));
-        break;
+  case ZYDIS_MNEMONIC_MOVDDUP:
+  case ZYDIS_MNEMONIC_VMOVDDUP:
+    if (pOperands[1].type == ZYDIS_OPERAND_TYPE_MEMORY || pOperands[1].type == ZYDIS_OPERAND_TYPE_POINTER)
+      return "_mm_loaddup_pd(";
+    else
+      return "_mm_movedup_pd(";
 
-      case ZYDIS_MNEMONIC_MOVAPD:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_pd("));
-        break;
+  case ZYDIS_MNEMONIC_VCVTSI2SH:
+    if (pInstruction->operand_count > 2 && pOperands[2].element_size == 4)
+      return "_mm_cvti32_sh(";
+    else if (pInstruction->operand_count > 2 && pOperands[2].element_size == 8)
+      return "_mm_cvti64_sh(";
+    else
+      return "_mm_cvti_sh(";
 
-      case ZYDIS_MNEMONIC_MOVDQA:
-      case ZYDIS_MNEMONIC_VMOVDQA:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_si("));
-        break;
+  case ZYDIS_MNEMONIC_VCVTUSI2SH:
+    if (pInstruction->operand_count > 2 && pOperands[2].element_size == 4)
+      return "_mm_cvtu32_sh(";
+    else if (pInstruction->operand_count > 2 && pOperands[2].element_size == 8)
+      return "_mm_cvtu64_sh(";
+    else
+      return "_mm_cvtu_sh(";
 
-      case ZYDIS_MNEMONIC_VMOVDQA32:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_epi32("));
-        break;
+  case ZYDIS_MNEMONIC_VCVTSH2SI:
+    if (pInstruction->operand_count > 0 && pOperands[0].element_size == 4)
+      return "_mm_cvtsh_i32(";
+    else if (pInstruction->operand_count > 0 && pOperands[0].element_size == 8)
+      return "_mm_cvtsh_i64(";
+    else
+      return "_mm_cvtsh_i(";
 
-      case ZYDIS_MNEMONIC_VMOVDQA64:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_epi64("));
-        break;
+  case ZYDIS_MNEMONIC_VCVTSH2USI:
+    if (pInstruction->operand_count > 0 && pOperands[0].element_size == 4)
+      return "_mm_cvtsh_u32(";
+    else if (pInstruction->operand_count > 0 && pOperands[0].element_size == 8)
+      return "_mm_cvtsh_u64(";
+    else
+      return "_mm_cvtsh_u(";
 
-      case ZYDIS_MNEMONIC_MOVNTDQ:
-      case ZYDIS_MNEMONIC_VMOVNTDQ:
-      case ZYDIS_MNEMONIC_MOVNTDQA:
-      case ZYDIS_MNEMONIC_VMOVNTDQA:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_stream_si("));
-        break;
+  case ZYDIS_MNEMONIC_VCVTSD2USI:
+    if (pInstruction->operand_count > 0 && pOperands[0].element_size == 4)
+      return "_mm_cvtsd_u32(";
+    else if (pInstruction->operand_count > 0 && pOperands[0].element_size == 8)
+      return "_mm_cvtsd_u64(";
+    else
+      return "_mm_cvtsd_u(";
 
-      case ZYDIS_MNEMONIC_MOVNTPD:
-      case ZYDIS_MNEMONIC_VMOVNTPD:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_stream_pd("));
-        break;
+  case ZYDIS_MNEMONIC_VCVTSS2USI:
+    if (pInstruction->operand_count > 0 && pOperands[0].element_size == 4)
+      return "_mm_cvtss_u32(";
+    else if (pInstruction->operand_count > 0 && pOperands[0].element_size == 8)
+      return "_mm_cvtss_u64(";
+    else
+      return "_mm_cvtss_u(";
 
-      case ZYDIS_MNEMONIC_MOVNTPS:
-      case ZYDIS_MNEMONIC_VMOVNTPS:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_stream_ps("));
-        break;
+  case ZYDIS_MNEMONIC_VCVTUSI2SD:
+    if (pInstruction->operand_count > 2 && pOperands[2].element_size == 4)
+      return "_mm_cvtu32_sd(";
+    else if (pInstruction->operand_count > 2 && pOperands[2].element_size == 8)
+      return "_mm_cvtu64_sd(";
+    else
+      return "_mm_cvtu_sd(";
 
-      default:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "("));
-        break;
-      }
-    }
+  case ZYDIS_MNEMONIC_VCVTUSI2SS:
+    if (pInstruction->operand_count > 2 && pOperands[2].element_size == 4)
+      return "_mm_cvtu32_ss(";
+    else if (pInstruction->operand_count > 2 && pOperands[2].element_size == 8)
+      return "_mm_cvtu64_ss(";
+    else
+      return "_mm_cvtu_ss(";
 
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[operandIndex++], virtualAddress, pInfo, zof_noAddressDeref, isReg2RegMove));
-    const size_t startOperandIndex = operandIndex;
+  case ZYDIS_MNEMONIC_VCVTTSD2SI:
+    if (pInstruction->operand_count > 0 && pOperands[0].element_size == 4)
+      return "_mm_cvttsd_i32(";
+    else if (pInstruction->operand_count > 0 && pOperands[0].element_size == 8)
+      return "_mm_cvttsd_i64(";
+    else
+      return "_mm_cvttsd_si(";
 
-    if (isReg2RegMove)
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = "));
-    else if (startOperandIndex < pInstruction->operand_count)
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, ", "));
+  case ZYDIS_MNEMONIC_VCVTTSD2USI:
+    if (pInstruction->operand_count > 0 && pOperands[0].element_size == 4)
+      return "_mm_cvttsd_u32(";
+    else if (pInstruction->operand_count > 0 && pOperands[0].element_size == 8)
+      return "_mm_cvttsd_u64(";
+    else
+      return "_mm_cvttsd_u(";
 
-    for (; operandIndex < pInstruction->operand_count; operandIndex++)
-    {
-      if (operandIndex > startOperandIndex)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, ", "));
+  case ZYDIS_MNEMONIC_CVTTSS2SI:
+  case ZYDIS_MNEMONIC_VCVTTSS2SI:
+    if (pInstruction->operand_count > 0 && pOperands[0].element_size == 4)
+      return "_mm_cvttss_si32(";
+    else if (pInstruction->operand_count > 0 && pOperands[0].element_size == 8)
+      return "_mm_cvttss_si64(";
+    else
+      return "_mm_cvttss_si(";
 
-      ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[operandIndex], virtualAddress, pInfo, zof_noAddressDeref));
-    }
+  case ZYDIS_MNEMONIC_VCVTTSS2USI:
+    if (pInstruction->operand_count > 0 && pOperands[0].element_size == 4)
+      return "_mm_cvttss_u32(";
+    else if (pInstruction->operand_count > 0 && pOperands[0].element_size == 8)
+      return "_mm_cvttss_u64(";
+    else
+      return "_mm_cvttss_u(";
 
-    if (!isReg2RegMove)
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, ")"));
+  case ZYDIS_MNEMONIC_VCVTTSH2SI:
+    if (pInstruction->operand_count > 0 && pOperands[0].element_size == 4)
+      return "_mm_cvttsh_si32(";
+    else if (pInstruction->operand_count > 0 && pOperands[0].element_size == 8)
+      return "_mm_cvttsh_si64(";
+    else
+      return "_mm_cvttsh_si(";
 
-    break;
+  case ZYDIS_MNEMONIC_VCVTTSH2USI:
+    if (pInstruction->operand_count > 0 && pOperands[0].element_size == 4)
+      return "_mm_cvttsh_u32(";
+    else if (pInstruction->operand_count > 0 && pOperands[0].element_size == 8)
+      return "_mm_cvttsh_u64(";
+    else
+      return "_mm_cvttsh_u(";
+  default:
+    return "_mm_??_(";
   }
+}
 
-  case ZYDIS_MNEMONIC_MOVUPS:
-  case ZYDIS_MNEMONIC_MOVUPD:
-  case ZYDIS_MNEMONIC_MOVQ:
-  case ZYDIS_MNEMONIC_MOVD:
-  case ZYDIS_MNEMONIC_MOVSS:
-  case ZYDIS_MNEMONIC_MOVSD:
-  case ZYDIS_MNEMONIC_MOVDQU:
-  case ZYDIS_MNEMONIC_MOVDQ2Q:
-  case ZYDIS_MNEMONIC_VMOVUPS:
-  case ZYDIS_MNEMONIC_VMOVUPD:
-  case ZYDIS_MNEMONIC_VMOVQ:
-  case ZYDIS_MNEMONIC_VMOVD:
-  case ZYDIS_MNEMONIC_VMOVSS:
-  case ZYDIS_MNEMONIC_VMOVSD:
-  case ZYDIS_MNEMONIC_VMOVSH:
-  case ZYDIS_MNEMONIC_VMOVDQU:
-  case ZYDIS_MNEMONIC_VMOVDQU16:
-  case ZYDIS_MNEMONIC_VMOVDQU32:
-  case ZYDIS_MNEMONIC_VMOVDQU64:
-  case ZYDIS_MNEMONIC_VMOVDQU8:
-  case ZYDIS_MNEMONIC_LDDQU:
-  case ZYDIS_MNEMONIC_VPMASKMOVD:
-  case ZYDIS_MNEMONIC_VPMASKMOVQ:
-  case ZYDIS_MNEMONIC_VMASKMOVPD:
-  case ZYDIS_MNEMONIC_VMASKMOVPS:
-  case ZYDIS_MNEMONIC_MASKMOVQ:
-  case ZYDIS_MNEMONIC_MASKMOVDQU:
-  {
-    zydec_HintOp(ZydecFormattingInfo::Mov, pInfo);
-    zydec_HintOperand(&pOperands[1], pInfo);
-
-    bool isReg2RegMove = false;
-    size_t operandIndex = 0;
+////////////////////////////////////////////////////////////////////////////////
 
-    if (pOperands[0].type == ZYDIS_OPERAND_TYPE_MEMORY || pOperands[0].type == ZYDIS_OPERAND_TYPE_POINTER)
-    {
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_unaligned_store"));
-    }
-    else if (pOperands[1].type == ZYDIS_OPERAND_TYPE_MEMORY || pOperands[1].type == ZYDIS_OPERAND_TYPE_POINTER)
-    {
-      ERROR_CHECK(zydec_WriteResultOperand(&bufferPos, &remainingSize, &pOperands[operandIndex++], virtualAddress, pInfo, zof_noAddressDeref));
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = _mm_unaligned_load"));
-    }
-    else if (pInstruction->operand_count == 2)
-    {
-      isReg2RegMove = true;
-    }
-    else
-    {
-      if (pInstruction->operand_count == 3)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_maskz_mov_unaligned"));
-      else if (pInstruction->operand_count == 4)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mask_mov_unaligned"));
-      else
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mov_unaligned"));
-    }
+enum ZydecLinearContextRegisterIndex : size_t
+{
+  zlcri_gpr = 0,
+  zlcri_flags = zlcri_gpr + 16,
+  zlcri_xmm = zlcri_flags + 1,
+  zlcri_ymm = zlcri_xmm + 32,
+  zlcri_zmm = zlcri_ymm + 32,
+  zlcri_mask = zlcri_zmm + 32,
+  zlcri_mmx = zlcri_mask + 8,
+  zlcri_x87 = zlcri_mmx + 8,
+  zlcri_count = zlcri_x87 + 8,
+};
 
-    if (!isReg2RegMove)
-    {
-      switch (pInstruction->mnemonic)
-      {
-      case ZYDIS_MNEMONIC_MOVUPS:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_ps("));
-        break;
+static_assert(zlcri_count == ZydecLinearContextRegisterCount, "Register index layout doesn't match the size of `ZydecLinearContext::regInfo`.");
 
-      case ZYDIS_MNEMONIC_MOVUPD:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_pd("));
-        break;
+static constexpr size_t ZydecLinearContextRegisterBitsetSize = (ZydecLinearContextRegisterCount + 63) / 64;
 
-      case ZYDIS_MNEMONIC_MOVD:
-      case ZYDIS_MNEMONIC_VMOVD:
-      case ZYDIS_MNEMONIC_VMOVDQU32:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_epi32("));
-        break;
+constexpr uint64_t zydec_LinearContext_GprBit(const ZydisRegister reg)
+{
+  return (uint64_t)1 << (zlcri_gpr + reg - ZYDIS_REGISTER_RAX);
+}
 
-      case ZYDIS_MNEMONIC_MOVQ:
-      case ZYDIS_MNEMONIC_VMOVQ:
-      case ZYDIS_MNEMONIC_VMOVDQU64:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_epi64("));
-        break;
+// Registers that keep their names across calls, all other names are cleared after a call.
+static constexpr uint64_t AfterCallRetainedRegistersWindows[ZydecLinearContextRegisterBitsetSize] = {
+  zydec_LinearContext_GprBit(ZYDIS_REGISTER_RBX) | zydec_LinearContext_GprBit(ZYDIS_REGISTER_RBP) | zydec_LinearContext_GprBit(ZYDIS_REGISTER_RDI) | zydec_LinearContext_GprBit(ZYDIS_REGISTER_RSI) | zydec_LinearContext_GprBit(ZYDIS_REGISTER_RSP) | zydec_LinearContext_GprBit(ZYDIS_REGISTER_R12) | zydec_LinearContext_GprBit(ZYDIS_REGISTER_R13) | zydec_LinearContext_GprBit(ZYDIS_REGISTER_R14) | zydec_LinearContext_GprBit(ZYDIS_REGISTER_R15) | ((uint64_t)0x3FF << (zlcri_xmm + 6)), // xmm6 - xmm15.
+};
 
-      case ZYDIS_MNEMONIC_VPMASKMOVD:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mask_epi32("));
-        break;
+static constexpr uint64_t AfterCallRetainedRegistersLinux[ZydecLinearContextRegisterBitsetSize] = {
+  zydec_LinearContext_GprBit(ZYDIS_REGISTER_RBX) | zydec_LinearContext_GprBit(ZYDIS_REGISTER_RSP) | zydec_LinearContext_GprBit(ZYDIS_REGISTER_RBP) | zydec_LinearContext_GprBit(ZYDIS_REGISTER_R12) | zydec_LinearContext_GprBit(ZYDIS_REGISTER_R13) | zydec_LinearContext_GprBit(ZYDIS_REGISTER_R14) | zydec_LinearContext_GprBit(ZYDIS_REGISTER_R15),
+};
 
-      case ZYDIS_MNEMONIC_VPMASKMOVQ:
-      case ZYDIS_MNEMONIC_MASKMOVQ:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mask_epi64("));
-        break;
+size_t zydec_LinearContext_GetRegisterIndex(const ZydisRegister reg)
+{
+  if (reg >= ZYDIS_REGISTER_RAX && reg <= ZYDIS_REGISTER_R15)
+    return zlcri_gpr + reg - ZYDIS_REGISTER_RAX;
+  else if (reg >= ZYDIS_REGISTER_XMM0 && reg <= ZYDIS_REGISTER_ZMM31) // xmm, ymm & zmm registers are laid out the same way.
+    return zlcri_xmm + reg - ZYDIS_REGISTER_XMM0;
+  else if (reg >= ZYDIS_REGISTER_K0 && reg <= ZYDIS_REGISTER_K7)
+    return zlcri_mask + reg - ZYDIS_REGISTER_K0;
+  else if (reg >= ZYDIS_REGISTER_MM0 && reg <= ZYDIS_REGISTER_MM7)
+    return zlcri_mmx + reg - ZYDIS_REGISTER_MM0;
+  else if (reg >= ZYDIS_REGISTER_ST0 && reg <= ZYDIS_REGISTER_ST7)
+    return zlcri_x87 + reg - ZYDIS_REGISTER_ST0;
+  else if (reg == ZYDIS_REGISTER_RFLAGS)
+    return zlcri_flags;
+  else
+    return ZydecLinearContextRegisterCount;
+}
 
-      case ZYDIS_MNEMONIC_VMASKMOVPD:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mask_pd("));
-        break;
+inline uint32_t zydec_LinearContext_GetName(const ZydecLinearContext *pContext, const ZydisRegister reg)
+{
+  const size_t index = zydec_LinearContext_GetRegisterIndex(reg);
 
-      case ZYDIS_MNEMONIC_VMASKMOVPS:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mask_ps("));
-        break;
+  return index < ZydecLinearContextRegisterCount ? pContext->regInfo[index] : 0;
+}
 
-      case ZYDIS_MNEMONIC_MASKMOVDQU:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mask_si128("));
-        break;
+void zydec_LinearContext_AfterCall(void *pUserData)
+{
+  ZydecLinearContextFormatInfo *pInfo = static_cast<ZydecLinearContextFormatInfo *>(pUserData);
 
-      case ZYDIS_MNEMONIC_MOVSS:
-      case ZYDIS_MNEMONIC_VMOVSS:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_ss("));
-        break;
+  const uint64_t *pRetained = pInfo->pOriginalInfo->afterCallRegisterRetentionMode == ZydecFormattingInfo::AfterCallRegisterRetentionMode::Windows ? AfterCallRetainedRegistersWindows : AfterCallRetainedRegistersLinux;
 
-      case ZYDIS_MNEMONIC_MOVSD:
-      case ZYDIS_MNEMONIC_VMOVSD:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_sd("));
-        break;
+  for (size_t i = 0; i < ZydecLinearContextRegisterCount; i++)
+    pInfo->pContext->regInfo[i] &= (uint32_t)0 - (uint32_t)((pRetained[i / 64] >> (i & 63)) & 1);
+}
 
-      case ZYDIS_MNEMONIC_VMOVSH:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_sh("));
-        break;
+void zydec_LinearContext_Snapshot(const ZydecLinearContext *pContext, ZydecLinearContext *pSnapshot)
+{
+  *pSnapshot = *pContext;
+}
 
-      case ZYDIS_MNEMONIC_LDDQU:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_cross_cache_line_si("));
-        break;
+void zydec_LinearContext_Restore(ZydecLinearContext *pContext, const ZydecLinearContext *pSnapshot)
+{
+  *pContext = *pSnapshot;
+}
 
-      case ZYDIS_MNEMONIC_MOVDQU:
-      case ZYDIS_MNEMONIC_VMOVDQU:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_si("));
-        break;
+// Only copies the registers assigned so far, which are none at the start of an instruction.
+void zydec_LinearContext_SaveNamingState(const ZydecLinearContextFormatInfo *pFormatContextInfo, ZydecLinearContextNamingState *pState)
+{
+  pState->context = *pFormatContextInfo->pContext;
+  pState->resultNameCount = pFormatContextInfo->resultNameCount;
+  pState->assignedRegisterCount = pFormatContextInfo->assignedRegisterCount;
+  memcpy(pState->assignedRegisterValue, pFormatContextInfo->assignedRegisterValue, sizeof(uint32_t) * pFormatContextInfo->assignedRegisterCount);
+  pState->regHint = pFormatContextInfo->regHint;
+  pState->opHint = pFormatContextInfo->opHint;
+  pState->hasValHint = pFormatContextInfo->hasValHint;
+  pState->valHint = pFormatContextInfo->valHint;
+}
 
-      case ZYDIS_MNEMONIC_VMOVDQU16:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_epi16("));
-        break;
+void zydec_LinearContext_RestoreNamingState(ZydecLinearContextFormatInfo *pFormatContextInfo, const ZydecLinearContextNamingState *pState)
+{
+  *pFormatContextInfo->pContext = pState->context;
+  pFormatContextInfo->resultNameCount = pState->resultNameCount;
+  pFormatContextInfo->assignedRegisterCount = pState->assignedRegisterCount;
+  memcpy(pFormatContextInfo->assignedRegisterValue, pState->assignedRegisterValue, sizeof(uint32_t) * pState->assignedRegisterCount);
+  pFormatContextInfo->regHint = pState->regHint;
+  pFormatContextInfo->opHint = pState->opHint;
+  pFormatContextInfo->hasValHint = pState->hasValHint;
+  pFormatContextInfo->valHint = pState->valHint;
+}
 
-      case ZYDIS_MNEMONIC_VMOVDQU8:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_epi8("));
-        break;
+// Only depends on the address of the instruction & the index of the result within it, see `ZydecFormattingInfo::RegisterNamingMode::AddressSeeded`.
+uint32_t zydec_LinearContext_SeededRegisterName(const size_t virtualAddress, const size_t resultIndex)
+{
+  // SplitMix64.
+  uint64_t state = (uint64_t)virtualAddress * 0x9E3779B97F4A7C15 + (uint64_t)resultIndex * 0xBF58476D1CE4E5B9 + 0xBADC0FFEECA7F00D;
+  state = (state ^ (state >> 30)) * 0xBF58476D1CE4E5B9;
+  state = (state ^ (state >> 27)) * 0x94D049BB133111EB;
+  state ^= state >> 31;
 
-      case ZYDIS_MNEMONIC_MOVDQ2Q:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_pi("));
-        break;
+  const uint32_t ret = (uint32_t)(state >> 32);
 
-      default:
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "("));
-        break;
-      }
-    }
+  return ret != 0 ? ret : (uint32_t)state | 1;
+}
 
-    ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[operandIndex++], virtualAddress, pInfo, zof_noAddressDeref, isReg2RegMove));
-    const size_t startOperandIndex = operandIndex;
+uint32_t zydec_LinearContext_NextRegisterName(ZydecLinearContext *pContext)
+{
+  bool firstRun = true;
+  uint32_t ret;
 
-    if (isReg2RegMove)
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = "));
-    else if (startOperandIndex < pInstruction->operand_count)
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, ", "));
+  while (true)
+  {
+    const uint64_t oldState = pContext->hashState;
+    pContext->hashState = oldState * 6364136223846793005ULL | 1;
 
-    for (; operandIndex < pInstruction->operand_count; operandIndex++)
-    {
-      if (operandIndex > startOperandIndex)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, ", "));
+    const uint32_t xorshifted = (uint32_t)(((oldState >> 18) ^ oldState) >> 27);
+    const uint32_t rot = (uint32_t)(oldState >> 59);
 
-      ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[operandIndex], virtualAddress, pInfo, zof_noAddressDeref));
-    }
+    ret = (xorshifted >> rot) | (xorshifted << (uint32_t)((-(int32_t)rot) & 31));
 
-    if (!isReg2RegMove)
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, ")"));
+    if (!firstRun || ret != 0)
+      break;
 
-    break;
+    firstRun = false;
   }
+  
+  return ret;
+}
 
-  case ZYDIS_MNEMONIC_PAND:
-  case ZYDIS_MNEMONIC_VPAND:
-  case ZYDIS_MNEMONIC_VPANDQ:
-  case ZYDIS_MNEMONIC_VPANDD:
-  case ZYDIS_MNEMONIC_PANDN:
-  case ZYDIS_MNEMONIC_VPANDN:
-  case ZYDIS_MNEMONIC_VPANDNQ:
-  case ZYDIS_MNEMONIC_VPANDND:
-  case ZYDIS_MNEMONIC_PCMPEQB:
-  case ZYDIS_MNEMONIC_PCMPEQW:
-  case ZYDIS_MNEMONIC_PCMPEQD:
-  case ZYDIS_MNEMONIC_PCMPEQQ:
-  case ZYDIS_MNEMONIC_VPCMPEQB:
-  case ZYDIS_MNEMONIC_VPCMPEQW:
-  case ZYDIS_MNEMONIC_VPCMPEQD:
-  case ZYDIS_MNEMONIC_VPCMPEQQ:
-  case ZYDIS_MNEMONIC_PCMPGTB:
-  case ZYDIS_MNEMONIC_PCMPGTW:
-  case ZYDIS_MNEMONIC_PCMPGTD:
-  case ZYDIS_MNEMONIC_PCMPGTQ:
-  case ZYDIS_MNEMONIC_VPCMPGTB:
-  case ZYDIS_MNEMONIC_VPCMPGTW:
-  case ZYDIS_MNEMONIC_VPCMPGTD:
-  case ZYDIS_MNEMONIC_VPCMPGTQ:
-  case ZYDIS_MNEMONIC_PACKUSWB:
-  case ZYDIS_MNEMONIC_PACKUSDW:
-  case ZYDIS_MNEMONIC_VPACKUSWB:
-  case ZYDIS_MNEMONIC_VPACKUSDW:
-  case ZYDIS_MNEMONIC_PACKSSWB:
-  case ZYDIS_MNEMONIC_PACKSSDW:
-  case ZYDIS_MNEMONIC_VPACKSSWB:
-  case ZYDIS_MNEMONIC_VPACKSSDW:
-  case ZYDIS_MNEMONIC_PADDB:
-  case ZYDIS_MNEMONIC_PADDW:
-  case ZYDIS_MNEMONIC_PADDD:
-  case ZYDIS_MNEMONIC_PADDQ:
-  case ZYDIS_MNEMONIC_VPADDB:
-  case ZYDIS_MNEMONIC_VPADDW:
-  case ZYDIS_MNEMONIC_VPADDD:
-  case ZYDIS_MNEMONIC_VPADDQ:
-  case ZYDIS_MNEMONIC_ADDPS:
-  case ZYDIS_MNEMONIC_ADDPD:
-  case ZYDIS_MNEMONIC_ADDSS:
-  case ZYDIS_MNEMONIC_ADDSD:
-  case ZYDIS_MNEMONIC_VADDPS:
-  case ZYDIS_MNEMONIC_VADDPD:
-  case ZYDIS_MNEMONIC_VADDSS:
-  case ZYDIS_MNEMONIC_VADDSD:
-  case ZYDIS_MNEMONIC_PADDSB:
-  case ZYDIS_MNEMONIC_PADDSW:
-  case ZYDIS_MNEMONIC_VPADDSB:
-  case ZYDIS_MNEMONIC_VPADDSW:
-  case ZYDIS_MNEMONIC_EMMS:
-  case ZYDIS_MNEMONIC_PMADDWD:
-  case ZYDIS_MNEMONIC_VPMADDWD:
-  case ZYDIS_MNEMONIC_PMULHW:
-  case ZYDIS_MNEMONIC_VPMULHW:
-  case ZYDIS_MNEMONIC_PMULLW:
-  case ZYDIS_MNEMONIC_VPMULLW:
-  case ZYDIS_MNEMONIC_POR:
-  case ZYDIS_MNEMONIC_VPOR:
-  case ZYDIS_MNEMONIC_VPORD:
-  case ZYDIS_MNEMONIC_VPORQ:
-  case ZYDIS_MNEMONIC_PABSW:
-  case ZYDIS_MNEMONIC_VPABSW:
-  case ZYDIS_MNEMONIC_PABSB:
-  case ZYDIS_MNEMONIC_VPABSB:
-  case ZYDIS_MNEMONIC_PABSD:
-  case ZYDIS_MNEMONIC_VPABSD:
-  case ZYDIS_MNEMONIC_ADDSUBPS:
-  case ZYDIS_MNEMONIC_VADDSUBPS:
-  case ZYDIS_MNEMONIC_ADDSUBPD:
-  case ZYDIS_MNEMONIC_VADDSUBPD:
-  case ZYDIS_MNEMONIC_PALIGNR:
-  case ZYDIS_MNEMONIC_VPALIGNR:
-  case ZYDIS_MNEMONIC_PAVGB:
-  case ZYDIS_MNEMONIC_VPAVGB:
-  case ZYDIS_MNEMONIC_PAVGW:
-  case ZYDIS_MNEMONIC_VPAVGW:
-  case ZYDIS_MNEMONIC_PBLENDW:
-  case ZYDIS_MNEMONIC_VPBLENDW:
-  case ZYDIS_MNEMONIC_PBLENDVB:
-  case ZYDIS_MNEMONIC_VPBLENDVB:
-  case ZYDIS_MNEMONIC_VPBLENDD:
-  case ZYDIS_MNEMONIC_BLENDPS:
-  case ZYDIS_MNEMONIC_VBLENDPS:
-  case ZYDIS_MNEMONIC_BLENDPD:
-  case ZYDIS_MNEMONIC_VBLENDPD:
-  case ZYDIS_MNEMONIC_BLENDVPS:
-  case ZYDIS_MNEMONIC_VBLENDVPS:
-  case ZYDIS_MNEMONIC_BLENDVPD:
-  case ZYDIS_MNEMONIC_VBLENDVPD:
-  case ZYDIS_MNEMONIC_VBROADCASTF128:
-  case ZYDIS_MNEMONIC_VBROADCASTF32X2:
-  case ZYDIS_MNEMONIC_VBROADCASTF32X4:
-  case ZYDIS_MNEMONIC_VBROADCASTF32X8:
-  case ZYDIS_MNEMONIC_VBROADCASTF64X2:
-  case ZYDIS_MNEMONIC_VBROADCASTF64X4:
-  case ZYDIS_MNEMONIC_VBROADCASTI128:
-  case ZYDIS_MNEMONIC_VBROADCASTI32X2:
-  case ZYDIS_MNEMONIC_VBROADCASTI32X4:
-  case ZYDIS_MNEMONIC_VBROADCASTI32X8:
-  case ZYDIS_MNEMONIC_VBROADCASTI64X2:
-  case ZYDIS_MNEMONIC_VBROADCASTI64X4:
-  case ZYDIS_MNEMONIC_VBROADCASTSD:
-  case ZYDIS_MNEMONIC_VBROADCASTSS:
-  case ZYDIS_MNEMONIC_VPBROADCASTB:
-  case ZYDIS_MNEMONIC_VPBROADCASTD:
-  case ZYDIS_MNEMONIC_VPBROADCASTMB2Q:
-  case ZYDIS_MNEMONIC_VPBROADCASTMW2D:
-  case ZYDIS_MNEMONIC_VPBROADCASTQ:
-  case ZYDIS_MNEMONIC_VPBROADCASTW:
-  case ZYDIS_MNEMONIC_PSLLDQ:
-  case ZYDIS_MNEMONIC_VPSLLDQ:
-  case ZYDIS_MNEMONIC_PSRLDQ:
-  case ZYDIS_MNEMONIC_VPSRLDQ:
-  case ZYDIS_MNEMONIC_ROUNDSS:
-  case ZYDIS_MNEMONIC_VROUNDSS:
-  case ZYDIS_MNEMONIC_ROUNDSD:
-  case ZYDIS_MNEMONIC_VROUNDSD:
-  case ZYDIS_MNEMONIC_ROUNDPS:
-  case ZYDIS_MNEMONIC_VROUNDPS:
-  case ZYDIS_MNEMONIC_ROUNDPD:
-  case ZYDIS_MNEMONIC_VROUNDPD:
-  case ZYDIS_MNEMONIC_CLFLUSH:
-  case ZYDIS_MNEMONIC_CLFLUSHOPT:
-  case ZYDIS_MNEMONIC_CMPSS:
-  case ZYDIS_MNEMONIC_VCMPSS:
-  case ZYDIS_MNEMONIC_CMPSD:
-  case ZYDIS_MNEMONIC_VCMPSD:
-  case ZYDIS_MNEMONIC_CMPPS:
-  case ZYDIS_MNEMONIC_VCMPPS:
-  case ZYDIS_MNEMONIC_CMPPD:
-  case ZYDIS_MNEMONIC_VCMPPD:
-  case ZYDIS_MNEMONIC_PCMPESTRI:
-  case ZYDIS_MNEMONIC_PCMPESTRM:
-  case ZYDIS_MNEMONIC_COMISS:
-  case ZYDIS_MNEMONIC_VCOMISS:
-  case ZYDIS_MNEMONIC_COMISD:
-  case ZYDIS_MNEMONIC_VCOMISD:
-  case ZYDIS_MNEMONIC_VCOMISH:
-  case ZYDIS_MNEMONIC_CRC32:
-  case ZYDIS_MNEMONIC_CVTPI2PS:
-  case ZYDIS_MNEMONIC_CVTPS2PI:
-  case ZYDIS_MNEMONIC_CVTSI2SS:
-  case ZYDIS_MNEMONIC_VCVTSI2SS:
-  case ZYDIS_MNEMONIC_CVTSS2SI:
-  case ZYDIS_MNEMONIC_VCVTSS2SI:
-  case ZYDIS_MNEMONIC_PMOVSXWD:
-  case ZYDIS_MNEMONIC_VPMOVSXWD:
-  case ZYDIS_MNEMONIC_PMOVSXWQ:
-  case ZYDIS_MNEMONIC_VPMOVSXWQ:
-  case ZYDIS_MNEMONIC_PMOVSXDQ:
-  case ZYDIS_MNEMONIC_VPMOVSXDQ:
-  case ZYDIS_MNEMONIC_CVTDQ2PS:
-  case ZYDIS_MNEMONIC_VCVTDQ2PS:
-  case ZYDIS_MNEMONIC_CVTDQ2PD:
-  case ZYDIS_MNEMONIC_VCVTDQ2PD:
-  case ZYDIS_MNEMONIC_PMOVSXBW:
-  case ZYDIS_MNEMONIC_VPMOVSXBW:
-  case ZYDIS_MNEMONIC_PMOVSXBD:
-  case ZYDIS_MNEMONIC_VPMOVSXBD:
-  case ZYDIS_MNEMONIC_PMOVSXBQ:
-  case ZYDIS_MNEMONIC_VPMOVSXBQ:
-  case ZYDIS_MNEMONIC_PMOVZXWD:
-  case ZYDIS_MNEMONIC_VPMOVZXWD:
-  case ZYDIS_MNEMONIC_PMOVZXWQ:
-  case ZYDIS_MNEMONIC_VPMOVZXWQ:
-  case ZYDIS_MNEMONIC_PMOVZXDQ:
-  case ZYDIS_MNEMONIC_VPMOVZXDQ:
-  case ZYDIS_MNEMONIC_PMOVZXBW:
-  case ZYDIS_MNEMONIC_VPMOVZXBW:
-  case ZYDIS_MNEMONIC_PMOVZXBD:
-  case ZYDIS_MNEMONIC_VPMOVZXBD:
-  case ZYDIS_MNEMONIC_PMOVZXBQ:
-  case ZYDIS_MNEMONIC_VPMOVZXBQ:
-  case ZYDIS_MNEMONIC_VCVTPH2PS:
-  case ZYDIS_MNEMONIC_VCVTNEPS2BF16:
-  case ZYDIS_MNEMONIC_CVTPD2DQ:
-  case ZYDIS_MNEMONIC_VCVTPD2DQ:
-  case ZYDIS_MNEMONIC_CVTPD2PI:
-  case ZYDIS_MNEMONIC_CVTPD2PS:
-  case ZYDIS_MNEMONIC_VCVTPD2PS:
-  case ZYDIS_MNEMONIC_CVTPI2PD:
-  case ZYDIS_MNEMONIC_CVTPS2DQ:
-  case ZYDIS_MNEMONIC_VCVTPS2DQ:
-  case ZYDIS_MNEMONIC_CVTPS2PD:
-  case ZYDIS_MNEMONIC_VCVTPS2PD:
-  case ZYDIS_MNEMONIC_VCVTPS2PH:
-  case ZYDIS_MNEMONIC_CVTSD2SI:
-  case ZYDIS_MNEMONIC_VCVTSD2SI:
-  case ZYDIS_MNEMONIC_CVTSD2SS:
-  case ZYDIS_MNEMONIC_VCVTSD2SS:
-  case ZYDIS_MNEMONIC_CVTSI2SD:
-  case ZYDIS_MNEMONIC_VCVTSI2SD:
-  case ZYDIS_MNEMONIC_CVTSS2SD:
-  case ZYDIS_MNEMONIC_VCVTSS2SD:
-  case ZYDIS_MNEMONIC_CVTTPS2PI:
-  case ZYDIS_MNEMONIC_CVTTPD2DQ:
-  case ZYDIS_MNEMONIC_VCVTTPD2DQ:
-  case ZYDIS_MNEMONIC_CVTTPD2PI:
-  case ZYDIS_MNEMONIC_CVTTPS2DQ:
-  case ZYDIS_MNEMONIC_VCVTTPS2DQ:
-  case ZYDIS_MNEMONIC_CVTTSD2SI:
-  case ZYDIS_MNEMONIC_DIVPD:
-  case ZYDIS_MNEMONIC_DIVPS:
-  case ZYDIS_MNEMONIC_DIVSD:
-  case ZYDIS_MNEMONIC_DIVSS:
-  case ZYDIS_MNEMONIC_VDIVPD:
-  case ZYDIS_MNEMONIC_VDIVPS:
-  case ZYDIS_MNEMONIC_VDIVSD:
-  case ZYDIS_MNEMONIC_VDIVSS:
-  case ZYDIS_MNEMONIC_DPPD:
-  case ZYDIS_MNEMONIC_VDPPD:
-  case ZYDIS_MNEMONIC_DPPS:
-  case ZYDIS_MNEMONIC_VDPPS:
-  case ZYDIS_MNEMONIC_VPDPWSSD:
-  case ZYDIS_MNEMONIC_VPDPWSSDS:
-  case ZYDIS_MNEMONIC_VPDPBUSD:
-  case ZYDIS_MNEMONIC_VPDPBUSDS:
-  case ZYDIS_MNEMONIC_PEXTRB:
-  case ZYDIS_MNEMONIC_VPEXTRB:
-  case ZYDIS_MNEMONIC_PEXTRW:
-  case ZYDIS_MNEMONIC_VPEXTRW:
-  case ZYDIS_MNEMONIC_PEXTRD:
-  case ZYDIS_MNEMONIC_VPEXTRD:
-  case ZYDIS_MNEMONIC_PEXTRQ:
-  case ZYDIS_MNEMONIC_VPEXTRQ:
-  case ZYDIS_MNEMONIC_EXTRACTPS:
-  case ZYDIS_MNEMONIC_VEXTRACTPS:
-  case ZYDIS_MNEMONIC_VEXTRACTF128:
-  case ZYDIS_MNEMONIC_VEXTRACTI128:
-  case ZYDIS_MNEMONIC_VFMADD132PD:
-  case ZYDIS_MNEMONIC_VFMADD213PD:
-  case ZYDIS_MNEMONIC_VFMADD231PD:
-  case ZYDIS_MNEMONIC_VFMADD132PS:
-  case ZYDIS_MNEMONIC_VFMADD213PS:
-  case ZYDIS_MNEMONIC_VFMADD231PS:
-  case ZYDIS_MNEMONIC_VFMADD132SD:
-  case ZYDIS_MNEMONIC_VFMADD213SD:
-  case ZYDIS_MNEMONIC_VFMADD231SD:
-  case ZYDIS_MNEMONIC_VFMADD132SS:
-  case ZYDIS_MNEMONIC_VFMADD213SS:
-  case ZYDIS_MNEMONIC_VFMADD231SS:
-  case ZYDIS_MNEMONIC_VFMADDSUB132PD:
-  case ZYDIS_MNEMONIC_VFMADDSUB213PD:
-  case ZYDIS_MNEMONIC_VFMADDSUB231PD:
-  case ZYDIS_MNEMONIC_VFMADDSUB132PS:
-  case ZYDIS_MNEMONIC_VFMADDSUB213PS:
-  case ZYDIS_MNEMONIC_VFMADDSUB231PS:
-  case ZYDIS_MNEMONIC_VFMSUB132PD:
-  case ZYDIS_MNEMONIC_VFMSUB213PD:
-  case ZYDIS_MNEMONIC_VFMSUB231PD:
-  case ZYDIS_MNEMONIC_VFMSUB132PS:
-  case ZYDIS_MNEMONIC_VFMSUB213PS:
-  case ZYDIS_MNEMONIC_VFMSUB231PS:
-  case ZYDIS_MNEMONIC_VFMSUB132SD:
-  case ZYDIS_MNEMONIC_VFMSUB213SD:
-  case ZYDIS_MNEMONIC_VFMSUB231SD:
-  case ZYDIS_MNEMONIC_VFMSUB132SS:
-  case ZYDIS_MNEMONIC_VFMSUB213SS:
-  case ZYDIS_MNEMONIC_VFMSUB231SS:
-  case ZYDIS_MNEMONIC_VFMSUBADD132PD:
-  case ZYDIS_MNEMONIC_VFMSUBADD213PD:
-  case ZYDIS_MNEMONIC_VFMSUBADD231PD:
-  case ZYDIS_MNEMONIC_VFMSUBADD132PS:
-  case ZYDIS_MNEMONIC_VFMSUBADD213PS:
-  case ZYDIS_MNEMONIC_VFMSUBADD231PS:
-  case ZYDIS_MNEMONIC_VFNMADD132PD:
-  case ZYDIS_MNEMONIC_VFNMADD213PD:
-  case ZYDIS_MNEMONIC_VFNMADD231PD:
-  case ZYDIS_MNEMONIC_VFNMADD132PS:
-  case ZYDIS_MNEMONIC_VFNMADD213PS:
-  case ZYDIS_MNEMONIC_VFNMADD231PS:
-  case ZYDIS_MNEMONIC_VFNMADD132SD:
-  case ZYDIS_MNEMONIC_VFNMADD213SD:
-  case ZYDIS_MNEMONIC_VFNMADD231SD:
-  case ZYDIS_MNEMONIC_VFNMADD132SS:
-  case ZYDIS_MNEMONIC_VFNMADD213SS:
-  case ZYDIS_MNEMONIC_VFNMADD231SS:
-  case ZYDIS_MNEMONIC_VFNMSUB132PD:
-  case ZYDIS_MNEMONIC_VFNMSUB213PD:
-  case ZYDIS_MNEMONIC_VFNMSUB231PD:
-  case ZYDIS_MNEMONIC_VFNMSUB132PS:
-  case ZYDIS_MNEMONIC_VFNMSUB213PS:
-  case ZYDIS_MNEMONIC_VFNMSUB231PS:
-  case ZYDIS_MNEMONIC_VFNMSUB132SD:
-  case ZYDIS_MNEMONIC_VFNMSUB213SD:
-  case ZYDIS_MNEMONIC_VFNMSUB231SD:
-  case ZYDIS_MNEMONIC_VFNMSUB132SS:
-  case ZYDIS_MNEMONIC_VFNMSUB213SS:
-  case ZYDIS_MNEMONIC_VFNMSUB231SS:
-  case ZYDIS_MNEMONIC_STMXCSR:
-  case ZYDIS_MNEMONIC_PHADDW:
-  case ZYDIS_MNEMONIC_VPHADDW:
-  case ZYDIS_MNEMONIC_PHADDD:
-  case ZYDIS_MNEMONIC_VPHADDD:
-  case ZYDIS_MNEMONIC_HADDPD:
-  case ZYDIS_MNEMONIC_VHADDPD:
-  case ZYDIS_MNEMONIC_HADDPS:
-  case ZYDIS_MNEMONIC_VHADDPS:
-  case ZYDIS_MNEMONIC_PHADDSW:
-  case ZYDIS_MNEMONIC_VPHADDSW:
-  case ZYDIS_MNEMONIC_PHSUBW:
-  case ZYDIS_MNEMONIC_VPHSUBW:
-  case ZYDIS_MNEMONIC_PHSUBD:
-  case ZYDIS_MNEMONIC_VPHSUBD:
-  case ZYDIS_MNEMONIC_HSUBPD:
-  case ZYDIS_MNEMONIC_VHSUBPD:
-  case ZYDIS_MNEMONIC_HSUBPS:
-  case ZYDIS_MNEMONIC_VHSUBPS:
-  case ZYDIS_MNEMONIC_PHSUBSW:
-  case ZYDIS_MNEMONIC_VPHSUBSW:
-  case ZYDIS_MNEMONIC_VPGATHERDD:
-  case ZYDIS_MNEMONIC_VPGATHERDQ:
-  case ZYDIS_MNEMONIC_VGATHERDPD:
-  case ZYDIS_MNEMONIC_VGATHERDPS:
-  case ZYDIS_MNEMONIC_VPGATHERQD:
-  case ZYDIS_MNEMONIC_VPGATHERQQ:
-  case ZYDIS_MNEMONIC_VGATHERQPD:
-  case ZYDIS_MNEMONIC_VGATHERQPS:
-  case ZYDIS_MNEMONIC_PINSRB:
-  case ZYDIS_MNEMONIC_VPINSRB:
-  case ZYDIS_MNEMONIC_PINSRW:
-  case ZYDIS_MNEMONIC_VPINSRW:
-  case ZYDIS_MNEMONIC_PINSRD:
-  case ZYDIS_MNEMONIC_VPINSRD:
-  case ZYDIS_MNEMONIC_PINSRQ:
-  case ZYDIS_MNEMONIC_VPINSRQ:
-  case ZYDIS_MNEMONIC_INSERTPS:
-  case ZYDIS_MNEMONIC_VINSERTPS:
-  case ZYDIS_MNEMONIC_VINSERTF128:
-  case ZYDIS_MNEMONIC_VINSERTI128:
-  case ZYDIS_MNEMONIC_LFENCE:
-  case ZYDIS_MNEMONIC_MOVHPS:
-  case ZYDIS_MNEMONIC_MOVHPD:
-  case ZYDIS_MNEMONIC_VPMADD52HUQ:
-  case ZYDIS_MNEMONIC_VPMADD52LUQ:
-  case ZYDIS_MNEMONIC_PMADDUBSW:
-  case ZYDIS_MNEMONIC_VPMADDUBSW:
-  case ZYDIS_MNEMONIC_PMAXSB:
-  case ZYDIS_MNEMONIC_VPMAXSB:
-  case ZYDIS_MNEMONIC_PMAXSW:
-  case ZYDIS_MNEMONIC_VPMAXSW:
-  case ZYDIS_MNEMONIC_PMAXSD:
-  case ZYDIS_MNEMONIC_VPMAXSD:
-  case ZYDIS_MNEMONIC_VPMAXSQ:
-  case ZYDIS_MNEMONIC_PMAXUB:
-  case ZYDIS_MNEMONIC_VPMAXUB:
-  case ZYDIS_MNEMONIC_PMAXUW:
-  case ZYDIS_MNEMONIC_VPMAXUW:
-  case ZYDIS_MNEMONIC_PMAXUD:
-  case ZYDIS_MNEMONIC_VPMAXUD:
-  case ZYDIS_MNEMONIC_VPMAXUQ:
-  case ZYDIS_MNEMONIC_MAXPD:
-  case ZYDIS_MNEMONIC_VMAXPD:
-  case ZYDIS_MNEMONIC_MAXPS:
-  case ZYDIS_MNEMONIC_VMAXPS:
-  case ZYDIS_MNEMONIC_MAXSD:
-  case ZYDIS_MNEMONIC_VMAXSD:
-  case ZYDIS_MNEMONIC_MAXSS:
-  case ZYDIS_MNEMONIC_VMAXSS:
-  case ZYDIS_MNEMONIC_PMINSB:
-  case ZYDIS_MNEMONIC_VPMINSB:
-  case ZYDIS_MNEMONIC_PMINSW:
-  case ZYDIS_MNEMONIC_VPMINSW:
-  case ZYDIS_MNEMONIC_PMINSD:
-  case ZYDIS_MNEMONIC_VPMINSD:
-  case ZYDIS_MNEMONIC_VPMINSQ:
-  case ZYDIS_MNEMONIC_PMINUB:
-  case ZYDIS_MNEMONIC_VPMINUB:
-  case ZYDIS_MNEMONIC_PMINUW:
-  case ZYDIS_MNEMONIC_VPMINUW:
-  case ZYDIS_MNEMONIC_PMINUD:
-  case ZYDIS_MNEMONIC_VPMINUD:
-  case ZYDIS_MNEMONIC_VPMINUQ:
-  case ZYDIS_MNEMONIC_MINPD:
-  case ZYDIS_MNEMONIC_VMINPD:
-  case ZYDIS_MNEMONIC_MINPS:
-  case ZYDIS_MNEMONIC_VMINPS:
-  case ZYDIS_MNEMONIC_MINSD:
-  case ZYDIS_MNEMONIC_VMINSD:
-  case ZYDIS_MNEMONIC_MINSS:
-  case ZYDIS_MNEMONIC_VMINSS:
-  case ZYDIS_MNEMONIC_PHMINPOSUW:
-  case ZYDIS_MNEMONIC_VPHMINPOSUW:
-  case ZYDIS_MNEMONIC_MOVDDUP:
-  case ZYDIS_MNEMONIC_VMOVDDUP:
-  case ZYDIS_MNEMONIC_MOVSHDUP:
-  case ZYDIS_MNEMONIC_VMOVSHDUP:
-  case ZYDIS_MNEMONIC_MOVHLPS:
-  case ZYDIS_MNEMONIC_VMOVHLPS:
-  case ZYDIS_MNEMONIC_MOVSLDUP:
-  case ZYDIS_MNEMONIC_VMOVSLDUP:
-  case ZYDIS_MNEMONIC_MOVLHPS:
-  case ZYDIS_MNEMONIC_VMOVLHPS:
-  case ZYDIS_MNEMONIC_PMOVMSKB:
-  case ZYDIS_MNEMONIC_VPMOVMSKB:
-  case ZYDIS_MNEMONIC_MOVMSKPD:
-  case ZYDIS_MNEMONIC_VMOVMSKPD:
-  case ZYDIS_MNEMONIC_MOVMSKPS:
-  case ZYDIS_MNEMONIC_VMOVMSKPS:
-  case ZYDIS_MNEMONIC_MPSADBW:
-  case ZYDIS_MNEMONIC_VMPSADBW:
-  case ZYDIS_MNEMONIC_PMULDQ:
-  case ZYDIS_MNEMONIC_VPMULDQ:
-  case ZYDIS_MNEMONIC_PMULUDQ:
-  case ZYDIS_MNEMONIC_VPMULUDQ:
-  case ZYDIS_MNEMONIC_MULPD:
-  case ZYDIS_MNEMONIC_VMULPD:
-  case ZYDIS_MNEMONIC_MULPS:
-  case ZYDIS_MNEMONIC_VMULPS:
-  case ZYDIS_MNEMONIC_MULSD:
-  case ZYDIS_MNEMONIC_VMULSD:
-  case ZYDIS_MNEMONIC_MULSS:
-  case ZYDIS_MNEMONIC_VMULSS:
-  case ZYDIS_MNEMONIC_PMULHRSW:
-  case ZYDIS_MNEMONIC_VPMULHRSW:
-  case ZYDIS_MNEMONIC_PMULLD:
-  case ZYDIS_MNEMONIC_VPMULLD:
-  case ZYDIS_MNEMONIC_ORPD:
-  case ZYDIS_MNEMONIC_VORPD:
-  case ZYDIS_MNEMONIC_ORPS:
-  case ZYDIS_MNEMONIC_VORPS:
-  case ZYDIS_MNEMONIC_PAUSE:
-  case ZYDIS_MNEMONIC_VPERMILPD:
-  case ZYDIS_MNEMONIC_VPERMILPS:
-  case ZYDIS_MNEMONIC_VPERM2F128:
-  case ZYDIS_MNEMONIC_VPERM2I128:
-  case ZYDIS_MNEMONIC_VPERMQ:
-  case ZYDIS_MNEMONIC_VPERMPD:
-  case ZYDIS_MNEMONIC_VPERMPS:
-  case ZYDIS_MNEMONIC_RCPPS:
-  case ZYDIS_MNEMONIC_VRCPPS:
-  case ZYDIS_MNEMONIC_RCPSS:
-  case ZYDIS_MNEMONIC_VRCPSS:
-  case ZYDIS_MNEMONIC_RSQRTPS:
-  case ZYDIS_MNEMONIC_VRSQRTPS:
-  case ZYDIS_MNEMONIC_RSQRTSS:
-  case ZYDIS_MNEMONIC_VRSQRTSS:
-  case ZYDIS_MNEMONIC_PSADBW:
-  case ZYDIS_MNEMONIC_VPSADBW:
-  case ZYDIS_MNEMONIC_SFENCE:
-  case ZYDIS_MNEMONIC_PSHUFB:
-  case ZYDIS_MNEMONIC_PSHUFW:
-  case ZYDIS_MNEMONIC_PSHUFD:
-  case ZYDIS_MNEMONIC_VPSHUFB:
-  case ZYDIS_MNEMONIC_VPSHUFD:
-  case ZYDIS_MNEMONIC_SHUFPS:
-  case ZYDIS_MNEMONIC_VSHUFPS:
-  case ZYDIS_MNEMONIC_SHUFPD:
-  case ZYDIS_MNEMONIC_VSHUFPD:
-  case ZYDIS_MNEMONIC_PSHUFHW:
-  case ZYDIS_MNEMONIC_VPSHUFHW:
-  case ZYDIS_MNEMONIC_PSHUFLW:
-  case ZYDIS_MNEMONIC_VPSHUFLW:
-  case ZYDIS_MNEMONIC_PSIGNB:
-  case ZYDIS_MNEMONIC_VPSIGNB:
-  case ZYDIS_MNEMONIC_PSIGNW:
-  case ZYDIS_MNEMONIC_VPSIGNW:
-  case ZYDIS_MNEMONIC_PSIGND:
-  case ZYDIS_MNEMONIC_VPSIGND:
-  case ZYDIS_MNEMONIC_PSLLW:
-  case ZYDIS_MNEMONIC_VPSLLW:
-  case ZYDIS_MNEMONIC_PSLLD:
-  case ZYDIS_MNEMONIC_VPSLLD:
-  case ZYDIS_MNEMONIC_PSLLQ:
-  case ZYDIS_MNEMONIC_VPSLLQ:
-  case ZYDIS_MNEMONIC_VPSLLVD:
-  case ZYDIS_MNEMONIC_VPSLLVQ:
-  case ZYDIS_MNEMONIC_SQRTPD:
-  case ZYDIS_MNEMONIC_VSQRTPD:
-  case ZYDIS_MNEMONIC_SQRTPS:
-  case ZYDIS_MNEMONIC_VSQRTPS:
-  case ZYDIS_MNEMONIC_SQRTSD:
-  case ZYDIS_MNEMONIC_VSQRTSD:
-  case ZYDIS_MNEMONIC_SQRTSS:
-  case ZYDIS_MNEMONIC_VSQRTSS:
-  case ZYDIS_MNEMONIC_PSRAW:
-  case ZYDIS_MNEMONIC_VPSRAW:
-  case ZYDIS_MNEMONIC_PSRAD:
-  case ZYDIS_MNEMONIC_VPSRAD:
-  case ZYDIS_MNEMONIC_VPSRAQ:
-  case ZYDIS_MNEMONIC_VPSRAVW:
-  case ZYDIS_MNEMONIC_VPSRAVD:
-  case ZYDIS_MNEMONIC_VPSRAVQ:
-  case ZYDIS_MNEMONIC_PSRLW:
-  case ZYDIS_MNEMONIC_VPSRLW:
-  case ZYDIS_MNEMONIC_PSRLD:
-  case ZYDIS_MNEMONIC_VPSRLD:
-  case ZYDIS_MNEMONIC_PSRLQ:
-  case ZYDIS_MNEMONIC_VPSRLQ:
-  case ZYDIS_MNEMONIC_VPSRLVW:
-  case ZYDIS_MNEMONIC_VPSRLVD:
-  case ZYDIS_MNEMONIC_VPSRLVQ:
-  case ZYDIS_MNEMONIC_PSUBB:
-  case ZYDIS_MNEMONIC_VPSUBB:
-  case ZYDIS_MNEMONIC_PSUBW:
-  case ZYDIS_MNEMONIC_VPSUBW:
-  case ZYDIS_MNEMONIC_PSUBD:
-  case ZYDIS_MNEMONIC_VPSUBD:
-  case ZYDIS_MNEMONIC_PSUBQ:
-  case ZYDIS_MNEMONIC_VPSUBQ:
-  case ZYDIS_MNEMONIC_SUBPD:
-  case ZYDIS_MNEMONIC_VSUBPD:
-  case ZYDIS_MNEMONIC_SUBPS:
-  case ZYDIS_MNEMONIC_VSUBPS:
-  case ZYDIS_MNEMONIC_SUBSD:
-  case ZYDIS_MNEMONIC_VSUBSD:
-  case ZYDIS_MNEMONIC_SUBSS:
-  case ZYDIS_MNEMONIC_VSUBSS:
-  case ZYDIS_MNEMONIC_PSUBSB:
-  case ZYDIS_MNEMONIC_VPSUBSB:
-  case ZYDIS_MNEMONIC_PSUBSW:
-  case ZYDIS_MNEMONIC_VPSUBSW:
-  case ZYDIS_MNEMONIC_PTEST:
-  case ZYDIS_MNEMONIC_VPTEST:
-  case ZYDIS_MNEMONIC_VTESTPD:
-  case ZYDIS_MNEMONIC_VTESTPS:
-  case ZYDIS_MNEMONIC_UCOMISD:
-  case ZYDIS_MNEMONIC_UCOMISS:
-  case ZYDIS_MNEMONIC_PUNPCKHBW:
-  case ZYDIS_MNEMONIC_VPUNPCKHBW:
-  case ZYDIS_MNEMONIC_PUNPCKHWD:
-  case ZYDIS_MNEMONIC_VPUNPCKHWD:
-  case ZYDIS_MNEMONIC_PUNPCKHDQ:
-  case ZYDIS_MNEMONIC_VPUNPCKHDQ:
-  case ZYDIS_MNEMONIC_PUNPCKHQDQ:
-  case ZYDIS_MNEMONIC_VPUNPCKHQDQ:
-  case ZYDIS_MNEMONIC_UNPCKHPD:
-  case ZYDIS_MNEMONIC_VUNPCKHPD:
-  case ZYDIS_MNEMONIC_UNPCKHPS:
-  case ZYDIS_MNEMONIC_VUNPCKHPS:
-  case ZYDIS_MNEMONIC_PUNPCKLBW:
-  case ZYDIS_MNEMONIC_VPUNPCKLBW:
-  case ZYDIS_MNEMONIC_PUNPCKLWD:
-  case ZYDIS_MNEMONIC_VPUNPCKLWD:
-  case ZYDIS_MNEMONIC_PUNPCKLDQ:
-  case ZYDIS_MNEMONIC_VPUNPCKLDQ:
-  case ZYDIS_MNEMONIC_PUNPCKLQDQ:
-  case ZYDIS_MNEMONIC_VPUNPCKLQDQ:
-  case ZYDIS_MNEMONIC_UNPCKLPD:
-  case ZYDIS_MNEMONIC_VUNPCKLPD:
-  case ZYDIS_MNEMONIC_UNPCKLPS:
-  case ZYDIS_MNEMONIC_VUNPCKLPS:
-  case ZYDIS_MNEMONIC_PXOR:
-  case ZYDIS_MNEMONIC_VPXOR:
-  case ZYDIS_MNEMONIC_XORPS:
-  case ZYDIS_MNEMONIC_VXORPS:
-  case ZYDIS_MNEMONIC_XORPD:
-  case ZYDIS_MNEMONIC_VXORPD:
-  case ZYDIS_MNEMONIC_VZEROALL:
-  case ZYDIS_MNEMONIC_VZEROUPPER:
-  case ZYDIS_MNEMONIC_VP2INTERSECTD:
-  case ZYDIS_MNEMONIC_VP2INTERSECTQ:
-  case ZYDIS_MNEMONIC_VP4DPWSSD:
-  case ZYDIS_MNEMONIC_VP4DPWSSDS:
-  case ZYDIS_MNEMONIC_V4FMADDPS:
-  case ZYDIS_MNEMONIC_V4FMADDSS:
-  case ZYDIS_MNEMONIC_V4FNMADDPS:
-  case ZYDIS_MNEMONIC_V4FNMADDSS:
-  case ZYDIS_MNEMONIC_VPABSQ:
-  case ZYDIS_MNEMONIC_VADDPH:
-  case ZYDIS_MNEMONIC_VADDSH:
-  case ZYDIS_MNEMONIC_PADDUSW:
-  case ZYDIS_MNEMONIC_VPADDUSW:
-  case ZYDIS_MNEMONIC_PADDUSB:
-  case ZYDIS_MNEMONIC_VPADDUSB:
-  case ZYDIS_MNEMONIC_VALIGND:
-  case ZYDIS_MNEMONIC_VALIGNQ:
-  case ZYDIS_MNEMONIC_VANDNPS:
-  case ZYDIS_MNEMONIC_VANDNPD:
-  case ZYDIS_MNEMONIC_VPSHUFBITQMB:
-  case ZYDIS_MNEMONIC_VPBLENDMB:
-  case ZYDIS_MNEMONIC_VPBLENDMW:
-  case ZYDIS_MNEMONIC_VPBLENDMD:
-  case ZYDIS_MNEMONIC_VPBLENDMQ:
-  case ZYDIS_MNEMONIC_VBLENDMPS:
-  case ZYDIS_MNEMONIC_VBLENDMPD:
-  case ZYDIS_MNEMONIC_VPCMPB:
-  case ZYDIS_MNEMONIC_VPCMPW:
-  case ZYDIS_MNEMONIC_VPCMPD:
-  case ZYDIS_MNEMONIC_VPCMPQ:
-  case ZYDIS_MNEMONIC_VPCMPUB:
-  case ZYDIS_MNEMONIC_VPCMPUW:
-  case ZYDIS_MNEMONIC_VPCMPUD:
-  case ZYDIS_MNEMONIC_VPCMPUQ:
-  case ZYDIS_MNEMONIC_VCMPPH:
-  case ZYDIS_MNEMONIC_VFCMULCPH:
-  case ZYDIS_MNEMONIC_VFCMULCSH:
-  case ZYDIS_MNEMONIC_VPCOMPRESSB:
-  case ZYDIS_MNEMONIC_VPCOMPRESSW:
-  case ZYDIS_MNEMONIC_VPCOMPRESSD:
-  case ZYDIS_MNEMONIC_VPCOMPRESSQ:
-  case ZYDIS_MNEMONIC_VCOMPRESSPD:
-  case ZYDIS_MNEMONIC_VCOMPRESSPS:
-  case ZYDIS_MNEMONIC_VPCONFLICTD:
-  case ZYDIS_MNEMONIC_VPCONFLICTQ:
-  case ZYDIS_MNEMONIC_VCVTW2PH:
-  case ZYDIS_MNEMONIC_VCVTDQ2PH:
-  case ZYDIS_MNEMONIC_VCVTQQ2PH:
-  case ZYDIS_MNEMONIC_VCVTPD2PH:
-  case ZYDIS_MNEMONIC_VCVTUW2PH:
-  case ZYDIS_MNEMONIC_VCVTUDQ2PH:
-  case ZYDIS_MNEMONIC_VCVTUQQ2PH:
-  case ZYDIS_MNEMONIC_VCVTQQ2PS:
-  case ZYDIS_MNEMONIC_VCVTQQ2PD:
-  case ZYDIS_MNEMONIC_VCVTPH2PD:
-  case ZYDIS_MNEMONIC_VCVTPH2W:
-  case ZYDIS_MNEMONIC_VCVTPH2DQ:
-  case ZYDIS_MNEMONIC_VCVTPH2QQ:
-  case ZYDIS_MNEMONIC_VCVTPH2UW:
-  case ZYDIS_MNEMONIC_VCVTPH2UDQ:
-  case ZYDIS_MNEMONIC_VCVTPH2UQQ:
-  case ZYDIS_MNEMONIC_VCVTPD2QQ:
-  case ZYDIS_MNEMONIC_VCVTPS2QQ:
-  case ZYDIS_MNEMONIC_VCVTUDQ2PS:
-  case ZYDIS_MNEMONIC_VCVTUQQ2PS:
-  case ZYDIS_MNEMONIC_VCVTPS2UDQ:
-  case ZYDIS_MNEMONIC_VCVTPS2UQQ:
-  case ZYDIS_MNEMONIC_VCVTUDQ2PD:
-  case ZYDIS_MNEMONIC_VCVTUQQ2PD:
-  case ZYDIS_MNEMONIC_VCVTPD2UDQ:
-  case ZYDIS_MNEMONIC_VCVTPD2UQQ:
-  case ZYDIS_MNEMONIC_VCVTSI2SH:
-  case ZYDIS_MNEMONIC_VCVTUSI2SH:
-  case ZYDIS_MNEMONIC_VCVTSS2SH:
-  case ZYDIS_MNEMONIC_VCVTSD2SH:
-  case ZYDIS_MNEMONIC_VCVTSH2SI:
-  case ZYDIS_MNEMONIC_VCVTSH2USI:
-  case ZYDIS_MNEMONIC_VCVTSH2SS:
-  case ZYDIS_MNEMONIC_VCVTSH2SD:
-  case ZYDIS_MNEMONIC_VPMOVQB:
-  case ZYDIS_MNEMONIC_VPMOVDB:
-  case ZYDIS_MNEMONIC_VPMOVWB:
-  case ZYDIS_MNEMONIC_VPMOVQW:
-  case ZYDIS_MNEMONIC_VPMOVDW:
-  case ZYDIS_MNEMONIC_VPMOVQD:
-  case ZYDIS_MNEMONIC_VCVTNE2PS2BF16:
-  case ZYDIS_MNEMONIC_VCVTSD2USI:
-  case ZYDIS_MNEMONIC_VCVTSS2USI:
-  case ZYDIS_MNEMONIC_VCVTUSI2SD:
-  case ZYDIS_MNEMONIC_VCVTUSI2SS:
-  case ZYDIS_MNEMONIC_VPMOVSWB:
-  case ZYDIS_MNEMONIC_VPMOVSDB:
-  case ZYDIS_MNEMONIC_VPMOVSQB:
-  case ZYDIS_MNEMONIC_VPMOVSDW:
-  case ZYDIS_MNEMONIC_VPMOVSQW:
-  case ZYDIS_MNEMONIC_VPMOVSQD:
-  case ZYDIS_MNEMONIC_VCVTTSD2SI:
-  case ZYDIS_MNEMONIC_VCVTTSD2USI:
-  case ZYDIS_MNEMONIC_CVTTSS2SI:
-  case ZYDIS_MNEMONIC_VCVTTSS2SI:
-  case ZYDIS_MNEMONIC_VCVTTSS2USI:
-  case ZYDIS_MNEMONIC_VCVTTSH2SI:
-  case ZYDIS_MNEMONIC_VCVTTSH2USI:
-  case ZYDIS_MNEMONIC_VCVTTPH2QQ:
-  case ZYDIS_MNEMONIC_VCVTTPS2QQ:
-  case ZYDIS_MNEMONIC_VCVTTPD2QQ:
-  case ZYDIS_MNEMONIC_VCVTTPH2DQ:
-  case ZYDIS_MNEMONIC_VCVTTPH2W:
-  case ZYDIS_MNEMONIC_VCVTTPH2UQQ:
-  case ZYDIS_MNEMONIC_VCVTTPS2UQQ:
-  case ZYDIS_MNEMONIC_VCVTTPD2UQQ:
-  case ZYDIS_MNEMONIC_VCVTTPD2UDQ:
-  case ZYDIS_MNEMONIC_VCVTTPS2UDQ:
-  case ZYDIS_MNEMONIC_VCVTTPH2UDQ:
-  case ZYDIS_MNEMONIC_VCVTTPH2UW:
-  case ZYDIS_MNEMONIC_VPMOVUSWB:
-  case ZYDIS_MNEMONIC_VPMOVUSDB:
-  case ZYDIS_MNEMONIC_VPMOVUSQB:
-  case ZYDIS_MNEMONIC_VPMOVUSDW:
-  case ZYDIS_MNEMONIC_VPMOVUSQW:
-  case ZYDIS_MNEMONIC_VPMOVUSQD:
-  case ZYDIS_MNEMONIC_VCVTPH2PSX:
-  case ZYDIS_MNEMONIC_VCVTPS2PHX:
-  case ZYDIS_MNEMONIC_VDBPSADBW:
-  case ZYDIS_MNEMONIC_VDIVPH:
-  case ZYDIS_MNEMONIC_VDIVSH:
-  case ZYDIS_MNEMONIC_VDPBF16PS:
-  case ZYDIS_MNEMONIC_VEXP2PD:
-  case ZYDIS_MNEMONIC_VEXP2PS:
-  case ZYDIS_MNEMONIC_VPEXPANDB:
-  case ZYDIS_MNEMONIC_VPEXPANDW:
-  case ZYDIS_MNEMONIC_VPEXPANDD:
-  case ZYDIS_MNEMONIC_VPEXPANDQ:
-  case ZYDIS_MNEMONIC_VEXPANDPS:
-  case ZYDIS_MNEMONIC_VEXPANDPD:
-  case ZYDIS_MNEMONIC_VEXTRACTF32X4:
-  case ZYDIS_MNEMONIC_VEXTRACTF32X8:
-  case ZYDIS_MNEMONIC_VEXTRACTF64X2:
-  case ZYDIS_MNEMONIC_VEXTRACTF64X4:
-  case ZYDIS_MNEMONIC_VEXTRACTI32X4:
-  case ZYDIS_MNEMONIC_VEXTRACTI32X8:
-  case ZYDIS_MNEMONIC_VEXTRACTI64X2:
-  case ZYDIS_MNEMONIC_VEXTRACTI64X4:
-  case ZYDIS_MNEMONIC_VFCMADDCPH:
-  case ZYDIS_MNEMONIC_VFCMADDCSH:
-  case ZYDIS_MNEMONIC_VFIXUPIMMPD:
-  case ZYDIS_MNEMONIC_VFIXUPIMMPS:
-  case ZYDIS_MNEMONIC_VFIXUPIMMSD:
-  case ZYDIS_MNEMONIC_VFIXUPIMMSS:
-  case ZYDIS_MNEMONIC_VFMADDCPH:
-  case ZYDIS_MNEMONIC_VFMADDCSH:
-  case ZYDIS_MNEMONIC_VFMADD132PH:
-  case ZYDIS_MNEMONIC_VFMADD213PH:
-  case ZYDIS_MNEMONIC_VFMADD231PH:
-  case ZYDIS_MNEMONIC_VFMADD132SH:
-  case ZYDIS_MNEMONIC_VFMADD213SH:
-  case ZYDIS_MNEMONIC_VFMADD231SH:
-  case ZYDIS_MNEMONIC_VFMADDSUB132PH:
-  case ZYDIS_MNEMONIC_VFMADDSUB213PH:
-  case ZYDIS_MNEMONIC_VFMADDSUB231PH:
-  case ZYDIS_MNEMONIC_VFMSUB132PH:
-  case ZYDIS_MNEMONIC_VFMSUB213PH:
-  case ZYDIS_MNEMONIC_VFMSUB231PH:
-  case ZYDIS_MNEMONIC_VFMSUB132SH:
-  case ZYDIS_MNEMONIC_VFMSUB213SH:
-  case ZYDIS_MNEMONIC_VFMSUB231SH:
-  case ZYDIS_MNEMONIC_VFMSUBADD132PH:
-  case ZYDIS_MNEMONIC_VFMSUBADD213PH:
-  case ZYDIS_MNEMONIC_VFMSUBADD231PH:
-  case ZYDIS_MNEMONIC_VFMULCPH:
-  case ZYDIS_MNEMONIC_VFMULCSH:
-  case ZYDIS_MNEMONIC_VFNMADD132PH:
-  case ZYDIS_MNEMONIC_VFNMADD213PH:
-  case ZYDIS_MNEMONIC_VFNMADD231PH:
-  case ZYDIS_MNEMONIC_VFNMADD132SH:
-  case ZYDIS_MNEMONIC_VFNMADD213SH:
-  case ZYDIS_MNEMONIC_VFNMADD231SH:
-  case ZYDIS_MNEMONIC_VFNMSUB132PH:
-  case ZYDIS_MNEMONIC_VFNMSUB213PH:
-  case ZYDIS_MNEMONIC_VFNMSUB231PH:
-  case ZYDIS_MNEMONIC_VFNMSUB132SH:
-  case ZYDIS_MNEMONIC_VFNMSUB213SH:
-  case ZYDIS_MNEMONIC_VFNMSUB231SH:
-  case ZYDIS_MNEMONIC_VFPCLASSPD:
-  case ZYDIS_MNEMONIC_VFPCLASSPS:
-  case ZYDIS_MNEMONIC_VFPCLASSPH:
-  case ZYDIS_MNEMONIC_VGETEXPPD:
-  case ZYDIS_MNEMONIC_VGETEXPPS:
-  case ZYDIS_MNEMONIC_VGETEXPPH:
-  case ZYDIS_MNEMONIC_VGETEXPSD:
-  case ZYDIS_MNEMONIC_VGETEXPSS:
-  case ZYDIS_MNEMONIC_VGETEXPSH:
-  case ZYDIS_MNEMONIC_VGETMANTPD:
-  case ZYDIS_MNEMONIC_VGETMANTPS:
-  case ZYDIS_MNEMONIC_VGETMANTPH:
-  case ZYDIS_MNEMONIC_VGETMANTSD:
-  case ZYDIS_MNEMONIC_VGETMANTSS:
-  case ZYDIS_MNEMONIC_VGETMANTSH:
-  case ZYDIS_MNEMONIC_VPSCATTERDD:
-  case ZYDIS_MNEMONIC_VPSCATTERDQ:
-  case ZYDIS_MNEMONIC_VPSCATTERQD:
-  case ZYDIS_MNEMONIC_VPSCATTERQQ:
-  case ZYDIS_MNEMONIC_VSCATTERDPS:
-  case ZYDIS_MNEMONIC_VSCATTERDPD:
-  case ZYDIS_MNEMONIC_VSCATTERQPS:
-  case ZYDIS_MNEMONIC_VSCATTERQPD:
-  case ZYDIS_MNEMONIC_VINSERTF32X4:
-  case ZYDIS_MNEMONIC_VINSERTF32X8:
-  case ZYDIS_MNEMONIC_VINSERTF64X2:
-  case ZYDIS_MNEMONIC_VINSERTF64X4:
-  case ZYDIS_MNEMONIC_VINSERTI32X4:
-  case ZYDIS_MNEMONIC_VINSERTI32X8:
-  case ZYDIS_MNEMONIC_VINSERTI64X2:
-  case ZYDIS_MNEMONIC_VINSERTI64X4:
-  case ZYDIS_MNEMONIC_KANDNB:
-  case ZYDIS_MNEMONIC_KANDNW:
-  case ZYDIS_MNEMONIC_KANDND:
-  case ZYDIS_MNEMONIC_KANDNQ:
-  case ZYDIS_MNEMONIC_KNOTB:
-  case ZYDIS_MNEMONIC_KNOTW:
-  case ZYDIS_MNEMONIC_KNOTD:
-  case ZYDIS_MNEMONIC_KNOTQ:
-  case ZYDIS_MNEMONIC_KUNPCKBW:
-  case ZYDIS_MNEMONIC_KUNPCKWD:
-  case ZYDIS_MNEMONIC_KUNPCKDQ:
-  case ZYDIS_MNEMONIC_KXNORB:
-  case ZYDIS_MNEMONIC_KXNORW:
-  case ZYDIS_MNEMONIC_KXNORD:
-  case ZYDIS_MNEMONIC_KXNORQ:
-  case ZYDIS_MNEMONIC_VPLZCNTD:
-  case ZYDIS_MNEMONIC_VPLZCNTQ:
-  case ZYDIS_MNEMONIC_VMAXPH:
-  case ZYDIS_MNEMONIC_VMAXSH:
-  case ZYDIS_MNEMONIC_VMINPH:
-  case ZYDIS_MNEMONIC_VMINSH:
-  case ZYDIS_MNEMONIC_VPMOVB2M:
-  case ZYDIS_MNEMONIC_VPMOVW2M:
-  case ZYDIS_MNEMONIC_VPMOVD2M:
-  case ZYDIS_MNEMONIC_VPMOVQ2M:
-  case ZYDIS_MNEMONIC_VPMOVM2B:
-  case ZYDIS_MNEMONIC_VPMOVM2W:
-  case ZYDIS_MNEMONIC_VPMOVM2D:
-  case ZYDIS_MNEMONIC_VPMOVM2Q:
-  case ZYDIS_MNEMONIC_VMULPH:
-  case ZYDIS_MNEMONIC_VMULSH:
-  case ZYDIS_MNEMONIC_VSUBPH:
-  case ZYDIS_MNEMONIC_VSUBSH:
-  case ZYDIS_MNEMONIC_VCMPSH:
-  case ZYDIS_MNEMONIC_VPMULHUW:
-  case ZYDIS_MNEMONIC_VPMULHUD:
-  case ZYDIS_MNEMONIC_VPMULLQ:
-  case ZYDIS_MNEMONIC_VPMULTISHIFTQB:
-  case ZYDIS_MNEMONIC_VPERMT2B:
-  case ZYDIS_MNEMONIC_VPERMT2W:
-  case ZYDIS_MNEMONIC_VPERMT2D:
-  case ZYDIS_MNEMONIC_VPERMT2Q:
-  case ZYDIS_MNEMONIC_VPERMT2PS:
-  case ZYDIS_MNEMONIC_VPERMT2PD:
-  case ZYDIS_MNEMONIC_VPERMB:
-  case ZYDIS_MNEMONIC_VPERMW:
-  case ZYDIS_MNEMONIC_VPERMD:
-  case ZYDIS_MNEMONIC_VPOPCNTB:
-  case ZYDIS_MNEMONIC_VPOPCNTW:
-  case ZYDIS_MNEMONIC_VPOPCNTD:
-  case ZYDIS_MNEMONIC_VPOPCNTQ:
-  case ZYDIS_MNEMONIC_VRANGEPD:
-  case ZYDIS_MNEMONIC_VRANGEPS:
-  case ZYDIS_MNEMONIC_VRANGESD:
-  case ZYDIS_MNEMONIC_VRANGESS:
-  case ZYDIS_MNEMONIC_VRCPPH:
-  case ZYDIS_MNEMONIC_VRCPSH:
-  case ZYDIS_MNEMONIC_VRCP14PD:
-  case ZYDIS_MNEMONIC_VRCP14PS:
-  case ZYDIS_MNEMONIC_VRCP14SD:
-  case ZYDIS_MNEMONIC_VRCP14SS:
-  case ZYDIS_MNEMONIC_VRCP28PD:
-  case ZYDIS_MNEMONIC_VRCP28PS:
-  case ZYDIS_MNEMONIC_VRCP28SD:
-  case ZYDIS_MNEMONIC_VRCP28SS:
-  case ZYDIS_MNEMONIC_VREDUCEPD:
-  case ZYDIS_MNEMONIC_VREDUCEPS:
-  case ZYDIS_MNEMONIC_VREDUCEPH:
-  case ZYDIS_MNEMONIC_VREDUCESD:
-  case ZYDIS_MNEMONIC_VREDUCESS:
-  case ZYDIS_MNEMONIC_VREDUCESH:
-  case ZYDIS_MNEMONIC_VPROLD:
-  case ZYDIS_MNEMONIC_VPROLQ:
-  case ZYDIS_MNEMONIC_VPROLVD:
-  case ZYDIS_MNEMONIC_VPROLVQ:
-  case ZYDIS_MNEMONIC_VPRORD:
-  case ZYDIS_MNEMONIC_VPRORQ:
-  case ZYDIS_MNEMONIC_VPRORVD:
-  case ZYDIS_MNEMONIC_VPRORVQ:
-  case ZYDIS_MNEMONIC_VRNDSCALEPD:
-  case ZYDIS_MNEMONIC_VRNDSCALEPS:
-  case ZYDIS_MNEMONIC_VRNDSCALEPH:
-  case ZYDIS_MNEMONIC_VRNDSCALESD:
-  case ZYDIS_MNEMONIC_VRNDSCALESS:
-  case ZYDIS_MNEMONIC_VRNDSCALESH:
-  case ZYDIS_MNEMONIC_VRSQRTPH:
-  case ZYDIS_MNEMONIC_VRSQRTSH:
-  case ZYDIS_MNEMONIC_VRSQRT14PD:
-  case ZYDIS_MNEMONIC_VRSQRT14PS:
-  case ZYDIS_MNEMONIC_VRSQRT14SD:
-  case ZYDIS_MNEMONIC_VRSQRT14SS:
-  case ZYDIS_MNEMONIC_VRSQRT28PD:
-  case ZYDIS_MNEMONIC_VRSQRT28PS:
-  case ZYDIS_MNEMONIC_VRSQRT28SD:
-  case ZYDIS_MNEMONIC_VRSQRT28SS:
-  case ZYDIS_MNEMONIC_VSCALEFPD:
-  case ZYDIS_MNEMONIC_VSCALEFPS:
-  case ZYDIS_MNEMONIC_VSCALEFPH:
-  case ZYDIS_MNEMONIC_VSCALEFSD:
-  case ZYDIS_MNEMONIC_VSCALEFSS:
-  case ZYDIS_MNEMONIC_VSCALEFSH:
-  case ZYDIS_MNEMONIC_VPXORQ:
-  case ZYDIS_MNEMONIC_VPXORD:
-  case ZYDIS_MNEMONIC_VPSHLB:
-  case ZYDIS_MNEMONIC_VPSHLW:
-  case ZYDIS_MNEMONIC_VPSHLD:
-  case ZYDIS_MNEMONIC_VPSHLQ:
-  case ZYDIS_MNEMONIC_VPSHLDW:
-  case ZYDIS_MNEMONIC_VPSHLDD:
-  case ZYDIS_MNEMONIC_VPSHLDQ:
-  case ZYDIS_MNEMONIC_VPSHLDVW:
-  case ZYDIS_MNEMONIC_VPSHLDVD:
-  case ZYDIS_MNEMONIC_VPSHLDVQ:
-  case ZYDIS_MNEMONIC_VPSHRDW:
-  case ZYDIS_MNEMONIC_VPSHRDD:
-  case ZYDIS_MNEMONIC_VPSHRDQ:
-  case ZYDIS_MNEMONIC_VPSHRDVW:
-  case ZYDIS_MNEMONIC_VPSHRDVD:
-  case ZYDIS_MNEMONIC_VPSHRDVQ:
-  case ZYDIS_MNEMONIC_VSHUFF32X4:
-  case ZYDIS_MNEMONIC_VSHUFF64X2:
-  case ZYDIS_MNEMONIC_VSHUFI32X4:
-  case ZYDIS_MNEMONIC_VSHUFI64X2:
-  case ZYDIS_MNEMONIC_VPSLLVW:
-  case ZYDIS_MNEMONIC_VSQRTPH:
-  case ZYDIS_MNEMONIC_VSQRTSH:
-  case ZYDIS_MNEMONIC_VPSUBRD:
-  case ZYDIS_MNEMONIC_VPSUBUSB:
-  case ZYDIS_MNEMONIC_VPSUBUSW:
-  case ZYDIS_MNEMONIC_VPTERNLOGD:
-  case ZYDIS_MNEMONIC_VPTERNLOGQ:
-  case ZYDIS_MNEMONIC_VPTESTMB:
-  case ZYDIS_MNEMONIC_VPTESTMW:
-  case ZYDIS_MNEMONIC_VPTESTMD:
-  case ZYDIS_MNEMONIC_VPTESTMQ:
-  case ZYDIS_MNEMONIC_VPTESTNMB:
-  case ZYDIS_MNEMONIC_VPTESTNMW:
-  case ZYDIS_MNEMONIC_VPTESTNMD:
-  case ZYDIS_MNEMONIC_VPTESTNMQ:
-  case ZYDIS_MNEMONIC_VUCOMISH:
-  {
-    bool addressParam = false;
-    bool maySelfReference = true;
+void zydec_LinearContext_Merge(ZydecLinearContext *pContext, const ZydecLinearContext *pOther)
+{
+  for (size_t i = 0; i < ZydecLinearContextRegisterCount; i++)
+    if (pContext->regInfo[i] != pOther->regInfo[i])
+      pContext->regInfo[i] = zydec_LinearContext_NextRegisterName(pContext);
+}
 
-    if (simplifyShorthands)
-    {
-      if (pInstruction->operand_count == 3 && pOperands[1].type == ZYDIS_OPERAND_TYPE_REGISTER && pOperands[2].type == ZYDIS_OPERAND_TYPE_REGISTER && pOperands[1].reg.value == pOperands[2].reg.value)
-      {
-        switch (pInstruction->mnemonic)
-        {
-        case ZYDIS_MNEMONIC_PAND:
-        case ZYDIS_MNEMONIC_VPAND:
-        case ZYDIS_MNEMONIC_VPANDQ:
-        case ZYDIS_MNEMONIC_VPANDD:
-        case ZYDIS_MNEMONIC_POR:
-        case ZYDIS_MNEMONIC_VPOR:
-        case ZYDIS_MNEMONIC_VPORD:
-        case ZYDIS_MNEMONIC_VPORQ:
-        case ZYDIS_MNEMONIC_ORPD:
-        case ZYDIS_MNEMONIC_VORPD:
-        case ZYDIS_MNEMONIC_ORPS:
-        case ZYDIS_MNEMONIC_VORPS:
-          zydec_HintOperand(&pOperands[1], pInfo);
-          ERROR_CHECK(zydec_WriteResultOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-          ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = "));
-          ERROR_CHECK(zydec_WriteRegister(&bufferPos, &remainingSize, pOperands[1].reg.value, pInfo, false));
-          ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, ";"));
-          return true;
+bool zydec_LinearContext_WriteRegisterName(char **pBufferPos, size_t *pRemainingSize, const ZydisRegister reg, const uint32_t registerName)
+{
+  if (!zydec_WriteRegisterRaw(pBufferPos, pRemainingSize, reg))
+    return false;
 
-        case ZYDIS_MNEMONIC_PXOR:
-        case ZYDIS_MNEMONIC_VPXOR:
-        case ZYDIS_MNEMONIC_XORPS:
-        case ZYDIS_MNEMONIC_VXORPS:
-        case ZYDIS_MNEMONIC_XORPD:
-        case ZYDIS_MNEMONIC_VXORPD:
-        case ZYDIS_MNEMONIC_VPXORQ:
-        case ZYDIS_MNEMONIC_VPXORD:
-          zydec_HintValue(0, pInfo);
-          ERROR_CHECK(zydec_WriteResultOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-          ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = 0;"));
-          return true;
+  if (registerName != 0)
+  {
+    if (!zydec_WriteLiteral(pBufferPos, pRemainingSize, "_"))
+      return false;
 
-        case ZYDIS_MNEMONIC_PCMPEQB:
-        case ZYDIS_MNEMONIC_VPCMPEQB:
-        case ZYDIS_MNEMONIC_PCMPEQW:
-        case ZYDIS_MNEMONIC_VPCMPEQW:
-        case ZYDIS_MNEMONIC_PCMPEQD:
-        case ZYDIS_MNEMONIC_VPCMPEQD:
-        case ZYDIS_MNEMONIC_PCMPEQQ:
-        case ZYDIS_MNEMONIC_VPCMPEQQ:
-          zydec_HintValue((int64_t)-1, pInfo);
-          ERROR_CHECK(zydec_WriteResultOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-          ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = -1;"));
-          return true;
+    static const char syllables[256][3] = {
+      "ba", "ca", "da", "fa", "ga", "ha", "ja", "ka", "la", "ma", "na", "pa", "qa", "ra", "sa", "ta", "va", "wa", "xa", "ya", "za",
+      "be", "ce", "de", "fe", "ge", "he", "je", "ke", "le", "me", "ne", "pe", "qe", "re", "se", "te", "ve", "we", "xe", "ye", "ze",
+      "bi", "ci", "di", "fi", "gi", "hi", "ji", "ki", "li", "mi", "ni", "pi", "qi", "ri", "si", "ti", "vi", "wi", "xi", "yi", "zi",
+      "bo", "co", "do", "fo", "go", "ho", "jo", "ko", "lo", "mo", "no", "po", "qo", "ro", "so", "to", "vo", "wo", "xo", "yo", "zo",
+      "bu", "cu", "du", "fu", "gu", "hu", "ju", "ku", "lu", "mu", "nu", "pu", "qu", "ru", "su", "tu", "vu", "wu", "xu", "yu", "zu",
+      "Ba", "Ca", "Da", "Fa", "Ga", "Ha", "Ja", "Ka", "La", "Ma", "Na", "Pa", "Qa", "Ra", "Sa", "Ta", "Va", "Wa", "Xa", "Ya", "Za",
+      "Be", "Ce", "De", "Fe", "Ge", "He", "Je", "Ke", "Le", "Me", "Ne", "Pe", "Qe", "Re", "Se", "Te", "Ve", "We", "Xe", "Ye", "Ze",
+      "Bi", "Ci", "Di", "Fi", "Gi", "Hi", "Ji", "Ki", "Li", "Mi", "Ni", "Pi", "Qi", "Ri", "Si", "Ti", "Vi", "Wi", "Xi", "Yi", "Zi",
+      "Bo", "Co", "Do", "Fo", "Go", "Ho", "Jo", "Ko", "Lo", "Mo", "No", "Po", "Qo", "Ro", "So", "To", "Vo", "Wo", "Xo", "Yo", "Zo",
+      "Bu", "Cu", "Du", "Fu", "Gu", "Hu", "Ju", "Ku", "Lu", "Mu", "Nu", "Pu", "Qu", "Ru", "Su", "Tu", "Vu", "Wu", "Xu", "Yu", "Zu",
+      "a_", "b_", "c_", "d_", "e_", "f_", "g_", "h_", "i_", "j_", "k_", "l_", "m_", "n_", "o_", "p_", "q_", "r_", "s_", "t_", "u_", "v_", "w_", "x_", "y_", "z_",
+      "Ad", "An", "Sh", "In", "Cm", "Ab", "Bl", "Bs", "Ex", "6i", "7i", "9i", "4o", "6o", "7o", "9o", "4u", "6u", "7u", "9u",
+    };
 
-        default:
-          break;
-        }
-      }
-    }
+    uint32_t val = registerName;
 
-    if (pInstruction->operand_count > 1)
+    for (size_t i = 0; i < sizeof(uint32_t); i += sizeof(uint8_t))
     {
-      switch (pInstruction->mnemonic)
-      {
-      case ZYDIS_MNEMONIC_PAND:
-      case ZYDIS_MNEMONIC_VPAND:
-      case ZYDIS_MNEMONIC_VPANDQ:
-      case ZYDIS_MNEMONIC_VPANDD:
-      case ZYDIS_MNEMONIC_KANDB:
-      case ZYDIS_MNEMONIC_KANDW:
-      case ZYDIS_MNEMONIC_KANDD:
-      case ZYDIS_MNEMONIC_KANDQ:
-        zydec_HintOp(ZydecFormattingInfo::And, pInfo);
-        break;
-
-      case ZYDIS_MNEMONIC_PANDN:
-      case ZYDIS_MNEMONIC_VPANDN:
-      case ZYDIS_MNEMONIC_VPANDNQ:
-      case ZYDIS_MNEMONIC_VPANDND:
-      case ZYDIS_MNEMONIC_VANDNPS:
-      case ZYDIS_MNEMONIC_VANDNPD:
-      case ZYDIS_MNEMONIC_KANDNB:
-      case ZYDIS_MNEMONIC_KANDNW:
-      case ZYDIS_MNEMONIC_KANDND:
-      case ZYDIS_MNEMONIC_KANDNQ:
-        zydec_HintOp(ZydecFormattingInfo::AndNot, pInfo);
-        break;
-
-      case ZYDIS_MNEMONIC_PCMPEQB:
-      case ZYDIS_MNEMONIC_VPCMPEQB:
-      case ZYDIS_MNEMONIC_PCMPEQW:
-      case ZYDIS_MNEMONIC_VPCMPEQW:
-      case ZYDIS_MNEMONIC_PCMPEQD:
-      case ZYDIS_MNEMONIC_VPCMPEQD:
-      case ZYDIS_MNEMONIC_PCMPEQQ:
-      case ZYDIS_MNEMONIC_VPCMPEQQ:
-      case ZYDIS_MNEMONIC_PCMPGTB:
-      case ZYDIS_MNEMONIC_VPCMPGTB:
-      case ZYDIS_MNEMONIC_PCMPGTW:
-      case ZYDIS_MNEMONIC_VPCMPGTW:
-      case ZYDIS_MNEMONIC_PCMPGTD:
-      case ZYDIS_MNEMONIC_VPCMPGTD:
-      case ZYDIS_MNEMONIC_PCMPGTQ:
-      case ZYDIS_MNEMONIC_VPCMPGTQ:
-      case ZYDIS_MNEMONIC_CMPSS:
-      case ZYDIS_MNEMONIC_VCMPSS:
-      case ZYDIS_MNEMONIC_CMPSD:
-      case ZYDIS_MNEMONIC_VCMPSD:
-      case ZYDIS_MNEMONIC_CMPPS:
-      case ZYDIS_MNEMONIC_VCMPPS:
-      case ZYDIS_MNEMONIC_CMPPD:
-      case ZYDIS_MNEMONIC_VCMPPD:
-      case ZYDIS_MNEMONIC_VPCMPB:
-      case ZYDIS_MNEMONIC_VPCMPW:
-      case ZYDIS_MNEMONIC_VPCMPD:
-      case ZYDIS_MNEMONIC_VPCMPQ:
-      case ZYDIS_MNEMONIC_VPCMPUB:
-      case ZYDIS_MNEMONIC_VPCMPUW:
-      case ZYDIS_MNEMONIC_VPCMPUD:
-      case ZYDIS_MNEMONIC_VPCMPUQ:
-      case ZYDIS_MNEMONIC_VCMPPH:
-      case ZYDIS_MNEMONIC_VCMPSH:
-        zydec_HintOp(ZydecFormattingInfo::Cmp, pInfo);
-        break;
-
-      case ZYDIS_MNEMONIC_PACKUSWB:
-      case ZYDIS_MNEMONIC_VPACKUSWB:
-      case ZYDIS_MNEMONIC_PACKUSDW:
-      case ZYDIS_MNEMONIC_VPACKUSDW:
-      case ZYDIS_MNEMONIC_PACKSSWB:
-      case ZYDIS_MNEMONIC_VPACKSSWB:
-      case ZYDIS_MNEMONIC_PACKSSDW:
-      case ZYDIS_MNEMONIC_VPACKSSDW:
-        zydec_HintOp(ZydecFormattingInfo::Pack, pInfo);
-        break;
-
-      case ZYDIS_MNEMONIC_PADDB:
-      case ZYDIS_MNEMONIC_VPADDB:
-      case ZYDIS_MNEMONIC_PADDW:
-      case ZYDIS_MNEMONIC_VPADDW:
-      case ZYDIS_MNEMONIC_PADDD:
-      case ZYDIS_MNEMONIC_VPADDD:
-      case ZYDIS_MNEMONIC_PADDQ:
-      case ZYDIS_MNEMONIC_VPADDQ:
-      case ZYDIS_MNEMONIC_ADDPS:
-      case ZYDIS_MNEMONIC_VADDPS:
-      case ZYDIS_MNEMONIC_ADDPD:
-      case ZYDIS_MNEMONIC_VADDPD:
-      case ZYDIS_MNEMONIC_ADDSS:
-      case ZYDIS_MNEMONIC_VADDSS:
-      case ZYDIS_MNEMONIC_ADDSD:
-      case ZYDIS_MNEMONIC_VADDSD:
-      case ZYDIS_MNEMONIC_PADDSB:
-      case ZYDIS_MNEMONIC_PADDSW:
-      case ZYDIS_MNEMONIC_VPADDSB:
-      case ZYDIS_MNEMONIC_VPADDSW:
-      case ZYDIS_MNEMONIC_PHADDW:
-      case ZYDIS_MNEMONIC_VPHADDW:
-      case ZYDIS_MNEMONIC_PHADDD:
-      case ZYDIS_MNEMONIC_VPHADDD:
-      case ZYDIS_MNEMONIC_HADDPD:
-      case ZYDIS_MNEMONIC_VHADDPD:
-      case ZYDIS_MNEMONIC_HADDPS:
-      case ZYDIS_MNEMONIC_VHADDPS:
-      case ZYDIS_MNEMONIC_PHADDSW:
-      case ZYDIS_MNEMONIC_VPHADDSW:
-      case ZYDIS_MNEMONIC_VADDPH:
-      case ZYDIS_MNEMONIC_VADDSH:
-      case ZYDIS_MNEMONIC_PADDUSW:
-      case ZYDIS_MNEMONIC_VPADDUSW:
-      case ZYDIS_MNEMONIC_PADDUSB:
-      case ZYDIS_MNEMONIC_VPADDUSB:
-      case ZYDIS_MNEMONIC_KADDB:
-      case ZYDIS_MNEMONIC_KADDW:
-      case ZYDIS_MNEMONIC_KADDD:
-      case ZYDIS_MNEMONIC_KADDQ:
-        zydec_HintOp(ZydecFormattingInfo::Add, pInfo);
-        break;
-
-      case ZYDIS_MNEMONIC_PMULHW:
-      case ZYDIS_MNEMONIC_VPMULHW:
-      case ZYDIS_MNEMONIC_PMULLW:
-      case ZYDIS_MNEMONIC_VPMULLW:
-      case ZYDIS_MNEMONIC_PMULDQ:
-      case ZYDIS_MNEMONIC_VPMULDQ:
-      case ZYDIS_MNEMONIC_PMULUDQ:
-      case ZYDIS_MNEMONIC_VPMULUDQ:
-      case ZYDIS_MNEMONIC_MULPD:
-      case ZYDIS_MNEMONIC_VMULPD:
-      case ZYDIS_MNEMONIC_MULPS:
-      case ZYDIS_MNEMONIC_VMULPS:
-      case ZYDIS_MNEMONIC_MULSD:
-      case ZYDIS_MNEMONIC_VMULSD:
-      case ZYDIS_MNEMONIC_MULSS:
-      case ZYDIS_MNEMONIC_VMULSS:
-      case ZYDIS_MNEMONIC_PMULHRSW:
-      case ZYDIS_MNEMONIC_VPMULHRSW:
-      case ZYDIS_MNEMONIC_PMULLD:
-      case ZYDIS_MNEMONIC_VPMULLD:
-      case ZYDIS_MNEMONIC_VFCMULCPH:
-      case ZYDIS_MNEMONIC_VFCMULCSH:
-      case ZYDIS_MNEMONIC_VMULPH:
-      case ZYDIS_MNEMONIC_VMULSH:
-      case ZYDIS_MNEMONIC_VPMULHUW:
-      case ZYDIS_MNEMONIC_VPMULHUD:
-      case ZYDIS_MNEMONIC_VPMULLQ:
-        zydec_HintOp(ZydecFormattingInfo::Mul, pInfo);
-        break;
-
-      case ZYDIS_MNEMONIC_POR:
-      case ZYDIS_MNEMONIC_VPOR:
-      case ZYDIS_MNEMONIC_VPORD:
-      case ZYDIS_MNEMONIC_VPORQ:
-      case ZYDIS_MNEMONIC_ORPD:
-      case ZYDIS_MNEMONIC_VORPD:
-      case ZYDIS_MNEMONIC_ORPS:
-      case ZYDIS_MNEMONIC_VORPS:
-      case ZYDIS_MNEMONIC_KORB:
-      case ZYDIS_MNEMONIC_KORW:
-      case ZYDIS_MNEMONIC_KORD:
-      case ZYDIS_MNEMONIC_KORQ:
-        zydec_HintOp(ZydecFormattingInfo::Or, pInfo);
-        break;
-
-      case ZYDIS_MNEMONIC_PABSB:
-      case ZYDIS_MNEMONIC_VPABSB:
-      case ZYDIS_MNEMONIC_PABSW:
-      case ZYDIS_MNEMONIC_VPABSW:
-      case ZYDIS_MNEMONIC_PABSD:
-      case ZYDIS_MNEMONIC_VPABSD:
-      case ZYDIS_MNEMONIC_PAVGB:
-      case ZYDIS_MNEMONIC_VPAVGB:
-      case ZYDIS_MNEMONIC_PAVGW:
-      case ZYDIS_MNEMONIC_VPAVGW:
-      case ZYDIS_MNEMONIC_VPABSQ:
-        zydec_HintOp(ZydecFormattingInfo::Abs, pInfo);
-        break;
-
-      case ZYDIS_MNEMONIC_PBLENDW:
-      case ZYDIS_MNEMONIC_VPBLENDW:
-      case ZYDIS_MNEMONIC_VPBLENDD:
-      case ZYDIS_MNEMONIC_BLENDPS:
-      case ZYDIS_MNEMONIC_VBLENDPS:
-      case ZYDIS_MNEMONIC_BLENDPD:
-      case ZYDIS_MNEMONIC_VBLENDPD:
-      case ZYDIS_MNEMONIC_PBLENDVB:
-      case ZYDIS_MNEMONIC_VPBLENDVB:
-      case ZYDIS_MNEMONIC_BLENDVPS:
-      case ZYDIS_MNEMONIC_VBLENDVPS:
-      case ZYDIS_MNEMONIC_BLENDVPD:
-      case ZYDIS_MNEMONIC_VBLENDVPD:
-      case ZYDIS_MNEMONIC_VPBLENDMB:
-      case ZYDIS_MNEMONIC_VPBLENDMW:
-      case ZYDIS_MNEMONIC_VPBLENDMD:
-      case ZYDIS_MNEMONIC_VPBLENDMQ:
-      case ZYDIS_MNEMONIC_VBLENDMPS:
-      case ZYDIS_MNEMONIC_VBLENDMPD:
-        zydec_HintOp(ZydecFormattingInfo::Blend, pInfo);
-        break;
-
-      case ZYDIS_MNEMONIC_VBROADCASTF128:
-      case ZYDIS_MNEMONIC_VBROADCASTF32X2:
-      case ZYDIS_MNEMONIC_VBROADCASTF32X4:
-      case ZYDIS_MNEMONIC_VBROADCASTF32X8:
-      case ZYDIS_MNEMONIC_VBROADCASTF64X2:
-      case ZYDIS_MNEMONIC_VBROADCASTF64X4:
-      case ZYDIS_MNEMONIC_VBROADCASTI128:
-      case ZYDIS_MNEMONIC_VBROADCASTI32X2:
-      case ZYDIS_MNEMONIC_VBROADCASTI32X4:
-      case ZYDIS_MNEMONIC_VBROADCASTI32X8:
-      case ZYDIS_MNEMONIC_VBROADCASTI64X2:
-      case ZYDIS_MNEMONIC_VBROADCASTI64X4:
-      case ZYDIS_MNEMONIC_VBROADCASTSD:
-      case ZYDIS_MNEMONIC_VBROADCASTSS:
-      case ZYDIS_MNEMONIC_VPBROADCASTB:
-      case ZYDIS_MNEMONIC_VPBROADCASTW:
-      case ZYDIS_MNEMONIC_VPBROADCASTD:
-      case ZYDIS_MNEMONIC_VPBROADCASTQ:
-      case ZYDIS_MNEMONIC_VPBROADCASTMB2Q:
-      case ZYDIS_MNEMONIC_VPBROADCASTMW2D:
-        zydec_HintOp(ZydecFormattingInfo::Broadcast, pInfo);
-        break;
-
-      case ZYDIS_MNEMONIC_PSLLDQ:
-      case ZYDIS_MNEMONIC_VPSLLDQ:
-      case ZYDIS_MNEMONIC_PSLLW:
-      case ZYDIS_MNEMONIC_VPSLLW:
-      case ZYDIS_MNEMONIC_PSLLD:
-      case ZYDIS_MNEMONIC_VPSLLD:
-      case ZYDIS_MNEMONIC_PSLLQ:
-      case ZYDIS_MNEMONIC_VPSLLQ:
-      case ZYDIS_MNEMONIC_VPSLLVD:
-      case ZYDIS_MNEMONIC_VPSLLVQ:
-      case ZYDIS_MNEMONIC_VPSHLB:
-      case ZYDIS_MNEMONIC_VPSHLW:
-      case ZYDIS_MNEMONIC_VPSHLD:
-      case ZYDIS_MNEMONIC_VPSHLQ:
-      case ZYDIS_MNEMONIC_VPSLLVW:
-        zydec_HintOp(ZydecFormattingInfo::ShL, pInfo);
-        break;
-
-      case ZYDIS_MNEMONIC_PSRLDQ:
-      case ZYDIS_MNEMONIC_VPSRLDQ:
-      case ZYDIS_MNEMONIC_PSRAW:
-      case ZYDIS_MNEMONIC_VPSRAW:
-      case ZYDIS_MNEMONIC_PSRAD:
-      case ZYDIS_MNEMONIC_VPSRAD:
-      case ZYDIS_MNEMONIC_VPSRAQ:
-      case ZYDIS_MNEMONIC_VPSRAVW:
-      case ZYDIS_MNEMONIC_VPSRAVD:
-      case ZYDIS_MNEMONIC_VPSRAVQ:
-      case ZYDIS_MNEMONIC_PSRLW:
-      case ZYDIS_MNEMONIC_VPSRLW:
-      case ZYDIS_MNEMONIC_PSRLD:
-      case ZYDIS_MNEMONIC_VPSRLD:
-      case ZYDIS_MNEMONIC_PSRLQ:
-      case ZYDIS_MNEMONIC_VPSRLQ:
-      case ZYDIS_MNEMONIC_VPSRLVW:
-      case ZYDIS_MNEMONIC_VPSRLVD:
-      case ZYDIS_MNEMONIC_VPSRLVQ:
-        zydec_HintOp(ZydecFormattingInfo::ShR, pInfo);
-        break;
-
-      case ZYDIS_MNEMONIC_ROUNDSS:
-      case ZYDIS_MNEMONIC_VROUNDSS:
-      case ZYDIS_MNEMONIC_ROUNDSD:
-      case ZYDIS_MNEMONIC_VROUNDSD:
-      case ZYDIS_MNEMONIC_ROUNDPS:
-      case ZYDIS_MNEMONIC_VROUNDPS:
-      case ZYDIS_MNEMONIC_ROUNDPD:
-      case ZYDIS_MNEMONIC_VROUNDPD:
-        zydec_HintOp(ZydecFormattingInfo::Round, pInfo);
-        break;
-
-      case ZYDIS_MNEMONIC_CVTPI2PS:
-      case ZYDIS_MNEMONIC_CVTPS2PI:
-      case ZYDIS_MNEMONIC_CVTSI2SS:
-      case ZYDIS_MNEMONIC_VCVTSI2SS:
-      case ZYDIS_MNEMONIC_CVTSS2SI:
-      case ZYDIS_MNEMONIC_VCVTSS2SI:
-      case ZYDIS_MNEMONIC_PMOVSXWD:
-      case ZYDIS_MNEMONIC_VPMOVSXWD:
-      case ZYDIS_MNEMONIC_PMOVSXWQ:
-      case ZYDIS_MNEMONIC_VPMOVSXWQ:
-      case ZYDIS_MNEMONIC_PMOVSXDQ:
-      case ZYDIS_MNEMONIC_VPMOVSXDQ:
-      case ZYDIS_MNEMONIC_CVTDQ2PS:
-      case ZYDIS_MNEMONIC_VCVTDQ2PS:
-      case ZYDIS_MNEMONIC_CVTDQ2PD:
-      case ZYDIS_MNEMONIC_VCVTDQ2PD:
-      case ZYDIS_MNEMONIC_PMOVSXBW:
-      case ZYDIS_MNEMONIC_VPMOVSXBW:
-      case ZYDIS_MNEMONIC_PMOVSXBD:
-      case ZYDIS_MNEMONIC_VPMOVSXBD:
-      case ZYDIS_MNEMONIC_PMOVSXBQ:
-      case ZYDIS_MNEMONIC_VPMOVSXBQ:
-      case ZYDIS_MNEMONIC_PMOVZXWD:
-      case ZYDIS_MNEMONIC_VPMOVZXWD:
-      case ZYDIS_MNEMONIC_PMOVZXWQ:
-      case ZYDIS_MNEMONIC_VPMOVZXWQ:
-      case ZYDIS_MNEMONIC_PMOVZXDQ:
-      case ZYDIS_MNEMONIC_VPMOVZXDQ:
-      case ZYDIS_MNEMONIC_PMOVZXBW:
-      case ZYDIS_MNEMONIC_VPMOVZXBW:
-      case ZYDIS_MNEMONIC_PMOVZXBD:
-      case ZYDIS_MNEMONIC_VPMOVZXBD:
-      case ZYDIS_MNEMONIC_PMOVZXBQ:
-      case ZYDIS_MNEMONIC_VPMOVZXBQ:
-      case ZYDIS_MNEMONIC_VCVTPH2PS:
-      case ZYDIS_MNEMONIC_VCVTNEPS2BF16:
-      case ZYDIS_MNEMONIC_CVTPD2DQ:
-      case ZYDIS_MNEMONIC_VCVTPD2DQ:
-      case ZYDIS_MNEMONIC_CVTPD2PI:
-      case ZYDIS_MNEMONIC_CVTPD2PS:
-      case ZYDIS_MNEMONIC_VCVTPD2PS:
-      case ZYDIS_MNEMONIC_CVTPI2PD:
-      case ZYDIS_MNEMONIC_CVTPS2DQ:
-      case ZYDIS_MNEMONIC_VCVTPS2DQ:
-      case ZYDIS_MNEMONIC_CVTPS2PD:
-      case ZYDIS_MNEMONIC_VCVTPS2PD:
-      case ZYDIS_MNEMONIC_VCVTPS2PH:
-      case ZYDIS_MNEMONIC_CVTSD2SI:
-      case ZYDIS_MNEMONIC_VCVTSD2SI:
-      case ZYDIS_MNEMONIC_CVTSD2SS:
-      case ZYDIS_MNEMONIC_VCVTSD2SS:
-      case ZYDIS_MNEMONIC_CVTSI2SD:
-      case ZYDIS_MNEMONIC_VCVTSI2SD:
-      case ZYDIS_MNEMONIC_CVTSS2SD:
-      case ZYDIS_MNEMONIC_VCVTSS2SD:
-      case ZYDIS_MNEMONIC_CVTTPS2PI:
-      case ZYDIS_MNEMONIC_CVTTPD2DQ:
-      case ZYDIS_MNEMONIC_VCVTTPD2DQ:
-      case ZYDIS_MNEMONIC_CVTTPD2PI:
-      case ZYDIS_MNEMONIC_CVTTPS2DQ:
-      case ZYDIS_MNEMONIC_VCVTTPS2DQ:
-      case ZYDIS_MNEMONIC_CVTTSD2SI:
-      case ZYDIS_MNEMONIC_VCVTW2PH:
-      case ZYDIS_MNEMONIC_VCVTDQ2PH:
-      case ZYDIS_MNEMONIC_VCVTQQ2PH:
-      case ZYDIS_MNEMONIC_VCVTPD2PH:
-      case ZYDIS_MNEMONIC_VCVTUW2PH:
-      case ZYDIS_MNEMONIC_VCVTUDQ2PH:
-      case ZYDIS_MNEMONIC_VCVTUQQ2PH:
-      case ZYDIS_MNEMONIC_VCVTQQ2PS:
-      case ZYDIS_MNEMONIC_VCVTQQ2PD:
-      case ZYDIS_MNEMONIC_VCVTPH2PD:
-      case ZYDIS_MNEMONIC_VCVTPH2W:
-      case ZYDIS_MNEMONIC_VCVTPH2DQ:
-      case ZYDIS_MNEMONIC_VCVTPH2QQ:
-      case ZYDIS_MNEMONIC_VCVTPH2UW:
-      case ZYDIS_MNEMONIC_VCVTPH2UDQ:
-      case ZYDIS_MNEMONIC_VCVTPH2UQQ:
-      case ZYDIS_MNEMONIC_VCVTPD2QQ:
-      case ZYDIS_MNEMONIC_VCVTPS2QQ:
-      case ZYDIS_MNEMONIC_VCVTUDQ2PS:
-      case ZYDIS_MNEMONIC_VCVTUQQ2PS:
-      case ZYDIS_MNEMONIC_VCVTPS2UDQ:
-      case ZYDIS_MNEMONIC_VCVTPS2UQQ:
-      case ZYDIS_MNEMONIC_VCVTUDQ2PD:
-      case ZYDIS_MNEMONIC_VCVTUQQ2PD:
-      case ZYDIS_MNEMONIC_VCVTPD2UDQ:
-      case ZYDIS_MNEMONIC_VCVTPD2UQQ:
-      case ZYDIS_MNEMONIC_VCVTSI2SH:
-      case ZYDIS_MNEMONIC_VCVTUSI2SH:
-      case ZYDIS_MNEMONIC_VCVTSS2SH:
-      case ZYDIS_MNEMONIC_VCVTSD2SH:
-      case ZYDIS_MNEMONIC_VCVTSH2SI:
-      case ZYDIS_MNEMONIC_VCVTSH2USI:
-      case ZYDIS_MNEMONIC_VCVTSH2SS:
-      case ZYDIS_MNEMONIC_VCVTSH2SD:
-      case ZYDIS_MNEMONIC_VPMOVQB:
-      case ZYDIS_MNEMONIC_VPMOVDB:
-      case ZYDIS_MNEMONIC_VPMOVWB:
-      case ZYDIS_MNEMONIC_VPMOVQW:
-      case ZYDIS_MNEMONIC_VPMOVDW:
-      case ZYDIS_MNEMONIC_VPMOVQD:
-      case ZYDIS_MNEMONIC_VCVTNE2PS2BF16:
-      case ZYDIS_MNEMONIC_VCVTSD2USI:
-      case ZYDIS_MNEMONIC_VCVTSS2USI:
-      case ZYDIS_MNEMONIC_VCVTUSI2SD:
-      case ZYDIS_MNEMONIC_VCVTUSI2SS:
-      case ZYDIS_MNEMONIC_VPMOVSWB:
-      case ZYDIS_MNEMONIC_VPMOVSDB:
-      case ZYDIS_MNEMONIC_VPMOVSQB:
-      case ZYDIS_MNEMONIC_VPMOVSDW:
-      case ZYDIS_MNEMONIC_VPMOVSQW:
-      case ZYDIS_MNEMONIC_VPMOVSQD:
-      case ZYDIS_MNEMONIC_VCVTTSD2SI:
-      case ZYDIS_MNEMONIC_VCVTTSD2USI:
-      case ZYDIS_MNEMONIC_CVTTSS2SI:
-      case ZYDIS_MNEMONIC_VCVTTSS2USI:
-      case ZYDIS_MNEMONIC_VCVTTSH2SI:
-      case ZYDIS_MNEMONIC_VCVTTSH2USI:
-      case ZYDIS_MNEMONIC_VCVTTPH2QQ:
-      case ZYDIS_MNEMONIC_VCVTTPS2QQ:
-      case ZYDIS_MNEMONIC_VCVTTPD2QQ:
-      case ZYDIS_MNEMONIC_VCVTTPH2DQ:
-      case ZYDIS_MNEMONIC_VCVTTPH2W:
-      case ZYDIS_MNEMONIC_VCVTTPH2UQQ:
-      case ZYDIS_MNEMONIC_VCVTTPS2UQQ:
-      case ZYDIS_MNEMONIC_VCVTTPD2UQQ:
-      case ZYDIS_MNEMONIC_VCVTTPD2UDQ:
-      case ZYDIS_MNEMONIC_VCVTTPH2UDQ:
-      case ZYDIS_MNEMONIC_VCVTTPH2UW:
-      case ZYDIS_MNEMONIC_VPMOVUSWB:
-      case ZYDIS_MNEMONIC_VPMOVUSDB:
-      case ZYDIS_MNEMONIC_VPMOVUSQB:
-      case ZYDIS_MNEMONIC_VPMOVUSDW:
-      case ZYDIS_MNEMONIC_VPMOVUSQW:
-      case ZYDIS_MNEMONIC_VPMOVUSQD:
-      case ZYDIS_MNEMONIC_VCVTPH2PSX:
-      case ZYDIS_MNEMONIC_VCVTPS2PHX:
-        zydec_HintOp(ZydecFormattingInfo::Convert, pInfo);
-        break;
-
-      case ZYDIS_MNEMONIC_DIVPD:
-      case ZYDIS_MNEMONIC_VDIVPD:
-      case ZYDIS_MNEMONIC_DIVPS:
-      case ZYDIS_MNEMONIC_VDIVPS:
-      case ZYDIS_MNEMONIC_DIVSD:
-      case ZYDIS_MNEMONIC_VDIVSD:
-      case ZYDIS_MNEMONIC_DIVSS:
-      case ZYDIS_MNEMONIC_VDIVSS:
-      case ZYDIS_MNEMONIC_VDIVPH:
-      case ZYDIS_MNEMONIC_VDIVSH:
-        zydec_HintOp(ZydecFormattingInfo::Div, pInfo);
-        break;
-
-      case ZYDIS_MNEMONIC_DPPD:
-      case ZYDIS_MNEMONIC_VDPPD:
-      case ZYDIS_MNEMONIC_DPPS:
-      case ZYDIS_MNEMONIC_VDPPS:
-        zydec_HintOp(ZydecFormattingInfo::DotProduct, pInfo);
-        break;
-
-      case ZYDIS_MNEMONIC_PEXTRB:
-      case ZYDIS_MNEMONIC_VPEXTRB:
-      case ZYDIS_MNEMONIC_PEXTRW:
-      case ZYDIS_MNEMONIC_VPEXTRW:
-      case ZYDIS_MNEMONIC_PEXTRD:
-      case ZYDIS_MNEMONIC_VPEXTRD:
-      case ZYDIS_MNEMONIC_PEXTRQ:
-      case ZYDIS_MNEMONIC_VPEXTRQ:
-      case ZYDIS_MNEMONIC_EXTRACTPS:
-      case ZYDIS_MNEMONIC_VEXTRACTPS:
-      case ZYDIS_MNEMONIC_VEXTRACTF128:
-      case ZYDIS_MNEMONIC_VEXTRACTI128:
-      case ZYDIS_MNEMONIC_VEXTRACTF32X4:
-      case ZYDIS_MNEMONIC_VEXTRACTF32X8:
-      case ZYDIS_MNEMONIC_VEXTRACTF64X2:
-      case ZYDIS_MNEMONIC_VEXTRACTF64X4:
-      case ZYDIS_MNEMONIC_VEXTRACTI32X4:
-      case ZYDIS_MNEMONIC_VEXTRACTI32X8:
-      case ZYDIS_MNEMONIC_VEXTRACTI64X2:
-      case ZYDIS_MNEMONIC_VEXTRACTI64X4:
-        zydec_HintOp(ZydecFormattingInfo::Extract, pInfo);
-        break;
-
-      case ZYDIS_MNEMONIC_PHSUBW:
-      case ZYDIS_MNEMONIC_VPHSUBW:
-      case ZYDIS_MNEMONIC_PHSUBD:
-      case ZYDIS_MNEMONIC_VPHSUBD:
-      case ZYDIS_MNEMONIC_HSUBPD:
-      case ZYDIS_MNEMONIC_VHSUBPD:
-      case ZYDIS_MNEMONIC_HSUBPS:
-      case ZYDIS_MNEMONIC_VHSUBPS:
-      case ZYDIS_MNEMONIC_PHSUBSW:
-      case ZYDIS_MNEMONIC_VPHSUBSW:
-      case ZYDIS_MNEMONIC_PSUBB:
-      case ZYDIS_MNEMONIC_VPSUBB:
-      case ZYDIS_MNEMONIC_PSUBW:
-      case ZYDIS_MNEMONIC_VPSUBW:
-      case ZYDIS_MNEMONIC_PSUBD:
-      case ZYDIS_MNEMONIC_VPSUBD:
-      case ZYDIS_MNEMONIC_PSUBQ:
-      case ZYDIS_MNEMONIC_VPSUBQ:
-      case ZYDIS_MNEMONIC_SUBPD:
-      case ZYDIS_MNEMONIC_VSUBPD:
-      case ZYDIS_MNEMONIC_SUBPS:
-      case ZYDIS_MNEMONIC_VSUBPS:
-      case ZYDIS_MNEMONIC_SUBSD:
-      case ZYDIS_MNEMONIC_VSUBSD:
-      case ZYDIS_MNEMONIC_SUBSS:
-      case ZYDIS_MNEMONIC_VSUBSS:
-      case ZYDIS_MNEMONIC_PSUBSB:
-      case ZYDIS_MNEMONIC_VPSUBSB:
-      case ZYDIS_MNEMONIC_PSUBSW:
-      case ZYDIS_MNEMONIC_VPSUBSW:
-      case ZYDIS_MNEMONIC_VSUBPH:
-      case ZYDIS_MNEMONIC_VSUBSH:
-      case ZYDIS_MNEMONIC_VPSUBUSB:
-      case ZYDIS_MNEMONIC_VPSUBUSW:
-        zydec_HintOp(ZydecFormattingInfo::Sub, pInfo);
-        break;
-
-      case ZYDIS_MNEMONIC_VPGATHERDD:
-      case ZYDIS_MNEMONIC_VPGATHERDQ:
-      case ZYDIS_MNEMONIC_VGATHERDPD:
-      case ZYDIS_MNEMONIC_VGATHERDPS:
-      case ZYDIS_MNEMONIC_VPGATHERQD:
-      case ZYDIS_MNEMONIC_VPGATHERQQ:
-      case ZYDIS_MNEMONIC_VGATHERQPD:
-      case ZYDIS_MNEMONIC_VGATHERQPS:
-        zydec_HintOp(ZydecFormattingInfo::Gather, pInfo);
-        break;
-
-      case ZYDIS_MNEMONIC_MOVHPS:
-      case ZYDIS_MNEMONIC_MOVHPD:
-        zydec_HintOp(ZydecFormattingInfo::Mov, pInfo);
-        break;
-
-      case ZYDIS_MNEMONIC_PMAXSB:
-      case ZYDIS_MNEMONIC_VPMAXSB:
-      case ZYDIS_MNEMONIC_PMAXSW:
-      case ZYDIS_MNEMONIC_VPMAXSW:
-      case ZYDIS_MNEMONIC_PMAXSD:
-      case ZYDIS_MNEMONIC_VPMAXSD:
-      case ZYDIS_MNEMONIC_VPMAXSQ:
-      case ZYDIS_MNEMONIC_PMAXUB:
-      case ZYDIS_MNEMONIC_VPMAXUB:
-      case ZYDIS_MNEMONIC_PMAXUW:
-      case ZYDIS_MNEMONIC_VPMAXUW:
-      case ZYDIS_MNEMONIC_PMAXUD:
-      case ZYDIS_MNEMONIC_VPMAXUD:
-      case ZYDIS_MNEMONIC_VPMAXUQ:
-      case ZYDIS_MNEMONIC_MAXPD:
-      case ZYDIS_MNEMONIC_VMAXPD:
-      case ZYDIS_MNEMONIC_MAXPS:
-      case ZYDIS_MNEMONIC_VMAXPS:
-      case ZYDIS_MNEMONIC_MAXSD:
-      case ZYDIS_MNEMONIC_VMAXSD:
-      case ZYDIS_MNEMONIC_MAXSS:
-      case ZYDIS_MNEMONIC_VMAXSS:
-      case ZYDIS_MNEMONIC_VMAXPH:
-      case ZYDIS_MNEMONIC_VMAXSH:
-        zydec_HintOp(ZydecFormattingInfo::Max, pInfo);
-        break;
-
-      case ZYDIS_MNEMONIC_PMINSB:
-      case ZYDIS_MNEMONIC_VPMINSB:
-      case ZYDIS_MNEMONIC_PMINSW:
-      case ZYDIS_MNEMONIC_VPMINSW:
-      case ZYDIS_MNEMONIC_PMINSD:
-      case ZYDIS_MNEMONIC_VPMINSD:
-      case ZYDIS_MNEMONIC_VPMINSQ:
-      case ZYDIS_MNEMONIC_PMINUB:
-      case ZYDIS_MNEMONIC_VPMINUB:
-      case ZYDIS_MNEMONIC_PMINUW:
-      case ZYDIS_MNEMONIC_VPMINUW:
-      case ZYDIS_MNEMONIC_PMINUD:
-      case ZYDIS_MNEMONIC_VPMINUD:
-      case ZYDIS_MNEMONIC_VPMINUQ:
-      case ZYDIS_MNEMONIC_MINPD:
-      case ZYDIS_MNEMONIC_VMINPD:
-      case ZYDIS_MNEMONIC_MINPS:
-      case ZYDIS_MNEMONIC_VMINPS:
-      case ZYDIS_MNEMONIC_MINSD:
-      case ZYDIS_MNEMONIC_VMINSD:
-      case ZYDIS_MNEMONIC_MINSS:
-      case ZYDIS_MNEMONIC_VMINSS:
-      case ZYDIS_MNEMONIC_VMINPH:
-      case ZYDIS_MNEMONIC_VMINSH:
-        zydec_HintOp(ZydecFormattingInfo::Min, pInfo);
-        break;
+      const uint8_t seg = (uint8_t)(val & 0xFF);
 
-      case ZYDIS_MNEMONIC_PMOVMSKB:
-      case ZYDIS_MNEMONIC_VPMOVMSKB:
-      case ZYDIS_MNEMONIC_MOVMSKPD:
-      case ZYDIS_MNEMONIC_VMOVMSKPD:
-      case ZYDIS_MNEMONIC_MOVMSKPS:
-      case ZYDIS_MNEMONIC_VMOVMSKPS:
-      case ZYDIS_MNEMONIC_VPMOVB2M:
-      case ZYDIS_MNEMONIC_VPMOVW2M:
-      case ZYDIS_MNEMONIC_VPMOVD2M:
-      case ZYDIS_MNEMONIC_VPMOVQ2M:
-      case ZYDIS_MNEMONIC_VPMOVM2B:
-      case ZYDIS_MNEMONIC_VPMOVM2W:
-      case ZYDIS_MNEMONIC_VPMOVM2D:
-      case ZYDIS_MNEMONIC_VPMOVM2Q:
-        zydec_HintOp(ZydecFormattingInfo::Mask, pInfo);
-        break;
+      if (!zydec_WriteRaw(pBufferPos, pRemainingSize, syllables[seg], 2))
+        return false;
 
-      case ZYDIS_MNEMONIC_VPERMILPD:
-      case ZYDIS_MNEMONIC_VPERMILPS:
-      case ZYDIS_MNEMONIC_VPERM2F128:
-      case ZYDIS_MNEMONIC_VPERM2I128:
-      case ZYDIS_MNEMONIC_VPERMQ:
-      case ZYDIS_MNEMONIC_VPERMPD:
-      case ZYDIS_MNEMONIC_VPERMPS:
-        zydec_HintOp(ZydecFormattingInfo::Permute, pInfo);
-        break;
+      val >>= 8;
+    }
+  }
 
-      case ZYDIS_MNEMONIC_PSHUFB:
-      case ZYDIS_MNEMONIC_VPSHUFB:
-      case ZYDIS_MNEMONIC_PSHUFW:
-      case ZYDIS_MNEMONIC_PSHUFD:
-      case ZYDIS_MNEMONIC_VPSHUFD:
-      case ZYDIS_MNEMONIC_SHUFPS:
-      case ZYDIS_MNEMONIC_VSHUFPS:
-      case ZYDIS_MNEMONIC_SHUFPD:
-      case ZYDIS_MNEMONIC_VSHUFPD:
-      case ZYDIS_MNEMONIC_PSHUFHW:
-      case ZYDIS_MNEMONIC_VPSHUFHW:
-      case ZYDIS_MNEMONIC_PSHUFLW:
-      case ZYDIS_MNEMONIC_VPSHUFLW:
-      case ZYDIS_MNEMONIC_VPSHUFBITQMB:
-      case ZYDIS_MNEMONIC_VSHUFF32X4:
-      case ZYDIS_MNEMONIC_VSHUFF64X2:
-      case ZYDIS_MNEMONIC_VSHUFI32X4:
-      case ZYDIS_MNEMONIC_VSHUFI64X2:
-        zydec_HintOp(ZydecFormattingInfo::Shuffle, pInfo);
-        break;
+  return true;
+}
 
-      case ZYDIS_MNEMONIC_PTEST:
-      case ZYDIS_MNEMONIC_VPTEST:
-      case ZYDIS_MNEMONIC_VTESTPD:
-      case ZYDIS_MNEMONIC_VTESTPS:
-        zydec_HintOp(ZydecFormattingInfo::Test, pInfo);
-        break;
+bool zydec_LinearContext_WriteRegister(char **pBufferPos, size_t *pRemainingSize, const ZydisRegister reg, void *pUserData)
+{
+  ZydecLinearContextFormatInfo *pInfo = static_cast<ZydecLinearContextFormatInfo *>(pUserData);
 
-      case ZYDIS_MNEMONIC_PUNPCKHBW:
-      case ZYDIS_MNEMONIC_VPUNPCKHBW:
-      case ZYDIS_MNEMONIC_PUNPCKHWD:
-      case ZYDIS_MNEMONIC_VPUNPCKHWD:
-      case ZYDIS_MNEMONIC_PUNPCKHDQ:
-      case ZYDIS_MNEMONIC_VPUNPCKHDQ:
-      case ZYDIS_MNEMONIC_PUNPCKHQDQ:
-      case ZYDIS_MNEMONIC_VPUNPCKHQDQ:
-      case ZYDIS_MNEMONIC_UNPCKHPD:
-      case ZYDIS_MNEMONIC_VUNPCKHPD:
-      case ZYDIS_MNEMONIC_UNPCKHPS:
-      case ZYDIS_MNEMONIC_VUNPCKHPS:
-      case ZYDIS_MNEMONIC_PUNPCKLBW:
-      case ZYDIS_MNEMONIC_VPUNPCKLBW:
-      case ZYDIS_MNEMONIC_PUNPCKLWD:
-      case ZYDIS_MNEMONIC_VPUNPCKLWD:
-      case ZYDIS_MNEMONIC_PUNPCKLDQ:
-      case ZYDIS_MNEMONIC_VPUNPCKLDQ:
-      case ZYDIS_MNEMONIC_PUNPCKLQDQ:
-      case ZYDIS_MNEMONIC_VPUNPCKLQDQ:
-      case ZYDIS_MNEMONIC_UNPCKLPD:
-      case ZYDIS_MNEMONIC_VUNPCKLPD:
-      case ZYDIS_MNEMONIC_UNPCKLPS:
-      case ZYDIS_MNEMONIC_VUNPCKLPS:
-      case ZYDIS_MNEMONIC_KUNPCKBW:
-      case ZYDIS_MNEMONIC_KUNPCKWD:
-      case ZYDIS_MNEMONIC_KUNPCKDQ:
-        zydec_HintOp(ZydecFormattingInfo::Unpack, pInfo);
-        break;
+  return zydec_LinearContext_WriteRegisterName(pBufferPos, pRemainingSize, reg, zydec_LinearContext_GetName(pInfo->pContext, reg));
+}
 
-      case ZYDIS_MNEMONIC_PXOR:
-      case ZYDIS_MNEMONIC_VPXOR:
-      case ZYDIS_MNEMONIC_XORPS:
-      case ZYDIS_MNEMONIC_VXORPS:
-      case ZYDIS_MNEMONIC_XORPD:
-      case ZYDIS_MNEMONIC_VXORPD:
-        zydec_HintOp(ZydecFormattingInfo::XOr, pInfo);
-        break;
+uint32_t zydec_LinearContext_GetRegisterName(const ZydisRegister reg, void *pUserData)
+{
+  ZydecLinearContextFormatInfo *pInfo = static_cast<ZydecLinearContextFormatInfo *>(pUserData);
 
-      case ZYDIS_MNEMONIC_KNOTB:
-      case ZYDIS_MNEMONIC_KNOTW:
-      case ZYDIS_MNEMONIC_KNOTD:
-      case ZYDIS_MNEMONIC_KNOTQ:
-        zydec_HintOp(ZydecFormattingInfo::Not, pInfo);
-        break;
+  return zydec_LinearContext_GetName(pInfo->pContext, reg);
+}
 
-      case ZYDIS_MNEMONIC_KXNORB:
-      case ZYDIS_MNEMONIC_KXNORW:
-      case ZYDIS_MNEMONIC_KXNORD:
-      case ZYDIS_MNEMONIC_KXNORQ:
-        zydec_HintOp(ZydecFormattingInfo::XNor, pInfo);
-        break;
+uint32_t zydec_LinearContext_GetResultRegisterName(const ZydisRegister reg, void *pUserData)
+{
+  ZydecLinearContextFormatInfo *pInfo = static_cast<ZydecLinearContextFormatInfo *>(pUserData);
 
-      case ZYDIS_MNEMONIC_VPERMT2B:
-      case ZYDIS_MNEMONIC_VPERMT2W:
-      case ZYDIS_MNEMONIC_VPERMT2D:
-      case ZYDIS_MNEMONIC_VPERMT2Q:
-      case ZYDIS_MNEMONIC_VPERMT2PS:
-      case ZYDIS_MNEMONIC_VPERMT2PD:
-      case ZYDIS_MNEMONIC_VPERMB:
-      case ZYDIS_MNEMONIC_VPERMW:
-      case ZYDIS_MNEMONIC_VPERMD:
-        zydec_HintOp(ZydecFormattingInfo::Permute, pInfo);
-        break;
+  uint32_t newName;
 
-      case ZYDIS_MNEMONIC_VPOPCNTB:
-      case ZYDIS_MNEMONIC_VPOPCNTW:
-      case ZYDIS_MNEMONIC_VPOPCNTD:
-      case ZYDIS_MNEMONIC_VPOPCNTQ:
-        zydec_HintOp(ZydecFormattingInfo::PopCnt, pInfo);
-        break;
+  if (pInfo->pOriginalInfo->registerNamingMode == ZydecFormattingInfo::RegisterNamingMode::AddressSeeded)
+    newName = zydec_LinearContext_SeededRegisterName(pInfo->virtualAddress, pInfo->resultNameCount);
+  else
+    newName = zydec_LinearContext_NextRegisterName(pInfo->pContext);
 
-      case ZYDIS_MNEMONIC_VPXORQ:
-      case ZYDIS_MNEMONIC_VPXORD:
-        zydec_HintOp(ZydecFormattingInfo::XOr, pInfo);
-        break;
+  pInfo->resultNameCount++;
 
-      default:
-        break;
-      }
+  if (pInfo->regHint != ZYDIS_REGISTER_NONE)
+  {
+    const uint32_t hintedRegName = zydec_LinearContext_GetName(pInfo->pContext, zydec_ResolveBaseRegister(pInfo->regHint));
 
-      ERROR_CHECK(zydec_WriteResultOperand(&bufferPos, &remainingSize, &pOperands[0], virtualAddress, pInfo));
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " = "));
+    if (hintedRegName != 0)
+      newName = hintedRegName;
+  }
+  else if (pInfo->hasValHint && (pInfo->valHint == 0 || pInfo->valHint == (int64_t)-1))
+  {
+    if (pInfo->valHint == 0)
+    {
+      newName &= 0xFFFF0000;
+      newName |= 0xDDC7; // `Nul_`
     }
-
-    switch (pInstruction->mnemonic)
+    else if (pInfo->valHint == (int64_t)-1)
+    {
+      newName &= 0xFFFF0000;
+      newName |= 0xDDC0; // `Ful_`
+    }
+  }
+  else if (pInfo->opHint != ZydecFormattingInfo::None)
+  {
+    switch (pInfo->opHint)
     {
-    case ZYDIS_MNEMONIC_PAND:
-    case ZYDIS_MNEMONIC_VPAND:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_and_si("));
+    case ZydecFormattingInfo::Add:
+      newName &= 0xFFFF0000;
+      newName |= 0xD5EC; // `Add_`
       break;
 
-    case ZYDIS_MNEMONIC_VPANDQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_and_epi64("));
+    case ZydecFormattingInfo::Sub:
+      newName &= 0xFFFF0000;
+      newName |= 0xD3CB; // `Sub_`
       break;
 
-    case ZYDIS_MNEMONIC_VPANDD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_and_epi32("));
+    case ZydecFormattingInfo::Mul:
+      newName &= 0xFFFF0000;
+      newName |= 0xDDC6; // `Mul_`
       break;
 
-    case ZYDIS_MNEMONIC_PANDN:
-    case ZYDIS_MNEMONIC_VPANDN:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_andnot_si("));
+    case ZydecFormattingInfo::Div:
+      newName &= 0xFFFF0000;
+      newName |= 0xE795; // `Div_`
       break;
 
-    case ZYDIS_MNEMONIC_VPANDNQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_andnot_epi64("));
+    case ZydecFormattingInfo::Mod:
+      newName &= 0xFFFF0000;
+      newName |= 0xD5B1; // `Mod_`
       break;
 
-    case ZYDIS_MNEMONIC_VPANDND:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_andnot_epi32("));
+    case ZydecFormattingInfo::And:
+      newName &= 0xFFFF0000;
+      newName |= 0xD5ED; // `And_`
       break;
 
-    case ZYDIS_MNEMONIC_VANDNPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_andnot_ps("));
+    case ZydecFormattingInfo::AndNot:
+      newName &= 0xFFFF0000;
+      newName |= 0xE5ED; // `Ant_`
       break;
 
-    case ZYDIS_MNEMONIC_VANDNPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_andnot_pd("));
+    case ZydecFormattingInfo::Or:
+      newName &= 0xFFFF0000;
+      newName |= 0xE33F; // `bor_`
       break;
 
-    case ZYDIS_MNEMONIC_PCMPEQB:
-    case ZYDIS_MNEMONIC_VPCMPEQB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cmpeq_epi8("));
+    case ZydecFormattingInfo::XOr:
+      newName &= 0xFFFF0000;
+      newName |= 0xE351; // `xor_`
       break;
 
-    case ZYDIS_MNEMONIC_PCMPEQW:
-    case ZYDIS_MNEMONIC_VPCMPEQW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cmpeq_epi16("));
+    case ZydecFormattingInfo::Neg:
+      newName &= 0xFFFF0000;
+      newName |= 0xD888; // `Neg_`
       break;
 
-    case ZYDIS_MNEMONIC_PCMPEQD:
-    case ZYDIS_MNEMONIC_VPCMPEQD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cmpeq_epi32("));
+    case ZydecFormattingInfo::ShL:
+      newName &= 0xFFFF0000;
+      newName |= 0xDDEE; // `Shl_`
       break;
 
-    case ZYDIS_MNEMONIC_PCMPEQQ:
-    case ZYDIS_MNEMONIC_VPCMPEQQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cmpeq_epi64("));
+    case ZydecFormattingInfo::ShR:
+      newName &= 0xFFFF0000;
+      newName |= 0xE3EE; // `Shr_`
       break;
 
-    case ZYDIS_MNEMONIC_PCMPGTB:
-    case ZYDIS_MNEMONIC_VPCMPGTB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cmpgt_epi8("));
+    case ZydecFormattingInfo::Inc:
+      newName &= 0xFFFF0000;
+      newName |= 0xD4EF; // `Inc_`
       break;
 
-    case ZYDIS_MNEMONIC_PCMPGTW:
-    case ZYDIS_MNEMONIC_VPCMPGTW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cmpgt_epi16("));
+    case ZydecFormattingInfo::Dec:
+      newName &= 0xFFFF0000;
+      newName |= 0xD480; // `Dec_`
       break;
 
-    case ZYDIS_MNEMONIC_PCMPGTD:
-    case ZYDIS_MNEMONIC_VPCMPGTD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cmpgt_epi32("));
+    case ZydecFormattingInfo::BitScanF:
+      newName &= 0xFFFF0000;
+      newName |= 0xD7F3; // `Bsf_`
       break;
 
-    case ZYDIS_MNEMONIC_PCMPGTQ:
-    case ZYDIS_MNEMONIC_VPCMPGTQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cmpgt_epi64("));
+    case ZydecFormattingInfo::BitScanR:
+      newName &= 0xFFFF0000;
+      newName |= 0xE3F3; // `Bsr_`
       break;
 
-    case ZYDIS_MNEMONIC_PACKUSWB:
-    case ZYDIS_MNEMONIC_VPACKUSWB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_packus_epu16_to_epi8("));
+    case ZydecFormattingInfo::PopCnt:
+      newName &= 0xFFFF0000;
+      newName |= 0xE1B3; // `Pop_`
       break;
 
-    case ZYDIS_MNEMONIC_PACKUSDW:
-    case ZYDIS_MNEMONIC_VPACKUSDW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_packus_epu32_to_epi16("));
+    case ZydecFormattingInfo::AddressOf:
+      newName &= 0xFFFF0000;
+      newName |= 0xD4B0; // `Loc_`
       break;
 
-    case ZYDIS_MNEMONIC_PACKSSWB:
-    case ZYDIS_MNEMONIC_VPACKSSWB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_packs_epu16_to_epi8("));
+    case ZydecFormattingInfo::Mov:
+    case ZydecFormattingInfo::ConditionalMov:
+      newName &= 0xFFFF0000;
+      newName |= 0xE7B1; // `Mov_`
       break;
 
-    case ZYDIS_MNEMONIC_PACKSSDW:
-    case ZYDIS_MNEMONIC_VPACKSSDW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_packs_epu32_to_epi16("));
+    case ZydecFormattingInfo::Set:
+      newName &= 0xFFFF0000;
+      newName |= 0xE58C; // `Set_`
       break;
 
-    case ZYDIS_MNEMONIC_PADDB:
-    case ZYDIS_MNEMONIC_VPADDB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_add_epi8("));
+    case ZydecFormattingInfo::Cmp:
+      newName &= 0xFFFF0000;
+      newName |= 0xE1F0; // `Cmp_`
       break;
 
-    case ZYDIS_MNEMONIC_PADDW:
-    case ZYDIS_MNEMONIC_VPADDW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_add_epi16("));
+    case ZydecFormattingInfo::Pack:
+    case ZydecFormattingInfo::Unpack:
+      newName &= 0xFFFF0000;
+      newName |= 0xDC74; // `Pak_`
       break;
 
-    case ZYDIS_MNEMONIC_PADDD:
-    case ZYDIS_MNEMONIC_VPADDD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_add_epi32("));
+    case ZydecFormattingInfo::Abs:
+      newName &= 0xFFFF0000;
+      newName |= 0xE4F1; // `Abs_`
       break;
 
-    case ZYDIS_MNEMONIC_PADDQ:
-    case ZYDIS_MNEMONIC_VPADDQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_add_epi64("));
+    case ZydecFormattingInfo::Blend:
+      newName &= 0xFFFF0000;
+      newName |= 0xD5F2; // `Bld_`
       break;
 
-    case ZYDIS_MNEMONIC_ADDPS:
-    case ZYDIS_MNEMONIC_VADDPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_add_ps("));
+    case ZydecFormattingInfo::Broadcast:
+      newName &= 0xFFFF0000;
+      newName |= 0xE5F3; // `Bst_`
       break;
 
-    case ZYDIS_MNEMONIC_ADDPD:
-    case ZYDIS_MNEMONIC_VADDPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_add_pd("));
+    case ZydecFormattingInfo::Shuffle:
+      newName &= 0xFFFF0000;
+      newName |= 0xD7EE; // `Shf_`
       break;
 
-    case ZYDIS_MNEMONIC_ADDSS:
-    case ZYDIS_MNEMONIC_VADDSS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_add_ss("));
+    case ZydecFormattingInfo::Permute:
+      newName &= 0xFFFF0000;
+      newName |= 0xDE89; // `Pem_`
       break;
 
-    case ZYDIS_MNEMONIC_ADDSD:
-    case ZYDIS_MNEMONIC_VADDSD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_add_sd("));
+    case ZydecFormattingInfo::Round:
+      newName &= 0xFFFF0000;
+      newName |= 0xD5B5; // `Rod_`
       break;
 
-    case ZYDIS_MNEMONIC_PADDSB:
-    case ZYDIS_MNEMONIC_PADDSW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_adds_epi8("));
+    case ZydecFormattingInfo::Convert:
+      newName &= 0xFFFF0000;
+      newName |= 0xE7A9; // `Con_`
       break;
 
-    case ZYDIS_MNEMONIC_VPADDSB:
-    case ZYDIS_MNEMONIC_VPADDSW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_adds_epi16("));
+    case ZydecFormattingInfo::DotProduct:
+      newName &= 0xFFFF0000;
+      newName |= 0xE5AA; // `Dot_`
       break;
 
-    case ZYDIS_MNEMONIC_EMMS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_empty("));
+    case ZydecFormattingInfo::Extract:
+      newName &= 0xFFFF0000;
+      newName |= 0xE5F4; // `Ext_`
       break;
 
-    case ZYDIS_MNEMONIC_PMADDWD:
-    case ZYDIS_MNEMONIC_VPMADDWD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_pmadd_epi16("));
+    case ZydecFormattingInfo::Gather:
+      newName &= 0xFFFF0000;
+      newName |= 0xE56D; // `Gat_`
       break;
 
-    case ZYDIS_MNEMONIC_PMULHW:
-    case ZYDIS_MNEMONIC_VPMULHW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mulhi_epi16("));
+    case ZydecFormattingInfo::Max:
+      newName &= 0xFFFF0000;
+      newName |= 0xE972; // `Max_`
       break;
 
-    case ZYDIS_MNEMONIC_PMULLW:
-    case ZYDIS_MNEMONIC_VPMULLW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mullo_epi16("));
-      break;
-
-    case ZYDIS_MNEMONIC_POR:
-    case ZYDIS_MNEMONIC_VPOR:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_or_si("));
-      break;
-
-    case ZYDIS_MNEMONIC_VPORD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_or_epi32("));
+    case ZydecFormattingInfo::Min:
+      newName &= 0xFFFF0000;
+      newName |= 0xDF9C; // `Min_`
       break;
 
-    case ZYDIS_MNEMONIC_VPORQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_or_epi64("));
+    case ZydecFormattingInfo::Mask:
+      newName &= 0xFFFF0000;
+      newName |= 0xE472; // `Mas_`
       break;
 
-    case ZYDIS_MNEMONIC_PABSB:
-    case ZYDIS_MNEMONIC_VPABSB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_abs_epi16("));
+    case ZydecFormattingInfo::Test:
+      newName &= 0xFFFF0000;
+      newName |= 0xE48D; // `Tes_`
       break;
 
-    case ZYDIS_MNEMONIC_PABSW:
-    case ZYDIS_MNEMONIC_VPABSW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_abs_epi16("));
+    case ZydecFormattingInfo::Not:
+      newName &= 0xFFFF0000;
+      newName |= 0xE5B2; // `Not_`
       break;
 
-    case ZYDIS_MNEMONIC_PABSD:
-    case ZYDIS_MNEMONIC_VPABSD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_abs_epi32("));
+    case ZydecFormattingInfo::XNor:
+      newName &= 0xFFFF0000;
+      newName |= 0x49E9; // `x_no`
       break;
 
-    case ZYDIS_MNEMONIC_ADDSUBPS:
-    case ZYDIS_MNEMONIC_VADDSUBPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_addsub_ps("));
-      break;
-      
-    case ZYDIS_MNEMONIC_ADDSUBPD:
-    case ZYDIS_MNEMONIC_VADDSUBPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_addsub_pd("));
-      break;
-      
-    case ZYDIS_MNEMONIC_PALIGNR:
-    case ZYDIS_MNEMONIC_VPALIGNR:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_alignr_epi8("));
+    default:
       break;
+    }
+  }
 
-    case ZYDIS_MNEMONIC_PAVGB:
-    case ZYDIS_MNEMONIC_VPAVGB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_avg_epu8("));
-      break;
+  const size_t registerIndex = zydec_LinearContext_GetRegisterIndex(reg);
 
-    case ZYDIS_MNEMONIC_PAVGW:
-    case ZYDIS_MNEMONIC_VPAVGW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_avg_epu16("));
-      break;
+  if (registerIndex == ZydecLinearContextRegisterCount)
+    return newName;
 
-    case ZYDIS_MNEMONIC_PBLENDW:
-    case ZYDIS_MNEMONIC_VPBLENDW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_blend_epi16("));
-      break;
+  // Assignments only become visible after the instruction, so that its source operands still refer to the previous names.
+  size_t index = 0;
 
-    case ZYDIS_MNEMONIC_VPBLENDD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_blend_epi32("));
-      break;
+  while (index < pInfo->assignedRegisterCount && pInfo->assignedRegister[index] != registerIndex)
+    index++;
 
-    case ZYDIS_MNEMONIC_BLENDPS:
-    case ZYDIS_MNEMONIC_VBLENDPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_blend_ps("));
-      break;
+  if (index == pInfo->assignedRegisterCount)
+  {
+    pInfo->assignedRegister[index] = registerIndex;
+    pInfo->assignedRegisterCount++;
+  }
 
-    case ZYDIS_MNEMONIC_BLENDPD:
-    case ZYDIS_MNEMONIC_VBLENDPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_blend_pd("));
-      break;
+  pInfo->assignedRegisterValue[index] = newName;
 
-    case ZYDIS_MNEMONIC_PBLENDVB:
-    case ZYDIS_MNEMONIC_VPBLENDVB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_blendv_epi8("));
-      break;
+  return newName;
+}
 
-    case ZYDIS_MNEMONIC_BLENDVPS:
-    case ZYDIS_MNEMONIC_VBLENDVPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_blendv_ps("));
-      break;
+bool zydec_LinearContext_WriteResultRegister(char **pBufferPos, size_t *pRemainingSize, const ZydisRegister reg, void *pUserData)
+{
+  return zydec_LinearContext_WriteRegisterName(pBufferPos, pRemainingSize, reg, zydec_LinearContext_GetResultRegisterName(reg, pUserData));
+}
 
-    case ZYDIS_MNEMONIC_BLENDVPD:
-    case ZYDIS_MNEMONIC_VBLENDVPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_blendv_pd("));
-      break;
+void zydec_LinearContext_HintRegister(const ZydisRegister reg, void *pUserData)
+{
+  ZydecLinearContextFormatInfo *pInfo = static_cast<ZydecLinearContextFormatInfo *>(pUserData);
+  pInfo->regHint = reg;
+}
 
-    case ZYDIS_MNEMONIC_VBROADCASTF128:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_broadcast_f128("));
-      break;
-      
-    case ZYDIS_MNEMONIC_VBROADCASTF32X2:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_broadcast_f32x2("));
-      break;
+void zydec_LinearContext_HintValue(const int64_t value, void *pUserData)
+{
+  ZydecLinearContextFormatInfo *pInfo = static_cast<ZydecLinearContextFormatInfo *>(pUserData);
+  pInfo->hasValHint = true;
+  pInfo->valHint = value;
+}
 
-    case ZYDIS_MNEMONIC_VBROADCASTF32X4:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_broadcast_f32x4("));
-      break;
+void zydec_LinearContext_HintOperation(const ZydecFormattingInfo::HintOperation operation, void *pUserData)
+{
+  ZydecLinearContextFormatInfo *pInfo = static_cast<ZydecLinearContextFormatInfo *>(pUserData);
+  pInfo->opHint = operation;
+}
 
-    case ZYDIS_MNEMONIC_VBROADCASTF32X8:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_broadcast_f32x8("));
-      break;
+void zydec_LinearContext_InitFormattingInfo(ZydecLinearContextFormatInfo *pFormatContextInfo, ZydecFormattingInfo *pNewInfo, ZydecLinearContext *pContext, ZydecFormattingInfo *pInfo)
+{
+  pFormatContextInfo->pContext = pContext;
+  pFormatContextInfo->pOriginalInfo = pInfo;
+
+  *pNewInfo = *pInfo;
+  pNewInfo->simplifyValueSelfModification = false;
+  pNewInfo->pRegUserData = pNewInfo->pCallUserData = pFormatContextInfo;
+  pNewInfo->pWriteRegister = zydec_LinearContext_WriteRegister;
+  pNewInfo->pWriteResultRegister = zydec_LinearContext_WriteResultRegister;
+  pNewInfo->pGetRegisterName = zydec_LinearContext_GetRegisterName;
+  pNewInfo->pGetResultRegisterName = zydec_LinearContext_GetResultRegisterName;
+  pNewInfo->pAfterCall = zydec_LinearContext_AfterCall;
+
+  pNewInfo->pSetHintReg = zydec_LinearContext_HintRegister;
+  pNewInfo->pSetHintVal = zydec_LinearContext_HintValue;
+  pNewInfo->pSetHintOp = zydec_LinearContext_HintOperation;
+}
 
-    case ZYDIS_MNEMONIC_VBROADCASTF64X2:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_broadcast_f64x2("));
-      break;
+// `int3` & `nop` padding between functions.
+inline bool zydec_IsFunctionPadding(const ZydisDecodedInstruction *pInstruction)
+{
+  return pInstruction->mnemonic == ZYDIS_MNEMONIC_INT3 || pInstruction->mnemonic == ZYDIS_MNEMONIC_NOP;
+}
 
-    case ZYDIS_MNEMONIC_VBROADCASTF64X4:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_broadcast_f64x4("));
-      break;
+// Returns and unconditional jumps, the first instruction after them (and their padding) being treated as the start of a function.
+inline bool zydec_IsUnconditionalBranch(const ZydisDecodedInstruction *pInstruction)
+{
+  return pInstruction->meta.category == ZYDIS_CATEGORY_RET || pInstruction->meta.category == ZYDIS_CATEGORY_UNCOND_BR;
+}
 
-    case ZYDIS_MNEMONIC_VBROADCASTI128:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_broadcastsi128_si256("));
-      break;
+inline void zydec_LinearContext_BeginInstruction(ZydecLinearContextFormatInfo *pFormatContextInfo, const ZydisDecodedInstruction *pInstruction, const size_t virtualAddress)
+{
+  pFormatContextInfo->virtualAddress = virtualAddress;
 
-    case ZYDIS_MNEMONIC_VBROADCASTI32X2:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_broadcast_i32x2("));
-      break;
+  // Seeded names start over at every function boundary of the code, so they don't depend on where the translation of a range started.
+  if (pFormatContextInfo->pOriginalInfo->registerNamingMode == ZydecFormattingInfo::RegisterNamingMode::AddressSeeded && !zydec_IsFunctionPadding(pInstruction))
+  {
+    ZydecLinearContext *pContext = pFormatContextInfo->pContext;
 
-    case ZYDIS_MNEMONIC_VBROADCASTI32X4:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_broadcast_i32x4("));
-      break;
+    if (pContext->isAfterUnconditionalBranch)
+      *pContext = ZydecLinearContext();
 
-    case ZYDIS_MNEMONIC_VBROADCASTI32X8:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_broadcast_i32x8("));
-      break;
+    pContext->isAfterUnconditionalBranch = zydec_IsUnconditionalBranch(pInstruction);
+  }
+}
 
-    case ZYDIS_MNEMONIC_VBROADCASTI64X2:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_broadcast_i64x2("));
-      break;
+// Applies the registers assigned by the last instruction to the context and resets the per-instruction state.
+void zydec_LinearContext_FinishInstruction(ZydecLinearContextFormatInfo *pFormatContextInfo)
+{
+  for (size_t i = 0; i < pFormatContextInfo->assignedRegisterCount; i++)
+    pFormatContextInfo->pContext->regInfo[pFormatContextInfo->assignedRegister[i]] = pFormatContextInfo->assignedRegisterValue[i];
+
+  pFormatContextInfo->assignedRegisterCount = 0;
+  pFormatContextInfo->resultNameCount = 0;
+  pFormatContextInfo->regHint = ZYDIS_REGISTER_NONE;
+  pFormatContextInfo->opHint = ZydecFormattingInfo::None;
+  pFormatContextInfo->hasValHint = false;
+  pFormatContextInfo->valHint = 0;
+}
 
-    case ZYDIS_MNEMONIC_VBROADCASTI64X4:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_broadcast_i64x4("));
-      break;
-    
-    case ZYDIS_MNEMONIC_VBROADCASTSD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_broadcast_sd("));
-      break;
-      
-    case ZYDIS_MNEMONIC_VBROADCASTSS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_broadcast_ss("));
-      break;
-      
-    case ZYDIS_MNEMONIC_VPBROADCASTB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_broadcast_epi8("));
-      break;
+bool zydec_TranslateInstructionWithLinearContext(ZydecLinearContext *pContext, const ZydisDecodedInstruction *pInstruction, const ZydisDecodedOperand *pOperands, const size_t operandCount, const size_t virtualAddress, char *buffer, const size_t bufferCapacity, bool *pHasTranslation, ZydecFormattingInfo *pInfo)
+{
+  ZydecLinearContextFormatInfo formatContextInfo;
+  ZydecFormattingInfo newInfo;
+  zydec_LinearContext_InitFormattingInfo(&formatContextInfo, &newInfo, pContext, pInfo);
+  zydec_LinearContext_BeginInstruction(&formatContextInfo, pInstruction, virtualAddress);
 
-    case ZYDIS_MNEMONIC_VPBROADCASTW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_broadcast_epi16("));
-      break;
-      
-    case ZYDIS_MNEMONIC_VPBROADCASTD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_broadcast_epi32("));
-      break;
+  const bool result = zydec_TranslateInstructionWithoutContext(pInstruction, pOperands, operandCount, virtualAddress, buffer, bufferCapacity, pHasTranslation, &newInfo);
 
-    case ZYDIS_MNEMONIC_VPBROADCASTQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_broadcast_epi64("));
-      break;
-      
-    case ZYDIS_MNEMONIC_VPBROADCASTMB2Q:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_broadcastmb_epi64("));
-      break;
+  zydec_LinearContext_FinishInstruction(&formatContextInfo);
 
-    case ZYDIS_MNEMONIC_VPBROADCASTMW2D:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_broadcastmw_epi32("));
-      break;
+  return result;
+}
 
-    case ZYDIS_MNEMONIC_PSLLDQ:
-    case ZYDIS_MNEMONIC_VPSLLDQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_bslli_epi128("));
-      break;
+////////////////////////////////////////////////////////////////////////////////
 
-    case ZYDIS_MNEMONIC_PSRLDQ:
-    case ZYDIS_MNEMONIC_VPSRLDQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_bsrli_epi128("));
-      break;
+void zydec_LinearSession_Init(ZydecLinearSession *pSession, const ZydecFormattingInfo *pInfo)
+{
+  pSession->context = ZydecLinearContext();
+  pSession->originalInfo = *pInfo;
 
-    case ZYDIS_MNEMONIC_ROUNDSS:
-    case ZYDIS_MNEMONIC_VROUNDSS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_round_ss("));
-      break;
+  zydec_LinearContext_InitFormattingInfo(&pSession->formatContextInfo, &pSession->info, &pSession->context, &pSession->originalInfo);
+}
 
-    case ZYDIS_MNEMONIC_ROUNDSD:
-    case ZYDIS_MNEMONIC_VROUNDSD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_round_sd("));
-      break;
+bool zydec_LinearSession_TranslateInstruction(ZydecLinearSession *pSession, const ZydisDecodedInstruction *pInstruction, const ZydisDecodedOperand *pOperands, const size_t operandCount, const size_t virtualAddress, char *buffer, const size_t bufferCapacity, bool *pHasTranslation)
+{
+  zydec_LinearContext_BeginInstruction(&pSession->formatContextInfo, pInstruction, virtualAddress);
 
-    case ZYDIS_MNEMONIC_ROUNDPS:
-    case ZYDIS_MNEMONIC_VROUNDPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_round_ps("));
-      break;
+  const bool result = zydec_TranslateInstructionWithoutContext(pInstruction, pOperands, operandCount, virtualAddress, buffer, bufferCapacity, pHasTranslation, &pSession->info);
 
-    case ZYDIS_MNEMONIC_ROUNDPD:
-    case ZYDIS_MNEMONIC_VROUNDPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_round_pd("));
-      break;
+  zydec_LinearContext_FinishInstruction(&pSession->formatContextInfo);
 
-    case ZYDIS_MNEMONIC_CLFLUSH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_clflush("));
-      addressParam = true;
-      break;
+  return result;
+}
 
-    case ZYDIS_MNEMONIC_CLFLUSHOPT:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_clflushopt("));
-      addressParam = true;
-      break;
+bool zydec_LinearSession_TranslateInstructionToTokens(ZydecLinearSession *pSession, const ZydisDecodedInstruction *pInstruction, const ZydisDecodedOperand *pOperands, const size_t operandCount, const size_t virtualAddress, ZydecToken *pTokens, const size_t tokenCapacity, size_t *pTokenCount, bool *pHasTranslation)
+{
+  zydec_LinearContext_BeginInstruction(&pSession->formatContextInfo, pInstruction, virtualAddress);
 
-    case ZYDIS_MNEMONIC_CMPSS:
-    case ZYDIS_MNEMONIC_VCMPSS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cmp_ss("));
-      break;
+  const bool result = zydec_TranslateInstructionToTokens(pInstruction, pOperands, operandCount, virtualAddress, pTokens, tokenCapacity, pTokenCount, pHasTranslation, &pSession->info);
 
-    case ZYDIS_MNEMONIC_CMPSD:
-    case ZYDIS_MNEMONIC_VCMPSD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cmp_sd("));
-      break;
+  zydec_LinearContext_FinishInstruction(&pSession->formatContextInfo);
 
-    case ZYDIS_MNEMONIC_CMPPS:
-    case ZYDIS_MNEMONIC_VCMPPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cmp_ps("));
-      break;
+  return result;
+}
 
-    case ZYDIS_MNEMONIC_CMPPD:
-    case ZYDIS_MNEMONIC_VCMPPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cmp_pd("));
-      break;
+bool zydec_TranslateInstructionBatch(ZydecLinearContext *pContext, const ZydisDecodedInstruction *pInstructions, const ZydisDecodedOperand *pOperands, const size_t operandCount, const size_t *pVirtualAddresses, const size_t instructionCount, char *arena, const size_t arenaCapacity, uint32_t *pOffsets, uint32_t *pLengths, uint64_t *pHasTranslation, size_t *pTranslatedCount, ZydecFormattingInfo *pInfo)
+{
+  if (pInstructions == nullptr || pOperands == nullptr || operandCount < 10 || pVirtualAddresses == nullptr || arena == nullptr || arenaCapacity > UINT32_MAX || pOffsets == nullptr || pLengths == nullptr || pHasTranslation == nullptr || pTranslatedCount == nullptr || pInfo == nullptr)
+    return false;
 
-    case ZYDIS_MNEMONIC_PCMPESTRI:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cmpstr("));
-      break;
+  *pTranslatedCount = 0;
 
-    case ZYDIS_MNEMONIC_PCMPESTRM:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cmpestrm("));
-      break;
+  ZydecLinearContextFormatInfo formatContextInfo;
+  ZydecFormattingInfo newInfo;
+  ZydecFormattingInfo *pBatchInfo = pInfo;
 
-    case ZYDIS_MNEMONIC_COMISS:
-    case ZYDIS_MNEMONIC_VCOMISS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_comieq_ss("));
-      break;
+  if (pContext != nullptr)
+  {
+    zydec_LinearContext_InitFormattingInfo(&formatContextInfo, &newInfo, pContext, pInfo);
+    pBatchInfo = &newInfo;
+  }
 
-    case ZYDIS_MNEMONIC_COMISD:
-    case ZYDIS_MNEMONIC_VCOMISD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_comieq_sd("));
-      break;
+  size_t arenaOffset = 0;
 
-    case ZYDIS_MNEMONIC_VCOMISH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_comieq_sh("));
-      break;
+  for (size_t i = 0; i < instructionCount; i++)
+  {
+    if (arenaCapacity - arenaOffset < ZydecBatchInstructionCapacity)
+      return false;
 
-    case ZYDIS_MNEMONIC_CRC32:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_crc32("));
-      break;
+    char *buffer = arena + arenaOffset;
+    bool hasTranslation = false;
 
-    case ZYDIS_MNEMONIC_CVTPI2PS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtpi_ps("));
-      break;
+    if (pContext != nullptr)
+      zydec_LinearContext_BeginInstruction(&formatContextInfo, &pInstructions[i], pVirtualAddresses[i]);
 
-    case ZYDIS_MNEMONIC_CVTPS2PI:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtps_pi("));
-      break;
+    if (!zydec_TranslateInstructionWithoutContext(&pInstructions[i], &pOperands[i * operandCount], operandCount, pVirtualAddresses[i], buffer, ZydecBatchInstructionCapacity, &hasTranslation, pBatchInfo))
+      hasTranslation = false;
 
-    case ZYDIS_MNEMONIC_CVTSI2SS:
-    case ZYDIS_MNEMONIC_VCVTSI2SS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtsi_ss("));
-      break;
+    if (pContext != nullptr)
+      zydec_LinearContext_FinishInstruction(&formatContextInfo);
 
-    case ZYDIS_MNEMONIC_CVTSS2SI:
-    case ZYDIS_MNEMONIC_VCVTSS2SI:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtss_si("));
-      break;
+    const uint64_t bit = (uint64_t)1 << (i & 63);
+    size_t length = 0;
 
-    case ZYDIS_MNEMONIC_PMOVSXWD:
-    case ZYDIS_MNEMONIC_VPMOVSXWD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtepi16_epi32("));
-      break;
+    if (hasTranslation)
+    {
+      length = strlen(buffer);
+      pHasTranslation[i / 64] |= bit;
+    }
+    else
+    {
+      buffer[0] = '\0';
+      pHasTranslation[i / 64] &= ~bit;
+    }
 
-    case ZYDIS_MNEMONIC_PMOVSXWQ:
-    case ZYDIS_MNEMONIC_VPMOVSXWQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtepi16_epi64("));
-      break;
+    pOffsets[i] = (uint32_t)arenaOffset;
+    pLengths[i] = (uint32_t)length;
+    arenaOffset += length + 1;
 
-    case ZYDIS_MNEMONIC_PMOVSXDQ:
-    case ZYDIS_MNEMONIC_VPMOVSXDQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtepi32_epi64("));
-      break;
+    (*pTranslatedCount)++;
+  }
 
-    case ZYDIS_MNEMONIC_CVTDQ2PS:
-    case ZYDIS_MNEMONIC_VCVTDQ2PS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtepi32_ps("));
-      break;
+  return true;
+}
 
-    case ZYDIS_MNEMONIC_CVTDQ2PD:
-    case ZYDIS_MNEMONIC_VCVTDQ2PD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtepi32_pd("));
-      break;
+////////////////////////////////////////////////////////////////////////////////
 
-    case ZYDIS_MNEMONIC_PMOVSXBW:
-    case ZYDIS_MNEMONIC_VPMOVSXBW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtepi8_epi16("));
-      break;
+bool zydec_LinearSession_AnalyzeInstruction(ZydecLinearSession *pSession, const ZydisDecodedInstruction *pInstruction, const ZydisDecodedOperand *pOperands, const size_t operandCount, const size_t virtualAddress, uint32_t *pNames, const size_t nameCapacity, size_t *pNameCount, bool *pHasTranslation)
+{
+  if (pInstruction == nullptr || pOperands == nullptr || operandCount < 10 || pNames == nullptr || pNameCount == nullptr || pHasTranslation == nullptr)
+    return false;
 
-    case ZYDIS_MNEMONIC_PMOVSXBD:
-    case ZYDIS_MNEMONIC_VPMOVSXBD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtepi8_epi32("));
-      break;
+  ZydecNameWriter writer;
+  writer.pNames = pNames;
+  writer.nameCount = 0;
+  writer.nameCapacity = nameCapacity;
 
-    case ZYDIS_MNEMONIC_PMOVSXBQ:
-    case ZYDIS_MNEMONIC_VPMOVSXBQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtepi8_epi64("));
-      break;
+  zydec_LinearContext_BeginInstruction(&pSession->formatContextInfo, pInstruction, virtualAddress);
 
-    case ZYDIS_MNEMONIC_PMOVZXWD:
-    case ZYDIS_MNEMONIC_VPMOVZXWD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtepu16_epi32("));
-      break;
+  bool result = zydec_TranslateInstruction(&writer, pInstruction, pOperands, virtualAddress, pHasTranslation, &pSession->info);
 
-    case ZYDIS_MNEMONIC_PMOVZXWQ:
-    case ZYDIS_MNEMONIC_VPMOVZXWQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtepu16_epi64("));
-      break;
+  zydec_LinearContext_FinishInstruction(&pSession->formatContextInfo);
 
-    case ZYDIS_MNEMONIC_PMOVZXDQ:
-    case ZYDIS_MNEMONIC_VPMOVZXDQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtepu32_epi64("));
-      break;
+  if (writer.nameCount > nameCapacity)
+  {
+    writer.nameCount = nameCapacity;
+    result = false;
+  }
 
-    case ZYDIS_MNEMONIC_PMOVZXBW:
-    case ZYDIS_MNEMONIC_VPMOVZXBW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtepu8_epi16("));
-      break;
+  *pNameCount = writer.nameCount;
 
-    case ZYDIS_MNEMONIC_PMOVZXBD:
-    case ZYDIS_MNEMONIC_VPMOVZXBD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtepu8_epi32("));
-      break;
+  return result;
+}
 
-    case ZYDIS_MNEMONIC_PMOVZXBQ:
-    case ZYDIS_MNEMONIC_VPMOVZXBQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtepu8_epi64("));
-      break;
+bool zydec_LinearSession_AdvanceInstruction(ZydecLinearSession *pSession, const ZydisDecodedInstruction *pInstruction, const ZydisDecodedOperand *pOperands, const size_t operandCount, const size_t virtualAddress)
+{
+  if (pInstruction == nullptr || pOperands == nullptr || operandCount < 10)
+    return false;
 
-    case ZYDIS_MNEMONIC_VCVTPH2PS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtph_ps("));
-      break;
+  ZydecNameWriter writer;
+  writer.pNames = nullptr;
+  writer.nameCount = 0;
+  writer.nameCapacity = 0;
 
-    case ZYDIS_MNEMONIC_VCVTNEPS2BF16:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtneps_pbh("));
-      break;
+  zydec_LinearContext_BeginInstruction(&pSession->formatContextInfo, pInstruction, virtualAddress);
 
-    case ZYDIS_MNEMONIC_CVTPD2DQ:
-    case ZYDIS_MNEMONIC_VCVTPD2DQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtpd_epi32("));
-      break;
+  bool hasTranslation = false;
+  const bool result = zydec_TranslateInstruction(&writer, pInstruction, pOperands, virtualAddress, &hasTranslation, &pSession->info);
 
-    case ZYDIS_MNEMONIC_CVTPD2PI:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtpd_pi32("));
-      break;
+  zydec_LinearContext_FinishInstruction(&pSession->formatContextInfo);
 
-    case ZYDIS_MNEMONIC_CVTPD2PS:
-    case ZYDIS_MNEMONIC_VCVTPD2PS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtpd_ps("));
-      break;
+  return result;
+}
 
-    case ZYDIS_MNEMONIC_CVTPI2PD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtpi32_pd("));
-      break;
+bool zydec_LinearSession_AdvanceCode(ZydecLinearSession *pSession, const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t codeSize, const size_t virtualAddress)
+{
+  if (pSession == nullptr || pDecoder == nullptr || pCode == nullptr)
+    return false;
 
-    case ZYDIS_MNEMONIC_CVTPS2DQ:
-    case ZYDIS_MNEMONIC_VCVTPS2DQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtps_epi32("));
-      break;
+  ZydisDecodedInstruction instruction;
+  ZydisDecodedOperand operands[ZYDIS_MAX_OPERAND_COUNT];
+  size_t offset = 0;
 
-    case ZYDIS_MNEMONIC_CVTPS2PD:
-    case ZYDIS_MNEMONIC_VCVTPS2PD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtps_pd("));
-      break;
+  while (offset < codeSize)
+  {
+    if (!ZYAN_SUCCESS(ZydisDecoderDecodeFull(pDecoder, pCode + offset, codeSize - offset, &instruction, operands)) || instruction.length == 0)
+    {
+      offset++;
+      continue;
+    }
 
-    case ZYDIS_MNEMONIC_VCVTPS2PH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtps_ph("));
-      break;
+    zydec_LinearSession_AdvanceInstruction(pSession, &instruction, operands, ZYDIS_MAX_OPERAND_COUNT, virtualAddress + offset);
+    offset += instruction.length;
+  }
 
-    case ZYDIS_MNEMONIC_CVTSD2SI:
-    case ZYDIS_MNEMONIC_VCVTSD2SI:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtsd_si("));
-      break;
+  return true;
+}
 
-    case ZYDIS_MNEMONIC_CVTSD2SS:
-    case ZYDIS_MNEMONIC_VCVTSD2SS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtsd_ss("));
-      break;
+bool zydec_LinearSession_AnalyzeLoop(ZydecLinearSession *pSession, const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t codeSize, const size_t virtualAddress, const size_t maxIterations, size_t *pIterationCount, bool *pReachedFixedPoint)
+{
+  if (pSession == nullptr || pDecoder == nullptr || pCode == nullptr || maxIterations == 0)
+    return false;
 
-    case ZYDIS_MNEMONIC_CVTSI2SD:
-    case ZYDIS_MNEMONIC_VCVTSI2SD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtsi_sd("));
-      break;
+  const uint64_t hashStateBefore = pSession->context.hashState;
+  ZydecLinearContext previous;
+  size_t iteration = 0;
+  bool isFixedPoint = false;
 
-    case ZYDIS_MNEMONIC_CVTSS2SD:
-    case ZYDIS_MNEMONIC_VCVTSS2SD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtss_sd("));
-      break;
+  // Every pass starts from the same hash state, so a pass only depends on the names carried in from the previous one.
+  while (iteration < maxIterations && !isFixedPoint)
+  {
+    zydec_LinearContext_Snapshot(&pSession->context, &previous);
 
-    case ZYDIS_MNEMONIC_CVTTPS2PI:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttps_pi("));
-      break;
+    ERROR_CHECK(zydec_LinearSession_AdvanceCode(pSession, pDecoder, pCode, codeSize, virtualAddress));
+    pSession->context.hashState = hashStateBefore;
+    iteration++;
 
-    case ZYDIS_MNEMONIC_CVTTPD2DQ:
-    case ZYDIS_MNEMONIC_VCVTTPD2DQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttpd_epi32("));
-      break;
+    isFixedPoint = (memcmp(previous.regInfo, pSession->context.regInfo, sizeof(previous.regInfo)) == 0);
+  }
 
-    case ZYDIS_MNEMONIC_CVTTPD2PI:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttpd_pi32("));
-      break;
+  if (pIterationCount != nullptr)
+    *pIterationCount = iteration;
 
-    case ZYDIS_MNEMONIC_CVTTPS2DQ:
-    case ZYDIS_MNEMONIC_VCVTTPS2DQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttps_epi32("));
-      break;
+  if (pReachedFixedPoint != nullptr)
+    *pReachedFixedPoint = isFixedPoint;
 
-    case ZYDIS_MNEMONIC_CVTTSD2SI:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttsd_si("));
-      break;
+  return true;
+}
 
-    case ZYDIS_MNEMONIC_DIVPD:
-    case ZYDIS_MNEMONIC_VDIVPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_div_pd("));
-      break;
+struct ZydecAnalyzedNames
+{
+  const uint32_t *pNames;
+  size_t nameCount;
+  size_t index;
+};
 
-    case ZYDIS_MNEMONIC_DIVPS:
-    case ZYDIS_MNEMONIC_VDIVPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_div_ps("));
-      break;
+// Hands out the recorded names in the order they were recorded in, as the translation writes the registers in the same order.
+bool zydec_AnalyzedNames_WriteRegister(char **pBufferPos, size_t *pRemainingSize, const ZydisRegister reg, void *pUserData)
+{
+  ZydecAnalyzedNames *pAnalyzedNames = static_cast<ZydecAnalyzedNames *>(pUserData);
 
-    case ZYDIS_MNEMONIC_DIVSD:
-    case ZYDIS_MNEMONIC_VDIVSD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_div_sd("));
-      break;
+  if (pAnalyzedNames->index >= pAnalyzedNames->nameCount)
+    return false;
 
-    case ZYDIS_MNEMONIC_DIVSS:
-    case ZYDIS_MNEMONIC_VDIVSS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_div_ss("));
-      break;
+  return zydec_LinearContext_WriteRegisterName(pBufferPos, pRemainingSize, reg, pAnalyzedNames->pNames[pAnalyzedNames->index++]);
+}
 
-    case ZYDIS_MNEMONIC_DPPD:
-    case ZYDIS_MNEMONIC_VDPPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_dp_pd("));
-      break;
+bool zydec_RenderAnalyzedInstruction(const ZydisDecodedInstruction *pInstruction, const ZydisDecodedOperand *pOperands, const size_t operandCount, const size_t virtualAddress, const uint32_t *pNames, const size_t nameCount, char *buffer, const size_t bufferCapacity, bool *pHasTranslation, ZydecFormattingInfo *pInfo)
+{
+  if (pNames == nullptr && nameCount != 0)
+    return false;
 
-    case ZYDIS_MNEMONIC_DPPS:
-    case ZYDIS_MNEMONIC_VDPPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_dp_ps("));
-      break;
+  ZydecAnalyzedNames analyzedNames;
+  analyzedNames.pNames = pNames;
+  analyzedNames.nameCount = nameCount;
+  analyzedNames.index = 0;
 
-    case ZYDIS_MNEMONIC_VPDPWSSD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_dpwssd_epi32("));
-      break;
+  // Same settings as `zydec_LinearContext_InitFormattingInfo`, but without any of the naming state.
+  ZydecFormattingInfo newInfo = *pInfo;
+  newInfo.simplifyValueSelfModification = false;
+  newInfo.pRegUserData = &analyzedNames;
+  newInfo.pWriteRegister = zydec_AnalyzedNames_WriteRegister;
+  newInfo.pWriteResultRegister = zydec_AnalyzedNames_WriteRegister;
+  newInfo.pGetRegisterName = nullptr;
+  newInfo.pGetResultRegisterName = nullptr;
+  newInfo.pSetHintReg = nullptr;
+  newInfo.pSetHintVal = nullptr;
+  newInfo.pSetHintOp = nullptr;
+  newInfo.pAfterCall = nullptr;
+
+  return zydec_TranslateInstructionWithoutContext(pInstruction, pOperands, operandCount, virtualAddress, buffer, bufferCapacity, pHasTranslation, &newInfo);
+}
 
-    case ZYDIS_MNEMONIC_VPDPWSSDS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_dpwssds_epi32("));
-      break;
+bool zydec_Listing_Analyze(ZydecListing *pListing, ZydecLinearSession *pSession, const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t codeSize, const size_t virtualAddress)
+{
+  if (pListing == nullptr || pSession == nullptr || pDecoder == nullptr || pCode == nullptr || codeSize > UINT32_MAX)
+    return false;
 
-    case ZYDIS_MNEMONIC_VPDPBUSD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_dpbusd_epi32("));
-      break;
+  ZydisDecodedInstruction instruction;
+  ZydisDecodedOperand operands[ZYDIS_MAX_OPERAND_COUNT];
 
-    case ZYDIS_MNEMONIC_VPDPBUSDS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_dpbusds_epi32("));
-      break;
+  while (pListing->analyzedSize < codeSize)
+  {
+    if (pListing->instructionCount >= pListing->instructionCapacity || pListing->nameCapacity - pListing->nameCount < ZydecListingInstructionNameCapacity || pListing->nameCount > UINT32_MAX)
+      return false;
 
-    case ZYDIS_MNEMONIC_PEXTRB:
-    case ZYDIS_MNEMONIC_VPEXTRB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_extract_epi8("));
-      break;
+    ZydecListingInstruction *pEntry = &pListing->pInstructions[pListing->instructionCount];
+    pEntry->offset = (uint32_t)pListing->analyzedSize;
+    pEntry->firstName = (uint32_t)pListing->nameCount;
+    pEntry->length = 1;
+    pEntry->nameCount = 0;
+    pEntry->hasTranslation = false;
 
-    case ZYDIS_MNEMONIC_PEXTRW:
-    case ZYDIS_MNEMONIC_VPEXTRW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_extract_epi16("));
-      break;
+    if (ZYAN_SUCCESS(ZydisDecoderDecodeFull(pDecoder, pCode + pListing->analyzedSize, codeSize - pListing->analyzedSize, &instruction, operands)) && instruction.length != 0)
+    {
+      size_t nameCount = 0;
+      bool hasTranslation = false;
 
-    case ZYDIS_MNEMONIC_PEXTRD:
-    case ZYDIS_MNEMONIC_VPEXTRD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_extract_epi32("));
-      break;
+      if (zydec_LinearSession_AnalyzeInstruction(pSession, &instruction, operands, ZYDIS_MAX_OPERAND_COUNT, virtualAddress + pListing->analyzedSize, pListing->pNames + pListing->nameCount, ZydecListingInstructionNameCapacity, &nameCount, &hasTranslation) && hasTranslation)
+      {
+        pEntry->nameCount = (uint8_t)nameCount;
+        pEntry->hasTranslation = true;
+        pListing->nameCount += nameCount;
+      }
 
-    case ZYDIS_MNEMONIC_PEXTRQ:
-    case ZYDIS_MNEMONIC_VPEXTRQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_extract_epi64("));
-      break;
+      pEntry->length = instruction.length;
+    }
 
-    case ZYDIS_MNEMONIC_EXTRACTPS:
-    case ZYDIS_MNEMONIC_VEXTRACTPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_extract_ps("));
-      break;
+    pListing->analyzedSize += pEntry->length;
+    pListing->instructionCount++;
+  }
 
-    case ZYDIS_MNEMONIC_VEXTRACTF128:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_extract_f128("));
-      break;
+  return true;
+}
 
-    case ZYDIS_MNEMONIC_VEXTRACTI128:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_extract_i128("));
-      break;
+bool zydec_Listing_Render(const ZydecListing *pListing, const size_t begin, const size_t end, const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t virtualAddress, char *arena, const size_t arenaCapacity, uint32_t *pOffsets, uint32_t *pLengths, uint64_t *pHasTranslation, size_t *pRenderedCount, ZydecFormattingInfo *pInfo)
+{
+  if (pListing == nullptr || begin > end || end > pListing->instructionCount || pDecoder == nullptr || pCode == nullptr || arena == nullptr || arenaCapacity > UINT32_MAX || pOffsets == nullptr || pLengths == nullptr || pHasTranslation == nullptr || pRenderedCount == nullptr || pInfo == nullptr)
+    return false;
 
-    case ZYDIS_MNEMONIC_VFMADD132PD:
-    case ZYDIS_MNEMONIC_VFMADD213PD:
-    case ZYDIS_MNEMONIC_VFMADD231PD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fmadd_pd("));
-      break;
-      
-    case ZYDIS_MNEMONIC_VFMADD132PS:
-    case ZYDIS_MNEMONIC_VFMADD213PS:
-    case ZYDIS_MNEMONIC_VFMADD231PS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fmadd_ps("));
-      break;
+  *pRenderedCount = 0;
 
-    case ZYDIS_MNEMONIC_VFMADD132SD:
-    case ZYDIS_MNEMONIC_VFMADD213SD:
-    case ZYDIS_MNEMONIC_VFMADD231SD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fmadd_sd("));
-      break;
-      
-    case ZYDIS_MNEMONIC_VFMADD132SS:
-    case ZYDIS_MNEMONIC_VFMADD213SS:
-    case ZYDIS_MNEMONIC_VFMADD231SS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fmadd_ss("));
-      break;
+  ZydisDecodedInstruction instruction;
+  ZydisDecodedOperand operands[ZYDIS_MAX_OPERAND_COUNT];
+  size_t arenaOffset = 0;
 
-    case ZYDIS_MNEMONIC_VFMADDSUB132PD:
-    case ZYDIS_MNEMONIC_VFMADDSUB213PD:
-    case ZYDIS_MNEMONIC_VFMADDSUB231PD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fmaddsub_pd("));
-      break;
+  for (size_t i = 0; i < end - begin; i++)
+  {
+    if (arenaCapacity - arenaOffset < ZydecBatchInstructionCapacity)
+      return false;
 
-    case ZYDIS_MNEMONIC_VFMADDSUB132PS:
-    case ZYDIS_MNEMONIC_VFMADDSUB213PS:
-    case ZYDIS_MNEMONIC_VFMADDSUB231PS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fmaddsub_ps("));
-      break;
+    const ZydecListingInstruction *pEntry = &pListing->pInstructions[begin + i];
+    char *buffer = arena + arenaOffset;
+    bool hasTranslation = pEntry->hasTranslation;
 
-    case ZYDIS_MNEMONIC_VFMSUB132PD:
-    case ZYDIS_MNEMONIC_VFMSUB213PD:
-    case ZYDIS_MNEMONIC_VFMSUB231PD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fmsub_pd("));
-      break;
+    if (hasTranslation)
+    {
+      if (!ZYAN_SUCCESS(ZydisDecoderDecodeFull(pDecoder, pCode + pEntry->offset, pEntry->length, &instruction, operands)))
+        hasTranslation = false;
+      else if (!zydec_RenderAnalyzedInstruction(&instruction, operands, ZYDIS_MAX_OPERAND_COUNT, virtualAddress + pEntry->offset, pListing->pNames + pEntry->firstName, pEntry->nameCount, buffer, ZydecBatchInstructionCapacity, &hasTranslation, pInfo))
+        hasTranslation = false;
+    }
 
-    case ZYDIS_MNEMONIC_VFMSUB132PS:
-    case ZYDIS_MNEMONIC_VFMSUB213PS:
-    case ZYDIS_MNEMONIC_VFMSUB231PS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fmsub_ps("));
-      break;
+    const uint64_t bit = (uint64_t)1 << (i & 63);
+    size_t length = 0;
 
-    case ZYDIS_MNEMONIC_VFMSUB132SD:
-    case ZYDIS_MNEMONIC_VFMSUB213SD:
-    case ZYDIS_MNEMONIC_VFMSUB231SD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fmsub_sd("));
-      break;
+    if (hasTranslation)
+    {
+      length = strlen(buffer);
+      pHasTranslation[i / 64] |= bit;
+    }
+    else
+    {
+      buffer[0] = '\0';
+      pHasTranslation[i / 64] &= ~bit;
+    }
 
-    case ZYDIS_MNEMONIC_VFMSUB132SS:
-    case ZYDIS_MNEMONIC_VFMSUB213SS:
-    case ZYDIS_MNEMONIC_VFMSUB231SS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fmsub_ss("));
-      break;
+    pOffsets[i] = (uint32_t)arenaOffset;
+    pLengths[i] = (uint32_t)length;
+    arenaOffset += length + 1;
 
-    case ZYDIS_MNEMONIC_VFMSUBADD132PD:
-    case ZYDIS_MNEMONIC_VFMSUBADD213PD:
-    case ZYDIS_MNEMONIC_VFMSUBADD231PD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fmsubadd_pd("));
-      break;
+    (*pRenderedCount)++;
+  }
 
-    case ZYDIS_MNEMONIC_VFMSUBADD132PS:
-    case ZYDIS_MNEMONIC_VFMSUBADD213PS:
-    case ZYDIS_MNEMONIC_VFMSUBADD231PS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fmsubadd_ps("));
-      break;
+  return true;
+}
 
-    case ZYDIS_MNEMONIC_VFNMADD132PD:
-    case ZYDIS_MNEMONIC_VFNMADD213PD:
-    case ZYDIS_MNEMONIC_VFNMADD231PD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fnmadd_pd("));
-      break;
+////////////////////////////////////////////////////////////////////////////////
 
-    case ZYDIS_MNEMONIC_VFNMADD132PS:
-    case ZYDIS_MNEMONIC_VFNMADD213PS:
-    case ZYDIS_MNEMONIC_VFNMADD231PS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fnmadd_ps("));
-      break;
+// Advances the session past the instruction at `offset` exactly like `zydec_Listing_Analyze` would, returning the length of the instruction (1 for bytes that failed to decode).
+size_t zydec_CheckpointIndex_AnalyzeInstruction(ZydecLinearSession *pSession, const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t codeSize, const size_t virtualAddress, const size_t offset, bool *pIsBlockEnd)
+{
+  ZydisDecodedInstruction instruction;
+  ZydisDecodedOperand operands[ZYDIS_MAX_OPERAND_COUNT];
 
-    case ZYDIS_MNEMONIC_VFNMADD132SD:
-    case ZYDIS_MNEMONIC_VFNMADD213SD:
-    case ZYDIS_MNEMONIC_VFNMADD231SD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fnmadd_sd("));
-      break;
+  *pIsBlockEnd = false;
 
-    case ZYDIS_MNEMONIC_VFNMADD132SS:
-    case ZYDIS_MNEMONIC_VFNMADD213SS:
-    case ZYDIS_MNEMONIC_VFNMADD231SS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fnmadd_ss("));
-      break;
+  if (!ZYAN_SUCCESS(ZydisDecoderDecodeFull(pDecoder, pCode + offset, codeSize - offset, &instruction, operands)) || instruction.length == 0)
+    return 1;
 
-    case ZYDIS_MNEMONIC_VFNMSUB132PD:
-    case ZYDIS_MNEMONIC_VFNMSUB213PD:
-    case ZYDIS_MNEMONIC_VFNMSUB231PD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fnmsub_pd("));
-      break;
+  zydec_LinearSession_AdvanceInstruction(pSession, &instruction, operands, ZYDIS_MAX_OPERAND_COUNT, virtualAddress + offset);
 
-    case ZYDIS_MNEMONIC_VFNMSUB132PS:
-    case ZYDIS_MNEMONIC_VFNMSUB213PS:
-    case ZYDIS_MNEMONIC_VFNMSUB231PS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fnmsub_ps("));
-      break;
+  switch (instruction.meta.category)
+  {
+  case ZYDIS_CATEGORY_COND_BR:
+  case ZYDIS_CATEGORY_UNCOND_BR:
+  case ZYDIS_CATEGORY_CALL:
+  case ZYDIS_CATEGORY_RET:
+    *pIsBlockEnd = true;
+    break;
 
-    case ZYDIS_MNEMONIC_VFNMSUB132SD:
-    case ZYDIS_MNEMONIC_VFNMSUB213SD:
-    case ZYDIS_MNEMONIC_VFNMSUB231SD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fnmsub_sd("));
-      break;
+  default:
+    break;
+  }
 
-    case ZYDIS_MNEMONIC_VFNMSUB132SS:
-    case ZYDIS_MNEMONIC_VFNMSUB213SS:
-    case ZYDIS_MNEMONIC_VFNMSUB231SS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fnmsub_ss("));
-      break;
-      
-    case ZYDIS_MNEMONIC_STMXCSR:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_getcsr("));
-      break;
+  return instruction.length;
+}
 
-    case ZYDIS_MNEMONIC_PHADDW:
-    case ZYDIS_MNEMONIC_VPHADDW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_hadd_epi16("));
-      break;
+bool zydec_CheckpointIndex_Build(ZydecCheckpointIndex *pIndex, ZydecLinearSession *pSession, const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t codeSize, const size_t virtualAddress)
+{
+  if (pIndex == nullptr || pSession == nullptr || pDecoder == nullptr || pCode == nullptr || pIndex->interval == 0)
+    return false;
 
-    case ZYDIS_MNEMONIC_PHADDD:
-    case ZYDIS_MNEMONIC_VPHADDD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_hadd_epi32("));
-      break;
+  while (pIndex->analyzedSize < codeSize)
+  {
+    // The checkpoint is taken before the instruction is analyzed, so running out of storage leaves the session where the next call continues from.
+    if (pIndex->instructionsSinceCheckpoint == 0)
+    {
+      if (pIndex->checkpointCount >= pIndex->checkpointCapacity)
+        return false;
 
-    case ZYDIS_MNEMONIC_HADDPD:
-    case ZYDIS_MNEMONIC_VHADDPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_hadd_pd("));
-      break;
+      ZydecLinearCheckpoint *pCheckpoint = &pIndex->pCheckpoints[pIndex->checkpointCount];
+      pCheckpoint->offset = pIndex->analyzedSize;
+      pCheckpoint->context = pSession->context;
 
-    case ZYDIS_MNEMONIC_HADDPS:
-    case ZYDIS_MNEMONIC_VHADDPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_hadd_ps("));
-      break;
+      pIndex->checkpointCount++;
+    }
 
-    case ZYDIS_MNEMONIC_PHADDSW:
-    case ZYDIS_MNEMONIC_VPHADDSW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_hadds_epi16("));
-      break;
+    bool isBlockEnd;
+    pIndex->analyzedSize += zydec_CheckpointIndex_AnalyzeInstruction(pSession, pDecoder, pCode, codeSize, virtualAddress, pIndex->analyzedSize, &isBlockEnd);
+    pIndex->instructionsSinceCheckpoint++;
 
-    case ZYDIS_MNEMONIC_PHSUBW:
-    case ZYDIS_MNEMONIC_VPHSUBW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_hsub_epi16("));
-      break;
+    if (pIndex->instructionsSinceCheckpoint >= pIndex->interval || (pIndex->atBlockStarts && isBlockEnd))
+      pIndex->instructionsSinceCheckpoint = 0;
+  }
 
-    case ZYDIS_MNEMONIC_PHSUBD:
-    case ZYDIS_MNEMONIC_VPHSUBD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_hsub_epi32("));
-      break;
+  return true;
+}
 
-    case ZYDIS_MNEMONIC_HSUBPD:
-    case ZYDIS_MNEMONIC_VHSUBPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_hsub_pd("));
-      break;
+bool zydec_CheckpointIndex_Seek(const ZydecCheckpointIndex *pIndex, ZydecLinearSession *pSession, const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t codeSize, const size_t virtualAddress, const size_t targetOffset, size_t *pResumeOffset)
+{
+  if (pIndex == nullptr || pSession == nullptr || pDecoder == nullptr || pCode == nullptr || pResumeOffset == nullptr || pIndex->checkpointCount == 0 || targetOffset > codeSize)
+    return false;
 
-    case ZYDIS_MNEMONIC_HSUBPS:
-    case ZYDIS_MNEMONIC_VHSUBPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_hsub_ps("));
-      break;
+  // Last checkpoint at or before `targetOffset`. Checkpoints are taken in ascending order, the first one being at offset 0.
+  size_t first = 0;
+  size_t count = pIndex->checkpointCount;
 
-    case ZYDIS_MNEMONIC_PHSUBSW:
-    case ZYDIS_MNEMONIC_VPHSUBSW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_hsubs_epi16("));
-      break;
+  while (count > 1)
+  {
+    const size_t half = count / 2;
 
-    case ZYDIS_MNEMONIC_VPGATHERDD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_i32gather_epi32("));
-      addressParam = true;
-      break;
+    if (pIndex->pCheckpoints[first + half].offset <= targetOffset)
+      first += half;
 
-    case ZYDIS_MNEMONIC_VPGATHERDQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_i32gather_epi64("));
-      addressParam = true;
-      break;
+    count -= half;
+  }
 
-    case ZYDIS_MNEMONIC_VGATHERDPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_i32gather_pd("));
-      addressParam = true;
-      break;
+  const ZydecLinearCheckpoint *pCheckpoint = &pIndex->pCheckpoints[first];
 
-    case ZYDIS_MNEMONIC_VGATHERDPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_i32gather_ps("));
-      addressParam = true;
-      break;
-      
-    case ZYDIS_MNEMONIC_VPGATHERQD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_i64gather_epi32("));
-      addressParam = true;
-      break;
+  if (pCheckpoint->offset > targetOffset)
+    return false;
 
-    case ZYDIS_MNEMONIC_VPGATHERQQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_i64gather_epi64("));
-      addressParam = true;
-      break;
+  pSession->context = pCheckpoint->context;
 
-    case ZYDIS_MNEMONIC_VGATHERQPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_i64gather_pd("));
-      addressParam = true;
-      break;
+  size_t offset = pCheckpoint->offset;
 
-    case ZYDIS_MNEMONIC_VGATHERQPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_i64gather_ps("));
-      addressParam = true;
-      break;
+  while (offset < targetOffset)
+  {
+    bool isBlockEnd;
+    offset += zydec_CheckpointIndex_AnalyzeInstruction(pSession, pDecoder, pCode, codeSize, virtualAddress, offset, &isBlockEnd);
+  }
 
-    case ZYDIS_MNEMONIC_PINSRB:
-    case ZYDIS_MNEMONIC_VPINSRB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_insert_epi8("));
-      break;
+  *pResumeOffset = offset;
 
-    case ZYDIS_MNEMONIC_PINSRW:
-    case ZYDIS_MNEMONIC_VPINSRW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_insert_epi16("));
-      break;
+  return true;
+}
 
-    case ZYDIS_MNEMONIC_PINSRD:
-    case ZYDIS_MNEMONIC_VPINSRD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_insert_epi32("));
-      break;
+////////////////////////////////////////////////////////////////////////////////
 
-    case ZYDIS_MNEMONIC_PINSRQ:
-    case ZYDIS_MNEMONIC_VPINSRQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_insert_epi64("));
-      break;
+struct ZydecBlockEnd
+{
+  size_t length; // of the instruction, 1 for bytes that failed to decode.
+  size_t target; // of a relative jump or call, `SIZE_MAX` if there is none or if it's outside of the code.
+  bool isBranch; // ends the block.
+  bool fallsThrough; // into the next instruction.
+};
 
-    case ZYDIS_MNEMONIC_INSERTPS:
-    case ZYDIS_MNEMONIC_VINSERTPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_insert_ps("));
-      break;
+// Decodes the instruction at `offset` like `zydec_Sweep_InstructionLength`. Calls don't end a block, as they return to the next instruction.
+inline ZydecBlockEnd zydec_ControlFlowGraph_DecodeInstruction(const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t codeSize, const size_t offset)
+{
+  ZydecBlockEnd ret;
+  ret.length = 1;
+  ret.target = SIZE_MAX;
+  ret.isBranch = false;
+  ret.fallsThrough = true;
 
-    case ZYDIS_MNEMONIC_VINSERTF128:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_insert_f128("));
-      break;
+  ZydisDecoderContext context;
+  ZydisDecodedInstruction instruction;
 
-    case ZYDIS_MNEMONIC_VINSERTI128:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_insert_i128("));
-      break;
+  if (!ZYAN_SUCCESS(ZydisDecoderDecodeInstruction(pDecoder, &context, pCode + offset, codeSize - offset, &instruction)) || instruction.length == 0)
+    return ret;
 
-    case ZYDIS_MNEMONIC_LFENCE:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_lfence("));
-      break;
+  ret.length = instruction.length;
 
-    case ZYDIS_MNEMONIC_MOVHPS:
-      if (pOperands[0].type == ZYDIS_OPERAND_TYPE_MEMORY || pOperands[0].type == ZYDIS_OPERAND_TYPE_POINTER)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_storeh_pi("));
-      else
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_loadh_pi("));
-      break;
+  switch (instruction.meta.category)
+  {
+  case ZYDIS_CATEGORY_COND_BR:
+  case ZYDIS_CATEGORY_UNCOND_BR:
+  case ZYDIS_CATEGORY_CALL:
+  {
+    if (instruction.raw.imm[0].is_relative)
+    {
+      const size_t target = offset + instruction.length + (size_t)instruction.raw.imm[0].value.s;
 
-    case ZYDIS_MNEMONIC_MOVHPD:
-      if (pOperands[0].type == ZYDIS_OPERAND_TYPE_MEMORY || pOperands[0].type == ZYDIS_OPERAND_TYPE_POINTER)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_storeh_pd("));
-      else
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_loadh_pd("));
-      break;
+      if (target < codeSize)
+        ret.target = target;
+    }
 
-    case ZYDIS_MNEMONIC_VPMADD52HUQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_madd52hi_epu64("));
-      break;
+    ret.isBranch = (instruction.meta.category != ZYDIS_CATEGORY_CALL);
+    ret.fallsThrough = (instruction.meta.category != ZYDIS_CATEGORY_UNCOND_BR);
 
-    case ZYDIS_MNEMONIC_VPMADD52LUQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_madd52lo_epu64("));
-      break;
+    break;
+  }
 
-    case ZYDIS_MNEMONIC_PMADDUBSW:
-    case ZYDIS_MNEMONIC_VPMADDUBSW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_maddubs_epi16("));
-      break;
+  case ZYDIS_CATEGORY_RET:
+    ret.isBranch = true;
+    ret.fallsThrough = false;
+    break;
 
-    case ZYDIS_MNEMONIC_PMAXSB:
-    case ZYDIS_MNEMONIC_VPMAXSB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_max_epi8("));
-      break;
+  default:
+    break;
+  }
 
-    case ZYDIS_MNEMONIC_PMAXSW:
-    case ZYDIS_MNEMONIC_VPMAXSW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_max_epi16("));
-      break;
+  return ret;
+}
 
-    case ZYDIS_MNEMONIC_PMAXSD:
-    case ZYDIS_MNEMONIC_VPMAXSD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_max_epi32("));
-      break;
+inline bool zydec_ControlFlowGraph_IsBitSet(const uint64_t *pBits, const size_t index)
+{
+  return (pBits[index / 64] & ((uint64_t)1 << (index & 63))) != 0;
+}
 
-    case ZYDIS_MNEMONIC_VPMAXSQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_max_epi64("));
-      break;
+uint32_t zydec_ControlFlowGraph_FindBlock(const ZydecControlFlowGraph *pGraph, const size_t offset)
+{
+  if (pGraph == nullptr || pGraph->pBlocks == nullptr || offset > UINT32_MAX)
+    return ZydecBasicBlockNone;
 
-    case ZYDIS_MNEMONIC_PMAXUB:
-    case ZYDIS_MNEMONIC_VPMAXUB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_max_epu8("));
-      break;
+  size_t first = 0;
+  size_t count = pGraph->blockCount;
 
-    case ZYDIS_MNEMONIC_PMAXUW:
-    case ZYDIS_MNEMONIC_VPMAXUW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_max_epu16("));
-      break;
+  while (count > 0)
+  {
+    const size_t half = count / 2;
 
-    case ZYDIS_MNEMONIC_PMAXUD:
-    case ZYDIS_MNEMONIC_VPMAXUD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_max_epu32("));
-      break;
+    if (pGraph->pBlocks[first + half].offset < offset)
+    {
+      first += half + 1;
+      count -= half + 1;
+    }
+    else
+    {
+      count = half;
+    }
+  }
 
-    case ZYDIS_MNEMONIC_VPMAXUQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_max_epu64("));
-      break;
+  if (first < pGraph->blockCount && pGraph->pBlocks[first].offset == offset)
+    return (uint32_t)first;
 
-    case ZYDIS_MNEMONIC_MAXPD:
-    case ZYDIS_MNEMONIC_VMAXPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_max_pd("));
-      break;
+  return ZydecBasicBlockNone;
+}
 
-    case ZYDIS_MNEMONIC_MAXPS:
-    case ZYDIS_MNEMONIC_VMAXPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_max_ps("));
-      break;
+// Appends the reverse postorder of the blocks reachable from `root` that haven't been ordered yet to `pOrder`.
+void zydec_ControlFlowGraph_OrderFrom(ZydecControlFlowGraph *pGraph, const uint32_t root, uint32_t *pStack, size_t *pOrderCount)
+{
+  const size_t treeStart = *pOrderCount;
+  size_t stackSize = 0;
 
-    case ZYDIS_MNEMONIC_MAXSD:
-    case ZYDIS_MNEMONIC_VMAXSD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_max_sd("));
-      break;
+  // `order` holds the index of the next successor to visit while a block is on the stack.
+  pGraph->pBlocks[root].order = 0;
+  pStack[stackSize++] = root;
 
-    case ZYDIS_MNEMONIC_MAXSS:
-    case ZYDIS_MNEMONIC_VMAXSS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_max_ss("));
-      break;
+  while (stackSize > 0)
+  {
+    ZydecBasicBlock *pBlock = &pGraph->pBlocks[pStack[stackSize - 1]];
 
-    case ZYDIS_MNEMONIC_PMINSB:
-    case ZYDIS_MNEMONIC_VPMINSB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_min_epi8("));
-      break;
+    if (pBlock->order < 2)
+    {
+      const uint32_t successor = pBlock->successors[pBlock->order++];
 
-    case ZYDIS_MNEMONIC_PMINSW:
-    case ZYDIS_MNEMONIC_VPMINSW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_min_epi16("));
-      break;
+      if (successor != ZydecBasicBlockNone && pGraph->pBlocks[successor].order == ZydecBasicBlockNone)
+      {
+        pGraph->pBlocks[successor].order = 0;
+        pStack[stackSize++] = successor;
+      }
 
-    case ZYDIS_MNEMONIC_PMINSD:
-    case ZYDIS_MNEMONIC_VPMINSD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_min_epi32("));
-      break;
+      continue;
+    }
 
-    case ZYDIS_MNEMONIC_VPMINSQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_min_epi64("));
-      break;
+    pGraph->pOrder[(*pOrderCount)++] = pStack[--stackSize];
+  }
 
-    case ZYDIS_MNEMONIC_PMINUB:
-    case ZYDIS_MNEMONIC_VPMINUB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_min_epu8("));
-      break;
+  for (size_t i = treeStart, j = *pOrderCount - 1; i < j; i++, j--)
+  {
+    const uint32_t tmp = pGraph->pOrder[i];
+    pGraph->pOrder[i] = pGraph->pOrder[j];
+    pGraph->pOrder[j] = tmp;
+  }
+}
 
-    case ZYDIS_MNEMONIC_PMINUW:
-    case ZYDIS_MNEMONIC_VPMINUW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_min_epu16("));
-      break;
+bool zydec_ControlFlowGraph_Build(ZydecControlFlowGraph *pGraph, const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t codeSize)
+{
+  if (pGraph == nullptr || pDecoder == nullptr || pCode == nullptr || codeSize == 0 || codeSize >= UINT32_MAX)
+    return false;
 
-    case ZYDIS_MNEMONIC_PMINUD:
-    case ZYDIS_MNEMONIC_VPMINUD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_min_epu32("));
-      break;
+  const size_t wordCount = (codeSize + 63) / 64;
+  uint64_t *pLeaders = static_cast<uint64_t *>(calloc(wordCount, sizeof(uint64_t)));
+  uint64_t *pBoundaries = static_cast<uint64_t *>(calloc(wordCount, sizeof(uint64_t)));
 
-    case ZYDIS_MNEMONIC_VPMINUQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_min_epu64("));
-      break;
+  if (pLeaders == nullptr || pBoundaries == nullptr)
+  {
+    free(pLeaders);
+    free(pBoundaries);
+    return false;
+  }
 
-    case ZYDIS_MNEMONIC_MINPD:
-    case ZYDIS_MNEMONIC_VMINPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_min_pd("));
-      break;
+  // Find the instruction boundaries & everything that starts a block.
+  pLeaders[0] = 1;
 
-    case ZYDIS_MNEMONIC_MINPS:
-    case ZYDIS_MNEMONIC_VMINPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_min_ps("));
-      break;
+  for (size_t offset = 0; offset < codeSize;)
+  {
+    const ZydecBlockEnd end = zydec_ControlFlowGraph_DecodeInstruction(pDecoder, pCode, codeSize, offset);
 
-    case ZYDIS_MNEMONIC_MINSD:
-    case ZYDIS_MNEMONIC_VMINSD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_min_sd("));
-      break;
+    pBoundaries[offset / 64] |= (uint64_t)1 << (offset & 63);
+    offset += end.length;
 
-    case ZYDIS_MNEMONIC_MINSS:
-    case ZYDIS_MNEMONIC_VMINSS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_min_ss("));
-      break;
+    if (end.target != SIZE_MAX)
+      pLeaders[end.target / 64] |= (uint64_t)1 << (end.target & 63);
 
-    case ZYDIS_MNEMONIC_PHMINPOSUW:
-    case ZYDIS_MNEMONIC_VPHMINPOSUW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_minpos_epu16("));
-      break;
+    if (end.isBranch && offset < codeSize)
+      pLeaders[offset / 64] |= (uint64_t)1 << (offset & 63);
+  }
 
-    case ZYDIS_MNEMONIC_MOVDDUP:
-    case ZYDIS_MNEMONIC_VMOVDDUP:
-    {
-      if (pOperands[1].type == ZYDIS_OPERAND_TYPE_MEMORY || pOperands[1].type == ZYDIS_OPERAND_TYPE_POINTER)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_loaddup_pd("));
-      else
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_movedup_pd("));
+  for (size_t i = 0; i < wordCount; i++)
+    pLeaders[i] &= pBoundaries[i];
 
-      addressParam = true;
+  const size_t blockCapacity = (pGraph->pBlocks != nullptr && pGraph->pOrder != nullptr) ? pGraph->blockCapacity : 0;
 
-      break;
-    }
+  // Form the blocks, with the successors as offsets for now, as later blocks don't exist yet.
+  size_t blockIndex = 0;
+  size_t edgeCount = 0;
 
-    case ZYDIS_MNEMONIC_MOVSHDUP:
-    case ZYDIS_MNEMONIC_VMOVSHDUP:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_movehdup_ps("));
-      break;
+  for (size_t offset = 0; offset < codeSize;)
+  {
+    const ZydecBlockEnd end = zydec_ControlFlowGraph_DecodeInstruction(pDecoder, pCode, codeSize, offset);
+    const size_t next = offset + end.length;
 
-    case ZYDIS_MNEMONIC_MOVHLPS:
-    case ZYDIS_MNEMONIC_VMOVHLPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_movehl_ps("));
-      break;
+    if (zydec_ControlFlowGraph_IsBitSet(pLeaders, offset))
+    {
+      if (blockIndex < blockCapacity)
+      {
+        ZydecBasicBlock *pBlock = &pGraph->pBlocks[blockIndex];
+        pBlock->offset = (uint32_t)offset;
+        pBlock->successors[0] = ZydecBasicBlockNone;
+        pBlock->successors[1] = ZydecBasicBlockNone;
+        pBlock->predecessorCount = 0;
+        pBlock->order = ZydecBasicBlockNone;
+      }
 
-    case ZYDIS_MNEMONIC_MOVSLDUP:
-    case ZYDIS_MNEMONIC_VMOVSLDUP:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_moveldup_ps("));
-      break;
+      blockIndex++;
+    }
 
-    case ZYDIS_MNEMONIC_MOVLHPS:
-    case ZYDIS_MNEMONIC_VMOVLHPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_movelh_ps("));
-      break;
+    if (end.isBranch || next >= codeSize || zydec_ControlFlowGraph_IsBitSet(pLeaders, next))
+    {
+      const uint32_t fallThrough = (end.fallsThrough && next < codeSize) ? (uint32_t)next : ZydecBasicBlockNone;
+      uint32_t target = ZydecBasicBlockNone;
 
-    case ZYDIS_MNEMONIC_PMOVMSKB:
-    case ZYDIS_MNEMONIC_VPMOVMSKB:
-      maySelfReference = false;
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_movemask_epi8("));
-      break;
+      // A conditional branch to the next instruction only has a single successor.
+      if (end.isBranch && end.target != SIZE_MAX && zydec_ControlFlowGraph_IsBitSet(pBoundaries, end.target) && end.target != fallThrough)
+        target = (uint32_t)end.target;
 
-    case ZYDIS_MNEMONIC_MOVMSKPD:
-    case ZYDIS_MNEMONIC_VMOVMSKPD:
-      maySelfReference = false;
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_movemask_pd("));
-      break;
+      edgeCount += (fallThrough != ZydecBasicBlockNone) + (target != ZydecBasicBlockNone);
 
-    case ZYDIS_MNEMONIC_MOVMSKPS:
-    case ZYDIS_MNEMONIC_VMOVMSKPS:
-      maySelfReference = false;
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_movemask_ps("));
-      break;
+      if (blockIndex <= blockCapacity)
+      {
+        ZydecBasicBlock *pBlock = &pGraph->pBlocks[blockIndex - 1];
+        pBlock->size = (uint32_t)(next - pBlock->offset);
+        pBlock->successors[0] = fallThrough;
+        pBlock->successors[1] = target;
+      }
+    }
 
-    case ZYDIS_MNEMONIC_MPSADBW:
-    case ZYDIS_MNEMONIC_VMPSADBW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mpsadbw_epu8("));
-      break;
+    offset = next;
+  }
 
-    case ZYDIS_MNEMONIC_PMULDQ:
-    case ZYDIS_MNEMONIC_VPMULDQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mul_epi32("));
-      break;
+  free(pLeaders);
+  free(pBoundaries);
 
-    case ZYDIS_MNEMONIC_PMULUDQ:
-    case ZYDIS_MNEMONIC_VPMULUDQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mul_epu32("));
-      break;
+  const size_t blockCount = blockIndex;
 
-    case ZYDIS_MNEMONIC_MULPD:
-    case ZYDIS_MNEMONIC_VMULPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mul_pd("));
-      break;
+  pGraph->blockCount = blockCount;
+  pGraph->predecessorCount = edgeCount;
 
-    case ZYDIS_MNEMONIC_MULPS:
-    case ZYDIS_MNEMONIC_VMULPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mul_ps("));
-      break;
+  if (blockCount > blockCapacity || pGraph->pPredecessors == nullptr || edgeCount > pGraph->predecessorCapacity)
+    return false;
 
-    case ZYDIS_MNEMONIC_MULSD:
-    case ZYDIS_MNEMONIC_VMULSD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mul_sd("));
-      break;
+  // Resolve the successors to block indices & count the predecessors of every block.
+  for (size_t i = 0; i < blockCount; i++)
+  {
+    ZydecBasicBlock *pBlock = &pGraph->pBlocks[i];
 
-    case ZYDIS_MNEMONIC_MULSS:
-    case ZYDIS_MNEMONIC_VMULSS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mul_ss("));
-      break;
+    for (size_t j = 0; j < 2; j++)
+    {
+      if (pBlock->successors[j] == ZydecBasicBlockNone)
+        continue;
 
-    case ZYDIS_MNEMONIC_PMULHRSW:
-    case ZYDIS_MNEMONIC_VPMULHRSW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mulhrs_epi16("));
-      break;
+      pBlock->successors[j] = zydec_ControlFlowGraph_FindBlock(pGraph, pBlock->successors[j]);
+      pGraph->pBlocks[pBlock->successors[j]].predecessorCount++;
+    }
+  }
 
-    case ZYDIS_MNEMONIC_PMULLD:
-    case ZYDIS_MNEMONIC_VPMULLD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mullo_epi32("));
-      break;
+  uint32_t firstPredecessor = 0;
 
-    case ZYDIS_MNEMONIC_ORPD:
-    case ZYDIS_MNEMONIC_VORPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_or_pd("));
-      break;
+  for (size_t i = 0; i < blockCount; i++)
+  {
+    pGraph->pBlocks[i].firstPredecessor = firstPredecessor;
+    firstPredecessor += pGraph->pBlocks[i].predecessorCount;
+    pGraph->pBlocks[i].predecessorCount = 0;
+  }
 
-    case ZYDIS_MNEMONIC_ORPS:
-    case ZYDIS_MNEMONIC_VORPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_or_ps("));
-      break;
+  for (size_t i = 0; i < blockCount; i++)
+  {
+    for (size_t j = 0; j < 2; j++)
+    {
+      const uint32_t successor = pGraph->pBlocks[i].successors[j];
 
-    case ZYDIS_MNEMONIC_PAUSE:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_pause("));
-      break;
+      if (successor == ZydecBasicBlockNone)
+        continue;
 
-    case ZYDIS_MNEMONIC_VPERMILPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_permute_pd("));
-      break;
+      ZydecBasicBlock *pSuccessor = &pGraph->pBlocks[successor];
+      pGraph->pPredecessors[pSuccessor->firstPredecessor + pSuccessor->predecessorCount++] = (uint32_t)i;
+    }
+  }
 
-    case ZYDIS_MNEMONIC_VPERMILPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_permute_ps("));
-      break;
+  // Order the blocks starting from the entry, then from every block without predecessors (e.g. other functions), then from whatever is left (unreachable loops).
+  uint32_t *pStack = static_cast<uint32_t *>(malloc(blockCount * sizeof(uint32_t)));
 
-    case ZYDIS_MNEMONIC_VPERM2F128:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_permute_2f128("));
-      break;
+  if (pStack == nullptr)
+    return false;
 
-    case ZYDIS_MNEMONIC_VPERM2I128:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_permute_2i128("));
-      break;
+  size_t orderCount = 0;
 
-    case ZYDIS_MNEMONIC_VPERMQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_permute4x64_epi64("));
-      break;
+  zydec_ControlFlowGraph_OrderFrom(pGraph, 0, pStack, &orderCount);
 
-    case ZYDIS_MNEMONIC_VPERMPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_permute4x64_pd("));
-      break;
+  for (size_t pass = 0; pass < 2; pass++)
+    for (size_t i = 1; i < blockCount; i++)
+      if (pGraph->pBlocks[i].order == ZydecBasicBlockNone && (pass == 1 || pGraph->pBlocks[i].predecessorCount == 0))
+        zydec_ControlFlowGraph_OrderFrom(pGraph, (uint32_t)i, pStack, &orderCount);
 
-    case ZYDIS_MNEMONIC_VPERMPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_permutevar8x32_ps("));
-      break;
+  free(pStack);
 
-    case ZYDIS_MNEMONIC_RCPPS:
-    case ZYDIS_MNEMONIC_VRCPPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_rcp_ps("));
-      break;
+  for (size_t i = 0; i < blockCount; i++)
+    pGraph->pBlocks[pGraph->pOrder[i]].order = (uint32_t)i;
 
-    case ZYDIS_MNEMONIC_RCPSS:
-    case ZYDIS_MNEMONIC_VRCPSS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_rcp_ss("));
-      break;
+  return true;
+}
 
-    case ZYDIS_MNEMONIC_RSQRTPS:
-    case ZYDIS_MNEMONIC_VRSQRTPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_rsqrt_ps("));
-      break;
+// Blocks continue the names of the block falling into them, everything else starts from its own address, so that both sides of a branch don't hand out the same names.
+inline uint64_t zydec_ControlFlowGraph_BlockHashState(const size_t virtualAddress)
+{
+  return ((uint64_t)virtualAddress * 0x9E3779B97F4A7C15) ^ 0xBADC0FFEECA7F00D;
+}
 
-    case ZYDIS_MNEMONIC_RSQRTSS:
-    case ZYDIS_MNEMONIC_VRSQRTSS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_rsqrt_ss("));
-      break;
+// Propagates the names through the blocks that `pMembers` is set for (or all of them if it's `nullptr`), ignoring every edge coming from anywhere else. Without `pMembers`, the entry & blocks without predecessors start with the names of the session.
+bool zydec_ControlFlowGraph_Propagate(ZydecControlFlowGraph *pGraph, const bool *pMembers, ZydecLinearSession *pSession, const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t codeSize, const size_t virtualAddress, const size_t maxPasses, size_t *pPassCount, bool *pReachedFixedPoint)
+{
+  if (pGraph == nullptr || pGraph->pBlocks == nullptr || pGraph->pOrder == nullptr || pGraph->pContexts == nullptr || pGraph->pPredecessors == nullptr || pGraph->blockCount == 0 || pSession == nullptr || pDecoder == nullptr || pCode == nullptr || maxPasses == 0)
+    return false;
 
-    case ZYDIS_MNEMONIC_PSADBW:
-    case ZYDIS_MNEMONIC_VPSADBW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_sad_epu8("));
-      break;
+  const ZydecBasicBlock *pLastBlock = &pGraph->pBlocks[pGraph->blockCount - 1];
 
-    case ZYDIS_MNEMONIC_SFENCE:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_sfence("));
-      break;
+  if ((size_t)pLastBlock->offset + pLastBlock->size > codeSize)
+    return false;
 
-    case ZYDIS_MNEMONIC_PSHUFB:
-    case ZYDIS_MNEMONIC_VPSHUFB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_shuffle_epi8("));
-      break;
+  const size_t blockCount = pGraph->blockCount;
+  ZydecLinearContext *pExits = static_cast<ZydecLinearContext *>(malloc(blockCount * sizeof(ZydecLinearContext)));
+  bool *pHasExit = static_cast<bool *>(calloc(blockCount, sizeof(bool)));
 
-    case ZYDIS_MNEMONIC_PSHUFW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_shuffle_epi16("));
-      break;
+  if (pExits == nullptr || pHasExit == nullptr)
+  {
+    free(pExits);
+    free(pHasExit);
+    return false;
+  }
 
-    case ZYDIS_MNEMONIC_PSHUFD:
-    case ZYDIS_MNEMONIC_VPSHUFD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_shuffle_epi32("));
-      break;
+  ZydecLinearContext initial;
+  zydec_LinearContext_Snapshot(&pSession->context, &initial);
 
-    case ZYDIS_MNEMONIC_SHUFPS:
-    case ZYDIS_MNEMONIC_VSHUFPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_shuffle_ps("));
-      break;
+  size_t pass = 0;
+  bool isFixedPoint = false;
 
-    case ZYDIS_MNEMONIC_SHUFPD:
-    case ZYDIS_MNEMONIC_VSHUFPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_shuffle_pd("));
-      break;
+  while (pass < maxPasses && !isFixedPoint)
+  {
+    isFixedPoint = (pass > 0);
 
-    case ZYDIS_MNEMONIC_PSHUFHW:
-    case ZYDIS_MNEMONIC_VPSHUFHW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_shufflehi_epi16("));
-      break;
+    for (size_t i = 0; i < blockCount; i++)
+    {
+      const uint32_t blockIndex = pGraph->pOrder[i];
 
-    case ZYDIS_MNEMONIC_PSHUFLW:
-    case ZYDIS_MNEMONIC_VPSHUFLW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_shufflelo_epi16("));
-      break;
+      if (pMembers != nullptr && !pMembers[blockIndex])
+        continue;
 
-    case ZYDIS_MNEMONIC_PSIGNB:
-    case ZYDIS_MNEMONIC_VPSIGNB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_sign_epi8("));
-      break;
+      const ZydecBasicBlock *pBlock = &pGraph->pBlocks[blockIndex];
+      const size_t blockAddress = virtualAddress + pBlock->offset;
+      const bool startsFromSession = (pMembers == nullptr && (blockIndex == 0 || pBlock->predecessorCount == 0));
+      size_t predecessorCount = 0;
 
-    case ZYDIS_MNEMONIC_PSIGNW:
-    case ZYDIS_MNEMONIC_VPSIGNW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_sign_epi16("));
-      break;
+      for (size_t j = 0; j < pBlock->predecessorCount; j++)
+        predecessorCount += (pMembers == nullptr || pMembers[pGraph->pPredecessors[pBlock->firstPredecessor + j]]);
 
-    case ZYDIS_MNEMONIC_PSIGND:
-    case ZYDIS_MNEMONIC_VPSIGND:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_sign_epi32("));
-      break;
+      ZydecLinearContext entry;
+      bool hasEntry = false;
 
-    case ZYDIS_MNEMONIC_PSLLW:
-    case ZYDIS_MNEMONIC_VPSLLW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_sll_epi16("));
-      break;
+      if (startsFromSession)
+      {
+        entry = initial;
 
-    case ZYDIS_MNEMONIC_PSLLD:
-    case ZYDIS_MNEMONIC_VPSLLD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_sll_epi32("));
-      break;
+        if (blockIndex != 0)
+          entry.hashState = zydec_ControlFlowGraph_BlockHashState(blockAddress);
 
-    case ZYDIS_MNEMONIC_PSLLQ:
-    case ZYDIS_MNEMONIC_VPSLLQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_sll_epi64("));
-      break;
+        hasEntry = true;
+      }
 
-    case ZYDIS_MNEMONIC_VPSLLVD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_sllv_epi32("));
-      break;
+      for (size_t j = 0; j < pBlock->predecessorCount; j++)
+      {
+        const uint32_t predecessor = pGraph->pPredecessors[pBlock->firstPredecessor + j];
 
-    case ZYDIS_MNEMONIC_VPSLLVQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_sllv_epi64("));
-      break;
+        if (!pHasExit[predecessor] || (pMembers != nullptr && !pMembers[predecessor]))
+          continue;
 
-    case ZYDIS_MNEMONIC_SQRTPD:
-    case ZYDIS_MNEMONIC_VSQRTPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_sqrt_pd("));
-      break;
+        const ZydecLinearContext *pExit = &pExits[predecessor];
 
-    case ZYDIS_MNEMONIC_SQRTPS:
-    case ZYDIS_MNEMONIC_VSQRTPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_sqrt_ps("));
-      break;
+        if (!hasEntry)
+        {
+          entry = *pExit;
 
-    case ZYDIS_MNEMONIC_SQRTSD:
-    case ZYDIS_MNEMONIC_VSQRTSD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_sqrt_sd("));
-      break;
+          if (pGraph->pBlocks[predecessor].successors[0] != blockIndex || predecessorCount > 1)
+            entry.hashState = zydec_ControlFlowGraph_BlockHashState(blockAddress);
 
-    case ZYDIS_MNEMONIC_SQRTSS:
-    case ZYDIS_MNEMONIC_VSQRTSS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_sqrt_ss("));
-      break;
+          hasEntry = true;
+          continue;
+        }
 
-    case ZYDIS_MNEMONIC_PSRAW:
-    case ZYDIS_MNEMONIC_VPSRAW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_sra_epi16("));
-      break;
+        // Deterministic names where the predecessors disagree, so that another pass over the same names comes to the same result.
+        for (size_t k = 0; k < ZydecLinearContextRegisterCount; k++)
+          if (entry.regInfo[k] != pExit->regInfo[k])
+            entry.regInfo[k] = zydec_LinearContext_SeededRegisterName(blockAddress, ZydecLinearContextRegisterCount + k);
+      }
 
-    case ZYDIS_MNEMONIC_PSRAD:
-    case ZYDIS_MNEMONIC_VPSRAD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_sra_epi32("));
-      break;
+      // Only loops without any (considered) entry from the outside get here before any of their predecessors.
+      if (!hasEntry)
+      {
+        entry = initial;
+        entry.hashState = zydec_ControlFlowGraph_BlockHashState(blockAddress);
+      }
 
-    case ZYDIS_MNEMONIC_VPSRAQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_sra_epi64("));
-      break;
+      ZydecLinearContext *pContext = &pGraph->pContexts[blockIndex];
 
-    case ZYDIS_MNEMONIC_VPSRAVW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_srav_epi16("));
-      break;
+      if (pass > 0 && pHasExit[blockIndex] && entry.hashState == pContext->hashState && memcmp(entry.regInfo, pContext->regInfo, sizeof(entry.regInfo)) == 0)
+        continue;
 
-    case ZYDIS_MNEMONIC_VPSRAVD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_srav_epi32("));
-      break;
+      isFixedPoint = false;
+      *pContext = entry;
 
-    case ZYDIS_MNEMONIC_VPSRAVQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_srav_epi64("));
-      break;
+      zydec_LinearContext_Restore(&pSession->context, &entry);
+      zydec_LinearSession_AdvanceCode(pSession, pDecoder, pCode + pBlock->offset, pBlock->size, blockAddress);
+      zydec_LinearContext_Snapshot(&pSession->context, &pExits[blockIndex]);
+      pHasExit[blockIndex] = true;
+    }
 
-    case ZYDIS_MNEMONIC_PSRLW:
-    case ZYDIS_MNEMONIC_VPSRLW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_srl_epi16("));
-      break;
+    pass++;
+  }
 
-    case ZYDIS_MNEMONIC_PSRLD:
-    case ZYDIS_MNEMONIC_VPSRLD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_srl_epi32("));
-      break;
+  zydec_LinearContext_Restore(&pSession->context, &initial);
 
-    case ZYDIS_MNEMONIC_PSRLQ:
-    case ZYDIS_MNEMONIC_VPSRLQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_srl_epi64("));
-      break;
+  free(pExits);
+  free(pHasExit);
 
-    case ZYDIS_MNEMONIC_VPSRLVW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_srlv_epi16("));
-      break;
+  if (pPassCount != nullptr)
+    *pPassCount = pass;
 
-    case ZYDIS_MNEMONIC_VPSRLVD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_srlv_epi32("));
-      break;
+  if (pReachedFixedPoint != nullptr)
+    *pReachedFixedPoint = isFixedPoint;
 
-    case ZYDIS_MNEMONIC_VPSRLVQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_srlv_epi64("));
-      break;
+  return true;
+}
 
-    case ZYDIS_MNEMONIC_PSUBB:
-    case ZYDIS_MNEMONIC_VPSUBB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_sub_epi8("));
-      break;
+bool zydec_ControlFlowGraph_PropagateNames(ZydecControlFlowGraph *pGraph, ZydecLinearSession *pSession, const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t codeSize, const size_t virtualAddress, const size_t maxPasses, size_t *pPassCount, bool *pReachedFixedPoint)
+{
+  return zydec_ControlFlowGraph_Propagate(pGraph, nullptr, pSession, pDecoder, pCode, codeSize, virtualAddress, maxPasses, pPassCount, pReachedFixedPoint);
+}
 
-    case ZYDIS_MNEMONIC_PSUBW:
-    case ZYDIS_MNEMONIC_VPSUBW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_sub_epi16("));
-      break;
+bool zydec_ControlFlowGraph_BeginBlock(const ZydecControlFlowGraph *pGraph, const size_t blockIndex, ZydecLinearSession *pSession)
+{
+  if (pGraph == nullptr || pGraph->pContexts == nullptr || blockIndex >= pGraph->blockCount || pSession == nullptr)
+    return false;
 
-    case ZYDIS_MNEMONIC_PSUBD:
-    case ZYDIS_MNEMONIC_VPSUBD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_sub_epi32("));
-      break;
+  zydec_LinearContext_Restore(&pSession->context, &pGraph->pContexts[blockIndex]);
 
-    case ZYDIS_MNEMONIC_PSUBQ:
-    case ZYDIS_MNEMONIC_VPSUBQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_sub_epi64("));
-      break;
+  return true;
+}
 
-    case ZYDIS_MNEMONIC_SUBPD:
-    case ZYDIS_MNEMONIC_VSUBPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_sub_pd("));
-      break;
+////////////////////////////////////////////////////////////////////////////////
 
-    case ZYDIS_MNEMONIC_SUBPS:
-    case ZYDIS_MNEMONIC_VSUBPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_sub_ps("));
-      break;
+struct ZydecDominatorTree
+{
+  const ZydecControlFlowGraph *pGraph;
+  uint32_t *pDominators; // immediate dominator of every block, `blockCount` for the roots of the graph, which are dominated by a virtual root only.
+};
 
-    case ZYDIS_MNEMONIC_SUBSD:
-    case ZYDIS_MNEMONIC_VSUBSD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_sub_sd("));
-      break;
+// Position in the reverse postorder, the virtual root coming first.
+inline uint32_t zydec_DominatorTree_Rank(const ZydecDominatorTree *pTree, const uint32_t block)
+{
+  return block == pTree->pGraph->blockCount ? 0 : pTree->pGraph->pBlocks[block].order + 1;
+}
 
-    case ZYDIS_MNEMONIC_SUBSS:
-    case ZYDIS_MNEMONIC_VSUBSS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_sub_ss("));
-      break;
+inline uint32_t zydec_DominatorTree_Intersect(const ZydecDominatorTree *pTree, uint32_t a, uint32_t b)
+{
+  while (a != b)
+  {
+    while (zydec_DominatorTree_Rank(pTree, a) > zydec_DominatorTree_Rank(pTree, b))
+      a = pTree->pDominators[a];
 
-    case ZYDIS_MNEMONIC_PSUBSB:
-    case ZYDIS_MNEMONIC_VPSUBSB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_subs_epi8("));
-      break;
+    while (zydec_DominatorTree_Rank(pTree, b) > zydec_DominatorTree_Rank(pTree, a))
+      b = pTree->pDominators[b];
+  }
 
-    case ZYDIS_MNEMONIC_PSUBSW:
-    case ZYDIS_MNEMONIC_VPSUBSW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_subs_epi16("));
-      break;
+  return a;
+}
 
-    case ZYDIS_MNEMONIC_PTEST:
-    case ZYDIS_MNEMONIC_VPTEST:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_test("));
-      break;
+inline bool zydec_DominatorTree_Dominates(const ZydecDominatorTree *pTree, const uint32_t dominator, uint32_t block)
+{
+  const uint32_t rank = zydec_DominatorTree_Rank(pTree, dominator);
 
-    case ZYDIS_MNEMONIC_VTESTPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_test_pd("));
-      break;
+  while (zydec_DominatorTree_Rank(pTree, block) > rank)
+    block = pTree->pDominators[block];
 
-    case ZYDIS_MNEMONIC_VTESTPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_test_ps("));
-      break;
+  return block == dominator;
+}
 
-    case ZYDIS_MNEMONIC_UCOMISD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_ucomi_sd("));
-      break;
+// Cooper, Harvey & Kennedy: "A Simple, Fast Dominance Algorithm". Blocks that no block before them in the reverse postorder leads to start a tree of their own.
+void zydec_DominatorTree_Build(ZydecDominatorTree *pTree)
+{
+  const ZydecControlFlowGraph *pGraph = pTree->pGraph;
+  const uint32_t root = (uint32_t)pGraph->blockCount;
 
-    case ZYDIS_MNEMONIC_UCOMISS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_ucomi_ss("));
-      break;
+  for (size_t i = 0; i < pGraph->blockCount; i++)
+  {
+    const ZydecBasicBlock *pBlock = &pGraph->pBlocks[i];
+    bool isRoot = true;
 
-    case ZYDIS_MNEMONIC_PUNPCKHBW:
-    case ZYDIS_MNEMONIC_VPUNPCKHBW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_unpackhi_epi8("));
-      break;
+    for (size_t j = 0; j < pBlock->predecessorCount && isRoot; j++)
+      isRoot = (pGraph->pBlocks[pGraph->pPredecessors[pBlock->firstPredecessor + j]].order >= pBlock->order);
 
-    case ZYDIS_MNEMONIC_PUNPCKHWD:
-    case ZYDIS_MNEMONIC_VPUNPCKHWD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_unpackhi_epi16("));
-      break;
+    pTree->pDominators[i] = isRoot ? root : ZydecBasicBlockNone;
+  }
 
-    case ZYDIS_MNEMONIC_PUNPCKHDQ:
-    case ZYDIS_MNEMONIC_VPUNPCKHDQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_unpackhi_epi32("));
-      break;
+  bool changed = true;
 
-    case ZYDIS_MNEMONIC_PUNPCKHQDQ:
-    case ZYDIS_MNEMONIC_VPUNPCKHQDQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_unpackhi_epi64("));
-      break;
+  while (changed)
+  {
+    changed = false;
 
-    case ZYDIS_MNEMONIC_UNPCKHPD:
-    case ZYDIS_MNEMONIC_VUNPCKHPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_unpackhi_pd("));
-      break;
+    for (size_t i = 0; i < pGraph->blockCount; i++)
+    {
+      const uint32_t block = pGraph->pOrder[i];
+      const ZydecBasicBlock *pBlock = &pGraph->pBlocks[block];
 
-    case ZYDIS_MNEMONIC_UNPCKHPS:
-    case ZYDIS_MNEMONIC_VUNPCKHPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_unpackhi_ps("));
-      break;
+      if (pTree->pDominators[block] == root)
+        continue;
 
-    case ZYDIS_MNEMONIC_PUNPCKLBW:
-    case ZYDIS_MNEMONIC_VPUNPCKLBW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_unpacklo_epi8("));
-      break;
+      uint32_t dominator = ZydecBasicBlockNone;
 
-    case ZYDIS_MNEMONIC_PUNPCKLWD:
-    case ZYDIS_MNEMONIC_VPUNPCKLWD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_unpacklo_epi16("));
-      break;
+      for (size_t j = 0; j < pBlock->predecessorCount; j++)
+      {
+        const uint32_t predecessor = pGraph->pPredecessors[pBlock->firstPredecessor + j];
 
-    case ZYDIS_MNEMONIC_PUNPCKLDQ:
-    case ZYDIS_MNEMONIC_VPUNPCKLDQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_unpacklo_epi32("));
-      break;
+        if (pTree->pDominators[predecessor] == ZydecBasicBlockNone)
+          continue;
 
-    case ZYDIS_MNEMONIC_PUNPCKLQDQ:
-    case ZYDIS_MNEMONIC_VPUNPCKLQDQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_unpacklo_epi64("));
-      break;
+        dominator = (dominator == ZydecBasicBlockNone) ? predecessor : zydec_DominatorTree_Intersect(pTree, predecessor, dominator);
+      }
 
-    case ZYDIS_MNEMONIC_UNPCKLPD:
-    case ZYDIS_MNEMONIC_VUNPCKLPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_unpacklo_pd("));
-      break;
+      if (pTree->pDominators[block] != dominator)
+      {
+        pTree->pDominators[block] = dominator;
+        changed = true;
+      }
+    }
+  }
+}
 
-    case ZYDIS_MNEMONIC_UNPCKLPS:
-    case ZYDIS_MNEMONIC_VUNPCKLPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_unpacklo_ps("));
-      break;
+static int zydec_LoopForest_CompareBlocks(const void *pA, const void *pB)
+{
+  const uint32_t a = *static_cast<const uint32_t *>(pA);
+  const uint32_t b = *static_cast<const uint32_t *>(pB);
 
-    case ZYDIS_MNEMONIC_PXOR:
-    case ZYDIS_MNEMONIC_VPXOR:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_xor_si("));
-      break;
+  return a < b ? -1 : (a > b ? 1 : 0);
+}
 
-    case ZYDIS_MNEMONIC_XORPS:
-    case ZYDIS_MNEMONIC_VXORPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_xor_ps("));
-      break;
+// Larger loops first, so that every loop is processed after the loops containing it.
+static int zydec_LoopForest_CompareLoopSizes(const void *pA, const void *pB)
+{
+  const uint64_t a = *static_cast<const uint64_t *>(pA);
+  const uint64_t b = *static_cast<const uint64_t *>(pB);
 
-    case ZYDIS_MNEMONIC_XORPD:
-    case ZYDIS_MNEMONIC_VXORPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_xor_pd("));
-      break;
+  return a > b ? -1 : (a < b ? 1 : 0);
+}
 
-    case ZYDIS_MNEMONIC_VZEROALL:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_zeroall("));
-      break;
+bool zydec_LoopForest_Build(ZydecLoopForest *pForest, const ZydecControlFlowGraph *pGraph)
+{
+  if (pForest == nullptr || pForest->pInnermostLoops == nullptr || pGraph == nullptr || pGraph->pBlocks == nullptr || pGraph->pOrder == nullptr || pGraph->pPredecessors == nullptr || pGraph->blockCount == 0)
+    return false;
 
-    case ZYDIS_MNEMONIC_VZEROUPPER:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_zeroupper("));
-      break;
+  const size_t blockCount = pGraph->blockCount;
 
-    case ZYDIS_MNEMONIC_VP2INTERSECTD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_2intersect_epi32("));
-      break;
+  ZydecDominatorTree tree;
+  tree.pGraph = pGraph;
+  tree.pDominators = static_cast<uint32_t *>(malloc(blockCount * sizeof(uint32_t)));
 
-    case ZYDIS_MNEMONIC_VP2INTERSECTQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_2intersect_epi64("));
-      break;
+  uint32_t *pMarks = static_cast<uint32_t *>(calloc(blockCount, sizeof(uint32_t))); // index + 1 of the last loop a block was found to be a part of.
+  uint32_t *pBody = static_cast<uint32_t *>(malloc(blockCount * sizeof(uint32_t)));
+  uint32_t *pExits = static_cast<uint32_t *>(malloc(blockCount * 2 * sizeof(uint32_t)));
 
-    case ZYDIS_MNEMONIC_VP4DPWSSD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_4dpwssd_epi32("));
-      break;
+  if (tree.pDominators == nullptr || pMarks == nullptr || pBody == nullptr || pExits == nullptr)
+  {
+    free(tree.pDominators);
+    free(pMarks);
+    free(pBody);
+    free(pExits);
+    return false;
+  }
 
-    case ZYDIS_MNEMONIC_VP4DPWSSDS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_4dpwssds_epi32("));
-      break;
+  zydec_DominatorTree_Build(&tree);
 
-    case ZYDIS_MNEMONIC_V4FMADDPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_4fmadd_ps("));
-      break;
+  const bool hasStorage = (pForest->pLoops != nullptr && pForest->pLoopBlocks != nullptr && pForest->pExits != nullptr);
+  size_t loopCount = 0;
+  size_t loopBlockCount = 0;
+  size_t exitCount = 0;
 
-    case ZYDIS_MNEMONIC_V4FMADDSS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_4fmadd_ss("));
-      break;
+  for (uint32_t header = 0; header < blockCount; header++)
+  {
+    const ZydecBasicBlock *pHeader = &pGraph->pBlocks[header];
+    const uint32_t mark = (uint32_t)loopCount + 1;
+    size_t bodySize = 0;
 
-    case ZYDIS_MNEMONIC_V4FNMADDPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_4fnmadd_ps("));
-      break;
+    // Back-edges are the edges to a block that dominates the block they're coming from.
+    for (size_t i = 0; i < pHeader->predecessorCount; i++)
+    {
+      const uint32_t latch = pGraph->pPredecessors[pHeader->firstPredecessor + i];
 
-    case ZYDIS_MNEMONIC_V4FNMADDSS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_4fnmadd_ss("));
-      break;
+      if (!zydec_DominatorTree_Dominates(&tree, header, latch))
+        continue;
 
-    case ZYDIS_MNEMONIC_VPABSQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_abs_epi64("));
-      break;
+      if (bodySize == 0)
+      {
+        pMarks[header] = mark;
+        pBody[bodySize++] = header;
+      }
 
-    case ZYDIS_MNEMONIC_VADDPH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_add_ph("));
-      break;
+      if (pMarks[latch] != mark)
+      {
+        pMarks[latch] = mark;
+        pBody[bodySize++] = latch;
+      }
+    }
 
-    case ZYDIS_MNEMONIC_VADDSH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_add_sh("));
-      break;
+    if (bodySize == 0)
+      continue;
 
-    case ZYDIS_MNEMONIC_PADDUSW:
-    case ZYDIS_MNEMONIC_VPADDUSW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_adds_epu16("));
-      break;
+    // Everything (dominated by the header) that leads to a back-edge, stopping at the header.
+    for (size_t i = 1; i < bodySize; i++)
+    {
+      const ZydecBasicBlock *pBlock = &pGraph->pBlocks[pBody[i]];
 
-    case ZYDIS_MNEMONIC_PADDUSB:
-    case ZYDIS_MNEMONIC_VPADDUSB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_adds_epu8("));
-      break;
+      for (size_t j = 0; j < pBlock->predecessorCount; j++)
+      {
+        const uint32_t predecessor = pGraph->pPredecessors[pBlock->firstPredecessor + j];
 
-    case ZYDIS_MNEMONIC_VALIGND:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_alignr_epi32("));
-      break;
+        if (pMarks[predecessor] != mark && zydec_DominatorTree_Dominates(&tree, header, predecessor))
+        {
+          pMarks[predecessor] = mark;
+          pBody[bodySize++] = predecessor;
+        }
+      }
+    }
 
-    case ZYDIS_MNEMONIC_VALIGNQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_alignr_epi64("));
-      break;
+    qsort(pBody, bodySize, sizeof(uint32_t), zydec_LoopForest_CompareBlocks);
 
-    case ZYDIS_MNEMONIC_VPSHUFBITQMB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_bitshuffle_epi64_mask("));
-      break;
+    size_t loopExitCount = 0;
 
-    case ZYDIS_MNEMONIC_VPBLENDMB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mask_blend_epi8("));
-      break;
+    for (size_t i = 0; i < bodySize; i++)
+      for (size_t j = 0; j < 2; j++)
+        if (pGraph->pBlocks[pBody[i]].successors[j] != ZydecBasicBlockNone && pMarks[pGraph->pBlocks[pBody[i]].successors[j]] != mark)
+          pExits[loopExitCount++] = pGraph->pBlocks[pBody[i]].successors[j];
 
-    case ZYDIS_MNEMONIC_VPBLENDMW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mask_blend_epi16("));
-      break;
+    qsort(pExits, loopExitCount, sizeof(uint32_t), zydec_LoopForest_CompareBlocks);
 
-    case ZYDIS_MNEMONIC_VPBLENDMD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mask_blend_epi32("));
-      break;
+    size_t uniqueExitCount = 0;
 
-    case ZYDIS_MNEMONIC_VPBLENDMQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mask_blend_epi64("));
-      break;
+    for (size_t i = 0; i < loopExitCount; i++)
+      if (uniqueExitCount == 0 || pExits[uniqueExitCount - 1] != pExits[i])
+        pExits[uniqueExitCount++] = pExits[i];
 
-    case ZYDIS_MNEMONIC_VBLENDMPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mask_blend_ps("));
-      break;
+    if (hasStorage && loopCount < pForest->loopCapacity && loopBlockCount + bodySize <= pForest->loopBlockCapacity && exitCount + uniqueExitCount <= pForest->exitCapacity)
+    {
+      const ZydecBasicBlock *pLast = &pGraph->pBlocks[pBody[bodySize - 1]];
+
+      ZydecLoop *pLoop = &pForest->pLoops[loopCount];
+      pLoop->header = header;
+      pLoop->parent = ZydecBasicBlockNone;
+      pLoop->depth = 1;
+      pLoop->firstBlock = (uint32_t)loopBlockCount;
+      pLoop->blockCount = (uint32_t)bodySize;
+      pLoop->firstExit = (uint32_t)exitCount;
+      pLoop->exitCount = (uint32_t)uniqueExitCount;
+      pLoop->offset = pGraph->pBlocks[pBody[0]].offset;
+      pLoop->size = pLast->offset + pLast->size - pLoop->offset;
+
+      memcpy(pForest->pLoopBlocks + loopBlockCount, pBody, bodySize * sizeof(uint32_t));
+      memcpy(pForest->pExits + exitCount, pExits, uniqueExitCount * sizeof(uint32_t));
+    }
 
-    case ZYDIS_MNEMONIC_VBLENDMPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mask_blend_pd("));
-      break;
+    loopCount++;
+    loopBlockCount += bodySize;
+    exitCount += uniqueExitCount;
+  }
 
-    case ZYDIS_MNEMONIC_VPCMPB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cmp_epi8_mask("));
-      break;
+  free(tree.pDominators);
+  free(pMarks);
+  free(pBody);
+  free(pExits);
 
-    case ZYDIS_MNEMONIC_VPCMPW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cmp_epi16_mask("));
-      break;
+  pForest->loopCount = loopCount;
+  pForest->loopBlockCount = loopBlockCount;
+  pForest->exitCount = exitCount;
 
-    case ZYDIS_MNEMONIC_VPCMPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cmp_epi32_mask("));
-      break;
+  if (!hasStorage || loopCount > pForest->loopCapacity || loopBlockCount > pForest->loopBlockCapacity || exitCount > pForest->exitCapacity)
+    return false;
 
-    case ZYDIS_MNEMONIC_VPCMPQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cmp_epi64_mask("));
-      break;
+  // Nesting: a loop's parent is the smallest loop containing its header, which is the last one to claim it when going from the largest to the smallest loop.
+  for (size_t i = 0; i < blockCount; i++)
+    pForest->pInnermostLoops[i] = ZydecBasicBlockNone;
 
-    case ZYDIS_MNEMONIC_VPCMPUB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cmp_epu8_mask("));
-      break;
+  if (loopCount == 0)
+    return true;
 
-    case ZYDIS_MNEMONIC_VPCMPUW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cmp_epu16_mask("));
-      break;
+  uint64_t *pBySize = static_cast<uint64_t *>(malloc(loopCount * sizeof(uint64_t)));
 
-    case ZYDIS_MNEMONIC_VPCMPUD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cmp_epu32_mask("));
-      break;
+  if (pBySize == nullptr)
+    return false;
 
-    case ZYDIS_MNEMONIC_VPCMPUQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cmp_epu64_mask("));
-      break;
+  for (size_t i = 0; i < loopCount; i++)
+    pBySize[i] = ((uint64_t)pForest->pLoops[i].blockCount << 32) | (uint64_t)(UINT32_MAX - i);
 
-    case ZYDIS_MNEMONIC_VCMPPH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cmp_ph_mask("));
-      break;
+  qsort(pBySize, loopCount, sizeof(uint64_t), zydec_LoopForest_CompareLoopSizes);
 
-    case ZYDIS_MNEMONIC_VFCMULCPH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cmul_pch("));
-      break;
+  for (size_t i = 0; i < loopCount; i++)
+  {
+    const uint32_t loopIndex = UINT32_MAX - (uint32_t)pBySize[i];
+    ZydecLoop *pLoop = &pForest->pLoops[loopIndex];
 
-    case ZYDIS_MNEMONIC_VFCMULCSH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cmul_sch("));
-      break;
+    pLoop->parent = pForest->pInnermostLoops[pLoop->header];
+    pLoop->depth = (pLoop->parent == ZydecBasicBlockNone) ? 1 : pForest->pLoops[pLoop->parent].depth + 1;
 
-    case ZYDIS_MNEMONIC_VPCOMPRESSB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mask_compress_epi8("));
-      break;
+    for (size_t j = 0; j < pLoop->blockCount; j++)
+      pForest->pInnermostLoops[pForest->pLoopBlocks[pLoop->firstBlock + j]] = loopIndex;
+  }
 
-    case ZYDIS_MNEMONIC_VPCOMPRESSW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mask_compress_epi16("));
-      break;
+  free(pBySize);
 
-    case ZYDIS_MNEMONIC_VPCOMPRESSD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mask_compress_epi32("));
-      break;
+  return true;
+}
 
-    case ZYDIS_MNEMONIC_VPCOMPRESSQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mask_compress_epi64("));
-      break;
+bool zydec_LoopForest_ContainsBlock(const ZydecLoopForest *pForest, const size_t loopIndex, const size_t blockIndex)
+{
+  if (pForest == nullptr || pForest->pInnermostLoops == nullptr || loopIndex >= pForest->loopCount)
+    return false;
 
-    case ZYDIS_MNEMONIC_VCOMPRESSPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mask_compress_pd("));
-      break;
+  uint32_t loop = pForest->pInnermostLoops[blockIndex];
 
-    case ZYDIS_MNEMONIC_VCOMPRESSPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mask_compress_ps("));
-      break;
+  while (loop != ZydecBasicBlockNone && loop != loopIndex)
+    loop = pForest->pLoops[loop].parent;
 
-    case ZYDIS_MNEMONIC_VPCONFLICTD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_conflict_epi32("));
-      break;
+  return loop == loopIndex;
+}
 
-    case ZYDIS_MNEMONIC_VPCONFLICTQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_conflict_epi64("));
-      break;
+uint32_t zydec_LoopForest_FindHotLoop(const ZydecLoopForest *pForest)
+{
+  if (pForest == nullptr || pForest->pLoops == nullptr)
+    return ZydecBasicBlockNone;
 
-    case ZYDIS_MNEMONIC_VCVTW2PH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtepi16_ph("));
-      break;
+  uint32_t ret = ZydecBasicBlockNone;
 
-    case ZYDIS_MNEMONIC_VCVTDQ2PH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtepi32_ph("));
-      break;
+  for (size_t i = 0; i < pForest->loopCount; i++)
+  {
+    const ZydecLoop *pLoop = &pForest->pLoops[i];
 
-    case ZYDIS_MNEMONIC_VCVTQQ2PH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtepi64_ph("));
-      break;
+    if (ret == ZydecBasicBlockNone || pLoop->depth > pForest->pLoops[ret].depth || (pLoop->depth == pForest->pLoops[ret].depth && pLoop->size > pForest->pLoops[ret].size))
+      ret = (uint32_t)i;
+  }
 
-    case ZYDIS_MNEMONIC_VCVTPD2PH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtpd_ph("));
-      break;
+  return ret;
+}
 
-    case ZYDIS_MNEMONIC_VCVTUW2PH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtepu16_ph("));
-      break;
+bool zydec_LoopForest_PropagateLoopNames(const ZydecLoopForest *pForest, const size_t loopIndex, ZydecControlFlowGraph *pGraph, ZydecLinearSession *pSession, const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t codeSize, const size_t virtualAddress, const size_t maxPasses, size_t *pPassCount, bool *pReachedFixedPoint)
+{
+  if (pForest == nullptr || pForest->pLoops == nullptr || pForest->pLoopBlocks == nullptr || loopIndex >= pForest->loopCount || pGraph == nullptr || pGraph->blockCount == 0)
+    return false;
 
-    case ZYDIS_MNEMONIC_VCVTUDQ2PH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtepu32_ph("));
-      break;
+  bool *pMembers = static_cast<bool *>(calloc(pGraph->blockCount, sizeof(bool)));
 
-    case ZYDIS_MNEMONIC_VCVTUQQ2PH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtepu64_ph("));
-      break;
+  if (pMembers == nullptr)
+    return false;
 
-    case ZYDIS_MNEMONIC_VCVTQQ2PS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtepi64_ps("));
-      break;
+  const ZydecLoop *pLoop = &pForest->pLoops[loopIndex];
 
-    case ZYDIS_MNEMONIC_VCVTQQ2PD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtepi64_pd("));
-      break;
+  for (size_t i = 0; i < pLoop->blockCount; i++)
+    pMembers[pForest->pLoopBlocks[pLoop->firstBlock + i]] = true;
 
-    case ZYDIS_MNEMONIC_VCVTPH2PD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtph_pd("));
-      break;
+  // Only the edges within the loop are considered, so the header only gets names from the back-edges once the first pass is done.
+  const bool result = zydec_ControlFlowGraph_Propagate(pGraph, pMembers, pSession, pDecoder, pCode, codeSize, virtualAddress, maxPasses, pPassCount, pReachedFixedPoint);
 
-    case ZYDIS_MNEMONIC_VCVTPH2W:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtph_epi16("));
-      break;
+  free(pMembers);
 
-    case ZYDIS_MNEMONIC_VCVTPH2DQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtph_epi32("));
-      break;
+  return result;
+}
 
-    case ZYDIS_MNEMONIC_VCVTPH2QQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtph_epi64("));
-      break;
+////////////////////////////////////////////////////////////////////////////////
 
-    case ZYDIS_MNEMONIC_VCVTPH2UW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtph_epu16("));
-      break;
+static constexpr uint32_t ZydecDefUseJoinBit = (uint32_t)1 << 31; // marks the join of block `value & ~ZydecDefUseJoinBit` in the state of a location while the joins are being found.
+static constexpr uint32_t ZydecDefUseUnset = ZydecValueNone - 1; // marks locations that no predecessor has been merged into yet.
+static constexpr uint32_t ZydecDefUseSlotBit = (uint32_t)1 << 31; // marks raw stack slot indices before the slots are deduplicated.
+static constexpr size_t ZydecDefUseMaxPasses = 64;
+static constexpr size_t ZydecDefUseMaxInstructionEffects = 64;
 
-    case ZYDIS_MNEMONIC_VCVTPH2UDQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtph_epu32("));
-      break;
+// The effects of an instruction that don't depend on the values flowing into it.
+struct ZydecDefUseEffects
+{
+  uint32_t offset;
+  uint32_t block;
+  uint32_t firstEffect; // index into `ZydecDefUseBuilder::pEffects`: `readCount` locations, followed by `definitionCount` values.
+  uint16_t readCount;
+  uint16_t definitionCount;
+  uint16_t mnemonic;
+  uint8_t length;
+  bool isCall;
+};
 
-    case ZYDIS_MNEMONIC_VCVTPH2UQQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtph_epu64("));
-      break;
+struct ZydecDefUseBuilder
+{
+  ZydecDefUseEffects *pInstructions = nullptr;
+  size_t instructionCount = 0;
+  size_t instructionCapacity = 0;
 
-    case ZYDIS_MNEMONIC_VCVTPD2QQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtpd_epi64("));
-      break;
+  uint32_t *pEffects = nullptr;
+  size_t effectCount = 0;
+  size_t effectCapacity = 0;
 
-    case ZYDIS_MNEMONIC_VCVTPS2QQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtps_epi64("));
-      break;
+  ZydecValue *pValues = nullptr;
+  size_t valueCount = 0;
+  size_t valueCapacity = 0;
 
-    case ZYDIS_MNEMONIC_VCVTUDQ2PS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtepu32_ps("));
-      break;
+  uint32_t *pReferences = nullptr;
+  size_t referenceCount = 0;
+  size_t referenceCapacity = 0;
 
-    case ZYDIS_MNEMONIC_VCVTUQQ2PS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtepu64_ps("));
-      break;
+  ZydecDefUseInstruction *pOutput = nullptr;
+  size_t outputCount = 0;
+  size_t outputCapacity = 0;
 
-    case ZYDIS_MNEMONIC_VCVTPS2UDQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtps_epu32("));
-      break;
+  ZydecStackSlot *pSlots = nullptr;
+  size_t slotCount = 0;
+  size_t slotCapacity = 0;
+};
 
-    case ZYDIS_MNEMONIC_VCVTPS2UQQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtps_epu64("));
-      break;
+template <typename T>
+inline bool zydec_DefUse_Append(T **ppItems, size_t *pCount, size_t *pCapacity, const T &item)
+{
+  if (*pCount == *pCapacity)
+  {
+    const size_t newCapacity = *pCapacity * 2 + 64;
+    T *pNewItems = static_cast<T *>(realloc(*ppItems, newCapacity * sizeof(T)));
 
-    case ZYDIS_MNEMONIC_VCVTUDQ2PD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtepu32_pd("));
-      break;
+    if (pNewItems == nullptr)
+      return false;
 
-    case ZYDIS_MNEMONIC_VCVTUQQ2PD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtepu64_pd("));
-      break;
+    *ppItems = pNewItems;
+    *pCapacity = newCapacity;
+  }
 
-    case ZYDIS_MNEMONIC_VCVTPD2UDQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtpd_epu32("));
-      break;
+  (*ppItems)[(*pCount)++] = item;
 
-    case ZYDIS_MNEMONIC_VCVTPD2UQQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtpd_epu64("));
-      break;
+  return true;
+}
 
-    case ZYDIS_MNEMONIC_VCVTSI2SH:
-      if (pInstruction->operand_count > 2 && pOperands[2].element_size == 4)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvti32_sh("));
-      else if (pInstruction->operand_count > 2 && pOperands[2].element_size == 8)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvti64_sh("));
-      else
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvti_sh("));
-      break;
+void zydec_DefUseBuilder_Destroy(ZydecDefUseBuilder *pBuilder)
+{
+  free(pBuilder->pInstructions);
+  free(pBuilder->pEffects);
+  free(pBuilder->pValues);
+  free(pBuilder->pReferences);
+  free(pBuilder->pOutput);
+  free(pBuilder->pSlots);
+}
 
-    case ZYDIS_MNEMONIC_VCVTUSI2SH:
-      if (pInstruction->operand_count > 2 && pOperands[2].element_size == 4)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtu32_sh("));
-      else if (pInstruction->operand_count > 2 && pOperands[2].element_size == 8)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtu64_sh("));
-      else
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtu_sh("));
-      break;
+// xmm, ymm & zmm registers share the location of the xmm register.
+inline uint32_t zydec_DefUse_RegisterLocation(const ZydisRegister reg)
+{
+  const size_t index = zydec_LinearContext_GetRegisterIndex(zydec_ResolveBaseRegister(reg));
 
-    case ZYDIS_MNEMONIC_VCVTSS2SH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtss_sh("));
-      break;
+  if (index >= zlcri_ymm && index < zlcri_mask)
+    return (uint32_t)(zlcri_xmm + (index - zlcri_xmm) % 32);
 
-    case ZYDIS_MNEMONIC_VCVTSD2SH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtsd_sh("));
-      break;
+  return (uint32_t)index;
+}
 
-    case ZYDIS_MNEMONIC_VCVTSH2SI:
-      if (pInstruction->operand_count > 0 && pOperands[0].element_size == 4)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtsh_i32("));
-      else if (pInstruction->operand_count > 0 && pOperands[0].element_size == 8)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtsh_i64("));
-      else
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtsh_i("));
-      break;
+inline ZydisRegister zydec_DefUse_LocationRegister(const uint32_t location, const ZydecStackSlot *pSlots)
+{
+  if (location >= ZydecLinearContextRegisterCount)
+    return (ZydisRegister)pSlots[location - ZydecLinearContextRegisterCount].base;
+  else if (location >= zlcri_x87)
+    return (ZydisRegister)(ZYDIS_REGISTER_ST0 + location - zlcri_x87);
+  else if (location >= zlcri_mmx)
+    return (ZydisRegister)(ZYDIS_REGISTER_MM0 + location - zlcri_mmx);
+  else if (location >= zlcri_mask)
+    return (ZydisRegister)(ZYDIS_REGISTER_K0 + location - zlcri_mask);
+  else if (location >= zlcri_xmm)
+    return (ZydisRegister)(ZYDIS_REGISTER_XMM0 + location - zlcri_xmm);
+  else if (location == zlcri_flags)
+    return ZYDIS_REGISTER_RFLAGS;
+  else
+    return (ZydisRegister)(ZYDIS_REGISTER_RAX + location - zlcri_gpr);
+}
 
-    case ZYDIS_MNEMONIC_VCVTSH2USI:
-      if (pInstruction->operand_count > 0 && pOperands[0].element_size == 4)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtsh_u32("));
-      else if (pInstruction->operand_count > 0 && pOperands[0].element_size == 8)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtsh_u64("));
-      else
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtsh_u("));
-      break;
+inline void zydec_DefUse_AddLocation(uint32_t *pLocations, uint16_t *pCount, const uint32_t location)
+{
+  for (size_t i = 0; i < *pCount; i++)
+    if (pLocations[i] == location)
+      return;
 
-    case ZYDIS_MNEMONIC_VCVTSH2SS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtsh_ss("));
-      break;
+  if (*pCount < ZydecDefUseMaxInstructionEffects)
+    pLocations[(*pCount)++] = location;
+}
 
-    case ZYDIS_MNEMONIC_VCVTSH2SD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtsh_sd("));
-      break;
+// `xor eax, eax` & co. don't depend on the previous value of the register.
+inline bool zydec_DefUse_IsZeroIdiom(const ZydisDecodedInstruction *pInstruction, const ZydisDecodedOperand *pOperands)
+{
+  switch (pInstruction->mnemonic)
+  {
+  case ZYDIS_MNEMONIC_XOR:
+  case ZYDIS_MNEMONIC_SUB:
+  case ZYDIS_MNEMONIC_PXOR:
+  case ZYDIS_MNEMONIC_XORPS:
+  case ZYDIS_MNEMONIC_XORPD:
+  case ZYDIS_MNEMONIC_VPXOR:
+  case ZYDIS_MNEMONIC_VPXORD:
+  case ZYDIS_MNEMONIC_VPXORQ:
+  case ZYDIS_MNEMONIC_VXORPS:
+  case ZYDIS_MNEMONIC_VXORPD:
+    break;
 
-    case ZYDIS_MNEMONIC_VPMOVQB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtepi64_epi8("));
-      break;
+  default:
+    return false;
+  }
 
-    case ZYDIS_MNEMONIC_VPMOVDB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtepi32_epi8("));
-      break;
+  const size_t count = pInstruction->operand_count_visible;
 
-    case ZYDIS_MNEMONIC_VPMOVWB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtepi16_epi8("));
-      break;
+  return count >= 2 && pOperands[count - 1].type == ZYDIS_OPERAND_TYPE_REGISTER && pOperands[count - 2].type == ZYDIS_OPERAND_TYPE_REGISTER && pOperands[count - 1].reg.value == pOperands[count - 2].reg.value;
+}
 
-    case ZYDIS_MNEMONIC_VPMOVQW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtepi64_epi16("));
-      break;
+// Records the locations the instruction reads & creates a value for every location it defines.
+bool zydec_DefUseBuilder_AddInstruction(ZydecDefUseBuilder *pBuilder, const ZydecDefUseGraph *pGraph, const ZydisDecodedInstruction *pInstruction, const ZydisDecodedOperand *pOperands, const uint32_t offset, const uint32_t block)
+{
+  uint32_t reads[ZydecDefUseMaxInstructionEffects];
+  uint32_t definitions[ZydecDefUseMaxInstructionEffects];
+  ZydisRegister definitionRegisters[ZydecDefUseMaxInstructionEffects];
+  uint16_t readCount = 0;
+  uint16_t definitionCount = 0;
 
-    case ZYDIS_MNEMONIC_VPMOVDW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtepi32_epi16("));
-      break;
+  const bool isZeroIdiom = zydec_DefUse_IsZeroIdiom(pInstruction, pOperands);
+  const bool mergesDestination = (pInstruction->avx.mask.mode == ZYDIS_MASK_MODE_MERGING && pInstruction->avx.mask.reg != ZYDIS_REGISTER_NONE && pInstruction->avx.mask.reg != ZYDIS_REGISTER_K0);
 
-    case ZYDIS_MNEMONIC_VPMOVQD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtepi64_epi32("));
-      break;
+  for (size_t i = 0; i < pInstruction->operand_count; i++)
+  {
+    const ZydisDecodedOperand *pOperand = &pOperands[i];
+    const bool isRead = (pOperand->actions & ZYDIS_OPERAND_ACTION_MASK_READ) != 0;
+    const bool isWrite = (pOperand->actions & ZYDIS_OPERAND_ACTION_MASK_WRITE) != 0;
 
-    case ZYDIS_MNEMONIC_VCVTNE2PS2BF16:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtne2ps_pbh("));
-      break;
+    if (pOperand->type == ZYDIS_OPERAND_TYPE_REGISTER)
+    {
+      const uint32_t location = zydec_DefUse_RegisterLocation(pOperand->reg.value);
 
-    case ZYDIS_MNEMONIC_VCVTSD2USI:
-      if (pInstruction->operand_count > 0 && pOperands[0].element_size == 4)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtsd_u32("));
-      else if (pInstruction->operand_count > 0 && pOperands[0].element_size == 8)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtsd_u64("));
-      else
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtsd_u("));
-      break;
+      if (location == ZydecLinearContextRegisterCount)
+        continue;
 
-    case ZYDIS_MNEMONIC_VCVTSS2USI:
-      if (pInstruction->operand_count > 0 && pOperands[0].element_size == 4)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtss_u32("));
-      else if (pInstruction->operand_count > 0 && pOperands[0].element_size == 8)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtss_u64("));
-      else
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtss_u("));
-      break;
+      const bool isPartialWrite = isWrite && ((location < zlcri_flags && pOperand->size < 32) || (pOperand->actions & ZYDIS_OPERAND_ACTION_CONDWRITE) != 0 || (i == 0 && mergesDestination));
 
-    case ZYDIS_MNEMONIC_VCVTUSI2SD:
-      if (pInstruction->operand_count > 2 && pOperands[2].element_size == 4)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtu32_sd("));
-      else if (pInstruction->operand_count > 2 && pOperands[2].element_size == 8)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtu64_sd("));
-      else
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtu_sd("));
-      break;
+      if ((isRead && !(isZeroIdiom && pOperand->visibility == ZYDIS_OPERAND_VISIBILITY_EXPLICIT)) || isPartialWrite)
+        zydec_DefUse_AddLocation(reads, &readCount, location);
 
-    case ZYDIS_MNEMONIC_VCVTUSI2SS:
-      if (pInstruction->operand_count > 2 && pOperands[2].element_size == 4)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtu32_ss("));
-      else if (pInstruction->operand_count > 2 && pOperands[2].element_size == 8)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtu64_ss("));
-      else
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtu_ss("));
-      break;
+      if (isWrite)
+      {
+        const uint16_t previousCount = definitionCount;
+        zydec_DefUse_AddLocation(definitions, &definitionCount, location);
 
-    case ZYDIS_MNEMONIC_VPMOVSWB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtsepi16_epi8("));
-      break;
+        if (definitionCount != previousCount)
+          definitionRegisters[previousCount] = zydec_ResolveBaseRegister(pOperand->reg.value);
+      }
+    }
+    else if (pOperand->type == ZYDIS_OPERAND_TYPE_MEMORY)
+    {
+      const uint32_t baseLocation = zydec_DefUse_RegisterLocation(pOperand->mem.base);
+      const uint32_t indexLocation = zydec_DefUse_RegisterLocation(pOperand->mem.index);
 
-    case ZYDIS_MNEMONIC_VPMOVSDB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtsepi32_epi8("));
-      break;
+      if (baseLocation != ZydecLinearContextRegisterCount)
+        zydec_DefUse_AddLocation(reads, &readCount, baseLocation);
 
-    case ZYDIS_MNEMONIC_VPMOVSQB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtsepi64_epi8("));
-      break;
+      if (indexLocation != ZydecLinearContextRegisterCount)
+        zydec_DefUse_AddLocation(reads, &readCount, indexLocation);
 
-    case ZYDIS_MNEMONIC_VPMOVSDW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtsepi32_epi16("));
-      break;
+      const bool isStackSlot = (pGraph->memoryTracking == ZydecDefUseGraph::MemoryTracking::StackSlots && pOperand->mem.type == ZYDIS_MEMOP_TYPE_MEM && pOperand->visibility == ZYDIS_OPERAND_VISIBILITY_EXPLICIT && (pOperand->mem.base == ZYDIS_REGISTER_RSP || pOperand->mem.base == ZYDIS_REGISTER_RBP) && pOperand->mem.index == ZYDIS_REGISTER_NONE && pOperand->mem.segment != ZYDIS_REGISTER_FS && pOperand->mem.segment != ZYDIS_REGISTER_GS);
 
-    case ZYDIS_MNEMONIC_VPMOVSQW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtsepi64_epi16("));
-      break;
+      if (!isStackSlot || (!isRead && !isWrite))
+        continue;
 
-    case ZYDIS_MNEMONIC_VPMOVSQD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtsepi64_epi32("));
-      break;
-      
-    case ZYDIS_MNEMONIC_VCVTTSD2SI:
-      if (pInstruction->operand_count > 0 && pOperands[0].element_size == 4)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttsd_i32("));
-      else if (pInstruction->operand_count > 0 && pOperands[0].element_size == 8)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttsd_i64("));
-      else
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttsd_si("));
-      break;
+      ZydecStackSlot slot;
+      slot.base = (uint16_t)pOperand->mem.base;
+      slot.size = (uint16_t)(pOperand->size / 8);
+      slot.displacement = (int32_t)pOperand->mem.disp.value;
 
-    case ZYDIS_MNEMONIC_VCVTTSD2USI:
-      if (pInstruction->operand_count > 0 && pOperands[0].element_size == 4)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttsd_u32("));
-      else if (pInstruction->operand_count > 0 && pOperands[0].element_size == 8)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttsd_u64("));
-      else
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttsd_u("));
-      break;
+      const uint32_t location = ZydecDefUseSlotBit | (uint32_t)pBuilder->slotCount;
+      ERROR_CHECK(zydec_DefUse_Append(&pBuilder->pSlots, &pBuilder->slotCount, &pBuilder->slotCapacity, slot));
 
-    case ZYDIS_MNEMONIC_CVTTSS2SI:
-    case ZYDIS_MNEMONIC_VCVTTSS2SI:
-      if (pInstruction->operand_count > 0 && pOperands[0].element_size == 4)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttss_si32("));
-      else if (pInstruction->operand_count > 0 && pOperands[0].element_size == 8)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttss_si64("));
-      else
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttss_si("));
-      break;
+      if (isRead)
+        zydec_DefUse_AddLocation(reads, &readCount, location);
 
-    case ZYDIS_MNEMONIC_VCVTTSS2USI:
-      if (pInstruction->operand_count > 0 && pOperands[0].element_size == 4)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttss_u32("));
-      else if (pInstruction->operand_count > 0 && pOperands[0].element_size == 8)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttss_u64("));
-      else
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttss_u("));
-      break;
+      if (isWrite)
+      {
+        const uint16_t previousCount = definitionCount;
+        zydec_DefUse_AddLocation(definitions, &definitionCount, location);
 
-    case ZYDIS_MNEMONIC_VCVTTSH2SI:
-      if (pInstruction->operand_count > 0 && pOperands[0].element_size == 4)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttsh_si32("));
-      else if (pInstruction->operand_count > 0 && pOperands[0].element_size == 8)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttsh_si64("));
-      else
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttsh_si("));
-      break;
+        if (definitionCount != previousCount)
+          definitionRegisters[previousCount] = pOperand->mem.base;
+      }
+    }
+  }
 
-    case ZYDIS_MNEMONIC_VCVTTSH2USI:
-      if (pInstruction->operand_count > 0 && pOperands[0].element_size == 4)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttsh_u32("));
-      else if (pInstruction->operand_count > 0 && pOperands[0].element_size == 8)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttsh_u64("));
-      else
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttsh_u("));
-      break;
+  ZydecDefUseEffects effects;
+  effects.offset = offset;
+  effects.block = block;
+  effects.firstEffect = (uint32_t)pBuilder->effectCount;
+  effects.readCount = readCount;
+  effects.definitionCount = definitionCount;
+  effects.mnemonic = (uint16_t)pInstruction->mnemonic;
+  effects.length = pInstruction->length;
+  effects.isCall = (pInstruction->meta.category == ZYDIS_CATEGORY_CALL);
 
-    case ZYDIS_MNEMONIC_VCVTTPH2QQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttph_epi64("));
-      break;
+  for (size_t i = 0; i < readCount; i++)
+    ERROR_CHECK(zydec_DefUse_Append(&pBuilder->pEffects, &pBuilder->effectCount, &pBuilder->effectCapacity, reads[i]));
 
-    case ZYDIS_MNEMONIC_VCVTTPS2QQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttps_epi64("));
-      break;
+  for (size_t i = 0; i < definitionCount; i++)
+  {
+    ZydecValue value;
+    value.instruction = (uint32_t)pBuilder->instructionCount;
+    value.location = definitions[i];
+    value.reg = (uint16_t)definitionRegisters[i];
+    value.kind = zvk_definition;
+    value.name = 0;
+    value.firstInput = 0;
+    value.inputCount = 0;
+    value.firstUse = 0;
+    value.useCount = 0;
+
+    ERROR_CHECK(zydec_DefUse_Append(&pBuilder->pEffects, &pBuilder->effectCount, &pBuilder->effectCapacity, (uint32_t)pBuilder->valueCount));
+    ERROR_CHECK(zydec_DefUse_Append(&pBuilder->pValues, &pBuilder->valueCount, &pBuilder->valueCapacity, value));
+  }
 
-    case ZYDIS_MNEMONIC_VCVTTPD2QQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttpd_epi64("));
-      break;
+  return zydec_DefUse_Append(&pBuilder->pInstructions, &pBuilder->instructionCount, &pBuilder->instructionCapacity, effects);
+}
 
-    case ZYDIS_MNEMONIC_VCVTTPH2DQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttph_epi32("));
-      break;
+static int zydec_DefUse_CompareSlots(const void *pA, const void *pB)
+{
+  const ZydecStackSlot *pSlotA = static_cast<const ZydecStackSlot *>(pA);
+  const ZydecStackSlot *pSlotB = static_cast<const ZydecStackSlot *>(pB);
 
-    case ZYDIS_MNEMONIC_VCVTTPH2W:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttph_epi16("));
-      break;
+  if (pSlotA->base != pSlotB->base)
+    return pSlotA->base < pSlotB->base ? -1 : 1;
 
-    case ZYDIS_MNEMONIC_VCVTTPH2UQQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttph_epu64("));
-      break;
+  if (pSlotA->displacement != pSlotB->displacement)
+    return pSlotA->displacement < pSlotB->displacement ? -1 : 1;
 
-    case ZYDIS_MNEMONIC_VCVTTPS2UQQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttps_epu64("));
-      break;
+  if (pSlotA->size != pSlotB->size)
+    return pSlotA->size < pSlotB->size ? -1 : 1;
 
-    case ZYDIS_MNEMONIC_VCVTTPD2UQQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttpd_epu64("));
-      break;
+  return 0;
+}
 
-    case ZYDIS_MNEMONIC_VCVTTPD2UDQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttpd_epu64("));
-      break;
+// Deduplicates the stack slots & replaces the raw slot indices with their locations.
+bool zydec_DefUseBuilder_ResolveSlots(ZydecDefUseBuilder *pBuilder)
+{
+  if (pBuilder->slotCount == 0)
+    return true;
 
-    case ZYDIS_MNEMONIC_VCVTTPS2UDQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttps_epu64("));
-      break;
+  ZydecStackSlot *pSorted = static_cast<ZydecStackSlot *>(malloc(pBuilder->slotCount * sizeof(ZydecStackSlot)));
+  uint32_t *pLocations = static_cast<uint32_t *>(malloc(pBuilder->slotCount * sizeof(uint32_t)));
 
-    case ZYDIS_MNEMONIC_VCVTTPH2UDQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttph_epu32("));
-      break;
+  if (pSorted == nullptr || pLocations == nullptr)
+  {
+    free(pSorted);
+    free(pLocations);
+    return false;
+  }
 
-    case ZYDIS_MNEMONIC_VCVTTPH2UW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvttph_epu16("));
-      break;
+  memcpy(pSorted, pBuilder->pSlots, pBuilder->slotCount * sizeof(ZydecStackSlot));
+  qsort(pSorted, pBuilder->slotCount, sizeof(ZydecStackSlot), zydec_DefUse_CompareSlots);
 
-    case ZYDIS_MNEMONIC_VPMOVUSWB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtusepi16_epi8("));
-      break;
+  size_t uniqueCount = 0;
 
-    case ZYDIS_MNEMONIC_VPMOVUSDB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtusepi32_epi8("));
-      break;
+  for (size_t i = 0; i < pBuilder->slotCount; i++)
+    if (uniqueCount == 0 || zydec_DefUse_CompareSlots(&pSorted[uniqueCount - 1], &pSorted[i]) != 0)
+      pSorted[uniqueCount++] = pSorted[i];
 
-    case ZYDIS_MNEMONIC_VPMOVUSQB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtusepi64_epi8("));
-      break;
+  for (size_t i = 0; i < pBuilder->slotCount; i++)
+  {
+    const ZydecStackSlot *pFound = static_cast<const ZydecStackSlot *>(bsearch(&pBuilder->pSlots[i], pSorted, uniqueCount, sizeof(ZydecStackSlot), zydec_DefUse_CompareSlots));
+    pLocations[i] = (uint32_t)(ZydecLinearContextRegisterCount + (pFound - pSorted));
+  }
 
-    case ZYDIS_MNEMONIC_VPMOVUSDW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtusepi32_epi16("));
-      break;
+  for (size_t i = 0; i < pBuilder->instructionCount; i++)
+  {
+    const ZydecDefUseEffects *pEffects = &pBuilder->pInstructions[i];
 
-    case ZYDIS_MNEMONIC_VPMOVUSQW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtusepi64_epi16("));
-      break;
+    for (size_t j = 0; j < pEffects->readCount; j++)
+    {
+      uint32_t *pLocation = &pBuilder->pEffects[pEffects->firstEffect + j];
 
-    case ZYDIS_MNEMONIC_VPMOVUSQD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtusepi64_epi32("));
-      break;
+      if ((*pLocation & ZydecDefUseSlotBit) != 0)
+        *pLocation = pLocations[*pLocation & ~ZydecDefUseSlotBit];
+    }
+  }
 
-    case ZYDIS_MNEMONIC_VCVTPH2PSX:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtxph_ps("));
-      break;
+  for (size_t i = 0; i < pBuilder->valueCount; i++)
+    if ((pBuilder->pValues[i].location & ZydecDefUseSlotBit) != 0)
+      pBuilder->pValues[i].location = pLocations[pBuilder->pValues[i].location & ~ZydecDefUseSlotBit];
 
-    case ZYDIS_MNEMONIC_VCVTPS2PHX:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cvtxps_ph("));
-      break;
+  free(pBuilder->pSlots);
+  free(pLocations);
 
-    case ZYDIS_MNEMONIC_VDBPSADBW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_dbsad_epu8("));
-      break;
+  pBuilder->pSlots = pSorted;
+  pBuilder->slotCount = uniqueCount;
+  pBuilder->slotCapacity = pBuilder->slotCount;
 
-    case ZYDIS_MNEMONIC_VDIVPH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_div_ph("));
-      break;
+  return true;
+}
 
-    case ZYDIS_MNEMONIC_VDIVSH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_div_sh("));
-      break;
+struct ZydecDefUseFlow
+{
+  const ZydecControlFlowGraph *pControlFlow;
+  const ZydecDefUseBuilder *pBuilder;
+  size_t locationCount;
+  uint32_t *pBlockInstructions; // index of the first instruction of every block, followed by the instruction count.
+  uint32_t *pEntries; // `locationCount` values per block, at its start.
+  uint32_t *pExits;
+  bool *pHasExit;
+  uint32_t *pMerged; // `locationCount` values of scratch.
+  uint32_t *pQueue; // blocks to visit, as a ring of `blockCount` blocks.
+  bool *pQueued;
+  const uint64_t *pRetained; // registers that calls don't clobber.
+  size_t slotRanges[2][2]; // first & end of the `rsp` & `rbp` slots.
+};
 
-    case ZYDIS_MNEMONIC_VDPBF16PS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_dpbf16_ps("));
-      break;
+inline void zydec_DefUseFlow_ApplyInstruction(const ZydecDefUseFlow *pFlow, const ZydecDefUseEffects *pEffects, uint32_t *pState)
+{
+  const ZydecDefUseBuilder *pBuilder = pFlow->pBuilder;
 
-    case ZYDIS_MNEMONIC_VEXP2PD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_exp2a23_pd("));
-      break;
+  for (size_t i = 0; i < pEffects->definitionCount; i++)
+  {
+    const uint32_t value = pBuilder->pEffects[pEffects->firstEffect + pEffects->readCount + i];
+    const uint32_t location = pBuilder->pValues[value].location;
 
-    case ZYDIS_MNEMONIC_VEXP2PS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_exp2a23_ps("));
-      break;
+    pState[location] = value;
 
-    case ZYDIS_MNEMONIC_VPEXPANDB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mask_expand_epi8("));
-      break;
+    if (!pEffects->isCall && (location == zlcri_gpr + ZYDIS_REGISTER_RSP - ZYDIS_REGISTER_RAX || location == zlcri_gpr + ZYDIS_REGISTER_RBP - ZYDIS_REGISTER_RAX))
+    {
+      const size_t *pRange = pFlow->slotRanges[location == zlcri_gpr + ZYDIS_REGISTER_RSP - ZYDIS_REGISTER_RAX ? 0 : 1];
 
-    case ZYDIS_MNEMONIC_VPEXPANDW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mask_expand_epi16("));
-      break;
+      for (size_t j = pRange[0]; j < pRange[1]; j++)
+        pState[ZydecLinearContextRegisterCount + j] = ZydecValueNone;
+    }
+  }
 
-    case ZYDIS_MNEMONIC_VPEXPANDD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mask_expand_epi32("));
-      break;
+  if (pEffects->isCall)
+    for (size_t i = 0; i < ZydecLinearContextRegisterCount; i++)
+      if (((pFlow->pRetained[i / 64] >> (i & 63)) & 1) == 0)
+        pState[i] = ZydecValueNone;
+}
 
-    case ZYDIS_MNEMONIC_VPEXPANDQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mask_expand_epi64("));
-      break;
-      
-    case ZYDIS_MNEMONIC_VEXPANDPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mask_expand_ps("));
-      break;
+// Entry values of the block: what all predecessors agree on, or the join of the block. The entry & blocks without predecessors start with unknown values.
+inline bool zydec_DefUseFlow_Merge(const ZydecDefUseFlow *pFlow, const uint32_t blockIndex, uint32_t *pEntry)
+{
+  const ZydecControlFlowGraph *pControlFlow = pFlow->pControlFlow;
+  const ZydecBasicBlock *pBlock = &pControlFlow->pBlocks[blockIndex];
+  const size_t locationCount = pFlow->locationCount;
+  const uint32_t join = ZydecDefUseJoinBit | blockIndex;
+  uint32_t *pMerged = pFlow->pMerged;
 
-    case ZYDIS_MNEMONIC_VEXPANDPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mask_expand_pd("));
-      break;
+  for (size_t location = 0; location < locationCount; location++)
+    pMerged[location] = (blockIndex == 0 || pBlock->predecessorCount == 0) ? ZydecValueNone : ZydecDefUseUnset;
 
-    case ZYDIS_MNEMONIC_VEXTRACTF32X4:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_extractf32x4_ps("));
-      break;
+  for (size_t i = 0; i < pBlock->predecessorCount; i++)
+  {
+    const uint32_t predecessor = pControlFlow->pPredecessors[pBlock->firstPredecessor + i];
 
-    case ZYDIS_MNEMONIC_VEXTRACTF32X8:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_extractf32x8_ps("));
-      break;
+    if (!pFlow->pHasExit[predecessor])
+      continue;
 
-    case ZYDIS_MNEMONIC_VEXTRACTF64X2:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_extractf64x2_pd("));
-      break;
+    const uint32_t *pExit = pFlow->pExits + predecessor * locationCount;
 
-    case ZYDIS_MNEMONIC_VEXTRACTF64X4:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_extractf64x4_pd("));
-      break;
+    for (size_t location = 0; location < locationCount; location++)
+    {
+      const uint32_t incoming = pExit[location];
 
-    case ZYDIS_MNEMONIC_VEXTRACTI32X4:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_extracti32x4_epi32("));
-      break;
+      // A join flowing back into its own block doesn't disagree with anything.
+      if (incoming == join)
+        continue;
 
-    case ZYDIS_MNEMONIC_VEXTRACTI32X8:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_extracti32x8_epi32("));
-      break;
+      if (pMerged[location] == ZydecDefUseUnset)
+        pMerged[location] = incoming;
+      else if (pMerged[location] != incoming)
+        pMerged[location] = join;
+    }
+  }
 
-    case ZYDIS_MNEMONIC_VEXTRACTI64X2:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_extracti64x2_epi64("));
-      break;
+  // Joins are kept once they exist, as the joins of nested loops passing values through each other would otherwise keep replacing each other.
+  for (size_t location = 0; location < locationCount; location++)
+    if (pMerged[location] == ZydecDefUseUnset)
+      pMerged[location] = ZydecValueNone;
+    else if (pEntry[location] == join)
+      pMerged[location] = join;
 
-    case ZYDIS_MNEMONIC_VEXTRACTI64X4:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_extracti64x4_epi64("));
-      break;
+  if (memcmp(pEntry, pMerged, locationCount * sizeof(uint32_t)) == 0)
+    return false;
 
-    case ZYDIS_MNEMONIC_VFCMADDCPH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fcmadd_pch("));
-      break;
+  memcpy(pEntry, pMerged, locationCount * sizeof(uint32_t));
 
-    case ZYDIS_MNEMONIC_VFCMADDCSH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fcmadd_sch("));
-      break;
+  return true;
+}
 
-    case ZYDIS_MNEMONIC_VFIXUPIMMPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fixupimm_pd("));
-      break;
+// Revisits the blocks whose predecessors changed what they leave behind, until nothing changes anymore. Returns `false` if the flow didn't settle.
+bool zydec_DefUseFlow_Run(ZydecDefUseFlow *pFlow)
+{
+  const ZydecControlFlowGraph *pControlFlow = pFlow->pControlFlow;
+  const size_t blockCount = pControlFlow->blockCount;
+  const size_t locationCount = pFlow->locationCount;
 
-    case ZYDIS_MNEMONIC_VFIXUPIMMPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fixupimm_ps("));
-      break;
+  for (size_t i = 0; i < blockCount * locationCount; i++)
+    pFlow->pEntries[i] = ZydecValueNone;
 
-    case ZYDIS_MNEMONIC_VFIXUPIMMSD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fixupimm_sd("));
-      break;
+  // Starting in reverse post-order, so most blocks only have to be visited once if there are no loops.
+  for (size_t i = 0; i < blockCount; i++)
+  {
+    pFlow->pQueue[i] = pControlFlow->pOrder[i];
+    pFlow->pQueued[pControlFlow->pOrder[i]] = true;
+  }
 
-    case ZYDIS_MNEMONIC_VFIXUPIMMSS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fixupimm_ss("));
-      break;
+  size_t queueBegin = 0;
+  size_t queuedCount = blockCount;
+  size_t remainingVisits = ZydecDefUseMaxPasses * blockCount;
 
-    case ZYDIS_MNEMONIC_VFMADDCPH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fmadd_pch("));
-      break;
+  while (queuedCount > 0)
+  {
+    if (remainingVisits-- == 0)
+      return false;
 
-    case ZYDIS_MNEMONIC_VFMADDCSH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fmadd_sch("));
-      break;
+    const uint32_t blockIndex = pFlow->pQueue[queueBegin];
+    queueBegin = (queueBegin + 1) % blockCount;
+    queuedCount--;
+    pFlow->pQueued[blockIndex] = false;
 
-    case ZYDIS_MNEMONIC_VFMADD132PH:
-    case ZYDIS_MNEMONIC_VFMADD213PH:
-    case ZYDIS_MNEMONIC_VFMADD231PH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fmadd_ph("));
-      break;
+    uint32_t *pEntry = pFlow->pEntries + blockIndex * locationCount;
 
-    case ZYDIS_MNEMONIC_VFMADD132SH:
-    case ZYDIS_MNEMONIC_VFMADD213SH:
-    case ZYDIS_MNEMONIC_VFMADD231SH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fmadd_sh("));
-      break;
+    if (!zydec_DefUseFlow_Merge(pFlow, blockIndex, pEntry) && pFlow->pHasExit[blockIndex])
+      continue;
 
-    case ZYDIS_MNEMONIC_VFMADDSUB132PH:
-    case ZYDIS_MNEMONIC_VFMADDSUB213PH:
-    case ZYDIS_MNEMONIC_VFMADDSUB231PH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fmaddsub_ph("));
-      break;
+    uint32_t *pExit = pFlow->pExits + blockIndex * locationCount;
+    uint32_t *pState = pFlow->pMerged;
+    memcpy(pState, pEntry, locationCount * sizeof(uint32_t));
 
-    case ZYDIS_MNEMONIC_VFMSUB132PH:
-    case ZYDIS_MNEMONIC_VFMSUB213PH:
-    case ZYDIS_MNEMONIC_VFMSUB231PH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fmsub_ph("));
-      break;
+    const uint32_t first = pFlow->pBlockInstructions[blockIndex * 2];
+    const uint32_t count = pFlow->pBlockInstructions[blockIndex * 2 + 1];
 
-    case ZYDIS_MNEMONIC_VFMSUB132SH:
-    case ZYDIS_MNEMONIC_VFMSUB213SH:
-    case ZYDIS_MNEMONIC_VFMSUB231SH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fmsub_sh("));
-      break;
+    for (size_t i = 0; i < count; i++)
+      zydec_DefUseFlow_ApplyInstruction(pFlow, &pFlow->pBuilder->pInstructions[first + i], pState);
 
-    case ZYDIS_MNEMONIC_VFMSUBADD132PH:
-    case ZYDIS_MNEMONIC_VFMSUBADD213PH:
-    case ZYDIS_MNEMONIC_VFMSUBADD231PH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fmsubadd_ph("));
-      break;
+    if (pFlow->pHasExit[blockIndex] && memcmp(pExit, pState, locationCount * sizeof(uint32_t)) == 0)
+      continue;
 
-    case ZYDIS_MNEMONIC_VFMULCPH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fmul_pch("));
-      break;
+    memcpy(pExit, pState, locationCount * sizeof(uint32_t));
+    pFlow->pHasExit[blockIndex] = true;
 
-    case ZYDIS_MNEMONIC_VFMULCSH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fmul_sch("));
-      break;
+    for (size_t i = 0; i < 2; i++)
+    {
+      const uint32_t successor = pControlFlow->pBlocks[blockIndex].successors[i];
 
-    case ZYDIS_MNEMONIC_VFNMADD132PH:
-    case ZYDIS_MNEMONIC_VFNMADD213PH:
-    case ZYDIS_MNEMONIC_VFNMADD231PH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fnmadd_ph("));
-      break;
+      if (successor == ZydecBasicBlockNone || pFlow->pQueued[successor])
+        continue;
 
-    case ZYDIS_MNEMONIC_VFNMADD132SH:
-    case ZYDIS_MNEMONIC_VFNMADD213SH:
-    case ZYDIS_MNEMONIC_VFNMADD231SH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fnmadd_sh("));
-      break;
+      pFlow->pQueue[(queueBegin + queuedCount) % blockCount] = successor;
+      pFlow->pQueued[successor] = true;
+      queuedCount++;
+    }
+  }
 
-    case ZYDIS_MNEMONIC_VFNMSUB132PH:
-    case ZYDIS_MNEMONIC_VFNMSUB213PH:
-    case ZYDIS_MNEMONIC_VFNMSUB231PH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fnmsub_ph("));
-      break;
+  return true;
+}
 
-    case ZYDIS_MNEMONIC_VFNMSUB132SH:
-    case ZYDIS_MNEMONIC_VFNMSUB213SH:
-    case ZYDIS_MNEMONIC_VFNMSUB231SH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fnmsub_sh("));
-      break;
+struct ZydecDefUseResolver
+{
+  ZydecDefUseBuilder *pBuilder;
+  uint32_t *pUnknowns; // value of every location that is unknown, created on demand.
+  uint32_t *pBlockJoins; // index of the first join value of every block, followed by the join count. The joins are ordered by location.
+};
 
-    case ZYDIS_MNEMONIC_VFPCLASSPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fpclass_pd_mask("));
-      break;
+inline uint32_t zydec_DefUseResolver_Resolve(ZydecDefUseResolver *pResolver, const uint32_t value, const uint32_t location, const ZydecStackSlot *pSlots)
+{
+  ZydecDefUseBuilder *pBuilder = pResolver->pBuilder;
 
-    case ZYDIS_MNEMONIC_VFPCLASSPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fpclass_ps_mask("));
-      break;
+  if (value == ZydecValueNone)
+  {
+    if (pResolver->pUnknowns[location] == ZydecValueNone)
+    {
+      ZydecValue unknown;
+      unknown.instruction = ZydecValueNone;
+      unknown.location = location;
+      unknown.reg = (uint16_t)zydec_DefUse_LocationRegister(location, pSlots);
+      unknown.kind = zvk_unknown;
+      unknown.name = 0;
+      unknown.firstInput = 0;
+      unknown.inputCount = 0;
+      unknown.firstUse = 0;
+      unknown.useCount = 0;
+
+      if (!zydec_DefUse_Append(&pBuilder->pValues, &pBuilder->valueCount, &pBuilder->valueCapacity, unknown))
+        return ZydecValueNone;
+
+      pResolver->pUnknowns[location] = (uint32_t)(pBuilder->valueCount - 1);
+    }
 
-    case ZYDIS_MNEMONIC_VFPCLASSPH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_fpclass_ph_mask("));
-      break;
+    return pResolver->pUnknowns[location];
+  }
 
-    case ZYDIS_MNEMONIC_VGETEXPPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_getexp_pd("));
-      break;
+  if ((value & ZydecDefUseJoinBit) == 0)
+    return value;
 
-    case ZYDIS_MNEMONIC_VGETEXPPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_getexp_ps("));
-      break;
+  const uint32_t blockIndex = value & ~ZydecDefUseJoinBit;
+  const size_t end = (size_t)pResolver->pBlockJoins[blockIndex * 2] + pResolver->pBlockJoins[blockIndex * 2 + 1];
+  size_t first = pResolver->pBlockJoins[blockIndex * 2];
+  size_t count = pResolver->pBlockJoins[blockIndex * 2 + 1];
 
-    case ZYDIS_MNEMONIC_VGETEXPPH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_getexp_ph("));
-      break;
+  while (count > 0)
+  {
+    const size_t half = count / 2;
 
-    case ZYDIS_MNEMONIC_VGETEXPSD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_getexp_sd("));
-      break;
+    if (pBuilder->pValues[first + half].location < location)
+    {
+      first += half + 1;
+      count -= half + 1;
+    }
+    else
+    {
+      count = half;
+    }
+  }
 
-    case ZYDIS_MNEMONIC_VGETEXPSS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_getexp_ss("));
-      break;
+  // Only if the flow didn't settle, a join may be missing from its block.
+  if (first == end || pBuilder->pValues[first].location != location)
+    return zydec_DefUseResolver_Resolve(pResolver, ZydecValueNone, location, pSlots);
 
-    case ZYDIS_MNEMONIC_VGETEXPSH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_getexp_sh("));
-      break;
+  return (uint32_t)first;
+}
 
-    case ZYDIS_MNEMONIC_VGETMANTPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_getmant_pd("));
-      break;
+// Appends `value` to the references, unless it's already among the ones since `firstReference`.
+inline bool zydec_DefUse_AppendReference(ZydecDefUseBuilder *pBuilder, const size_t firstReference, const uint32_t value)
+{
+  if (value == ZydecValueNone)
+    return false;
 
-    case ZYDIS_MNEMONIC_VGETMANTPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_getmant_ps("));
-      break;
+  for (size_t i = firstReference; i < pBuilder->referenceCount; i++)
+    if (pBuilder->pReferences[i] == value)
+      return true;
 
-    case ZYDIS_MNEMONIC_VGETMANTPH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_getmant_ph("));
-      break;
+  return zydec_DefUse_Append(&pBuilder->pReferences, &pBuilder->referenceCount, &pBuilder->referenceCapacity, value);
+}
 
-    case ZYDIS_MNEMONIC_VGETMANTSD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_getmant_sd("));
-      break;
+// Names of the values, advancing the session across the instructions in the order of the code.
+struct ZydecDefUseNaming
+{
+  ZydecLinearSession *pSession;
+  const ZydisDecoder *pDecoder;
+  const uint8_t *pCode;
+  size_t codeSize;
+  size_t virtualAddress;
+};
 
-    case ZYDIS_MNEMONIC_VGETMANTSS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_getmant_ss("));
-      break;
+inline uint32_t zydec_DefUseNaming_GetName(const ZydecDefUseNaming *pNaming, const ZydisRegister reg)
+{
+  if (pNaming->pSession == nullptr)
+    return 0;
 
-    case ZYDIS_MNEMONIC_VGETMANTSH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_getmant_sh("));
-      break;
+  return zydec_LinearContext_GetName(&pNaming->pSession->context, reg);
+}
 
-    case ZYDIS_MNEMONIC_VPSCATTERDD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_i32scatter_epi32("));
-      break;
+// The register a join is named by: the widest vector register that has a name at the start of the block.
+inline ZydisRegister zydec_DefUseNaming_JoinRegister(const ZydecDefUseNaming *pNaming, const uint32_t location, const ZydecStackSlot *pSlots)
+{
+  const ZydisRegister reg = zydec_DefUse_LocationRegister(location, pSlots);
 
-    case ZYDIS_MNEMONIC_VPSCATTERDQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_i32scatter_epi64("));
-      break;
+  if (reg >= ZYDIS_REGISTER_XMM0 && reg <= ZYDIS_REGISTER_XMM31)
+    for (ZydisRegister wide : { (ZydisRegister)(reg - ZYDIS_REGISTER_XMM0 + ZYDIS_REGISTER_ZMM0), (ZydisRegister)(reg - ZYDIS_REGISTER_XMM0 + ZYDIS_REGISTER_YMM0) })
+      if (zydec_DefUseNaming_GetName(pNaming, wide) != 0)
+        return wide;
 
-    case ZYDIS_MNEMONIC_VPSCATTERQD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_i64scatter_epi32("));
-      break;
+  return reg;
+}
 
-    case ZYDIS_MNEMONIC_VPSCATTERQQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_i64scatter_epi64("));
-      break;
+// Creates the join values of every block, the join instructions in front of the blocks, resolves what every instruction reads & names the values.
+bool zydec_DefUseBuilder_Resolve(ZydecDefUseBuilder *pBuilder, const ZydecDefUseFlow *pFlow, ZydecDefUseNaming *pNaming)
+{
+  const ZydecControlFlowGraph *pControlFlow = pFlow->pControlFlow;
+  const size_t blockCount = pControlFlow->blockCount;
+  const size_t locationCount = pFlow->locationCount;
 
-    case ZYDIS_MNEMONIC_VSCATTERDPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_i32scatter_ps("));
-      break;
+  ZydecDefUseResolver resolver;
+  resolver.pBuilder = pBuilder;
+  resolver.pUnknowns = static_cast<uint32_t *>(malloc(locationCount * sizeof(uint32_t)));
+  resolver.pBlockJoins = static_cast<uint32_t *>(malloc(blockCount * 2 * sizeof(uint32_t)));
 
-    case ZYDIS_MNEMONIC_VSCATTERDPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_i32scatter_pd("));
-      break;
+  uint32_t *pState = static_cast<uint32_t *>(malloc(locationCount * sizeof(uint32_t)));
+  uint32_t *pOutputIndices = static_cast<uint32_t *>(malloc((pBuilder->instructionCount + 1) * sizeof(uint32_t)));
 
-    case ZYDIS_MNEMONIC_VSCATTERQPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_i64scatter_ps("));
-      break;
+  bool success = (resolver.pUnknowns != nullptr && resolver.pBlockJoins != nullptr && pState != nullptr && pOutputIndices != nullptr);
 
-    case ZYDIS_MNEMONIC_VSCATTERQPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_i64scatter_pd("));
-      break;
+  if (success)
+  {
+    for (size_t i = 0; i < locationCount; i++)
+      resolver.pUnknowns[i] = ZydecValueNone;
 
-    case ZYDIS_MNEMONIC_VINSERTF32X4:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_insertf32x4("));
-      break;
+    for (size_t blockIndex = 0; blockIndex < blockCount && success; blockIndex++)
+    {
+      const uint32_t *pEntry = pFlow->pEntries + blockIndex * locationCount;
+      const uint32_t join = ZydecDefUseJoinBit | (uint32_t)blockIndex;
 
-    case ZYDIS_MNEMONIC_VINSERTF32X8:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_insertf32x8("));
-      break;
+      resolver.pBlockJoins[blockIndex * 2] = (uint32_t)pBuilder->valueCount;
+      resolver.pBlockJoins[blockIndex * 2 + 1] = 0;
 
-    case ZYDIS_MNEMONIC_VINSERTF64X2:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_insertf64x2("));
-      break;
+      for (size_t location = 0; location < locationCount && success; location++)
+      {
+        if (pEntry[location] != join)
+          continue;
+
+        ZydecValue value;
+        value.instruction = ZydecValueNone;
+        value.location = (uint32_t)location;
+        value.reg = (uint16_t)zydec_DefUse_LocationRegister((uint32_t)location, pBuilder->pSlots);
+        value.kind = zvk_join;
+        value.name = 0;
+        value.firstInput = 0;
+        value.inputCount = 0;
+        value.firstUse = 0;
+        value.useCount = 0;
+
+        success = zydec_DefUse_Append(&pBuilder->pValues, &pBuilder->valueCount, &pBuilder->valueCapacity, value);
+        resolver.pBlockJoins[blockIndex * 2 + 1]++;
+      }
+    }
+  }
 
-    case ZYDIS_MNEMONIC_VINSERTF64X4:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_insertf64x4("));
-      break;
+  ZydecLinearContext initial;
 
-    case ZYDIS_MNEMONIC_VINSERTI32X4:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_inserti32x4("));
-      break;
+  if (pNaming->pSession != nullptr)
+    zydec_LinearContext_Snapshot(&pNaming->pSession->context, &initial);
 
-    case ZYDIS_MNEMONIC_VINSERTI32X8:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_inserti32x8("));
-      break;
+  ZydisDecodedInstruction instruction;
+  ZydisDecodedOperand operands[ZYDIS_MAX_OPERAND_COUNT];
 
-    case ZYDIS_MNEMONIC_VINSERTI64X2:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_inserti64x2("));
-      break;
+  for (size_t blockIndex = 0; blockIndex < blockCount && success; blockIndex++)
+  {
+    const ZydecBasicBlock *pBlock = &pControlFlow->pBlocks[blockIndex];
+    const uint32_t *pEntry = pFlow->pEntries + blockIndex * locationCount;
+    const uint32_t firstJoin = resolver.pBlockJoins[blockIndex * 2];
+    const uint32_t joinCount = resolver.pBlockJoins[blockIndex * 2 + 1];
 
-    case ZYDIS_MNEMONIC_VINSERTI64X4:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_inserti64x4("));
-      break;
+    if (pNaming->pSession != nullptr && pControlFlow->pContexts != nullptr)
+      zydec_LinearContext_Restore(&pNaming->pSession->context, &pControlFlow->pContexts[blockIndex]);
 
-    case ZYDIS_MNEMONIC_KADDB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_kadd_mask8("));
-      break;
+    if (joinCount > 0)
+    {
+      ZydecDefUseInstruction joinInstruction;
+      joinInstruction.offset = pBlock->offset;
+      joinInstruction.block = (uint32_t)blockIndex;
+      joinInstruction.firstRead = (uint32_t)pBuilder->referenceCount;
+      joinInstruction.readCount = 0;
+      joinInstruction.mnemonic = ZYDIS_MNEMONIC_INVALID;
+      joinInstruction.length = 0;
+
+      for (size_t i = 0; i < joinCount && success; i++)
+      {
+        ZydecValue *pJoin = &pBuilder->pValues[firstJoin + i];
+        const size_t firstInput = pBuilder->referenceCount;
 
-    case ZYDIS_MNEMONIC_KADDW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_kadd_mask16("));
-      break;
+        if (blockIndex == 0 || pBlock->predecessorCount == 0)
+          success &= zydec_DefUse_AppendReference(pBuilder, firstInput, zydec_DefUseResolver_Resolve(&resolver, ZydecValueNone, pJoin->location, pBuilder->pSlots));
 
-    case ZYDIS_MNEMONIC_KADDD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_kadd_mask32("));
-      break;
+        for (size_t j = 0; j < pBlock->predecessorCount && success; j++)
+        {
+          const uint32_t predecessor = pControlFlow->pPredecessors[pBlock->firstPredecessor + j];
+          const uint32_t incoming = pFlow->pExits[predecessor * locationCount + pJoin->location];
 
-    case ZYDIS_MNEMONIC_KADDQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_kadd_mask64("));
-      break;
+          if (incoming != (ZydecDefUseJoinBit | (uint32_t)blockIndex))
+            success &= zydec_DefUse_AppendReference(pBuilder, firstInput, zydec_DefUseResolver_Resolve(&resolver, incoming, pJoin->location, pBuilder->pSlots));
+        }
 
-    case ZYDIS_MNEMONIC_KANDB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_kand_mask8("));
-      break;
+        pJoin = &pBuilder->pValues[firstJoin + i]; // resolving may have grown the values.
+        pJoin->instruction = (uint32_t)pBuilder->outputCount;
+        pJoin->firstInput = (uint32_t)firstInput;
+        pJoin->inputCount = (uint32_t)(pBuilder->referenceCount - firstInput);
+        pJoin->reg = (uint16_t)zydec_DefUseNaming_JoinRegister(pNaming, pJoin->location, pBuilder->pSlots);
+        pJoin->name = (pJoin->location < ZydecLinearContextRegisterCount) ? zydec_DefUseNaming_GetName(pNaming, (ZydisRegister)pJoin->reg) : 0;
+      }
 
-    case ZYDIS_MNEMONIC_KANDW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_kand_mask16("));
-      break;
+      joinInstruction.readCount = (uint16_t)(pBuilder->referenceCount - joinInstruction.firstRead);
+      joinInstruction.firstDefinition = (uint32_t)pBuilder->referenceCount;
+      joinInstruction.definitionCount = (uint16_t)joinCount;
 
-    case ZYDIS_MNEMONIC_KANDD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_kand_mask32("));
-      break;
+      for (size_t i = 0; i < joinCount && success; i++)
+        success = zydec_DefUse_Append(&pBuilder->pReferences, &pBuilder->referenceCount, &pBuilder->referenceCapacity, firstJoin + (uint32_t)i);
 
-    case ZYDIS_MNEMONIC_KANDQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_kand_mask64("));
-      break;
+      success = success && zydec_DefUse_Append(&pBuilder->pOutput, &pBuilder->outputCount, &pBuilder->outputCapacity, joinInstruction);
+    }
 
-    case ZYDIS_MNEMONIC_KANDNB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_kandn_mask8("));
-      break;
+    memcpy(pState, pEntry, locationCount * sizeof(uint32_t));
 
-    case ZYDIS_MNEMONIC_KANDNW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_kandn_mask16("));
-      break;
+    const uint32_t first = pFlow->pBlockInstructions[blockIndex * 2];
+    const uint32_t count = pFlow->pBlockInstructions[blockIndex * 2 + 1];
 
-    case ZYDIS_MNEMONIC_KANDND:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_kandn_mask32("));
-      break;
+    for (size_t i = first; i < first + count && success; i++)
+    {
+      const ZydecDefUseEffects *pEffects = &pBuilder->pInstructions[i];
 
-    case ZYDIS_MNEMONIC_KANDNQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_kandn_mask64("));
-      break;
+      ZydecDefUseInstruction output;
+      output.offset = pEffects->offset;
+      output.block = pEffects->block;
+      output.firstRead = (uint32_t)pBuilder->referenceCount;
+      output.mnemonic = pEffects->mnemonic;
+      output.length = pEffects->length;
 
-    case ZYDIS_MNEMONIC_KNOTB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_knot_mask8("));
-      break;
+      for (size_t j = 0; j < pEffects->readCount && success; j++)
+      {
+        const uint32_t location = pBuilder->pEffects[pEffects->firstEffect + j];
+        success = zydec_DefUse_AppendReference(pBuilder, output.firstRead, zydec_DefUseResolver_Resolve(&resolver, pState[location], location, pBuilder->pSlots));
+      }
 
-    case ZYDIS_MNEMONIC_KNOTW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_knot_mask16("));
-      break;
+      output.readCount = (uint16_t)(pBuilder->referenceCount - output.firstRead);
+      output.firstDefinition = (uint32_t)pBuilder->referenceCount;
+      output.definitionCount = pEffects->definitionCount;
 
-    case ZYDIS_MNEMONIC_KNOTD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_knot_mask32("));
-      break;
+      for (size_t j = 0; j < pEffects->definitionCount && success; j++)
+        success = zydec_DefUse_Append(&pBuilder->pReferences, &pBuilder->referenceCount, &pBuilder->referenceCapacity, pBuilder->pEffects[pEffects->firstEffect + pEffects->readCount + j]);
 
-    case ZYDIS_MNEMONIC_KNOTQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_knot_mask64("));
-      break;
-      
-    case ZYDIS_MNEMONIC_KORB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_kor_mask8("));
-      break;
+      pOutputIndices[i] = (uint32_t)pBuilder->outputCount;
+      success = success && zydec_DefUse_Append(&pBuilder->pOutput, &pBuilder->outputCount, &pBuilder->outputCapacity, output);
 
-    case ZYDIS_MNEMONIC_KORW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_kor_mask16("));
-      break;
+      zydec_DefUseFlow_ApplyInstruction(pFlow, pEffects, pState);
 
-    case ZYDIS_MNEMONIC_KORD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_kor_mask32("));
-      break;
+      // The names of the registers the translation named anew.
+      if (pNaming->pSession != nullptr && pEffects->mnemonic != ZYDIS_MNEMONIC_INVALID && success)
+      {
+        uint32_t namesBefore[ZydecDefUseMaxInstructionEffects];
 
-    case ZYDIS_MNEMONIC_KORQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_kor_mask64("));
-      break;
+        for (size_t j = 0; j < pEffects->definitionCount; j++)
+          namesBefore[j] = zydec_DefUseNaming_GetName(pNaming, (ZydisRegister)pBuilder->pValues[pBuilder->pEffects[pEffects->firstEffect + pEffects->readCount + j]].reg);
 
-    case ZYDIS_MNEMONIC_KUNPCKBW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_kunpackepi8_epi16("));
-      break;
+        if (ZYAN_SUCCESS(ZydisDecoderDecodeFull(pNaming->pDecoder, pNaming->pCode + pEffects->offset, pNaming->codeSize - pEffects->offset, &instruction, operands)))
+          zydec_LinearSession_AdvanceInstruction(pNaming->pSession, &instruction, operands, ZYDIS_MAX_OPERAND_COUNT, pNaming->virtualAddress + pEffects->offset);
 
-    case ZYDIS_MNEMONIC_KUNPCKWD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_kunpackepi16_epi32("));
-      break;
+        for (size_t j = 0; j < pEffects->definitionCount; j++)
+        {
+          ZydecValue *pValue = &pBuilder->pValues[pBuilder->pEffects[pEffects->firstEffect + pEffects->readCount + j]];
 
-    case ZYDIS_MNEMONIC_KUNPCKDQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_kunpackepi32_epi64("));
-      break;
+          if (pValue->location >= ZydecLinearContextRegisterCount)
+            continue;
 
-    case ZYDIS_MNEMONIC_KXNORB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_kxnor_mask8("));
-      break;
+          const uint32_t nameAfter = zydec_DefUseNaming_GetName(pNaming, (ZydisRegister)pValue->reg);
+          pValue->name = (nameAfter != namesBefore[j]) ? nameAfter : 0;
+        }
+      }
+    }
+  }
 
-    case ZYDIS_MNEMONIC_KXNORW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_kxnor_mask16("));
-      break;
+  if (pNaming->pSession != nullptr)
+    zydec_LinearContext_Restore(&pNaming->pSession->context, &initial);
 
-    case ZYDIS_MNEMONIC_KXNORD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_kxnor_mask32("));
-      break;
+  // Definitions referred to the instructions before the joins were inserted.
+  if (success)
+    for (size_t i = 0; i < pBuilder->valueCount; i++)
+      if (pBuilder->pValues[i].kind == zvk_definition)
+        pBuilder->pValues[i].instruction = pOutputIndices[pBuilder->pValues[i].instruction];
 
-    case ZYDIS_MNEMONIC_KXNORQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_kxnor_mask64("));
-      break;
+  free(resolver.pUnknowns);
+  free(resolver.pBlockJoins);
+  free(pState);
+  free(pOutputIndices);
 
-    case ZYDIS_MNEMONIC_VPLZCNTD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_lzcnt_epi32("));
-      break;
+  return success;
+}
 
-    case ZYDIS_MNEMONIC_VPLZCNTQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_lzcnt_epi64("));
-      break;
+bool zydec_DefUseGraph_Build(ZydecDefUseGraph *pGraph, const ZydecControlFlowGraph *pControlFlow, ZydecLinearSession *pSession, const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t codeSize, const size_t virtualAddress)
+{
+  if (pGraph == nullptr || pControlFlow == nullptr || pControlFlow->pBlocks == nullptr || pControlFlow->pOrder == nullptr || pControlFlow->pPredecessors == nullptr || pControlFlow->blockCount == 0 || pControlFlow->blockCount >= (ZydecDefUseUnset & ~ZydecDefUseJoinBit) || pDecoder == nullptr || pCode == nullptr)
+    return false;
 
-    case ZYDIS_MNEMONIC_VMAXPH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_max_ph("));
-      break;
+  const ZydecBasicBlock *pLastBlock = &pControlFlow->pBlocks[pControlFlow->blockCount - 1];
 
-    case ZYDIS_MNEMONIC_VMAXSH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_max_sh("));
-      break;
+  if ((size_t)pLastBlock->offset + pLastBlock->size > codeSize)
+    return false;
 
-    case ZYDIS_MNEMONIC_VMINPH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_min_ph("));
-      break;
+  const size_t blockCount = pControlFlow->blockCount;
 
-    case ZYDIS_MNEMONIC_VMINSH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_min_sh("));
-      break;
+  ZydecDefUseBuilder builder;
+  ZydecDefUseFlow flow;
+  flow.pControlFlow = pControlFlow;
+  flow.pBuilder = &builder;
+  flow.pBlockInstructions = static_cast<uint32_t *>(malloc(blockCount * 2 * sizeof(uint32_t)));
+  flow.pEntries = nullptr;
+  flow.pExits = nullptr;
+  flow.pHasExit = static_cast<bool *>(calloc(blockCount, sizeof(bool)));
+  flow.pMerged = nullptr;
+  flow.pQueue = static_cast<uint32_t *>(malloc(blockCount * sizeof(uint32_t)));
+  flow.pQueued = static_cast<bool *>(calloc(blockCount, sizeof(bool)));
+  flow.pRetained = (pSession != nullptr ? pSession->originalInfo.afterCallRegisterRetentionMode : ZydecFormattingInfo::AfterCallRegisterRetentionMode::Default) == ZydecFormattingInfo::AfterCallRegisterRetentionMode::Windows ? AfterCallRetainedRegistersWindows : AfterCallRetainedRegistersLinux;
 
-    case ZYDIS_MNEMONIC_VPMOVB2M:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_movepi8_mask("));
-      break;
+  bool success = (flow.pBlockInstructions != nullptr && flow.pHasExit != nullptr && flow.pQueue != nullptr && flow.pQueued != nullptr);
 
-    case ZYDIS_MNEMONIC_VPMOVW2M:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_movepi16_mask("));
-      break;
+  // The effects of every instruction.
+  ZydisDecodedInstruction instruction;
+  ZydisDecodedOperand operands[ZYDIS_MAX_OPERAND_COUNT];
 
-    case ZYDIS_MNEMONIC_VPMOVD2M:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_movepi32_mask("));
-      break;
+  for (size_t blockIndex = 0; blockIndex < blockCount && success; blockIndex++)
+  {
+    const ZydecBasicBlock *pBlock = &pControlFlow->pBlocks[blockIndex];
 
-    case ZYDIS_MNEMONIC_VPMOVQ2M:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_movepi64_mask("));
-      break;
+    flow.pBlockInstructions[blockIndex * 2] = (uint32_t)builder.instructionCount;
 
-    case ZYDIS_MNEMONIC_VPMOVM2B:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_movm_epi8("));
-      break;
+    for (size_t offset = pBlock->offset; offset < (size_t)pBlock->offset + pBlock->size && success;)
+    {
+      if (ZYAN_SUCCESS(ZydisDecoderDecodeFull(pDecoder, pCode + offset, codeSize - offset, &instruction, operands)) && instruction.length != 0)
+      {
+        success = zydec_DefUseBuilder_AddInstruction(&builder, pGraph, &instruction, operands, (uint32_t)offset, (uint32_t)blockIndex);
+        offset += instruction.length;
+      }
+      else
+      {
+        ZydecDefUseEffects effects;
+        effects.offset = (uint32_t)offset;
+        effects.block = (uint32_t)blockIndex;
+        effects.firstEffect = (uint32_t)builder.effectCount;
+        effects.readCount = 0;
+        effects.definitionCount = 0;
+        effects.mnemonic = ZYDIS_MNEMONIC_INVALID;
+        effects.length = 1;
+        effects.isCall = false;
+
+        success = zydec_DefUse_Append(&builder.pInstructions, &builder.instructionCount, &builder.instructionCapacity, effects);
+        offset++;
+      }
+    }
 
-    case ZYDIS_MNEMONIC_VPMOVM2W:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_movm_epi16("));
-      break;
+    flow.pBlockInstructions[blockIndex * 2 + 1] = (uint32_t)(builder.instructionCount - flow.pBlockInstructions[blockIndex * 2]);
+  }
 
-    case ZYDIS_MNEMONIC_VPMOVM2D:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_movm_epi32("));
-      break;
+  success = success && zydec_DefUseBuilder_ResolveSlots(&builder);
 
-    case ZYDIS_MNEMONIC_VPMOVM2Q:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_movm_epi64("));
-      break;
-      
-    case ZYDIS_MNEMONIC_VMULPH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mul_ph("));
-      break;
+  if (success)
+  {
+    flow.locationCount = ZydecLinearContextRegisterCount + builder.slotCount;
 
-    case ZYDIS_MNEMONIC_VMULSH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mul_sh("));
-      break;
+    // Slots are sorted by base register, `rsp` before `rbp` as `ZYDIS_REGISTER_RSP` < `ZYDIS_REGISTER_RBP`.
+    size_t rbpStart = 0;
 
-    case ZYDIS_MNEMONIC_VSUBPH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_sub_ph("));
-      break;
+    while (rbpStart < builder.slotCount && builder.pSlots[rbpStart].base == ZYDIS_REGISTER_RSP)
+      rbpStart++;
 
-    case ZYDIS_MNEMONIC_VSUBSH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_sub_sh("));
-      break;
+    flow.slotRanges[0][0] = 0;
+    flow.slotRanges[0][1] = rbpStart;
+    flow.slotRanges[1][0] = rbpStart;
+    flow.slotRanges[1][1] = builder.slotCount;
 
-    case ZYDIS_MNEMONIC_VCMPSH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_cmp_sh("));
-      break;
+    flow.pEntries = static_cast<uint32_t *>(malloc(blockCount * flow.locationCount * sizeof(uint32_t)));
+    flow.pExits = static_cast<uint32_t *>(malloc(blockCount * flow.locationCount * sizeof(uint32_t)));
+    flow.pMerged = static_cast<uint32_t *>(malloc(flow.locationCount * sizeof(uint32_t)));
 
-    case ZYDIS_MNEMONIC_VPMULHUW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mulhi_epu16("));
-      break;
+    success = (flow.pEntries != nullptr && flow.pExits != nullptr && flow.pMerged != nullptr);
+  }
 
-    case ZYDIS_MNEMONIC_VPMULHUD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mulhi_epu32("));
-      break;
+  // Should the flow not settle, the values of the last visits are used, which are still consistent within every block.
+  if (success)
+    zydec_DefUseFlow_Run(&flow);
 
-    case ZYDIS_MNEMONIC_VPMULLQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_mullo_epi64("));
-      break;
+  ZydecDefUseNaming naming;
+  naming.pSession = pSession;
+  naming.pDecoder = pDecoder;
+  naming.pCode = pCode;
+  naming.codeSize = codeSize;
+  naming.virtualAddress = virtualAddress;
 
-    case ZYDIS_MNEMONIC_VPMULTISHIFTQB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_multishift_epi64_epi8("));
-      break;
+  success = success && zydec_DefUseBuilder_Resolve(&builder, &flow, &naming);
 
-    case ZYDIS_MNEMONIC_VPERMT2B:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_permutex2var_epi8("));
-      break;
+  free(flow.pBlockInstructions);
+  free(flow.pEntries);
+  free(flow.pExits);
+  free(flow.pHasExit);
+  free(flow.pMerged);
+  free(flow.pQueue);
+  free(flow.pQueued);
 
-    case ZYDIS_MNEMONIC_VPERMT2W:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_permutex2var_epi16("));
-      break;
+  if (!success)
+  {
+    zydec_DefUseBuilder_Destroy(&builder);
+    return false;
+  }
 
-    case ZYDIS_MNEMONIC_VPERMT2D:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_permutex2var_epi32("));
-      break;
+  // Every instruction reading a value uses it.
+  size_t useCount = 0;
 
-    case ZYDIS_MNEMONIC_VPERMT2Q:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_permutex2var_epi64("));
-      break;
+  for (size_t i = 0; i < builder.outputCount; i++)
+    for (size_t j = 0; j < builder.pOutput[i].readCount; j++)
+      builder.pValues[builder.pReferences[builder.pOutput[i].firstRead + j]].useCount++;
 
-    case ZYDIS_MNEMONIC_VPERMT2PS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_permutex2var_ps("));
-      break;
+  for (size_t i = 0; i < builder.valueCount; i++)
+  {
+    builder.pValues[i].firstUse = (uint32_t)useCount;
+    useCount += builder.pValues[i].useCount;
+  }
 
-    case ZYDIS_MNEMONIC_VPERMT2PD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_permutex2var_pd("));
-      break;
+  pGraph->instructionCount = builder.outputCount;
+  pGraph->valueCount = builder.valueCount;
+  pGraph->referenceCount = builder.referenceCount;
+  pGraph->useCount = useCount;
+  pGraph->stackSlotCount = builder.slotCount;
 
-    case ZYDIS_MNEMONIC_VPERMB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_permutexvar_epi8("));
-      break;
+  const bool fits = (pGraph->pInstructions != nullptr && pGraph->instructionCount <= pGraph->instructionCapacity && pGraph->pValues != nullptr && pGraph->valueCount <= pGraph->valueCapacity && pGraph->pReferences != nullptr && pGraph->referenceCount <= pGraph->referenceCapacity && pGraph->pUses != nullptr && pGraph->useCount <= pGraph->useCapacity && (pGraph->stackSlotCount == 0 || (pGraph->pStackSlots != nullptr && pGraph->stackSlotCount <= pGraph->stackSlotCapacity)));
 
-    case ZYDIS_MNEMONIC_VPERMW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_permutexvar_epi16("));
-      break;
+  if (fits)
+  {
+    memcpy(pGraph->pInstructions, builder.pOutput, builder.outputCount * sizeof(ZydecDefUseInstruction));
+    memcpy(pGraph->pValues, builder.pValues, builder.valueCount * sizeof(ZydecValue));
+    memcpy(pGraph->pReferences, builder.pReferences, builder.referenceCount * sizeof(uint32_t));
 
-    case ZYDIS_MNEMONIC_VPERMD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_permutevar_epi32("));
-      break;
+    if (builder.slotCount > 0)
+      memcpy(pGraph->pStackSlots, builder.pSlots, builder.slotCount * sizeof(ZydecStackSlot));
 
-    case ZYDIS_MNEMONIC_VPOPCNTB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_popcnt_epi8("));
-      break;
+    for (size_t i = 0; i < pGraph->valueCount; i++)
+      pGraph->pValues[i].useCount = 0;
 
-    case ZYDIS_MNEMONIC_VPOPCNTW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_popcnt_epi16("));
-      break;
+    for (size_t i = 0; i < pGraph->instructionCount; i++)
+    {
+      for (size_t j = 0; j < pGraph->pInstructions[i].readCount; j++)
+      {
+        ZydecValue *pValue = &pGraph->pValues[pGraph->pReferences[pGraph->pInstructions[i].firstRead + j]];
+        pGraph->pUses[pValue->firstUse + pValue->useCount++] = (uint32_t)i;
+      }
+    }
+  }
 
-    case ZYDIS_MNEMONIC_VPOPCNTD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_popcnt_epi32("));
-      break;
+  zydec_DefUseBuilder_Destroy(&builder);
 
-    case ZYDIS_MNEMONIC_VPOPCNTQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_popcnt_epi64("));
-      break;
+  return fits;
+}
 
-    case ZYDIS_MNEMONIC_VRANGEPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_range_pd("));
-      break;
+// Writes the register name the value has in the translation (e.g. `a_Add_RoJo`), the bare register or the stack slot (e.g. `[rsp + 8]`).
+bool zydec_DefUseGraph_WriteValue(char **pBufferPos, size_t *pRemainingSize, const ZydecDefUseGraph *pGraph, const uint32_t valueIndex)
+{
+  const ZydecValue *pValue = &pGraph->pValues[valueIndex];
 
-    case ZYDIS_MNEMONIC_VRANGEPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_range_ps("));
-      break;
+  if (pValue->location >= ZydecLinearContextRegisterCount)
+  {
+    const ZydecStackSlot *pSlot = &pGraph->pStackSlots[pValue->location - ZydecLinearContextRegisterCount];
 
-    case ZYDIS_MNEMONIC_VRANGESD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_range_sd("));
-      break;
+    ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, "["));
+    ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, ZydisRegisterGetString((ZydisRegister)pSlot->base)));
 
-    case ZYDIS_MNEMONIC_VRANGESS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_range_ss("));
-      break;
+    if (pSlot->displacement != 0)
+    {
+      ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, pSlot->displacement < 0 ? " - " : " + "));
+      ERROR_CHECK(zydec_WriteUInt(pBufferPos, pRemainingSize, pSlot->displacement < 0 ? (uint64_t)-(int64_t)pSlot->displacement : (uint64_t)pSlot->displacement));
+    }
 
-    case ZYDIS_MNEMONIC_VRCPPH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_rcp_ph("));
-      break;
+    return zydec_WriteRaw(pBufferPos, pRemainingSize, "]");
+  }
 
-    case ZYDIS_MNEMONIC_VRCPSH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_rcp_sh("));
-      break;
+  return zydec_LinearContext_WriteRegisterName(pBufferPos, pRemainingSize, (ZydisRegister)pValue->reg, pValue->name);
+}
 
-    case ZYDIS_MNEMONIC_VRCP14PD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_rcp14_pd("));
-      break;
+inline bool zydec_DefUseGraph_WriteIndices(char **pBufferPos, size_t *pRemainingSize, const uint32_t *pIndices, const size_t count)
+{
+  ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, "["));
 
-    case ZYDIS_MNEMONIC_VRCP14PS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_rcp14_ps("));
-      break;
+  for (size_t i = 0; i < count; i++)
+  {
+    if (i != 0)
+      ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, ", "));
 
-    case ZYDIS_MNEMONIC_VRCP14SD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_rcp14_sd("));
-      break;
+    ERROR_CHECK(zydec_WriteUInt(pBufferPos, pRemainingSize, pIndices[i]));
+  }
 
-    case ZYDIS_MNEMONIC_VRCP14SS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_rcp14_ss("));
-      break;
+  return zydec_WriteRaw(pBufferPos, pRemainingSize, "]");
+}
 
-    case ZYDIS_MNEMONIC_VRCP28PD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_rcp28_pd("));
-      break;
+bool zydec_DefUseGraph_WriteDot(const ZydecDefUseGraph *pGraph, const size_t virtualAddress, char *buffer, const size_t bufferCapacity, size_t *pLength)
+{
+  if (pGraph == nullptr || buffer == nullptr || bufferCapacity == 0 || pLength == nullptr)
+    return false;
 
-    case ZYDIS_MNEMONIC_VRCP28PS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_rcp28_ps("));
-      break;
+  char *bufferPos = buffer;
+  size_t remainingSize = bufferCapacity - 1;
+  char **pBufferPos = &bufferPos;
+  size_t *pRemainingSize = &remainingSize;
 
-    case ZYDIS_MNEMONIC_VRCP28SD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_rcp28_sd("));
-      break;
+  *buffer = '\0';
 
-    case ZYDIS_MNEMONIC_VRCP28SS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_rcp28_ss("));
-      break;
+  ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, "digraph zydec\n{\n  node [shape=box, fontname=\"monospace\"];\n"));
 
-    case ZYDIS_MNEMONIC_VREDUCEPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_reduce_pd("));
-      break;
+  for (size_t i = 0; i < pGraph->instructionCount; i++)
+  {
+    const ZydecDefUseInstruction *pInstruction = &pGraph->pInstructions[i];
 
-    case ZYDIS_MNEMONIC_VREDUCEPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_reduce_ps("));
-      break;
+    ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, "  i"));
+    ERROR_CHECK(zydec_WriteUInt(pBufferPos, pRemainingSize, i));
+    ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, " [label=\""));
+    ERROR_CHECK(zydec_WriteHex(pBufferPos, pRemainingSize, virtualAddress + pInstruction->offset));
+    ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, " "));
 
-    case ZYDIS_MNEMONIC_VREDUCEPH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_reduce_ph("));
-      break;
+    if (pInstruction->length == 0)
+      ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, "join\", shape=ellipse];\n"));
+    else
+      ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, pInstruction->mnemonic == ZYDIS_MNEMONIC_INVALID ? "(invalid)" : ZydisMnemonicGetString((ZydisMnemonic)pInstruction->mnemonic)) && zydec_WriteRaw(pBufferPos, pRemainingSize, "\"];\n"));
+  }
 
-    case ZYDIS_MNEMONIC_VREDUCESD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_reduce_sd("));
-      break;
+  // Unknown values have no instruction defining them.
+  for (size_t i = 0; i < pGraph->valueCount; i++)
+  {
+    if (pGraph->pValues[i].kind != zvk_unknown || pGraph->pValues[i].useCount == 0)
+      continue;
+
+    ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, "  v"));
+    ERROR_CHECK(zydec_WriteUInt(pBufferPos, pRemainingSize, i));
+    ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, " [label=\""));
+    ERROR_CHECK(zydec_DefUseGraph_WriteValue(pBufferPos, pRemainingSize, pGraph, (uint32_t)i));
+    ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, "\", shape=plaintext];\n"));
+  }
 
-    case ZYDIS_MNEMONIC_VREDUCESS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_reduce_ss("));
-      break;
+  for (size_t i = 0; i < pGraph->instructionCount; i++)
+  {
+    const ZydecDefUseInstruction *pInstruction = &pGraph->pInstructions[i];
 
-    case ZYDIS_MNEMONIC_VREDUCESH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_reduce_sh("));
-      break;
+    for (size_t j = 0; j < pInstruction->readCount; j++)
+    {
+      const uint32_t valueIndex = pGraph->pReferences[pInstruction->firstRead + j];
+      const ZydecValue *pValue = &pGraph->pValues[valueIndex];
+
+      ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, pValue->kind == zvk_unknown ? "  v" : "  i"));
+      ERROR_CHECK(zydec_WriteUInt(pBufferPos, pRemainingSize, pValue->kind == zvk_unknown ? valueIndex : pValue->instruction));
+      ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, " -> i"));
+      ERROR_CHECK(zydec_WriteUInt(pBufferPos, pRemainingSize, i));
+      ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, " [label=\""));
+      ERROR_CHECK(zydec_DefUseGraph_WriteValue(pBufferPos, pRemainingSize, pGraph, valueIndex));
+      ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, "\"];\n"));
+    }
+  }
 
-    case ZYDIS_MNEMONIC_VPROLD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_rol_epi32("));
-      break;
+  ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, "}\n"));
 
-    case ZYDIS_MNEMONIC_VPROLQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_rol_epi64("));
-      break;
-      
-    case ZYDIS_MNEMONIC_VPROLVD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_rolv_epi32("));
-      break;
+  *pLength = (size_t)(bufferPos - buffer);
 
-    case ZYDIS_MNEMONIC_VPROLVQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_rolv_epi64("));
-      break;
+  return true;
+}
 
-    case ZYDIS_MNEMONIC_VPRORD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_ror_epi32("));
-      break;
+bool zydec_DefUseGraph_WriteJson(const ZydecDefUseGraph *pGraph, const size_t virtualAddress, char *buffer, const size_t bufferCapacity, size_t *pLength)
+{
+  if (pGraph == nullptr || buffer == nullptr || bufferCapacity == 0 || pLength == nullptr)
+    return false;
 
-    case ZYDIS_MNEMONIC_VPRORQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_ror_epi64("));
-      break;
+  char *bufferPos = buffer;
+  size_t remainingSize = bufferCapacity - 1;
+  char **pBufferPos = &bufferPos;
+  size_t *pRemainingSize = &remainingSize;
 
-    case ZYDIS_MNEMONIC_VPRORVD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_rorv_epi32("));
-      break;
+  *buffer = '\0';
 
-    case ZYDIS_MNEMONIC_VPRORVQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_rorv_epi64("));
-      break;
+  static const char *ValueKindNames[] = { "definition", "join", "unknown" };
 
-    case ZYDIS_MNEMONIC_VRNDSCALEPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_roundscale_pd("));
-      break;
+  ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, "{\n  \"instructions\": ["));
 
-    case ZYDIS_MNEMONIC_VRNDSCALEPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_roundscale_ps("));
-      break;
+  for (size_t i = 0; i < pGraph->instructionCount; i++)
+  {
+    const ZydecDefUseInstruction *pInstruction = &pGraph->pInstructions[i];
+
+    ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, i == 0 ? "\n    {\"address\": \"" : ",\n    {\"address\": \""));
+    ERROR_CHECK(zydec_WriteHex(pBufferPos, pRemainingSize, virtualAddress + pInstruction->offset));
+    ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, "\", \"mnemonic\": \""));
+    ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, pInstruction->length == 0 ? "join" : (pInstruction->mnemonic == ZYDIS_MNEMONIC_INVALID ? "(invalid)" : ZydisMnemonicGetString((ZydisMnemonic)pInstruction->mnemonic))));
+    ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, "\", \"block\": "));
+    ERROR_CHECK(zydec_WriteUInt(pBufferPos, pRemainingSize, pInstruction->block));
+    ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, ", \"reads\": "));
+    ERROR_CHECK(zydec_DefUseGraph_WriteIndices(pBufferPos, pRemainingSize, pGraph->pReferences + pInstruction->firstRead, pInstruction->readCount));
+    ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, ", \"defines\": "));
+    ERROR_CHECK(zydec_DefUseGraph_WriteIndices(pBufferPos, pRemainingSize, pGraph->pReferences + pInstruction->firstDefinition, pInstruction->definitionCount));
+    ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, "}"));
+  }
 
-    case ZYDIS_MNEMONIC_VRNDSCALEPH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_roundscale_ph("));
-      break;
+  ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, "\n  ],\n  \"values\": ["));
 
-    case ZYDIS_MNEMONIC_VRNDSCALESD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_roundscale_sd("));
-      break;
+  for (size_t i = 0; i < pGraph->valueCount; i++)
+  {
+    const ZydecValue *pValue = &pGraph->pValues[i];
 
-    case ZYDIS_MNEMONIC_VRNDSCALESS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_roundscale_ss("));
-      break;
+    ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, i == 0 ? "\n    {\"location\": \"" : ",\n    {\"location\": \""));
 
-    case ZYDIS_MNEMONIC_VRNDSCALESH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_roundscale_sh("));
-      break;
+    if (pValue->location >= ZydecLinearContextRegisterCount)
+      ERROR_CHECK(zydec_DefUseGraph_WriteValue(pBufferPos, pRemainingSize, pGraph, (uint32_t)i));
+    else
+      ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, ZydisRegisterGetString((ZydisRegister)pValue->reg)));
 
-    case ZYDIS_MNEMONIC_VRSQRTPH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_rsqrt_ph("));
-      break;
+    ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, "\", \"name\": "));
 
-    case ZYDIS_MNEMONIC_VRSQRTSH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_rsqrt_sh("));
-      break;
+    if (pValue->name != 0)
+      ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, "\"") && zydec_DefUseGraph_WriteValue(pBufferPos, pRemainingSize, pGraph, (uint32_t)i) && zydec_WriteRaw(pBufferPos, pRemainingSize, "\""));
+    else
+      ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, "null"));
 
-    case ZYDIS_MNEMONIC_VRSQRT14PD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_rsqrt14_pd("));
-      break;
+    ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, ", \"kind\": \""));
+    ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, ValueKindNames[pValue->kind]));
+    ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, "\", \"instruction\": "));
 
-    case ZYDIS_MNEMONIC_VRSQRT14PS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_rsqrt14_ps("));
-      break;
+    if (pValue->instruction != ZydecValueNone)
+      ERROR_CHECK(zydec_WriteUInt(pBufferPos, pRemainingSize, pValue->instruction));
+    else
+      ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, "null"));
 
-    case ZYDIS_MNEMONIC_VRSQRT14SD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_rsqrt14_sd("));
-      break;
+    ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, ", \"inputs\": "));
+    ERROR_CHECK(zydec_DefUseGraph_WriteIndices(pBufferPos, pRemainingSize, pGraph->pReferences + pValue->firstInput, pValue->inputCount));
+    ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, ", \"uses\": "));
+    ERROR_CHECK(zydec_DefUseGraph_WriteIndices(pBufferPos, pRemainingSize, pGraph->pUses + pValue->firstUse, pValue->useCount));
+    ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, "}"));
+  }
 
-    case ZYDIS_MNEMONIC_VRSQRT14SS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_rsqrt14_ss("));
-      break;
+  ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, "\n  ]\n}\n"));
 
-    case ZYDIS_MNEMONIC_VRSQRT28PD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_rsqrt28_pd("));
-      break;
+  *pLength = (size_t)(bufferPos - buffer);
 
-    case ZYDIS_MNEMONIC_VRSQRT28PS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_rsqrt28_ps("));
-      break;
+  return true;
+}
 
-    case ZYDIS_MNEMONIC_VRSQRT28SD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_rsqrt28_sd("));
-      break;
+////////////////////////////////////////////////////////////////////////////////
 
-    case ZYDIS_MNEMONIC_VRSQRT28SS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_rsqrt28_ss("));
-      break;
+// Instructions with similar timing on all of the supported microarchitectures.
+enum ZydecInstructionClass : uint8_t
+{
+  zic_none, // fences, stores & other instructions without results that anything could wait on.
+  zic_branch, // jumps, calls & returns.
+  zic_move, // register to register moves that are eliminated at register renaming, as well as pure loads & stores.
+  zic_moveGpr, // general purpose register to register moves.
+  zic_alu,
+  zic_lea,
+  zic_leaComplex, // with base, index & displacement.
+  zic_imul,
+  zic_mulWide, // with a double width result.
+  zic_div,
+  zic_bitCount,
+  zic_transfer, // between general purpose & vector registers.
+  zic_mask, // AVX-512 mask register operations.
+  zic_vecLogic,
+  zic_vecInt,
+  zic_vecShift,
+  zic_vecIntMul,
+  zic_vecIntMul32,
+  zic_shuffle,
+  zic_shuffleLane, // crossing 128 bit lanes.
+  zic_broadcast, // only while classifying: a pure load from memory, a lane crossing shuffle otherwise.
+  zic_fpAdd,
+  zic_fpMul,
+  zic_fma,
+  zic_fpCompare,
+  zic_fpDiv,
+  zic_fpSqrt,
+  zic_convert,
+  zic_horizontal,
+  zic_gather, // in addition to the load latency.
+  zic_count,
+};
 
-    case ZYDIS_MNEMONIC_VSCALEFPD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_scalef_pd("));
-      break;
+struct ZydecInstructionClassRule
+{
+  const char *mnemonic;
+  bool isPrefix;
+  ZydecInstructionClass instructionClass;
+};
 
-    case ZYDIS_MNEMONIC_VSCALEFPS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_scalef_ps("));
-      break;
+// Checked in order, the first match wins. Vector mnemonics are matched without the `v` of their VEX / EVEX encoded form.
+static const ZydecInstructionClassRule ScalarInstructionClassRules[] = {
+  { "nop", false, zic_none }, { "endbr", true, zic_none }, { "pause", false, zic_none }, { "lfence", false, zic_none }, { "sfence", false, zic_none }, { "mfence", false, zic_none }, { "prefetch", true, zic_none }, { "push", false, zic_none },
+  { "movzx", false, zic_alu }, { "movsx", false, zic_alu }, { "movsxd", false, zic_alu }, { "movbe", false, zic_alu }, { "mov", false, zic_move }, { "pop", false, zic_move },
+  { "cmov", true, zic_alu }, { "set", true, zic_alu },
+  { "lea", false, zic_lea },
+  { "imul", false, zic_imul }, { "mul", false, zic_mulWide }, { "mulx", false, zic_mulWide }, { "pdep", false, zic_imul }, { "pext", false, zic_imul },
+  { "div", false, zic_div }, { "idiv", false, zic_div },
+  { "popcnt", false, zic_bitCount }, { "lzcnt", false, zic_bitCount }, { "tzcnt", false, zic_bitCount }, { "bsf", false, zic_bitCount }, { "bsr", false, zic_bitCount },
+  { "fadd", true, zic_fpAdd }, { "fsub", true, zic_fpAdd }, { "fmul", true, zic_fpMul }, { "fdiv", true, zic_fpDiv }, { "fsqrt", false, zic_fpSqrt },
+};
 
-    case ZYDIS_MNEMONIC_VSCALEFPH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_scalef_ph("));
-      break;
+static const ZydecInstructionClassRule VectorInstructionClassRules[] = {
+  { "zeroupper", false, zic_none }, { "zeroall", false, zic_none }, { "movnt", true, zic_none }, { "maskmov", true, zic_none }, { "scatter", true, zic_none }, { "pscatter", true, zic_none },
+  { "movaps", false, zic_move }, { "movups", false, zic_move }, { "movapd", false, zic_move }, { "movupd", false, zic_move }, { "movdq", true, zic_move }, { "movss", false, zic_move }, { "movsd", false, zic_move }, { "movd", false, zic_move }, { "movq", false, zic_move }, { "lddqu", false, zic_move },
+  { "movmsk", true, zic_transfer }, { "pmovmskb", false, zic_transfer }, { "pextr", true, zic_transfer }, { "pinsr", true, zic_transfer },
+  { "fmadd", true, zic_fma }, { "fmsub", true, zic_fma }, { "fnmadd", true, zic_fma }, { "fnmsub", true, zic_fma },
+  { "addp", true, zic_fpAdd }, { "adds", true, zic_fpAdd }, { "subp", true, zic_fpAdd }, { "subs", true, zic_fpAdd },
+  { "mulp", true, zic_fpMul }, { "muls", true, zic_fpMul }, { "rcp", true, zic_fpMul }, { "rsqrt", true, zic_fpMul },
+  { "divp", true, zic_fpDiv }, { "divs", true, zic_fpDiv }, { "sqrtp", true, zic_fpSqrt }, { "sqrts", true, zic_fpSqrt },
+  { "minp", true, zic_fpCompare }, { "mins", true, zic_fpCompare }, { "maxp", true, zic_fpCompare }, { "maxs", true, zic_fpCompare }, { "cmpp", true, zic_fpCompare }, { "cmps", true, zic_fpCompare }, { "comis", true, zic_fpCompare }, { "ucomis", true, zic_fpCompare },
+  { "hadd", true, zic_horizontal }, { "hsub", true, zic_horizontal }, { "phadd", true, zic_horizontal }, { "phsub", true, zic_horizontal }, { "dpp", true, zic_horizontal },
+  { "cvt", true, zic_convert }, { "round", true, zic_convert }, { "rndscale", true, zic_convert }, { "getexp", true, zic_convert }, { "getmant", true, zic_convert }, { "scalef", true, zic_convert },
+  { "pmulld", false, zic_vecIntMul32 }, { "pmullq", false, zic_vecIntMul32 }, { "pmul", true, zic_vecIntMul }, { "pmadd", true, zic_vecIntMul }, { "psadbw", false, zic_vecIntMul }, { "dbpsadbw", false, zic_vecIntMul }, { "mpsadbw", false, zic_vecIntMul },
+  { "and", true, zic_vecLogic }, { "or", true, zic_vecLogic }, { "xor", true, zic_vecLogic }, { "pand", true, zic_vecLogic }, { "por", true, zic_vecLogic }, { "pxor", true, zic_vecLogic }, { "pternlog", true, zic_vecLogic },
+  { "pslldq", false, zic_shuffle }, { "psrldq", false, zic_shuffle }, { "psll", true, zic_vecShift }, { "psrl", true, zic_vecShift }, { "psra", true, zic_vecShift }, { "prol", true, zic_vecShift }, { "pror", true, zic_vecShift },
+  { "permil", true, zic_shuffle }, { "perm", true, zic_shuffleLane }, { "extractps", false, zic_shuffle }, { "insertps", false, zic_shuffle }, { "extract", true, zic_shuffleLane }, { "insert", true, zic_shuffleLane },
+  { "broadcast", true, zic_broadcast }, { "pbroadcast", true, zic_broadcast },
+  { "compress", true, zic_shuffleLane }, { "pcompress", true, zic_shuffleLane }, { "expand", true, zic_shuffleLane }, { "pexpand", true, zic_shuffleLane },
+  { "gather", true, zic_gather }, { "pgather", true, zic_gather },
+  { "pmovzx", true, zic_shuffle }, { "pmovsx", true, zic_shuffle }, { "pmov", true, zic_shuffleLane },
+  { "punpck", true, zic_shuffle }, { "unpck", true, zic_shuffle }, { "pshuf", true, zic_shuffle }, { "shuf", true, zic_shuffle }, { "palignr", false, zic_shuffle }, { "align", true, zic_shuffleLane }, { "pack", true, zic_shuffle }, { "movhlps", false, zic_shuffle }, { "movlhps", false, zic_shuffle }, { "movsh", true, zic_shuffle }, { "movsl", true, zic_shuffle }, { "movddup", false, zic_shuffle },
+};
 
-    case ZYDIS_MNEMONIC_VSCALEFSD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_scalef_sd("));
-      break;
+// Latencies in cycles of every instruction class, per microarchitecture.
+static const uint8_t InstructionClassLatencies[zic_count][zma_count] = {
+  //  Skylake, Ice Lake, Zen 3, Zen 4
+  { 0, 0, 0, 0 }, // zic_none
+  { 0, 0, 0, 0 }, // zic_branch
+  { 0, 0, 0, 0 }, // zic_move
+  { 0, 1, 0, 0 }, // zic_moveGpr: move elimination is disabled on Ice Lake.
+  { 1, 1, 1, 1 }, // zic_alu
+  { 1, 1, 1, 1 }, // zic_lea
+  { 3, 1, 2, 2 }, // zic_leaComplex
+  { 3, 3, 3, 3 }, // zic_imul
+  { 4, 4, 3, 3 }, // zic_mulWide
+  { 42, 15, 19, 14 }, // zic_div: 64 bit operands.
+  { 3, 3, 1, 1 }, // zic_bitCount
+  { 2, 3, 3, 3 }, // zic_transfer
+  { 1, 1, 1, 1 }, // zic_mask
+  { 1, 1, 1, 1 }, // zic_vecLogic
+  { 1, 1, 1, 1 }, // zic_vecInt
+  { 1, 1, 1, 1 }, // zic_vecShift
+  { 5, 5, 3, 3 }, // zic_vecIntMul
+  { 10, 10, 3, 3 }, // zic_vecIntMul32
+  { 1, 1, 1, 1 }, // zic_shuffle
+  { 3, 3, 3, 4 }, // zic_shuffleLane
+  { 3, 3, 3, 4 }, // zic_broadcast
+  { 4, 4, 3, 3 }, // zic_fpAdd
+  { 4, 4, 3, 3 }, // zic_fpMul
+  { 4, 4, 4, 4 }, // zic_fma
+  { 4, 4, 1, 1 }, // zic_fpCompare
+  { 11, 11, 10, 11 }, // zic_fpDiv
+  { 12, 12, 14, 15 }, // zic_fpSqrt
+  { 4, 4, 3, 4 }, // zic_convert
+  { 6, 6, 6, 6 }, // zic_horizontal
+  { 15, 15, 20, 14 }, // zic_gather
+};
 
-    case ZYDIS_MNEMONIC_VSCALEFSS:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_scalef_ss("));
-      break;
+// Load-to-use latencies of general purpose & vector registers and the latency of forwarding a store to a load, per microarchitecture.
+static const uint8_t MemoryLatencies[zma_count][3] = {
+  { 5, 6, 5 }, // Skylake
+  { 5, 6, 5 }, // Ice Lake
+  { 4, 7, 7 }, // Zen 3
+  { 4, 7, 6 }, // Zen 4
+};
 
-    case ZYDIS_MNEMONIC_VSCALEFSH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_scalef_sh("));
-      break;
+static const char *MicroarchitectureNames[zma_count] = { "skylake", "icelake", "zen3", "zen4" };
 
-    case ZYDIS_MNEMONIC_VPXORQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_xor_epi64("));
-      break;
+// Execution ports, with bit `i` of a mask being the `i`th name of `MicroarchitecturePortNames`.
+enum ZydecPortMask : uint16_t
+{
+  zpm_none = 0,
+
+  // Skylake & Ice Lake.
+  zpm_p0 = 0x001,
+  zpm_p1 = 0x002,
+  zpm_p4 = 0x010,
+  zpm_p5 = 0x020,
+  zpm_p01 = 0x003,
+  zpm_p05 = 0x021,
+  zpm_p06 = 0x041,
+  zpm_p15 = 0x022,
+  zpm_p015 = 0x023,
+  zpm_p0156 = 0x063,
+  zpm_p23 = 0x00C,
+  zpm_p237 = 0x08C,
+  zpm_p49 = 0x210,
+  zpm_p78 = 0x180,
+
+  // Zen 3 & Zen 4.
+  zpm_alu1 = 0x002,
+  zpm_alu2 = 0x004,
+  zpm_alu03 = 0x009,
+  zpm_alu0123 = 0x00F,
+  zpm_agu01 = 0x030,
+  zpm_agu012 = 0x070,
+  zpm_fp1 = 0x100,
+  zpm_fp2 = 0x200,
+  zpm_fp01 = 0x180,
+  zpm_fp03 = 0x480,
+  zpm_fp12 = 0x300,
+  zpm_fp23 = 0x600,
+  zpm_fp0123 = 0x780,
+};
 
-    case ZYDIS_MNEMONIC_VPXORD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_xor_epi32("));
-      break;
+static const char *MicroarchitecturePortNames[zma_count][ZydecMaxPortCount] = {
+  { "p0", "p1", "p2", "p3", "p4", "p5", "p6", "p7" }, // Skylake
+  { "p0", "p1", "p2", "p3", "p4", "p5", "p6", "p7", "p8", "p9" }, // Ice Lake
+  { "alu0", "alu1", "alu2", "alu3", "agu0", "agu1", "agu2", "fp0", "fp1", "fp2", "fp3" }, // Zen 3
+  { "alu0", "alu1", "alu2", "alu3", "agu0", "agu1", "agu2", "fp0", "fp1", "fp2", "fp3" }, // Zen 4
+};
 
-    case ZYDIS_MNEMONIC_VPSHLB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_shl_epi8("));
-      break;
+static const uint8_t MicroarchitecturePortCounts[zma_count] = { 8, 10, 11, 11 };
+static const uint8_t MicroarchitectureIssueWidths[zma_count] = { 4, 5, 6, 6 };
 
-    case ZYDIS_MNEMONIC_VPSHLW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_shl_epi16("));
-      break;
+struct ZydecInstructionClassPorts
+{
+  uint8_t uopCount; // in the fused domain, without loads & stores.
+  ZydecPortUsage portUsages[2];
+};
 
-    case ZYDIS_MNEMONIC_VPSHLD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_shl_epi32("));
-      break;
+// Uops & execution ports of every instruction class with register operands, per microarchitecture.
+static const ZydecInstructionClassPorts InstructionClassPorts[zic_count][zma_count] = {
+  // Skylake, Ice Lake, Zen 3, Zen 4
+  { { 1, {} }, { 1, {} }, { 1, {} }, { 1, {} } }, // zic_none
+  { { 1, { { zpm_p06, 1 } } }, { 1, { { zpm_p06, 1 } } }, { 1, { { zpm_alu03, 1 } } }, { 1, { { zpm_alu03, 1 } } } }, // zic_branch
+  { { 1, {} }, { 1, {} }, { 1, {} }, { 1, {} } }, // zic_move
+  { { 1, {} }, { 1, { { zpm_p0156, 1 } } }, { 1, {} }, { 1, {} } }, // zic_moveGpr
+  { { 1, { { zpm_p0156, 1 } } }, { 1, { { zpm_p0156, 1 } } }, { 1, { { zpm_alu0123, 1 } } }, { 1, { { zpm_alu0123, 1 } } } }, // zic_alu
+  { { 1, { { zpm_p15, 1 } } }, { 1, { { zpm_p0156, 1 } } }, { 1, { { zpm_alu0123, 1 } } }, { 1, { { zpm_alu0123, 1 } } } }, // zic_lea
+  { { 1, { { zpm_p1, 1 } } }, { 1, { { zpm_p1, 1 } } }, { 1, { { zpm_alu0123, 1 } } }, { 1, { { zpm_alu0123, 1 } } } }, // zic_leaComplex
+  { { 1, { { zpm_p1, 1 } } }, { 1, { { zpm_p1, 1 } } }, { 1, { { zpm_alu1, 1 } } }, { 1, { { zpm_alu1, 1 } } } }, // zic_imul
+  { { 2, { { zpm_p1, 1 }, { zpm_p5, 1 } } }, { 2, { { zpm_p1, 1 }, { zpm_p5, 1 } } }, { 2, { { zpm_alu1, 2 } } }, { 2, { { zpm_alu1, 2 } } } }, // zic_mulWide
+  { { 36, { { zpm_p0, 24 }, { zpm_p0156, 30 } } }, { 4, { { zpm_p0, 10 } } }, { 2, { { zpm_alu2, 7 } } }, { 2, { { zpm_alu2, 7 } } } }, // zic_div: 64 bit operands, microcoded on Skylake.
+  { { 1, { { zpm_p1, 1 } } }, { 1, { { zpm_p1, 1 } } }, { 1, { { zpm_alu0123, 1 } } }, { 1, { { zpm_alu0123, 1 } } } }, // zic_bitCount
+  { { 1, { { zpm_p05, 1 } } }, { 1, { { zpm_p05, 1 } } }, { 1, { { zpm_fp2, 1 } } }, { 1, { { zpm_fp2, 1 } } } }, // zic_transfer
+  { { 1, { { zpm_p05, 1 } } }, { 1, { { zpm_p05, 1 } } }, { 1, { { zpm_fp01, 1 } } }, { 1, { { zpm_fp01, 1 } } } }, // zic_mask
+  { { 1, { { zpm_p015, 1 } } }, { 1, { { zpm_p015, 1 } } }, { 1, { { zpm_fp0123, 1 } } }, { 1, { { zpm_fp0123, 1 } } } }, // zic_vecLogic
+  { { 1, { { zpm_p015, 1 } } }, { 1, { { zpm_p015, 1 } } }, { 1, { { zpm_fp0123, 1 } } }, { 1, { { zpm_fp0123, 1 } } } }, // zic_vecInt
+  { { 1, { { zpm_p01, 1 } } }, { 1, { { zpm_p01, 1 } } }, { 1, { { zpm_fp12, 1 } } }, { 1, { { zpm_fp12, 1 } } } }, // zic_vecShift
+  { { 1, { { zpm_p01, 1 } } }, { 1, { { zpm_p01, 1 } } }, { 1, { { zpm_fp03, 1 } } }, { 1, { { zpm_fp03, 1 } } } }, // zic_vecIntMul
+  { { 2, { { zpm_p01, 2 } } }, { 2, { { zpm_p01, 2 } } }, { 1, { { zpm_fp03, 1 } } }, { 1, { { zpm_fp03, 1 } } } }, // zic_vecIntMul32
+  { { 1, { { zpm_p5, 1 } } }, { 1, { { zpm_p15, 1 } } }, { 1, { { zpm_fp12, 1 } } }, { 1, { { zpm_fp12, 1 } } } }, // zic_shuffle
+  { { 1, { { zpm_p5, 1 } } }, { 1, { { zpm_p5, 1 } } }, { 1, { { zpm_fp12, 1 } } }, { 1, { { zpm_fp12, 1 } } } }, // zic_shuffleLane
+  { { 1, { { zpm_p5, 1 } } }, { 1, { { zpm_p5, 1 } } }, { 1, { { zpm_fp12, 1 } } }, { 1, { { zpm_fp12, 1 } } } }, // zic_broadcast
+  { { 1, { { zpm_p01, 1 } } }, { 1, { { zpm_p01, 1 } } }, { 1, { { zpm_fp23, 1 } } }, { 1, { { zpm_fp23, 1 } } } }, // zic_fpAdd
+  { { 1, { { zpm_p01, 1 } } }, { 1, { { zpm_p01, 1 } } }, { 1, { { zpm_fp01, 1 } } }, { 1, { { zpm_fp01, 1 } } } }, // zic_fpMul
+  { { 1, { { zpm_p01, 1 } } }, { 1, { { zpm_p01, 1 } } }, { 1, { { zpm_fp01, 1 } } }, { 1, { { zpm_fp01, 1 } } } }, // zic_fma
+  { { 1, { { zpm_p01, 1 } } }, { 1, { { zpm_p01, 1 } } }, { 1, { { zpm_fp01, 1 } } }, { 1, { { zpm_fp01, 1 } } } }, // zic_fpCompare
+  { { 1, { { zpm_p0, 4 } } }, { 1, { { zpm_p0, 4 } } }, { 1, { { zpm_fp1, 4 } } }, { 1, { { zpm_fp1, 4 } } } }, // zic_fpDiv: 256 bit operands.
+  { { 1, { { zpm_p0, 6 } } }, { 1, { { zpm_p0, 6 } } }, { 1, { { zpm_fp1, 6 } } }, { 1, { { zpm_fp1, 6 } } } }, // zic_fpSqrt
+  { { 1, { { zpm_p01, 1 } } }, { 1, { { zpm_p01, 1 } } }, { 1, { { zpm_fp23, 1 } } }, { 1, { { zpm_fp23, 1 } } } }, // zic_convert
+  { { 3, { { zpm_p5, 2 }, { zpm_p01, 1 } } }, { 3, { { zpm_p5, 2 }, { zpm_p01, 1 } } }, { 3, { { zpm_fp12, 2 }, { zpm_fp23, 1 } } }, { 3, { { zpm_fp12, 2 }, { zpm_fp23, 1 } } } }, // zic_horizontal
+  { { 4, { { zpm_p0, 1 }, { zpm_p5, 1 } } }, { 4, { { zpm_p0, 1 }, { zpm_p5, 1 } } }, { 8, { { zpm_fp0123, 4 } } }, { 4, { { zpm_fp0123, 2 } } } }, // zic_gather: in addition to a load per element.
+};
 
-    case ZYDIS_MNEMONIC_VPSHLQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_shl_epi64("));
-      break;
-      
-    case ZYDIS_MNEMONIC_VPSHLDW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_shldi_epi16("));
-      break;
+// Ports of loads, store addresses & store data, per microarchitecture. Zen stores their data without an additional uop.
+static const uint16_t MemoryPorts[zma_count][3] = {
+  { zpm_p23, zpm_p237, zpm_p4 }, // Skylake
+  { zpm_p23, zpm_p78, zpm_p49 }, // Ice Lake
+  { zpm_agu012, zpm_agu01, zpm_none }, // Zen 3
+  { zpm_agu012, zpm_agu01, zpm_none }, // Zen 4
+};
 
-    case ZYDIS_MNEMONIC_VPSHLDD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_shldi_epi32("));
-      break;
+const char * zydec_Microarchitecture_GetName(const ZydecMicroarchitecture microarchitecture)
+{
+  return microarchitecture < zma_count ? MicroarchitectureNames[microarchitecture] : nullptr;
+}
 
-    case ZYDIS_MNEMONIC_VPSHLDQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_shldi_epi64("));
-      break;
+size_t zydec_Microarchitecture_GetPortCount(const ZydecMicroarchitecture microarchitecture)
+{
+  return microarchitecture < zma_count ? MicroarchitecturePortCounts[microarchitecture] : 0;
+}
 
-    case ZYDIS_MNEMONIC_VPSHLDVW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_shldv_epi16("));
-      break;
+const char * zydec_Microarchitecture_GetPortName(const ZydecMicroarchitecture microarchitecture, const size_t port)
+{
+  return (microarchitecture < zma_count && port < MicroarchitecturePortCounts[microarchitecture]) ? MicroarchitecturePortNames[microarchitecture][port] : nullptr;
+}
 
-    case ZYDIS_MNEMONIC_VPSHLDVD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_shldv_epi32("));
-      break;
+size_t zydec_Microarchitecture_GetIssueWidth(const ZydecMicroarchitecture microarchitecture)
+{
+  return microarchitecture < zma_count ? MicroarchitectureIssueWidths[microarchitecture] : 0;
+}
 
-    case ZYDIS_MNEMONIC_VPSHLDVQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_shldv_epi64("));
-      break;
+bool zydec_Microarchitecture_FromName(const char *name, ZydecMicroarchitecture *pMicroarchitecture)
+{
+  if (name == nullptr || pMicroarchitecture == nullptr)
+    return false;
 
-    case ZYDIS_MNEMONIC_VPSHRDW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_shrdi_epi16("));
-      break;
+  for (size_t i = 0; i < zma_count; i++)
+  {
+    if (strcmp(name, MicroarchitectureNames[i]) == 0)
+    {
+      *pMicroarchitecture = (ZydecMicroarchitecture)i;
+      return true;
+    }
+  }
 
-    case ZYDIS_MNEMONIC_VPSHRDD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_shrdi_epi32("));
-      break;
+  return false;
+}
 
-    case ZYDIS_MNEMONIC_VPSHRDQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_shrdi_epi64("));
-      break;
+inline bool zydec_IsVectorRegister(const ZydisRegister reg)
+{
+  return (reg >= ZYDIS_REGISTER_XMM0 && reg <= ZYDIS_REGISTER_ZMM31) || (reg >= ZYDIS_REGISTER_MM0 && reg <= ZYDIS_REGISTER_MM7);
+}
 
-    case ZYDIS_MNEMONIC_VPSHRDVW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_shrdv_epi16("));
-      break;
-      
-    case ZYDIS_MNEMONIC_VPSHRDVD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_shrdv_epi32("));
-      break;
+ZydecInstructionClass zydec_ClassifyInstruction(const ZydisDecodedInstruction *pInstruction, const ZydisDecodedOperand *pOperands, bool *pIsVector, bool *pReadsMemory)
+{
+  bool isVector = false;
+  bool readsMemory = false;
+  bool hasMemory = false;
 
-    case ZYDIS_MNEMONIC_VPSHRDVQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_shrdv_epi64("));
-      break;
-      
-    case ZYDIS_MNEMONIC_VSHUFF32X4:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_shuffle_f32x4("));
-      break;
+  for (size_t i = 0; i < pInstruction->operand_count; i++)
+  {
+    if (pOperands[i].type == ZYDIS_OPERAND_TYPE_REGISTER)
+    {
+      isVector |= (pOperands[i].visibility != ZYDIS_OPERAND_VISIBILITY_HIDDEN && zydec_IsVectorRegister(pOperands[i].reg.value));
+    }
+    else if (pOperands[i].type == ZYDIS_OPERAND_TYPE_MEMORY && (pOperands[i].mem.type == ZYDIS_MEMOP_TYPE_MEM || pOperands[i].mem.type == ZYDIS_MEMOP_TYPE_VSIB))
+    {
+      hasMemory = true;
+      readsMemory |= (pOperands[i].actions & ZYDIS_OPERAND_ACTION_MASK_READ) != 0;
+    }
+  }
 
-    case ZYDIS_MNEMONIC_VSHUFF64X2:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_shuffle_f64x2("));
-      break;
+  *pIsVector = isVector;
+  *pReadsMemory = readsMemory;
 
-    case ZYDIS_MNEMONIC_VSHUFI32X4:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_shuffle_i32x4("));
-      break;
+  switch (pInstruction->meta.category)
+  {
+  case ZYDIS_CATEGORY_COND_BR:
+  case ZYDIS_CATEGORY_UNCOND_BR:
+  case ZYDIS_CATEGORY_CALL:
+  case ZYDIS_CATEGORY_RET:
+    return zic_branch;
 
-    case ZYDIS_MNEMONIC_VSHUFI64X2:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_shuffle_i64x2("));
-      break;
+  default:
+    break;
+  }
 
-    case ZYDIS_MNEMONIC_VPSLLVW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_sllv_epi16("));
-      break;
+  const char *mnemonic = ZydisMnemonicGetString(pInstruction->mnemonic);
 
-    case ZYDIS_MNEMONIC_VSQRTPH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_sqrt_ph("));
-      break;
+  if (mnemonic == nullptr)
+    return zic_alu;
 
-    case ZYDIS_MNEMONIC_VSQRTSH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_sqrt_sh("));
-      break;
+  if (mnemonic[0] == 'k' && (pInstruction->encoding == ZYDIS_INSTRUCTION_ENCODING_VEX))
+    return zic_mask;
 
-    case ZYDIS_MNEMONIC_VPSUBUSB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_subs_epu8("));
-      break;
+  const ZydecInstructionClassRule *pRules = ScalarInstructionClassRules;
+  size_t ruleCount = sizeof(ScalarInstructionClassRules) / sizeof(ScalarInstructionClassRules[0]);
+  ZydecInstructionClass instructionClass = zic_alu;
 
-    case ZYDIS_MNEMONIC_VPSUBUSW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_subs_epu16("));
-      break;
+  if (isVector)
+  {
+    if (mnemonic[0] == 'v' && (pInstruction->encoding == ZYDIS_INSTRUCTION_ENCODING_VEX || pInstruction->encoding == ZYDIS_INSTRUCTION_ENCODING_EVEX))
+      mnemonic++;
 
-    case ZYDIS_MNEMONIC_VPTERNLOGD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_ternarylogic_epi32("));
-      break;
+    pRules = VectorInstructionClassRules;
+    ruleCount = sizeof(VectorInstructionClassRules) / sizeof(VectorInstructionClassRules[0]);
+    instructionClass = zic_vecInt;
+  }
 
-    case ZYDIS_MNEMONIC_VPTERNLOGQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_ternarylogic_epi64("));
-      break;
-      
-    case ZYDIS_MNEMONIC_VPTESTMB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_test_epi8_mask("));
+  for (size_t i = 0; i < ruleCount; i++)
+  {
+    if (pRules[i].isPrefix ? strncmp(mnemonic, pRules[i].mnemonic, strlen(pRules[i].mnemonic)) == 0 : strcmp(mnemonic, pRules[i].mnemonic) == 0)
+    {
+      instructionClass = pRules[i].instructionClass;
       break;
+    }
+  }
 
-    case ZYDIS_MNEMONIC_VPTESTMW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_test_epi16_mask("));
-      break;
+  switch (instructionClass)
+  {
+  case zic_move:
+  {
+    // EVEX encoded moves carry their writemask right after the destination.
+    const ZydisDecodedOperand *pSource = nullptr;
+    bool isMasked = false;
 
-    case ZYDIS_MNEMONIC_VPTESTMD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_test_epi32_mask("));
-      break;
+    for (size_t i = 1; i < pInstruction->operand_count_visible; i++)
+    {
+      if (pOperands[i].encoding != ZYDIS_OPERAND_ENCODING_MASK)
+      {
+        pSource = &pOperands[i];
+        break;
+      }
 
-    case ZYDIS_MNEMONIC_VPTESTMQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_test_epi64_mask("));
-      break;
-      
-    case ZYDIS_MNEMONIC_VPTESTNMB:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_testn_epi8_mask("));
-      break;
+      isMasked |= (pOperands[i].type == ZYDIS_OPERAND_TYPE_REGISTER && pOperands[i].reg.value != ZYDIS_REGISTER_K0);
+    }
 
-    case ZYDIS_MNEMONIC_VPTESTNMW:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_testn_epi16_mask("));
-      break;
+    if (!hasMemory && pSource != nullptr && pSource->type == ZYDIS_OPERAND_TYPE_IMMEDIATE)
+      return zic_alu;
 
-    case ZYDIS_MNEMONIC_VPTESTNMD:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_testn_epi32_mask("));
-      break;
+    if (hasMemory || pSource == nullptr || pSource->type != ZYDIS_OPERAND_TYPE_REGISTER)
+      return zic_move;
 
-    case ZYDIS_MNEMONIC_VPTESTNMQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_testn_epi64_mask("));
-      break;
+    const bool isVectorDestination = zydec_IsVectorRegister(pOperands[0].reg.value);
+    const bool isVectorSource = zydec_IsVectorRegister(pSource->reg.value);
 
-    case ZYDIS_MNEMONIC_VUCOMISH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_ucomi_sh("));
-      break;
+    if (isVectorDestination != isVectorSource)
+      return zic_transfer;
+    else if (!isVectorDestination)
+      return zic_moveGpr;
+    else if (pInstruction->mnemonic == ZYDIS_MNEMONIC_MOVSS || pInstruction->mnemonic == ZYDIS_MNEMONIC_MOVSD || pInstruction->mnemonic == ZYDIS_MNEMONIC_VMOVSS || pInstruction->mnemonic == ZYDIS_MNEMONIC_VMOVSD)
+      return zic_shuffle; // merges the low element into the destination.
+    else if (isMasked)
+      return zic_vecLogic; // blends into the destination rather than being eliminated.
+    else
+      return zic_move;
+  }
 
-    default:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "_mm_??_("));
-      break;
-    }
+  case zic_broadcast:
+    return hasMemory ? zic_move : zic_shuffleLane;
 
-    const size_t startOperandIndex = pInstruction->operand_count <= 1 || (pInstruction->operand_count == 2 && maySelfReference) ? 0 : 1;
+  case zic_lea:
+  {
+    const ZydisDecodedOperand *pAddress = &pOperands[1];
+    return (pAddress->mem.base != ZYDIS_REGISTER_NONE && pAddress->mem.index != ZYDIS_REGISTER_NONE && pAddress->mem.disp.value != 0) ? zic_leaComplex : zic_lea;
+  }
 
-    for (size_t operandIndex = startOperandIndex; operandIndex < pInstruction->operand_count; operandIndex++)
-    {
-      if (operandIndex > startOperandIndex)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, ", "));
+  case zic_imul:
+    return pInstruction->operand_count_visible == 1 ? zic_mulWide : zic_imul;
 
-      ERROR_CHECK(zydec_WriteOperand(&bufferPos, &remainingSize, &pOperands[operandIndex], virtualAddress, pInfo, !addressParam));
-    }
+  default:
+    return instructionClass;
+  }
+}
 
-    switch (pInstruction->mnemonic)
-    {
-    case ZYDIS_MNEMONIC_PSLLDQ:
-    case ZYDIS_MNEMONIC_VPSLLDQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " * 8); // byte shift left in 128 bit lanes"));
-      return true;
+void zydec_Microarchitecture_GetInstructionTiming(const ZydecMicroarchitecture microarchitecture, const ZydisDecodedInstruction *pInstruction, const ZydisDecodedOperand *pOperands, ZydecInstructionTiming *pTiming)
+{
+  bool isVector = false;
+  bool readsMemory = false;
+  const ZydecInstructionClass instructionClass = zydec_ClassifyInstruction(pInstruction, pOperands, &isVector, &readsMemory);
+  const size_t index = microarchitecture < zma_count ? microarchitecture : zma_skylake;
 
-    case ZYDIS_MNEMONIC_PSRLDQ:
-    case ZYDIS_MNEMONIC_VPSRLDQ:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, " * 8); // byte shift right in 128 bit lanes"));
-      return true;
+  pTiming->latency = InstructionClassLatencies[instructionClass][index];
+  pTiming->loadLatency = readsMemory ? MemoryLatencies[index][isVector ? 1 : 0] : 0;
+  pTiming->storeForwardingLatency = MemoryLatencies[index][2];
 
-    case ZYDIS_MNEMONIC_VPCOMPRESSB:
-    case ZYDIS_MNEMONIC_VPCOMPRESSW:
-    case ZYDIS_MNEMONIC_VPCOMPRESSD:
-    case ZYDIS_MNEMONIC_VPCOMPRESSQ:
-    case ZYDIS_MNEMONIC_VCOMPRESSPD:
-    case ZYDIS_MNEMONIC_VCOMPRESSPS:
-    case ZYDIS_MNEMONIC_VPMOVQB:
-    case ZYDIS_MNEMONIC_VPMOVDB:
-    case ZYDIS_MNEMONIC_VPMOVWB:
-    case ZYDIS_MNEMONIC_VPMOVQW:
-    case ZYDIS_MNEMONIC_VPMOVDW:
-    case ZYDIS_MNEMONIC_VPMOVQD:
-    case ZYDIS_MNEMONIC_VPMOVSWB:
-    case ZYDIS_MNEMONIC_VPMOVSDB:
-    case ZYDIS_MNEMONIC_VPMOVSQB:
-    case ZYDIS_MNEMONIC_VPMOVSDW:
-    case ZYDIS_MNEMONIC_VPMOVSQW:
-    case ZYDIS_MNEMONIC_VPMOVSQD:
-      if (pOperands[0].type == ZYDIS_OPERAND_TYPE_MEMORY || pOperands[0].type == ZYDIS_OPERAND_TYPE_POINTER)
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "); // with unaligned store"));
-      else
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, ");"));
-      return true;
+  const ZydecInstructionClassPorts *pPorts = &InstructionClassPorts[instructionClass][index];
+  const bool isZeroIdiom = zydec_DefUse_IsZeroIdiom(pInstruction, pOperands);
+  bool is512Bit = false;
 
-    case ZYDIS_MNEMONIC_VPEXPANDB:
-    case ZYDIS_MNEMONIC_VPEXPANDW:
-    case ZYDIS_MNEMONIC_VPEXPANDD:
-    case ZYDIS_MNEMONIC_VPEXPANDQ:
-      if (pInstruction->operand_count > 0 && (pOperands[pInstruction->operand_count - 1].type == ZYDIS_OPERAND_TYPE_MEMORY || pOperands[pInstruction->operand_count - 1].type == ZYDIS_OPERAND_TYPE_POINTER))
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "); // with unaligned load"));
-      else
-        ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, ");"));
-      return true;
+  for (size_t i = 0; i < pInstruction->operand_count; i++)
+    is512Bit |= (pOperands[i].type == ZYDIS_OPERAND_TYPE_REGISTER && pOperands[i].reg.value >= ZYDIS_REGISTER_ZMM0 && pOperands[i].reg.value <= ZYDIS_REGISTER_ZMM31);
 
-    case ZYDIS_MNEMONIC_VFMADD132PD:
-    case ZYDIS_MNEMONIC_VFMADD132PS:
-    case ZYDIS_MNEMONIC_VFMADD132SD:
-    case ZYDIS_MNEMONIC_VFMADD132SS:
-    case ZYDIS_MNEMONIC_VFMADDSUB132PD:
-    case ZYDIS_MNEMONIC_VFMADDSUB132PS:
-    case ZYDIS_MNEMONIC_VFMSUB132PD:
-    case ZYDIS_MNEMONIC_VFMSUB132PS:
-    case ZYDIS_MNEMONIC_VFMSUB132SD:
-    case ZYDIS_MNEMONIC_VFMSUB132SS:
-    case ZYDIS_MNEMONIC_VFMSUBADD132PD:
-    case ZYDIS_MNEMONIC_VFMSUBADD132PS:
-    case ZYDIS_MNEMONIC_VFNMADD132PD:
-    case ZYDIS_MNEMONIC_VFNMADD132PS:
-    case ZYDIS_MNEMONIC_VFNMADD132SD:
-    case ZYDIS_MNEMONIC_VFNMADD132SS:
-    case ZYDIS_MNEMONIC_VFNMSUB132PD:
-    case ZYDIS_MNEMONIC_VFNMSUB132PS:
-    case ZYDIS_MNEMONIC_VFNMSUB132SD:
-    case ZYDIS_MNEMONIC_VFNMSUB132SS:
-    case ZYDIS_MNEMONIC_VFMADD132PH:
-    case ZYDIS_MNEMONIC_VFMADD132SH:
-    case ZYDIS_MNEMONIC_VFMADDSUB132PH:
-    case ZYDIS_MNEMONIC_VFMSUB132PH:
-    case ZYDIS_MNEMONIC_VFMSUB132SH:
-    case ZYDIS_MNEMONIC_VFMSUBADD132PH:
-    case ZYDIS_MNEMONIC_VFNMADD132PH:
-    case ZYDIS_MNEMONIC_VFNMADD132SH:
-    case ZYDIS_MNEMONIC_VFNMSUB132PH:
-    case ZYDIS_MNEMONIC_VFNMSUB132SH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "); // part 1 / 3"));
-      return true;
+  pTiming->uopCount = pPorts->uopCount;
+  pTiming->portUsageCount = 0;
 
-    case ZYDIS_MNEMONIC_VFMADD213PD:
-    case ZYDIS_MNEMONIC_VFMADD213PS:
-    case ZYDIS_MNEMONIC_VFMADD213SD:
-    case ZYDIS_MNEMONIC_VFMADD213SS:
-    case ZYDIS_MNEMONIC_VFMADDSUB213PD:
-    case ZYDIS_MNEMONIC_VFMADDSUB213PS:
-    case ZYDIS_MNEMONIC_VFMSUB213PD:
-    case ZYDIS_MNEMONIC_VFMSUB213PS:
-    case ZYDIS_MNEMONIC_VFMSUB213SD:
-    case ZYDIS_MNEMONIC_VFMSUB213SS:
-    case ZYDIS_MNEMONIC_VFMSUBADD213PD:
-    case ZYDIS_MNEMONIC_VFMSUBADD213PS:
-    case ZYDIS_MNEMONIC_VFNMADD213PD:
-    case ZYDIS_MNEMONIC_VFNMADD213PS:
-    case ZYDIS_MNEMONIC_VFNMADD213SD:
-    case ZYDIS_MNEMONIC_VFNMADD213SS:
-    case ZYDIS_MNEMONIC_VFNMSUB213PD:
-    case ZYDIS_MNEMONIC_VFNMSUB213PS:
-    case ZYDIS_MNEMONIC_VFNMSUB213SD:
-    case ZYDIS_MNEMONIC_VFNMSUB213SS:
-    case ZYDIS_MNEMONIC_VFMADD213PH:
-    case ZYDIS_MNEMONIC_VFMADD213SH:
-    case ZYDIS_MNEMONIC_VFMADDSUB213PH:
-    case ZYDIS_MNEMONIC_VFMSUB213PH:
-    case ZYDIS_MNEMONIC_VFMSUB213SH:
-    case ZYDIS_MNEMONIC_VFMSUBADD213PH:
-    case ZYDIS_MNEMONIC_VFNMADD213PH:
-    case ZYDIS_MNEMONIC_VFNMADD213SH:
-    case ZYDIS_MNEMONIC_VFNMSUB213PH:
-    case ZYDIS_MNEMONIC_VFNMSUB213SH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "); // part 2 / 3"));
-      return true;
+  for (size_t i = 0; i < 2 && !isZeroIdiom; i++)
+  {
+    ZydecPortUsage usage = pPorts->portUsages[i];
 
-    case ZYDIS_MNEMONIC_VFMADD231PD:
-    case ZYDIS_MNEMONIC_VFMADD231PS:
-    case ZYDIS_MNEMONIC_VFMADD231SD:
-    case ZYDIS_MNEMONIC_VFMADD231SS:
-    case ZYDIS_MNEMONIC_VFMADDSUB231PD:
-    case ZYDIS_MNEMONIC_VFMADDSUB231PS:
-    case ZYDIS_MNEMONIC_VFMSUB231PD:
-    case ZYDIS_MNEMONIC_VFMSUB231PS:
-    case ZYDIS_MNEMONIC_VFMSUB231SD:
-    case ZYDIS_MNEMONIC_VFMSUB231SS:
-    case ZYDIS_MNEMONIC_VFMSUBADD231PD:
-    case ZYDIS_MNEMONIC_VFMSUBADD231PS:
-    case ZYDIS_MNEMONIC_VFNMADD231PD:
-    case ZYDIS_MNEMONIC_VFNMADD231PS:
-    case ZYDIS_MNEMONIC_VFNMADD231SD:
-    case ZYDIS_MNEMONIC_VFNMADD231SS:
-    case ZYDIS_MNEMONIC_VFNMSUB231PD:
-    case ZYDIS_MNEMONIC_VFNMSUB231PS:
-    case ZYDIS_MNEMONIC_VFNMSUB231SD:
-    case ZYDIS_MNEMONIC_VFNMSUB231SS:
-    case ZYDIS_MNEMONIC_VFMADD231PH:
-    case ZYDIS_MNEMONIC_VFMADD231SH:
-    case ZYDIS_MNEMONIC_VFMADDSUB231PH:
-    case ZYDIS_MNEMONIC_VFMSUB231PH:
-    case ZYDIS_MNEMONIC_VFMSUB231SH:
-    case ZYDIS_MNEMONIC_VFMSUBADD231PH:
-    case ZYDIS_MNEMONIC_VFNMADD231PH:
-    case ZYDIS_MNEMONIC_VFNMADD231SH:
-    case ZYDIS_MNEMONIC_VFNMSUB231PH:
-    case ZYDIS_MNEMONIC_VFNMSUB231SH:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, "); // part 3 / 3"));
-      return true;
+    if (usage.ports == zpm_none)
+      continue;
 
-    default:
-      ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, ")"));
-      break;
+    if (isVector && is512Bit)
+    {
+      if (index == zma_skylake || index == zma_iceLake)
+      {
+        // The vector units of port 1 are fused with the ones of port 0 for 512 bit uops.
+        if (usage.ports & zpm_p1)
+          usage.ports = (uint16_t)((usage.ports & ~zpm_p1) | zpm_p5);
+      }
+      else if (index == zma_zen4)
+      {
+        // 512 bit uops occupy the 256 bit units twice.
+        usage.cycles *= 2;
+      }
     }
 
-    break;
+    pTiming->portUsages[pTiming->portUsageCount++] = usage;
   }
 
-  default:
-    *pHasTranslation = false;
-    return false;
-  }
+  const bool hasComputation = pTiming->portUsageCount > 0;
+
+  for (size_t i = 0; i < pInstruction->operand_count; i++)
+  {
+    if (pOperands[i].type != ZYDIS_OPERAND_TYPE_MEMORY || (pOperands[i].mem.type != ZYDIS_MEMOP_TYPE_MEM && pOperands[i].mem.type != ZYDIS_MEMOP_TYPE_VSIB))
+      continue;
+
+    if ((pOperands[i].actions & ZYDIS_OPERAND_ACTION_MASK_READ) != 0 && pTiming->portUsageCount < 4)
+    {
+      uint8_t loadCount = 1;
 
-  ERROR_CHECK(zydec_WriteRaw(&bufferPos, &remainingSize, ";"));
+      if (instructionClass == zic_gather && pOperands[0].element_size != 0)
+        loadCount = (uint8_t)(pOperands[0].size / pOperands[0].element_size);
 
-  return true;
+      pTiming->portUsages[pTiming->portUsageCount++] = { MemoryPorts[index][0], loadCount };
+    }
+
+    if ((pOperands[i].actions & ZYDIS_OPERAND_ACTION_MASK_WRITE) != 0)
+    {
+      if (pTiming->portUsageCount < 4)
+        pTiming->portUsages[pTiming->portUsageCount++] = { MemoryPorts[index][1], 1 };
+
+      if (MemoryPorts[index][2] != zpm_none && pTiming->portUsageCount < 4)
+        pTiming->portUsages[pTiming->portUsageCount++] = { MemoryPorts[index][2], 1 };
+
+      // Loads are micro-fused with the computation, stores are a separate fused domain uop.
+      if (hasComputation)
+        pTiming->uopCount++;
+    }
+  }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 
-struct ZydecLinearContextFormatInfo
+// What the critical path needs to know about an instruction of the loop.
+struct ZydecCriticalPathMember
 {
-  ZydecLinearContext *pContext = nullptr;
-  ZydecFormattingInfo *pOriginalInfo = nullptr;
-  size_t assignedRegisterCount = 0;
-  ZydisRegister assignedRegister[8];
-  uint32_t assignedRegisterValue[8];
-
-  ZydisRegister regHint = ZYDIS_REGISTER_NONE;
-  ZydecFormattingInfo::HintOperation opHint = ZydecFormattingInfo::None;
+  uint32_t instruction; // index into `ZydecDefUseGraph::pInstructions`.
+  uint16_t latency;
+  uint16_t loadLatency;
+  uint16_t storeForwardingLatency;
+  uint32_t addressLocations[4]; // of the base & index registers of memory operands, `ZydecLinearContextRegisterCount` if unused.
+};
 
-  bool hasValHint = false;
-  int64_t valHint = 0;
+struct ZydecCriticalPathBlock
+{
+  uint32_t rank; // in the reverse post-order of the control flow graph.
+  uint32_t block;
 };
 
-void zydec_LinearContext_AfterCall(void *pUserData)
+static int zydec_CriticalPath_CompareBlocks(const void *pA, const void *pB)
 {
-  ZydecLinearContextFormatInfo *pInfo = static_cast<ZydecLinearContextFormatInfo *>(pUserData);
+  const ZydecCriticalPathBlock *pBlockA = static_cast<const ZydecCriticalPathBlock *>(pA);
+  const ZydecCriticalPathBlock *pBlockB = static_cast<const ZydecCriticalPathBlock *>(pB);
 
-  switch (pInfo->pOriginalInfo->afterCallRegisterRetentionMode)
-  {
-  case ZydecFormattingInfo::AfterCallRegisterRetentionMode::Windows:
+  return pBlockA->rank < pBlockB->rank ? -1 : (pBlockA->rank > pBlockB->rank ? 1 : 0);
+}
+
+// Latency the member adds to a chain reading `pValue`.
+inline uint32_t zydec_CriticalPath_GetLatency(const ZydecCriticalPathMember *pMember, const ZydecValue *pValue)
+{
+  if (pValue->location >= ZydecLinearContextRegisterCount)
+    return (uint32_t)pMember->storeForwardingLatency + pMember->latency;
+
+  for (size_t i = 0; i < 4; i++)
+    if (pMember->addressLocations[i] == pValue->location)
+      return (uint32_t)pMember->loadLatency + pMember->latency;
+
+  return pMember->latency;
+}
+
+bool zydec_CriticalPath_Find(ZydecCriticalPath *pPath, const ZydecDefUseGraph *pDefUse, const ZydecControlFlowGraph *pControlFlow, const ZydecLoopForest *pForest, const size_t loopIndex, const ZydecMicroarchitecture microarchitecture, const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t codeSize)
+{
+  if (pPath == nullptr || pDefUse == nullptr || pDefUse->pInstructions == nullptr || pDefUse->pValues == nullptr || pControlFlow == nullptr || pControlFlow->pOrder == nullptr || pForest == nullptr || loopIndex >= pForest->loopCount || pDecoder == nullptr || pCode == nullptr)
+    return false;
+
+  const ZydecLoop *pLoop = &pForest->pLoops[loopIndex];
+  const size_t blockCount = pControlFlow->blockCount;
+
+  uint32_t *pBlockInstructions = static_cast<uint32_t *>(malloc(blockCount * 2 * sizeof(uint32_t))); // index of the first instruction of every block, followed by the instruction count.
+  uint32_t *pRanks = static_cast<uint32_t *>(malloc(blockCount * sizeof(uint32_t)));
+  ZydecCriticalPathBlock *pBlocks = static_cast<ZydecCriticalPathBlock *>(malloc(pLoop->blockCount * sizeof(ZydecCriticalPathBlock)));
+  ZydecCriticalPathMember *pMembers = static_cast<ZydecCriticalPathMember *>(malloc(pDefUse->instructionCount * sizeof(ZydecCriticalPathMember)));
+  int64_t *pDistances = static_cast<int64_t *>(malloc(pDefUse->valueCount * sizeof(int64_t))); // longest chain from the join to every value, -1 if it doesn't depend on the join.
+  uint32_t *pFrom = static_cast<uint32_t *>(malloc(pDefUse->valueCount * sizeof(uint32_t))); // value that the longest chain to every value came from.
+  uint32_t *pLatencies = static_cast<uint32_t *>(malloc(pDefUse->valueCount * sizeof(uint32_t)));
+
+  bool success = (pBlockInstructions != nullptr && pRanks != nullptr && pBlocks != nullptr && pMembers != nullptr && pDistances != nullptr && pFrom != nullptr && pLatencies != nullptr);
+
+  size_t memberCount = 0;
+  size_t linkCount = 0;
+  uint32_t bestJoin = ZydecValueNone;
+  int64_t bestCycles = 0;
+
+  if (success)
   {
-    for (size_t i = 0; i < ZYDIS_REGISTER_MAX_VALUE; i++)
+    for (size_t i = 0; i < blockCount * 2; i++)
+      pBlockInstructions[i] = 0;
+
+    for (size_t i = pDefUse->instructionCount; i > 0; i--)
     {
-      switch (i)
-      {
-      case ZYDIS_REGISTER_RBX:
-      case ZYDIS_REGISTER_RBP:
-      case ZYDIS_REGISTER_RDI:
-      case ZYDIS_REGISTER_RSI:
-      case ZYDIS_REGISTER_RSP:
-      case ZYDIS_REGISTER_R12:
-      case ZYDIS_REGISTER_R13:
-      case ZYDIS_REGISTER_R14:
-      case ZYDIS_REGISTER_R15:
-      case ZYDIS_REGISTER_XMM6:
-      case ZYDIS_REGISTER_XMM7:
-      case ZYDIS_REGISTER_XMM8:
-      case ZYDIS_REGISTER_XMM9:
-      case ZYDIS_REGISTER_XMM10:
-      case ZYDIS_REGISTER_XMM11:
-      case ZYDIS_REGISTER_XMM12:
-      case ZYDIS_REGISTER_XMM13:
-      case ZYDIS_REGISTER_XMM14:
-      case ZYDIS_REGISTER_XMM15:
-        break;
+      pBlockInstructions[pDefUse->pInstructions[i - 1].block * 2] = (uint32_t)(i - 1);
+      pBlockInstructions[pDefUse->pInstructions[i - 1].block * 2 + 1]++;
+    }
 
-      default:
-        pInfo->pContext->regInfo[i] = 0;
-        break;
-      }
+    for (size_t i = 0; i < blockCount; i++)
+      pRanks[pControlFlow->pOrder[i]] = (uint32_t)i;
+
+    for (size_t i = 0; i < pLoop->blockCount; i++)
+    {
+      pBlocks[i].block = pForest->pLoopBlocks[pLoop->firstBlock + i];
+      pBlocks[i].rank = pRanks[pBlocks[i].block];
     }
 
-    break;
-  }
+    // Dependencies within an iteration only go forward in the reverse post-order of the blocks, starting at the header.
+    qsort(pBlocks, pLoop->blockCount, sizeof(ZydecCriticalPathBlock), zydec_CriticalPath_CompareBlocks);
 
-  default:
-  case ZydecFormattingInfo::AfterCallRegisterRetentionMode::Linux:
-  {
-    for (size_t i = 0; i < ZYDIS_REGISTER_MAX_VALUE; i++)
+    ZydisDecodedInstruction instruction;
+    ZydisDecodedOperand operands[ZYDIS_MAX_OPERAND_COUNT];
+
+    for (size_t i = 0; i < pLoop->blockCount; i++)
     {
-      switch (i)
+      const uint32_t first = pBlockInstructions[pBlocks[i].block * 2];
+      const uint32_t count = pBlockInstructions[pBlocks[i].block * 2 + 1];
+
+      for (uint32_t j = first; j < first + count; j++)
       {
-      case ZYDIS_REGISTER_RBX:
-      case ZYDIS_REGISTER_RSP:
-      case ZYDIS_REGISTER_RBP:
-      case ZYDIS_REGISTER_R12:
-      case ZYDIS_REGISTER_R13:
-      case ZYDIS_REGISTER_R14:
-      case ZYDIS_REGISTER_R15:
-        break;
+        const ZydecDefUseInstruction *pInstruction = &pDefUse->pInstructions[j];
+        ZydecCriticalPathMember *pMember = &pMembers[memberCount++];
 
-      default:
-        pInfo->pContext->regInfo[i] = 0;
-        break;
+        pMember->instruction = j;
+        pMember->latency = 0;
+        pMember->loadLatency = 0;
+        pMember->storeForwardingLatency = 0;
+
+        for (size_t k = 0; k < 4; k++)
+          pMember->addressLocations[k] = ZydecLinearContextRegisterCount;
+
+        if (pInstruction->length == 0 || pInstruction->mnemonic == ZYDIS_MNEMONIC_INVALID || pInstruction->offset >= codeSize || !ZYAN_SUCCESS(ZydisDecoderDecodeFull(pDecoder, pCode + pInstruction->offset, codeSize - pInstruction->offset, &instruction, operands)))
+          continue;
+
+        ZydecInstructionTiming timing;
+        zydec_Microarchitecture_GetInstructionTiming(microarchitecture, &instruction, operands, &timing);
+
+        pMember->latency = timing.latency;
+        pMember->loadLatency = timing.loadLatency;
+        pMember->storeForwardingLatency = timing.storeForwardingLatency;
+
+        size_t addressCount = 0;
+
+        for (size_t k = 0; k < instruction.operand_count && addressCount + 2 <= 4; k++)
+        {
+          if (operands[k].type != ZYDIS_OPERAND_TYPE_MEMORY || (operands[k].mem.type != ZYDIS_MEMOP_TYPE_MEM && operands[k].mem.type != ZYDIS_MEMOP_TYPE_VSIB) || (operands[k].actions & ZYDIS_OPERAND_ACTION_MASK_READ) == 0)
+            continue;
+
+          pMember->addressLocations[addressCount++] = zydec_DefUse_RegisterLocation(operands[k].mem.base);
+          pMember->addressLocations[addressCount++] = zydec_DefUse_RegisterLocation(operands[k].mem.index);
+        }
       }
     }
 
-    break;
-  }
-  }
-}
+    for (size_t i = 0; i < pDefUse->valueCount; i++)
+      pDistances[i] = -1;
 
-uint32_t zydec_LinearContext_NextRegisterName(ZydecLinearContext *pContext)
-{
-  bool firstRun = true;
-  uint32_t ret;
+    // Every value joined at the header may be carried around the loop.
+    const uint32_t header = pLoop->header;
 
-  while (true)
-  {
-    const uint64_t oldState = pContext->hashState;
-    pContext->hashState = oldState * 6364136223846793005ULL | 1;
+    for (size_t m = 0; m < memberCount; m++)
+    {
+      const ZydecDefUseInstruction *pHeaderJoin = &pDefUse->pInstructions[pMembers[m].instruction];
 
-    const uint32_t xorshifted = (uint32_t)(((oldState >> 18) ^ oldState) >> 27);
-    const uint32_t rot = (uint32_t)(oldState >> 59);
+      if (pHeaderJoin->block != header || pHeaderJoin->length != 0)
+        continue;
 
-    ret = (xorshifted >> rot) | (xorshifted << (uint32_t)((-(int32_t)rot) & 31));
+      for (size_t j = 0; j < pHeaderJoin->definitionCount; j++)
+      {
+        const uint32_t join = pDefUse->pReferences[pHeaderJoin->firstDefinition + j];
 
-    if (!firstRun || ret != 0)
-      break;
+        for (size_t k = 0; k < memberCount; k++)
+        {
+          const ZydecDefUseInstruction *pInstruction = &pDefUse->pInstructions[pMembers[k].instruction];
 
-    firstRun = false;
-  }
-  
-  return ret;
-}
+          for (size_t l = 0; l < pInstruction->definitionCount; l++)
+            pDistances[pDefUse->pReferences[pInstruction->firstDefinition + l]] = -1;
+        }
 
-bool zydec_LinearContext_WriteRegisterName(char **pBufferPos, size_t *pRemainingSize, const ZydisRegister reg, const uint32_t registerName)
-{
-  if (!zydec_WriteRegisterRaw(pBufferPos, pRemainingSize, reg))
-    return false;
+        pDistances[join] = 0;
 
-  if (registerName != 0)
-  {
-    if (!zydec_WriteRaw(pBufferPos, pRemainingSize, "_"))
-      return false;
+        for (size_t k = 0; k < memberCount; k++)
+        {
+          const ZydecCriticalPathMember *pMember = &pMembers[k];
+          const ZydecDefUseInstruction *pInstruction = &pDefUse->pInstructions[pMember->instruction];
 
-    static const char syllables[256][3] = {
-      "ba", "ca", "da", "fa", "ga", "ha", "ja", "ka", "la", "ma", "na", "pa", "qa", "ra", "sa", "ta", "va", "wa", "xa", "ya", "za",
-      "be", "ce", "de", "fe", "ge", "he", "je", "ke", "le", "me", "ne", "pe", "qe", "re", "se", "te", "ve", "we", "xe", "ye", "ze",
-      "bi", "ci", "di", "fi", "gi", "hi", "ji", "ki", "li", "mi", "ni", "pi", "qi", "ri", "si", "ti", "vi", "wi", "xi", "yi", "zi",
-      "bo", "co", "do", "fo", "go", "ho", "jo", "ko", "lo", "mo", "no", "po", "qo", "ro", "so", "to", "vo", "wo", "xo", "yo", "zo",
-      "bu", "cu", "du", "fu", "gu", "hu", "ju", "ku", "lu", "mu", "nu", "pu", "qu", "ru", "su", "tu", "vu", "wu", "xu", "yu", "zu",
-      "Ba", "Ca", "Da", "Fa", "Ga", "Ha", "Ja", "Ka", "La", "Ma", "Na", "Pa", "Qa", "Ra", "Sa", "Ta", "Va", "Wa", "Xa", "Ya", "Za",
-      "Be", "Ce", "De", "Fe", "Ge", "He", "Je", "Ke", "Le", "Me", "Ne", "Pe", "Qe", "Re", "Se", "Te", "Ve", "We", "Xe", "Ye", "Ze",
-      "Bi", "Ci", "Di", "Fi", "Gi", "Hi", "Ji", "Ki", "Li", "Mi", "Ni", "Pi", "Qi", "Ri", "Si", "Ti", "Vi", "Wi", "Xi", "Yi", "Zi",
-      "Bo", "Co", "Do", "Fo", "Go", "Ho", "Jo", "Ko", "Lo", "Mo", "No", "Po", "Qo", "Ro", "So", "To", "Vo", "Wo", "Xo", "Yo", "Zo",
-      "Bu", "Cu", "Du", "Fu", "Gu", "Hu", "Ju", "Ku", "Lu", "Mu", "Nu", "Pu", "Qu", "Ru", "Su", "Tu", "Vu", "Wu", "Xu", "Yu", "Zu",
-      "a_", "b_", "c_", "d_", "e_", "f_", "g_", "h_", "i_", "j_", "k_", "l_", "m_", "n_", "o_", "p_", "q_", "r_", "s_", "t_", "u_", "v_", "w_", "x_", "y_", "z_",
-      "Ad", "An", "Sh", "In", "Cm", "Ab", "Bl", "Bs", "Ex", "6i", "7i", "9i", "4o", "6o", "7o", "9o", "4u", "6u", "7u", "9u",
-    };
+          // The joins of other blocks pass on the longest chain of their inputs, the other joins of the header start chains of their own.
+          if (pInstruction->length == 0)
+          {
+            if (pInstruction->block == header)
+              continue;
+
+            for (size_t l = 0; l < pInstruction->definitionCount; l++)
+            {
+              const uint32_t value = pDefUse->pReferences[pInstruction->firstDefinition + l];
+              const ZydecValue *pValue = &pDefUse->pValues[value];
+
+              for (size_t n = 0; n < pValue->inputCount; n++)
+              {
+                const uint32_t input = pDefUse->pReferences[pValue->firstInput + n];
+
+                if (pDistances[input] > pDistances[value])
+                {
+                  pDistances[value] = pDistances[input];
+                  pFrom[value] = input;
+                  pLatencies[value] = 0;
+                }
+              }
+            }
+
+            continue;
+          }
 
-    uint32_t val = registerName;
+          int64_t distance = -1;
+          uint32_t from = ZydecValueNone;
+          uint32_t latency = 0;
 
-    for (size_t i = 0; i < sizeof(uint32_t); i += sizeof(uint8_t))
-    {
-      const uint8_t seg = (uint8_t)(val & 0xFF);
+          for (size_t l = 0; l < pInstruction->readCount; l++)
+          {
+            const uint32_t input = pDefUse->pReferences[pInstruction->firstRead + l];
 
-      if (!zydec_WriteRaw(pBufferPos, pRemainingSize, syllables[seg]))
-        return false;
+            if (pDistances[input] < 0)
+              continue;
 
-      val >>= 8;
+            const uint32_t inputLatency = zydec_CriticalPath_GetLatency(pMember, &pDefUse->pValues[input]);
+
+            if (pDistances[input] + inputLatency > distance)
+            {
+              distance = pDistances[input] + inputLatency;
+              from = input;
+              latency = inputLatency;
+            }
+          }
+
+          for (size_t l = 0; l < pInstruction->definitionCount; l++)
+          {
+            const uint32_t value = pDefUse->pReferences[pInstruction->firstDefinition + l];
+
+            pDistances[value] = distance;
+            pFrom[value] = from;
+            pLatencies[value] = latency;
+          }
+        }
+
+        // The chain is carried around the loop if the back-edges lead it back into the join.
+        const ZydecValue *pJoin = &pDefUse->pValues[join];
+        uint32_t back = ZydecValueNone;
+
+        for (size_t k = 0; k < pJoin->inputCount; k++)
+        {
+          const uint32_t input = pDefUse->pReferences[pJoin->firstInput + k];
+
+          if (input != join && pDistances[input] > 0 && (back == ZydecValueNone || pDistances[input] > pDistances[back]))
+            back = input;
+        }
+
+        if (back == ZydecValueNone || pDistances[back] <= bestCycles)
+          continue;
+
+        bestCycles = pDistances[back];
+        bestJoin = join;
+        linkCount = 0;
+
+        for (uint32_t value = back; value != join && linkCount <= pDefUse->valueCount; value = pFrom[value])
+          if (pDefUse->pValues[value].kind == zvk_definition)
+            linkCount++;
+
+        if (linkCount > pPath->linkCapacity || pPath->pLinks == nullptr)
+          continue;
+
+        size_t linkIndex = linkCount;
+
+        for (uint32_t value = back; value != join && linkIndex > 0; value = pFrom[value])
+        {
+          if (pDefUse->pValues[value].kind != zvk_definition)
+            continue;
+
+          ZydecCriticalPathLink *pLink = &pPath->pLinks[--linkIndex];
+          pLink->instruction = pDefUse->pValues[value].instruction;
+          pLink->value = pFrom[value];
+          pLink->latency = pLatencies[value];
+        }
+      }
     }
   }
 
-  return true;
-}
+  free(pBlockInstructions);
+  free(pRanks);
+  free(pBlocks);
+  free(pMembers);
+  free(pDistances);
+  free(pFrom);
+  free(pLatencies);
 
-bool zydec_LinearContext_WriteRegister(char **pBufferPos, size_t *pRemainingSize, const ZydisRegister reg, void *pUserData)
-{
-  ZydecLinearContextFormatInfo *pInfo = static_cast<ZydecLinearContextFormatInfo *>(pUserData);
+  if (!success)
+    return false;
+
+  pPath->linkCount = linkCount;
+  pPath->join = bestJoin;
+  pPath->cycles = (uint32_t)bestCycles;
 
-  return zydec_LinearContext_WriteRegisterName(pBufferPos, pRemainingSize, reg, pInfo->pContext->regInfo[reg]);
+  return linkCount <= pPath->linkCapacity && (linkCount == 0 || pPath->pLinks != nullptr);
 }
 
-bool zydec_LinearContext_WriteResultRegister(char **pBufferPos, size_t *pRemainingSize, const ZydisRegister reg, void *pUserData)
+////////////////////////////////////////////////////////////////////////////////
+
+// Busy cycles of all uops that can execute on the same set of ports.
+struct ZydecThroughputGroup
 {
-  ZydecLinearContextFormatInfo *pInfo = static_cast<ZydecLinearContextFormatInfo *>(pUserData);
+  uint16_t ports;
+  uint8_t portCount;
+  uint32_t cycles;
+};
+
+static int zydec_Throughput_CompareGroups(const void *pA, const void *pB)
+{
+  const ZydecThroughputGroup *pGroupA = static_cast<const ZydecThroughputGroup *>(pA);
+  const ZydecThroughputGroup *pGroupB = static_cast<const ZydecThroughputGroup *>(pB);
 
-  uint32_t newName = zydec_LinearContext_NextRegisterName(pInfo->pContext);
+  if (pGroupA->portCount != pGroupB->portCount)
+    return pGroupA->portCount < pGroupB->portCount ? -1 : 1;
 
-  if (pInfo->regHint != ZYDIS_REGISTER_NONE)
-  {
-    ZydisRegister baseRegister = zydec_ResolveBaseRegister(pInfo->regHint);
-    const uint32_t hintedRegName = pInfo->pContext->regInfo[baseRegister];
+  return pGroupA->ports < pGroupB->ports ? -1 : (pGroupA->ports > pGroupB->ports ? 1 : 0);
+}
 
-    if (hintedRegName != 0)
-      newName = hintedRegName;
-  }
-  else if (pInfo->hasValHint && (pInfo->valHint == 0 || pInfo->valHint == (int64_t)-1))
+static bool zydec_Throughput_AddUsage(ZydecThroughputGroup *pGroups, const size_t groupCapacity, size_t *pGroupCount, const ZydecPortUsage usage, const int32_t sign)
+{
+  for (size_t i = 0; i < *pGroupCount; i++)
   {
-    if (pInfo->valHint == 0)
-    {
-      newName &= 0xFFFF0000;
-      newName |= 0xDDC7; // `Nul_`
-    }
-    else if (pInfo->valHint == (int64_t)-1)
+    if (pGroups[i].ports == usage.ports)
     {
-      newName &= 0xFFFF0000;
-      newName |= 0xDDC0; // `Ful_`
+      pGroups[i].cycles = (uint32_t)((int32_t)pGroups[i].cycles + sign * usage.cycles);
+      return true;
     }
   }
-  else if (pInfo->opHint != ZydecFormattingInfo::None)
-  {
-    switch (pInfo->opHint)
-    {
-    case ZydecFormattingInfo::Add:
-      newName &= 0xFFFF0000;
-      newName |= 0xD5EC; // `Add_`
-      break;
 
-    case ZydecFormattingInfo::Sub:
-      newName &= 0xFFFF0000;
-      newName |= 0xD3CB; // `Sub_`
-      break;
+  if (sign < 0 || *pGroupCount >= groupCapacity)
+    return false;
 
-    case ZydecFormattingInfo::Mul:
-      newName &= 0xFFFF0000;
-      newName |= 0xDDC6; // `Mul_`
-      break;
+  ZydecThroughputGroup *pGroup = &pGroups[(*pGroupCount)++];
+  pGroup->ports = usage.ports;
+  pGroup->portCount = 0;
+  pGroup->cycles = usage.cycles;
 
-    case ZydecFormattingInfo::Div:
-      newName &= 0xFFFF0000;
-      newName |= 0xE795; // `Div_`
-      break;
+  for (uint16_t ports = usage.ports; ports != 0; ports &= (uint16_t)(ports - 1))
+    pGroup->portCount++;
 
-    case ZydecFormattingInfo::Mod:
-      newName &= 0xFFFF0000;
-      newName |= 0xD5B1; // `Mod_`
-      break;
+  return true;
+}
 
-    case ZydecFormattingInfo::And:
-      newName &= 0xFFFF0000;
-      newName |= 0xD5ED; // `And_`
-      break;
+// Whether a conditional branch right after the instruction is decoded into a single uop with it.
+inline bool zydec_Throughput_IsMacroFusible(const ZydecMicroarchitecture microarchitecture, const ZydisDecodedInstruction *pInstruction, const ZydisDecodedOperand *pOperands)
+{
+  bool hasMemory = false;
+  bool hasImmediate = false;
 
-    case ZydecFormattingInfo::AndNot:
-      newName &= 0xFFFF0000;
-      newName |= 0xE5ED; // `Ant_`
-      break;
+  for (size_t i = 0; i < pInstruction->operand_count_visible; i++)
+  {
+    hasMemory |= (pOperands[i].type == ZYDIS_OPERAND_TYPE_MEMORY);
+    hasImmediate |= (pOperands[i].type == ZYDIS_OPERAND_TYPE_IMMEDIATE);
+  }
 
-    case ZydecFormattingInfo::Or:
-      newName &= 0xFFFF0000;
-      newName |= 0xE33F; // `bor_`
-      break;
+  switch (pInstruction->mnemonic)
+  {
+  case ZYDIS_MNEMONIC_CMP:
+  case ZYDIS_MNEMONIC_TEST:
+    return !(hasMemory && hasImmediate);
 
-    case ZydecFormattingInfo::XOr:
-      newName &= 0xFFFF0000;
-      newName |= 0xE351; // `xor_`
-      break;
+  case ZYDIS_MNEMONIC_ADD:
+  case ZYDIS_MNEMONIC_SUB:
+  case ZYDIS_MNEMONIC_AND:
+  case ZYDIS_MNEMONIC_INC:
+  case ZYDIS_MNEMONIC_DEC:
+    return (microarchitecture == zma_skylake || microarchitecture == zma_iceLake) && !hasMemory;
 
-    case ZydecFormattingInfo::Neg:
-      newName &= 0xFFFF0000;
-      newName |= 0xD888; // `Neg_`
-      break;
+  default:
+    return false;
+  }
+}
 
-    case ZydecFormattingInfo::ShL:
-      newName &= 0xFFFF0000;
-      newName |= 0xDDEE; // `Shl_`
-      break;
+bool zydec_Throughput_Estimate(ZydecThroughput *pThroughput, const ZydecControlFlowGraph *pControlFlow, const uint32_t *pBlocks, const size_t blockCount, const ZydecMicroarchitecture microarchitecture, const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t codeSize)
+{
+  if (pThroughput == nullptr || pControlFlow == nullptr || pControlFlow->pBlocks == nullptr || (pBlocks == nullptr && blockCount > 0) || microarchitecture >= zma_count || pDecoder == nullptr || pCode == nullptr)
+    return false;
 
-    case ZydecFormattingInfo::ShR:
-      newName &= 0xFFFF0000;
-      newName |= 0xE3EE; // `Shr_`
-      break;
+  ZydecThroughputGroup groups[32];
+  size_t groupCount = 0;
+  uint32_t instructionCount = 0;
+  uint32_t uopCount = 0;
 
-    case ZydecFormattingInfo::Inc:
-      newName &= 0xFFFF0000;
-      newName |= 0xD4EF; // `Inc_`
-      break;
+  ZydisDecodedInstruction instruction;
+  ZydisDecodedOperand operands[ZYDIS_MAX_OPERAND_COUNT];
 
-    case ZydecFormattingInfo::Dec:
-      newName &= 0xFFFF0000;
-      newName |= 0xD480; // `Dec_`
+  for (size_t i = 0; i < blockCount; i++)
+  {
+    if (pBlocks[i] >= pControlFlow->blockCount)
+      return false;
+
+    const ZydecBasicBlock *pBlock = &pControlFlow->pBlocks[pBlocks[i]];
+    const size_t end = (size_t)pBlock->offset + pBlock->size;
+
+    // The computation of the previous instruction, if a conditional branch may fuse with it.
+    ZydecPortUsage fusibleUsage = { zpm_none, 0 };
+
+    for (size_t offset = pBlock->offset; offset < end && offset < codeSize; offset += instruction.length)
+    {
+      if (!ZYAN_SUCCESS(ZydisDecoderDecodeFull(pDecoder, pCode + offset, codeSize - offset, &instruction, operands)))
+        break;
+
+      ZydecInstructionTiming timing;
+      zydec_Microarchitecture_GetInstructionTiming(microarchitecture, &instruction, operands, &timing);
+
+      instructionCount++;
+
+      if (instruction.meta.category == ZYDIS_CATEGORY_COND_BR && fusibleUsage.ports != zpm_none)
+      {
+        // The fused pair executes on the branch port instead.
+        if (!zydec_Throughput_AddUsage(groups, sizeof(groups) / sizeof(groups[0]), &groupCount, fusibleUsage, -1))
+          return false;
+      }
+      else
+      {
+        uopCount += timing.uopCount;
+      }
+
+      for (size_t j = 0; j < timing.portUsageCount; j++)
+        if (!zydec_Throughput_AddUsage(groups, sizeof(groups) / sizeof(groups[0]), &groupCount, timing.portUsages[j], 1))
+          return false;
+
+      fusibleUsage = { zpm_none, 0 };
+
+      if (timing.portUsageCount > 0 && zydec_Throughput_IsMacroFusible(microarchitecture, &instruction, operands))
+        fusibleUsage = timing.portUsages[0];
+    }
+  }
+
+  // Spread the uops over their ports, starting with the ones that have the fewest options. Every group levels the least busy of its ports.
+  qsort(groups, groupCount, sizeof(ZydecThroughputGroup), zydec_Throughput_CompareGroups);
+
+  const size_t portCount = MicroarchitecturePortCounts[microarchitecture];
+  double portCycles[ZydecMaxPortCount] = {};
+
+  for (size_t i = 0; i < groupCount; i++)
+  {
+    double remaining = groups[i].cycles;
+
+    while (remaining > 1e-9)
+    {
+      double lowest = -1;
+      double nextLowest = -1;
+      size_t lowestCount = 0;
+
+      for (size_t port = 0; port < portCount; port++)
+      {
+        if ((groups[i].ports & (1 << port)) == 0)
+          continue;
+
+        if (lowestCount == 0 || portCycles[port] < lowest - 1e-9)
+        {
+          if (lowestCount != 0)
+            nextLowest = lowest;
+
+          lowest = portCycles[port];
+          lowestCount = 1;
+        }
+        else if (portCycles[port] <= lowest + 1e-9)
+        {
+          lowestCount++;
+        }
+        else if (nextLowest < 0 || portCycles[port] < nextLowest)
+        {
+          nextLowest = portCycles[port];
+        }
+      }
+
+      if (lowestCount == 0)
+        break;
+
+      double fill = remaining;
+
+      if (nextLowest >= 0 && (nextLowest - lowest) * (double)lowestCount < fill)
+        fill = (nextLowest - lowest) * (double)lowestCount;
+
+      for (size_t port = 0; port < portCount; port++)
+        if ((groups[i].ports & (1 << port)) != 0 && portCycles[port] <= lowest + 1e-9)
+          portCycles[port] += fill / (double)lowestCount;
+
+      remaining -= fill;
+    }
+  }
+
+  pThroughput->instructionCount = instructionCount;
+  pThroughput->uopCount = uopCount;
+  pThroughput->issueCycles = (double)uopCount / (double)MicroarchitectureIssueWidths[microarchitecture];
+  pThroughput->cycles = pThroughput->issueCycles;
+  pThroughput->bottleneckPort = ZydecThroughputIssueBound;
+
+  for (size_t port = 0; port < ZydecMaxPortCount; port++)
+  {
+    pThroughput->portCycles[port] = portCycles[port];
+
+    if (portCycles[port] > pThroughput->cycles + 1e-9)
+    {
+      pThroughput->cycles = portCycles[port];
+      pThroughput->bottleneckPort = (uint8_t)port;
+    }
+  }
+
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool zydec_SplitCodeAtFunctionBoundaries(const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t codeSize, const size_t minRangeSize, ZydecCodeRange *pRanges, const size_t rangeCapacity, size_t *pRangeCount)
+{
+  if (pDecoder == nullptr || pCode == nullptr || pRanges == nullptr || pRangeCount == nullptr)
+    return false;
+
+  *pRangeCount = 0;
+
+  ZydisDecoderContext context;
+  ZydisDecodedInstruction instruction;
+  size_t rangeStart = 0;
+  size_t offset = 0;
+  bool isAfterUnconditionalBranch = false;
+
+  // Only the instructions are decoded, as the operands don't matter for finding the boundaries. Bytes that fail to decode are skipped just like the translation skips them.
+  while (offset < codeSize)
+  {
+    size_t length = 1;
+    bool isPadding = false;
+    bool isUnconditionalBranch = false;
+
+    if (ZYAN_SUCCESS(ZydisDecoderDecodeInstruction(pDecoder, &context, pCode + offset, codeSize - offset, &instruction)) && instruction.length != 0)
+    {
+      length = instruction.length;
+      isPadding = zydec_IsFunctionPadding(&instruction);
+      isUnconditionalBranch = zydec_IsUnconditionalBranch(&instruction);
+    }
+
+    if (isAfterUnconditionalBranch && !isPadding && offset - rangeStart >= minRangeSize)
+    {
+      if (*pRangeCount >= rangeCapacity)
+        return false;
+
+      pRanges[*pRangeCount].offset = rangeStart;
+      pRanges[*pRangeCount].size = offset - rangeStart;
+      (*pRangeCount)++;
+
+      rangeStart = offset;
+    }
+
+    if (!isPadding)
+      isAfterUnconditionalBranch = isUnconditionalBranch;
+
+    offset += length;
+  }
+
+  if (rangeStart < codeSize)
+  {
+    if (*pRangeCount >= rangeCapacity)
+      return false;
+
+    pRanges[*pRangeCount].offset = rangeStart;
+    pRanges[*pRangeCount].size = codeSize - rangeStart;
+    (*pRangeCount)++;
+  }
+
+  return true;
+}
+
+struct ZydecSweepState
+{
+  const ZydisDecoder *pDecoder;
+  const uint8_t *pCode;
+  size_t codeSize;
+  size_t rangeSize;
+  size_t rangeCount;
+
+  uint64_t *pBoundaries; // bit `i` is set if the speculative decoding of the range containing offset `i` found an instruction starting there.
+  size_t *pSpeculativeEnds; // offset of the first instruction at or after the end of each range, as found by the speculative decoding.
+  std::atomic<size_t> nextRange;
+};
+
+// Decodes like `zydec_Listing_Analyze` & the translation would, skipping bytes that fail to decode.
+inline size_t zydec_Sweep_InstructionLength(const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t codeSize, const size_t offset)
+{
+  ZydisDecoderContext context;
+  ZydisDecodedInstruction instruction;
+
+  if (ZYAN_SUCCESS(ZydisDecoderDecodeInstruction(pDecoder, &context, pCode + offset, codeSize - offset, &instruction)) && instruction.length != 0)
+    return instruction.length;
+
+  return 1;
+}
+
+void zydec_Sweep_Worker(ZydecSweepState *pState)
+{
+  while (true)
+  {
+    const size_t rangeIndex = pState->nextRange++;
+
+    if (rangeIndex >= pState->rangeCount)
       break;
 
-    case ZydecFormattingInfo::BitScanF:
-      newName &= 0xFFFF0000;
-      newName |= 0xD7F3; // `Bsf_`
-      break;
+    const size_t rangeStart = rangeIndex * pState->rangeSize;
+    const size_t rangeEnd = rangeStart + pState->rangeSize < pState->codeSize ? rangeStart + pState->rangeSize : pState->codeSize;
+    size_t offset = rangeStart;
+
+    // Ranges are multiples of 64 bytes, so no two threads write to the same word.
+    while (offset < rangeEnd)
+    {
+      pState->pBoundaries[offset / 64] |= (uint64_t)1 << (offset & 63);
+      offset += zydec_Sweep_InstructionLength(pState->pDecoder, pState->pCode, pState->codeSize, offset);
+    }
+
+    pState->pSpeculativeEnds[rangeIndex] = offset;
+  }
+}
+
+bool zydec_SplitCodeParallel(const ZydisDecoder *pDecoder, const uint8_t *pCode, const size_t codeSize, const size_t rangeSize, const size_t threadCount, ZydecCodeRange *pRanges, const size_t rangeCapacity, size_t *pRangeCount)
+{
+  if (pDecoder == nullptr || pCode == nullptr || rangeSize < ZYDIS_MAX_INSTRUCTION_LENGTH || pRanges == nullptr || pRangeCount == nullptr)
+    return false;
+
+  *pRangeCount = 0;
+
+  if (codeSize == 0)
+    return true;
+
+  ZydecSweepState state;
+  state.pDecoder = pDecoder;
+  state.pCode = pCode;
+  state.codeSize = codeSize;
+  state.rangeSize = (rangeSize + 63) & ~(size_t)63;
+  state.rangeCount = (codeSize + state.rangeSize - 1) / state.rangeSize;
+  state.nextRange = 0;
+
+  if (state.rangeCount > rangeCapacity)
+    return false;
+
+  state.pBoundaries = static_cast<uint64_t *>(calloc((codeSize + 63) / 64, sizeof(uint64_t)));
+  state.pSpeculativeEnds = static_cast<size_t *>(malloc(state.rangeCount * sizeof(size_t)));
+
+  if (state.pBoundaries == nullptr || state.pSpeculativeEnds == nullptr)
+  {
+    free(state.pBoundaries);
+    free(state.pSpeculativeEnds);
+    return false;
+  }
+
+  size_t workerCount = threadCount != 0 ? threadCount : std::thread::hardware_concurrency();
+
+  if (workerCount > state.rangeCount)
+    workerCount = state.rangeCount;
+
+  if (workerCount <= 1)
+  {
+    zydec_Sweep_Worker(&state);
+  }
+  else
+  {
+    std::thread *pThreads = new std::thread[workerCount];
+
+    for (size_t i = 0; i < workerCount; i++)
+      pThreads[i] = std::thread(zydec_Sweep_Worker, &state);
+
+    for (size_t i = 0; i < workerCount; i++)
+      pThreads[i].join();
+
+    delete[] pThreads;
+  }
+
+  // The first range starts at the start of the code, so its speculative decoding is correct. Every following range starts where the previous one truly ended.
+  size_t rangeStart = 0;
+
+  for (size_t i = 0; i < state.rangeCount && rangeStart < codeSize; i++)
+  {
+    const size_t nominalEnd = (i + 1) * state.rangeSize < codeSize ? (i + 1) * state.rangeSize : codeSize;
+    size_t offset = rangeStart;
+
+    // Decodes from the true start until running into a boundary that the speculative decoding found as well, from which on both agree.
+    while (offset < nominalEnd && !(state.pBoundaries[offset / 64] & ((uint64_t)1 << (offset & 63))))
+      offset += zydec_Sweep_InstructionLength(pDecoder, pCode, codeSize, offset);
+
+    const size_t rangeEnd = offset < nominalEnd ? state.pSpeculativeEnds[i] : offset;
+
+    pRanges[*pRangeCount].offset = rangeStart;
+    pRanges[*pRangeCount].size = rangeEnd - rangeStart;
+    (*pRangeCount)++;
+
+    rangeStart = rangeEnd;
+  }
+
+  free(state.pBoundaries);
+  free(state.pSpeculativeEnds);
+
+  return true;
+}
+
+// No single line written by `ZydecParallelTranslation::pWriteLine` may be longer than this.
+static constexpr size_t ZydecParallelMaxLineLength = 64 * 1024;
+
+struct ZydecParallelRangeOutput
+{
+  char *pText;
+  size_t length;
+  size_t capacity;
+  bool isDone;
+  bool hasFailed;
+};
+
+struct ZydecParallelState
+{
+  const ZydecParallelTranslation *pTranslation;
+  const ZydecFormattingInfo *pInfo;
+
+  ZydecParallelRangeOutput *pSlots; // range `i` is written to slot `i % slotCount`.
+  size_t slotCount;
+
+  std::mutex mutex;
+  std::condition_variable condition;
+  size_t nextRange;
+  size_t emittedRangeCount;
+  bool stop;
+};
+
+bool zydec_Parallel_WriteLine(char **pBufferPos, size_t *pRemainingSize, const ZydisDecodedInstruction * /* pInstruction */, const ZydisDecodedOperand * /* pOperands */, const size_t /* virtualAddress */, const char *translation, const bool hasTranslation, void * /* pUserData */)
+{
+  if (hasTranslation && !zydec_WriteRaw(pBufferPos, pRemainingSize, translation))
+    return false;
+
+  return zydec_WriteLiteral(pBufferPos, pRemainingSize, "\n");
+}
+
+// Returns the offset of the last function boundary at or before the start of the range, as the serial translation would find it, scanning back through the preceding ranges until one contains a boundary.
+// Every preceding range is only scanned once (up to the first instruction of the range after it), so finding the boundary costs no more than analyzing the code from there.
+size_t zydec_Parallel_FindFunctionStart(const ZydecParallelTranslation *pTranslation, const size_t rangeIndex)
+{
+  const size_t rangeStart = pTranslation->pRanges[rangeIndex].offset;
+
+  ZydisDecoderContext context;
+  ZydisDecodedInstruction instruction;
+
+  for (size_t i = rangeIndex; i > 0; i--)
+  {
+    size_t functionStart = pTranslation->codeSize;
+    size_t offset = pTranslation->pRanges[i - 1].offset;
+    const size_t scanEnd = pTranslation->pRanges[i].offset;
+    bool isAfterUnconditionalBranch = false;
+
+    // Includes the first instruction of the next range, which may be a boundary itself, and continues through padding that runs into it, as the later ranges were scanned without knowing about the branch before it.
+    while (offset <= rangeStart && offset < pTranslation->codeSize && (offset <= scanEnd || isAfterUnconditionalBranch))
+    {
+      size_t length = 1;
+
+      if (ZYAN_SUCCESS(ZydisDecoderDecodeInstruction(pTranslation->pDecoder, &context, pTranslation->pCode + offset, pTranslation->codeSize - offset, &instruction)) && instruction.length != 0)
+      {
+        length = instruction.length;
+
+        if (!zydec_IsFunctionPadding(&instruction))
+        {
+          if (isAfterUnconditionalBranch)
+            functionStart = offset;
+
+          isAfterUnconditionalBranch = zydec_IsUnconditionalBranch(&instruction);
+        }
+      }
+
+      offset += length;
+    }
+
+    if (functionStart != pTranslation->codeSize)
+      return functionStart;
+  }
+
+  return pTranslation->pRanges[0].offset;
+}
+
+bool zydec_Parallel_TranslateRange(const ZydecParallelTranslation *pTranslation, ZydecFormattingInfo *pInfo, ZydecLinearSession *pSession, const ZydecCodeRange *pRange, ZydecParallelRangeOutput *pOutput)
+{
+  if (pRange->offset > pTranslation->codeSize || pRange->size > pTranslation->codeSize - pRange->offset)
+    return false;
+
+  ZydecParallelTranslation::WriteLineFunc *pWriteLine = pTranslation->pWriteLine != nullptr ? pTranslation->pWriteLine : zydec_Parallel_WriteLine;
+
+  if (pTranslation->linearContext)
+    zydec_LinearSession_Init(pSession, pInfo);
+
+  ZydisDecodedInstruction instruction;
+  ZydisDecodedOperand operands[ZYDIS_MAX_OPERAND_COUNT];
+
+  // Seeded names only depend on the code since the last function boundary, so analyzing from there reproduces the names of a serial translation, wherever the range starts.
+  if (pTranslation->linearContext && pInfo->registerNamingMode == ZydecFormattingInfo::RegisterNamingMode::AddressSeeded)
+  {
+    size_t offset = zydec_Parallel_FindFunctionStart(pTranslation, (size_t)(pRange - pTranslation->pRanges));
+
+    while (offset < pRange->offset)
+    {
+      const bool isDecoded = ZYAN_SUCCESS(ZydisDecoderDecodeFull(pTranslation->pDecoder, pTranslation->pCode + offset, pTranslation->codeSize - offset, &instruction, operands)) && instruction.length != 0;
+
+      if (isDecoded)
+        zydec_LinearSession_AdvanceInstruction(pSession, &instruction, operands, ZYDIS_MAX_OPERAND_COUNT, pTranslation->virtualAddress + offset);
+
+      offset += isDecoded ? instruction.length : 1;
+    }
+  }
+  char translation[ZydecBatchInstructionCapacity];
+
+  const size_t rangeEnd = pRange->offset + pRange->size;
+  size_t offset = pRange->offset;
+
+  pOutput->length = 0;
+
+  while (offset < rangeEnd)
+  {
+    const bool isDecoded = ZYAN_SUCCESS(ZydisDecoderDecodeFull(pTranslation->pDecoder, pTranslation->pCode + offset, rangeEnd - offset, &instruction, operands)) && instruction.length != 0;
+    const size_t virtualAddress = pTranslation->virtualAddress + offset;
+    bool hasTranslation = false;
+
+    if (isDecoded)
+    {
+      bool success;
+
+      if (pTranslation->linearContext)
+        success = zydec_LinearSession_TranslateInstruction(pSession, &instruction, operands, ZYDIS_MAX_OPERAND_COUNT, virtualAddress, translation, sizeof(translation), &hasTranslation);
+      else
+        success = zydec_TranslateInstructionWithoutContext(&instruction, operands, ZYDIS_MAX_OPERAND_COUNT, virtualAddress, translation, sizeof(translation), &hasTranslation, pInfo);
+
+      if (!success)
+        hasTranslation = false;
+    }
+
+    if (!hasTranslation)
+      translation[0] = '\0';
+
+    // Grows the output until the line fits.
+    while (true)
+    {
+      char *bufferPos = pOutput->pText + pOutput->length;
+      size_t remainingSize = pOutput->capacity > pOutput->length ? pOutput->capacity - pOutput->length - 1 : 0;
+
+      if (pOutput->pText != nullptr && pWriteLine(&bufferPos, &remainingSize, isDecoded ? &instruction : nullptr, isDecoded ? operands : nullptr, virtualAddress, translation, hasTranslation, pTranslation->pUserData))
+      {
+        pOutput->length = (size_t)(bufferPos - pOutput->pText);
+        break;
+      }
+
+      if (remainingSize >= ZydecParallelMaxLineLength)
+        return false;
+
+      const size_t newCapacity = pOutput->capacity * 2 + ZydecParallelMaxLineLength;
+      char *pText = static_cast<char *>(realloc(pOutput->pText, newCapacity));
+
+      if (pText == nullptr)
+        return false;
+
+      pOutput->pText = pText;
+      pOutput->capacity = newCapacity;
+    }
+
+    offset += isDecoded ? instruction.length : 1;
+  }
+
+  return true;
+}
+
+void zydec_Parallel_Worker(ZydecParallelState *pState)
+{
+  ZydecFormattingInfo info = *pState->pInfo;
+  ZydecLinearSession *pSession = new ZydecLinearSession();
+
+  while (true)
+  {
+    size_t rangeIndex;
+
+    {
+      std::unique_lock<std::mutex> lock(pState->mutex);
+
+      // Ranges are only started once their slot has been emitted.
+      while (!pState->stop && pState->nextRange < pState->pTranslation->rangeCount && pState->nextRange >= pState->emittedRangeCount + pState->slotCount)
+        pState->condition.wait(lock);
+
+      if (pState->stop || pState->nextRange >= pState->pTranslation->rangeCount)
+        break;
+
+      rangeIndex = pState->nextRange++;
+    }
+
+    ZydecParallelRangeOutput *pOutput = &pState->pSlots[rangeIndex % pState->slotCount];
+    const bool success = zydec_Parallel_TranslateRange(pState->pTranslation, &info, pSession, &pState->pTranslation->pRanges[rangeIndex], pOutput);
+
+    {
+      std::unique_lock<std::mutex> lock(pState->mutex);
+
+      pOutput->hasFailed = !success;
+      pOutput->isDone = true;
+    }
+
+    pState->condition.notify_all();
+  }
+
+  delete pSession;
+}
+
+bool zydec_TranslateParallel(const ZydecParallelTranslation *pTranslation, const ZydecFormattingInfo *pInfo)
+{
+  if (pTranslation == nullptr || pInfo == nullptr || pTranslation->pDecoder == nullptr || pTranslation->pCode == nullptr || (pTranslation->pRanges == nullptr && pTranslation->rangeCount != 0) || pTranslation->pEmitRange == nullptr)
+    return false;
+
+  size_t threadCount = pTranslation->threadCount;
+
+  if (threadCount == 0)
+    threadCount = std::thread::hardware_concurrency();
+
+  if (threadCount > pTranslation->rangeCount)
+    threadCount = pTranslation->rangeCount;
+
+  bool success = true;
+
+  // Without any parallelism, the ranges are simply translated on the calling thread.
+  if (threadCount <= 1)
+  {
+    ZydecFormattingInfo info = *pInfo;
+    ZydecLinearSession *pSession = new ZydecLinearSession();
+    ZydecParallelRangeOutput output = {};
+
+    for (size_t i = 0; i < pTranslation->rangeCount && success; i++)
+      success = zydec_Parallel_TranslateRange(pTranslation, &info, pSession, &pTranslation->pRanges[i], &output) && pTranslation->pEmitRange(i, output.pText, output.length, pTranslation->pUserData);
+
+    free(output.pText);
+    delete pSession;
+
+    return success;
+  }
+
+  ZydecParallelState state;
+  state.pTranslation = pTranslation;
+  state.pInfo = pInfo;
+  state.slotCount = threadCount * 4;
+  state.pSlots = static_cast<ZydecParallelRangeOutput *>(calloc(state.slotCount, sizeof(ZydecParallelRangeOutput)));
+  state.nextRange = 0;
+  state.emittedRangeCount = 0;
+  state.stop = false;
+
+  if (state.pSlots == nullptr)
+    return false;
+
+  std::thread *pThreads = new std::thread[threadCount];
+
+  for (size_t i = 0; i < threadCount; i++)
+    pThreads[i] = std::thread(zydec_Parallel_Worker, &state);
+
+  for (size_t i = 0; i < pTranslation->rangeCount && success; i++)
+  {
+    ZydecParallelRangeOutput *pOutput = &state.pSlots[i % state.slotCount];
+
+    {
+      std::unique_lock<std::mutex> lock(state.mutex);
+
+      while (!pOutput->isDone)
+        state.condition.wait(lock);
+    }
+
+    success = !pOutput->hasFailed && pTranslation->pEmitRange(i, pOutput->pText, pOutput->length, pTranslation->pUserData);
+
+    {
+      std::unique_lock<std::mutex> lock(state.mutex);
+
+      pOutput->isDone = false;
+      state.emittedRangeCount++;
+      state.stop = !success;
+    }
+
+    state.condition.notify_all();
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(state.mutex);
+    state.stop = true;
+  }
+
+  state.condition.notify_all();
+
+  for (size_t i = 0; i < threadCount; i++)
+    pThreads[i].join();
+
+  delete[] pThreads;
+
+  for (size_t i = 0; i < state.slotCount; i++)
+    free(state.pSlots[i].pText);
+
+  free(state.pSlots);
+
+  return success;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+struct ZydecElf64Header
+{
+  uint8_t ident[16];
+  uint16_t type;
+  uint16_t machine;
+  uint32_t version;
+  uint64_t entry;
+  uint64_t programHeaderOffset;
+  uint64_t sectionHeaderOffset;
+  uint32_t flags;
+  uint16_t headerSize;
+  uint16_t programHeaderSize;
+  uint16_t programHeaderCount;
+  uint16_t sectionHeaderSize;
+  uint16_t sectionHeaderCount;
+  uint16_t sectionNameIndex;
+};
+
+struct ZydecElf64SectionHeader
+{
+  uint32_t name;
+  uint32_t type;
+  uint64_t flags;
+  uint64_t address;
+  uint64_t offset;
+  uint64_t size;
+  uint32_t link;
+  uint32_t info;
+  uint64_t addressAlignment;
+  uint64_t entrySize;
+};
+
+struct ZydecElf64Symbol
+{
+  uint32_t name;
+  uint8_t info;
+  uint8_t other;
+  uint16_t sectionIndex;
+  uint64_t value;
+  uint64_t size;
+};
+
+static_assert(sizeof(ZydecElf64Header) == 64 && sizeof(ZydecElf64SectionHeader) == 64 && sizeof(ZydecElf64Symbol) == 24, "ELF64 structure layout doesn't match the specification.");
+
+static constexpr uint16_t ZydecElfMachineX64 = 62;
+static constexpr uint32_t ZydecElfSectionTypeSymTab = 2;
+static constexpr uint32_t ZydecElfSectionTypeNoBits = 8;
+static constexpr uint32_t ZydecElfSectionTypeDynSym = 11;
+static constexpr uint64_t ZydecElfSectionFlagWrite = 0x1;
+static constexpr uint64_t ZydecElfSectionFlagAlloc = 0x2;
+static constexpr uint64_t ZydecElfSectionFlagExecInstr = 0x4;
+static constexpr uint16_t ZydecElfSectionIndexExtended = 0xFFFF;
+static constexpr uint8_t ZydecElfSymbolTypeObject = 1;
+static constexpr uint8_t ZydecElfSymbolTypeFunc = 2;
+static constexpr uint8_t ZydecElfSymbolTypeIFunc = 10;
+
+// Symbols preceding the closest one that are still checked for containing an address, as small unsized symbols may be placed within larger ones.
+static constexpr size_t ZydecImageSymbolLookBehind = 8;
+
+// Returns the null terminated string at `offset` of the string table, or `nullptr`.
+static const char * zydec_Elf_GetString(const uint8_t *pFile, const size_t fileSize, const ZydecElf64SectionHeader *pStringTable, const size_t offset)
+{
+  if (pStringTable->offset > fileSize || pStringTable->size > fileSize - pStringTable->offset || offset >= pStringTable->size)
+    return nullptr;
+
+  const char *string = reinterpret_cast<const char *>(pFile + pStringTable->offset + offset);
+
+  if (memchr(string, '\0', (size_t)(pStringTable->size - offset)) == nullptr)
+    return nullptr;
+
+  return string;
+}
+
+static bool zydec_Elf_GetSectionHeader(const uint8_t *pFile, const size_t fileSize, const ZydecElf64Header *pHeader, const size_t index, ZydecElf64SectionHeader *pSectionHeader)
+{
+  const uint64_t offset = pHeader->sectionHeaderOffset + index * (uint64_t)pHeader->sectionHeaderSize;
+
+  if (offset < pHeader->sectionHeaderOffset || offset > fileSize || fileSize - offset < sizeof(ZydecElf64SectionHeader))
+    return false;
+
+  memcpy(pSectionHeader, pFile + offset, sizeof(ZydecElf64SectionHeader));
+
+  return true;
+}
+
+static int zydec_Image_CompareSymbols(const void *pA, const void *pB)
+{
+  const ZydecImageSymbol *pSymbolA = static_cast<const ZydecImageSymbol *>(pA);
+  const ZydecImageSymbol *pSymbolB = static_cast<const ZydecImageSymbol *>(pB);
+
+  if (pSymbolA->virtualAddress != pSymbolB->virtualAddress)
+    return pSymbolA->virtualAddress < pSymbolB->virtualAddress ? -1 : 1;
+
+  // Sized symbols first, so that they are preferred over aliases of unknown size.
+  if (pSymbolA->size != pSymbolB->size)
+    return pSymbolA->size > pSymbolB->size ? -1 : 1;
+
+  return strcmp(pSymbolA->name, pSymbolB->name);
+}
+
+// Sorts the symbols by address and removes the ones that are listed more than once (e.g. in `.symtab` and `.dynsym`). Returns the remaining number of symbols.
+static size_t zydec_Image_SortSymbols(ZydecImageSymbol *pSymbols, const size_t symbolCount)
+{
+  if (symbolCount == 0)
+    return 0;
+
+  qsort(pSymbols, symbolCount, sizeof(ZydecImageSymbol), zydec_Image_CompareSymbols);
+
+  size_t uniqueCount = 1;
+
+  for (size_t i = 1; i < symbolCount; i++)
+  {
+    const ZydecImageSymbol *pPrevious = &pSymbols[uniqueCount - 1];
+
+    if (pSymbols[i].virtualAddress == pPrevious->virtualAddress && pSymbols[i].size == pPrevious->size && strcmp(pSymbols[i].name, pPrevious->name) == 0)
+      continue;
+
+    pSymbols[uniqueCount] = pSymbols[i];
+    uniqueCount++;
+  }
+
+  return uniqueCount;
+}
+
+static int zydec_Image_CompareFunctions(const void *pA, const void *pB)
+{
+  const ZydecImageFunction *pFunctionA = static_cast<const ZydecImageFunction *>(pA);
+  const ZydecImageFunction *pFunctionB = static_cast<const ZydecImageFunction *>(pB);
+
+  if (pFunctionA->virtualAddress != pFunctionB->virtualAddress)
+    return pFunctionA->virtualAddress < pFunctionB->virtualAddress ? -1 : 1;
+
+  if (pFunctionA->size != pFunctionB->size)
+    return pFunctionA->size > pFunctionB->size ? -1 : 1;
+
+  return 0;
+}
+
+// Sorts the functions by address, only keeping the largest one of the ones starting at the same address.
+static void zydec_Image_SortFunctions(ZydecImage *pImage)
+{
+  if (pImage->functionCount == 0)
+    return;
+
+  qsort(pImage->pFunctions, pImage->functionCount, sizeof(ZydecImageFunction), zydec_Image_CompareFunctions);
+
+  size_t uniqueCount = 1;
+
+  for (size_t i = 1; i < pImage->functionCount; i++)
+  {
+    if (pImage->pFunctions[i].virtualAddress == pImage->pFunctions[uniqueCount - 1].virtualAddress)
+      continue;
+
+    pImage->pFunctions[uniqueCount] = pImage->pFunctions[i];
+    uniqueCount++;
+  }
+
+  pImage->functionCount = uniqueCount;
+}
+
+static void zydec_Image_SetSectionName(ZydecImageSection *pSection, const char *name, const size_t maxLength)
+{
+  size_t length = 0;
+
+  while (length < maxLength && length + 1 < sizeof(pSection->name) && name[length] != '\0')
+  {
+    pSection->name[length] = name[length];
+    length++;
+  }
+
+  pSection->name[length] = '\0';
+}
+
+// The `Add` functions only count the entries that don't fit the storage, so that the required capacity is known once the image has been parsed.
+static void zydec_Image_AddSymbol(ZydecImage *pImage, const size_t virtualAddress, const size_t size, const char *name)
+{
+  if (pImage->symbolCount < pImage->symbolCapacity)
+  {
+    ZydecImageSymbol *pSymbol = &pImage->pSymbols[pImage->symbolCount];
+    pSymbol->virtualAddress = virtualAddress;
+    pSymbol->size = size;
+    pSymbol->name = name;
+  }
+
+  pImage->symbolCount++;
+}
+
+static void zydec_Image_AddFunction(ZydecImage *pImage, const size_t virtualAddress, const size_t size)
+{
+  if (pImage->functionCount < pImage->functionCapacity)
+  {
+    ZydecImageFunction *pFunction = &pImage->pFunctions[pImage->functionCount];
+    pFunction->virtualAddress = virtualAddress;
+    pFunction->size = size;
+  }
+
+  pImage->functionCount++;
+}
+
+static bool zydec_Image_Finish(ZydecImage *pImage)
+{
+  if (pImage->sectionCount > pImage->sectionCapacity || pImage->symbolCount > pImage->symbolCapacity || pImage->functionCount > pImage->functionCapacity)
+    return false;
+
+  pImage->symbolCount = zydec_Image_SortSymbols(pImage->pSymbols, pImage->symbolCount);
+  zydec_Image_SortFunctions(pImage);
+
+  return true;
+}
+
+bool zydec_Image_IsElf64(const uint8_t *pFile, const size_t fileSize)
+{
+  if (pFile == nullptr || fileSize < sizeof(ZydecElf64Header))
+    return false;
+
+  ZydecElf64Header header;
+  memcpy(&header, pFile, sizeof(header));
+
+  return header.ident[0] == 0x7F && header.ident[1] == 'E' && header.ident[2] == 'L' && header.ident[3] == 'F' && header.ident[4] == 2 /* 64 bit */ && header.ident[5] == 1 /* little endian */ && header.machine == ZydecElfMachineX64;
+}
+
+bool zydec_Image_LoadElf64(ZydecImage *pImage, const uint8_t *pFile, const size_t fileSize)
+{
+  if (pImage == nullptr || !zydec_Image_IsElf64(pFile, fileSize))
+    return false;
+
+  pImage->sectionCount = 0;
+  pImage->symbolCount = 0;
+  pImage->functionCount = 0;
+
+  ZydecElf64Header header;
+  memcpy(&header, pFile, sizeof(header));
+
+  pImage->entryPoint = (size_t)header.entry;
+
+  if (header.sectionHeaderOffset == 0)
+    return true; // Stripped of section headers entirely, so there's nothing to list.
+
+  if (header.sectionHeaderSize < sizeof(ZydecElf64SectionHeader))
+    return false;
+
+  size_t sectionHeaderCount = header.sectionHeaderCount;
+  size_t sectionNameIndex = header.sectionNameIndex;
+
+  // Images with a lot of sections store the actual values in the first section header.
+  if (sectionHeaderCount == 0 || sectionNameIndex == ZydecElfSectionIndexExtended)
+  {
+    ZydecElf64SectionHeader firstSection;
+
+    if (!zydec_Elf_GetSectionHeader(pFile, fileSize, &header, 0, &firstSection))
+      return false;
+
+    if (sectionHeaderCount == 0)
+      sectionHeaderCount = (size_t)firstSection.size;
+
+    if (sectionNameIndex == ZydecElfSectionIndexExtended)
+      sectionNameIndex = firstSection.link;
+  }
+
+  if (sectionHeaderCount > (fileSize - header.sectionHeaderOffset) / header.sectionHeaderSize)
+    return false;
+
+  ZydecElf64SectionHeader sectionNames;
+
+  if (!zydec_Elf_GetSectionHeader(pFile, fileSize, &header, sectionNameIndex, &sectionNames))
+    return false;
+
+  for (size_t i = 0; i < sectionHeaderCount; i++)
+  {
+    ZydecElf64SectionHeader section;
+
+    if (!zydec_Elf_GetSectionHeader(pFile, fileSize, &header, i, &section))
+      return false;
+
+    if (section.type != ZydecElfSectionTypeNoBits && (section.flags & ZydecElfSectionFlagAlloc) && section.size != 0)
+    {
+      if (section.offset > fileSize || section.size > fileSize - section.offset)
+        return false;
+
+      if (pImage->sectionCount < pImage->sectionCapacity)
+      {
+        ZydecImageSection *pSection = &pImage->pSections[pImage->sectionCount];
+        const char *name = zydec_Elf_GetString(pFile, fileSize, &sectionNames, section.name);
+
+        zydec_Image_SetSectionName(pSection, name != nullptr ? name : "", (size_t)-1);
+        pSection->virtualAddress = (size_t)section.address;
+        pSection->pData = pFile + section.offset;
+        pSection->size = (size_t)section.size;
+        pSection->isExecutable = !!(section.flags & ZydecElfSectionFlagExecInstr);
+        pSection->isWritable = !!(section.flags & ZydecElfSectionFlagWrite);
+      }
+
+      pImage->sectionCount++;
+    }
+
+    // `.dynsym` is also allocated, so it's listed as a section as well.
+    if (section.type == ZydecElfSectionTypeSymTab || section.type == ZydecElfSectionTypeDynSym)
+    {
+      ZydecElf64SectionHeader symbolNames;
+
+      if (section.entrySize < sizeof(ZydecElf64Symbol) || section.offset > fileSize || section.size > fileSize - section.offset || !zydec_Elf_GetSectionHeader(pFile, fileSize, &header, section.link, &symbolNames))
+        return false;
+
+      const size_t symbolCount = (size_t)(section.size / section.entrySize);
+
+      for (size_t j = 0; j < symbolCount; j++)
+      {
+        ZydecElf64Symbol symbol;
+        memcpy(&symbol, pFile + section.offset + j * section.entrySize, sizeof(symbol));
+
+        const uint8_t symbolType = symbol.info & 0xF;
+
+        if ((symbolType != ZydecElfSymbolTypeFunc && symbolType != ZydecElfSymbolTypeObject && symbolType != ZydecElfSymbolTypeIFunc) || symbol.sectionIndex == 0 /* undefined */ || symbol.value == 0)
+          continue;
+
+        const char *name = zydec_Elf_GetString(pFile, fileSize, &symbolNames, symbol.name);
+
+        if (name == nullptr || name[0] == '\0')
+          continue;
+
+        zydec_Image_AddSymbol(pImage, (size_t)symbol.value, (size_t)symbol.size, name);
+
+        if (symbolType != ZydecElfSymbolTypeObject && symbol.size != 0)
+          zydec_Image_AddFunction(pImage, (size_t)symbol.value, (size_t)symbol.size);
+      }
+    }
+  }
+
+  return zydec_Image_Finish(pImage);
+}
+
+struct ZydecPeSectionHeader
+{
+  char name[8];
+  uint32_t virtualSize;
+  uint32_t virtualAddress;
+  uint32_t rawDataSize;
+  uint32_t rawDataOffset;
+  uint32_t relocationsOffset;
+  uint32_t lineNumbersOffset;
+  uint16_t relocationCount;
+  uint16_t lineNumberCount;
+  uint32_t characteristics;
+};
+
+struct ZydecPeExportDirectory
+{
+  uint32_t characteristics;
+  uint32_t timeDateStamp;
+  uint16_t majorVersion;
+  uint16_t minorVersion;
+  uint32_t name;
+  uint32_t ordinalBase;
+  uint32_t functionCount;
+  uint32_t nameCount;
+  uint32_t functionsAddress;
+  uint32_t namesAddress;
+  uint32_t nameOrdinalsAddress;
+};
+
+struct ZydecPeImportDescriptor
+{
+  uint32_t lookupTableAddress;
+  uint32_t timeDateStamp;
+  uint32_t forwarderChain;
+  uint32_t name;
+  uint32_t addressTableAddress;
+};
+
+struct ZydecPeRuntimeFunction
+{
+  uint32_t beginAddress;
+  uint32_t endAddress;
+  uint32_t unwindInfoAddress;
+};
+
+static_assert(sizeof(ZydecPeSectionHeader) == 40 && sizeof(ZydecPeExportDirectory) == 40 && sizeof(ZydecPeImportDescriptor) == 20 && sizeof(ZydecPeRuntimeFunction) == 12, "PE structure layout doesn't match the specification.");
+
+static constexpr uint16_t ZydecPeMachineX64 = 0x8664;
+static constexpr uint16_t ZydecPeOptionalHeaderMagic64 = 0x20B;
+static constexpr size_t ZydecPeCoffHeaderSize = 20;
+static constexpr size_t ZydecPeOptionalHeaderEntryPointOffset = 16;
+static constexpr size_t ZydecPeOptionalHeaderImageBaseOffset = 24;
+static constexpr size_t ZydecPeOptionalHeaderDirectoryCountOffset = 108;
+static constexpr size_t ZydecPeOptionalHeaderDirectoriesOffset = 112;
+static constexpr size_t ZydecPeDirectoryExport = 0;
+static constexpr size_t ZydecPeDirectoryImport = 1;
+static constexpr size_t ZydecPeDirectoryException = 3;
+static constexpr uint32_t ZydecPeSectionCode = 0x20;
+static constexpr uint32_t ZydecPeSectionExecute = 0x20000000;
+static constexpr uint32_t ZydecPeSectionWrite = 0x80000000;
+static constexpr uint64_t ZydecPeImportByOrdinal = 0x8000000000000000ULL;
+
+struct ZydecPeView
+{
+  const uint8_t *pFile;
+  size_t fileSize;
+  const uint8_t *pSectionHeaders;
+  size_t sectionCount;
+};
+
+template <typename T>
+static T zydec_Pe_Read(const uint8_t *pData)
+{
+  T value;
+  memcpy(&value, pData, sizeof(T));
+  return value;
+}
+
+// Returns the contents of the image at `rva`, if `size` bytes of it are stored in the file. `*pAvailableSize` is the number of bytes stored there.
+static const uint8_t * zydec_Pe_GetData(const ZydecPeView *pView, const uint32_t rva, const size_t size, size_t *pAvailableSize = nullptr)
+{
+  for (size_t i = 0; i < pView->sectionCount; i++)
+  {
+    const ZydecPeSectionHeader section = zydec_Pe_Read<ZydecPeSectionHeader>(pView->pSectionHeaders + i * sizeof(ZydecPeSectionHeader));
+    const size_t storedSize = (section.virtualSize != 0 && section.virtualSize < section.rawDataSize) ? section.virtualSize : section.rawDataSize;
+
+    if (rva < section.virtualAddress || rva - section.virtualAddress >= storedSize)
+      continue;
+
+    if (section.rawDataOffset > pView->fileSize || storedSize > pView->fileSize - section.rawDataOffset)
+      return nullptr;
+
+    const size_t offset = rva - section.virtualAddress;
+
+    if (size > storedSize - offset)
+      return nullptr;
+
+    if (pAvailableSize != nullptr)
+      *pAvailableSize = storedSize - offset;
+
+    return pView->pFile + section.rawDataOffset + offset;
+  }
+
+  return nullptr;
+}
+
+static const char * zydec_Pe_GetString(const ZydecPeView *pView, const uint32_t rva)
+{
+  size_t availableSize = 0;
+  const char *string = reinterpret_cast<const char *>(zydec_Pe_GetData(pView, rva, 1, &availableSize));
+
+  if (string == nullptr || memchr(string, '\0', availableSize) == nullptr)
+    return nullptr;
+
+  return string;
+}
+
+static bool zydec_Pe_LoadExports(ZydecImage *pImage, const ZydecPeView *pView, const size_t imageBase, const uint32_t directoryAddress, const uint32_t directorySize)
+{
+  const uint8_t *pDirectory = zydec_Pe_GetData(pView, directoryAddress, sizeof(ZydecPeExportDirectory));
 
-    case ZydecFormattingInfo::BitScanR:
-      newName &= 0xFFFF0000;
-      newName |= 0xE3F3; // `Bsr_`
-      break;
+  if (pDirectory == nullptr)
+    return false;
 
-    case ZydecFormattingInfo::PopCnt:
-      newName &= 0xFFFF0000;
-      newName |= 0xE1B3; // `Pop_`
-      break;
+  const ZydecPeExportDirectory directory = zydec_Pe_Read<ZydecPeExportDirectory>(pDirectory);
 
-    case ZydecFormattingInfo::AddressOf:
-      newName &= 0xFFFF0000;
-      newName |= 0xD4B0; // `Loc_`
-      break;
+  const uint8_t *pFunctions = zydec_Pe_GetData(pView, directory.functionsAddress, directory.functionCount * sizeof(uint32_t));
+  const uint8_t *pNames = zydec_Pe_GetData(pView, directory.namesAddress, directory.nameCount * sizeof(uint32_t));
+  const uint8_t *pNameOrdinals = zydec_Pe_GetData(pView, directory.nameOrdinalsAddress, directory.nameCount * sizeof(uint16_t));
 
-    case ZydecFormattingInfo::Mov:
-    case ZydecFormattingInfo::ConditionalMov:
-      newName &= 0xFFFF0000;
-      newName |= 0xE7B1; // `Mov_`
-      break;
+  if (directory.nameCount != 0 && (pFunctions == nullptr || pNames == nullptr || pNameOrdinals == nullptr))
+    return false;
 
-    case ZydecFormattingInfo::Set:
-      newName &= 0xFFFF0000;
-      newName |= 0xE58C; // `Set_`
-      break;
+  for (size_t i = 0; i < directory.nameCount; i++)
+  {
+    const uint16_t ordinal = zydec_Pe_Read<uint16_t>(pNameOrdinals + i * sizeof(uint16_t));
 
-    case ZydecFormattingInfo::Cmp:
-      newName &= 0xFFFF0000;
-      newName |= 0xE1F0; // `Cmp_`
-      break;
+    if (ordinal >= directory.functionCount)
+      continue;
 
-    case ZydecFormattingInfo::Pack:
-    case ZydecFormattingInfo::Unpack:
-      newName &= 0xFFFF0000;
-      newName |= 0xDC74; // `Pak_`
-      break;
+    const uint32_t functionAddress = zydec_Pe_Read<uint32_t>(pFunctions + ordinal * sizeof(uint32_t));
 
-    case ZydecFormattingInfo::Abs:
-      newName &= 0xFFFF0000;
-      newName |= 0xE4F1; // `Abs_`
-      break;
+    // Forwarded to another module.
+    if (functionAddress >= directoryAddress && functionAddress - directoryAddress < directorySize)
+      continue;
 
-    case ZydecFormattingInfo::Blend:
-      newName &= 0xFFFF0000;
-      newName |= 0xD5F2; // `Bld_`
-      break;
+    const char *name = zydec_Pe_GetString(pView, zydec_Pe_Read<uint32_t>(pNames + i * sizeof(uint32_t)));
 
-    case ZydecFormattingInfo::Broadcast:
-      newName &= 0xFFFF0000;
-      newName |= 0xE5F3; // `Bst_`
-      break;
+    if (name != nullptr && name[0] != '\0' && functionAddress != 0)
+      zydec_Image_AddSymbol(pImage, imageBase + functionAddress, 0, name);
+  }
 
-    case ZydecFormattingInfo::Shuffle:
-      newName &= 0xFFFF0000;
-      newName |= 0xD7EE; // `Shf_`
-      break;
+  return true;
+}
 
-    case ZydecFormattingInfo::Permute:
-      newName &= 0xFFFF0000;
-      newName |= 0xDE89; // `Pem_`
-      break;
+static bool zydec_Pe_LoadImports(ZydecImage *pImage, const ZydecPeView *pView, const size_t imageBase, const uint32_t directoryAddress)
+{
+  for (uint32_t descriptorAddress = directoryAddress; ; descriptorAddress += sizeof(ZydecPeImportDescriptor))
+  {
+    const uint8_t *pDescriptor = zydec_Pe_GetData(pView, descriptorAddress, sizeof(ZydecPeImportDescriptor));
 
-    case ZydecFormattingInfo::Round:
-      newName &= 0xFFFF0000;
-      newName |= 0xD5B5; // `Rod_`
+    if (pDescriptor == nullptr)
+      return false;
+
+    const ZydecPeImportDescriptor descriptor = zydec_Pe_Read<ZydecPeImportDescriptor>(pDescriptor);
+
+    if (descriptor.addressTableAddress == 0)
+      return true;
+
+    // The address table is overwritten with the addresses of the imports when loading, but may also contain the lookup table on disk.
+    const uint32_t lookupTableAddress = descriptor.lookupTableAddress != 0 ? descriptor.lookupTableAddress : descriptor.addressTableAddress;
+
+    for (uint32_t i = 0; ; i++)
+    {
+      const uint8_t *pEntry = zydec_Pe_GetData(pView, lookupTableAddress + i * (uint32_t)sizeof(uint64_t), sizeof(uint64_t));
+
+      if (pEntry == nullptr)
+        return false;
+
+      const uint64_t entry = zydec_Pe_Read<uint64_t>(pEntry);
+
+      if (entry == 0)
+        break;
+
+      if (entry & ZydecPeImportByOrdinal)
+        continue;
+
+      // Skip the hint of the name entry.
+      const char *name = zydec_Pe_GetString(pView, (uint32_t)(entry & 0x7FFFFFFF) + (uint32_t)sizeof(uint16_t));
+
+      if (name != nullptr && name[0] != '\0')
+        zydec_Image_AddSymbol(pImage, imageBase + descriptor.addressTableAddress + i * sizeof(uint64_t), sizeof(uint64_t), name);
+    }
+  }
+}
+
+static bool zydec_Pe_LoadRuntimeFunctions(ZydecImage *pImage, const ZydecPeView *pView, const size_t imageBase, const uint32_t directoryAddress, const uint32_t directorySize)
+{
+  const size_t functionCount = directorySize / sizeof(ZydecPeRuntimeFunction);
+  const uint8_t *pFunctions = zydec_Pe_GetData(pView, directoryAddress, functionCount * sizeof(ZydecPeRuntimeFunction));
+
+  if (pFunctions == nullptr)
+    return false;
+
+  for (size_t i = 0; i < functionCount; i++)
+  {
+    const ZydecPeRuntimeFunction function = zydec_Pe_Read<ZydecPeRuntimeFunction>(pFunctions + i * sizeof(ZydecPeRuntimeFunction));
+
+    if (function.endAddress > function.beginAddress)
+      zydec_Image_AddFunction(pImage, imageBase + function.beginAddress, function.endAddress - function.beginAddress);
+  }
+
+  return true;
+}
+
+bool zydec_Image_IsPe64(const uint8_t *pFile, const size_t fileSize)
+{
+  if (pFile == nullptr || fileSize < 0x40 || pFile[0] != 'M' || pFile[1] != 'Z')
+    return false;
+
+  const uint32_t headerOffset = zydec_Pe_Read<uint32_t>(pFile + 0x3C);
+
+  if (headerOffset > fileSize || fileSize - headerOffset < 4 + ZydecPeCoffHeaderSize + sizeof(uint16_t))
+    return false;
+
+  const uint8_t *pHeader = pFile + headerOffset;
+
+  return pHeader[0] == 'P' && pHeader[1] == 'E' && pHeader[2] == 0 && pHeader[3] == 0 && zydec_Pe_Read<uint16_t>(pHeader + 4) == ZydecPeMachineX64 && zydec_Pe_Read<uint16_t>(pHeader + 4 + ZydecPeCoffHeaderSize) == ZydecPeOptionalHeaderMagic64;
+}
+
+bool zydec_Image_LoadPe64(ZydecImage *pImage, const uint8_t *pFile, const size_t fileSize)
+{
+  if (pImage == nullptr || !zydec_Image_IsPe64(pFile, fileSize))
+    return false;
+
+  pImage->sectionCount = 0;
+  pImage->symbolCount = 0;
+  pImage->functionCount = 0;
+
+  const uint8_t *pCoffHeader = pFile + zydec_Pe_Read<uint32_t>(pFile + 0x3C) + 4;
+  const size_t sectionCount = zydec_Pe_Read<uint16_t>(pCoffHeader + 2);
+  const size_t optionalHeaderSize = zydec_Pe_Read<uint16_t>(pCoffHeader + 16);
+  const uint8_t *pOptionalHeader = pCoffHeader + ZydecPeCoffHeaderSize;
+
+  if (optionalHeaderSize < ZydecPeOptionalHeaderDirectoriesOffset || (size_t)(pFile + fileSize - pOptionalHeader) < optionalHeaderSize)
+    return false;
+
+  ZydecPeView view;
+  view.pFile = pFile;
+  view.fileSize = fileSize;
+  view.pSectionHeaders = pOptionalHeader + optionalHeaderSize;
+  view.sectionCount = sectionCount;
+
+  if ((size_t)(pFile + fileSize - view.pSectionHeaders) < sectionCount * sizeof(ZydecPeSectionHeader))
+    return false;
+
+  const size_t imageBase = (size_t)zydec_Pe_Read<uint64_t>(pOptionalHeader + ZydecPeOptionalHeaderImageBaseOffset);
+  pImage->entryPoint = imageBase + zydec_Pe_Read<uint32_t>(pOptionalHeader + ZydecPeOptionalHeaderEntryPointOffset);
+
+  for (size_t i = 0; i < sectionCount; i++)
+  {
+    const ZydecPeSectionHeader section = zydec_Pe_Read<ZydecPeSectionHeader>(view.pSectionHeaders + i * sizeof(ZydecPeSectionHeader));
+
+    if (section.rawDataSize == 0)
+      continue;
+
+    // The remainder of the section (up to `virtualSize`) is zero initialized, rather than stored in the file.
+    const size_t storedSize = (section.virtualSize != 0 && section.virtualSize < section.rawDataSize) ? section.virtualSize : section.rawDataSize;
+
+    if (section.rawDataOffset > fileSize || storedSize > fileSize - section.rawDataOffset)
+      return false;
+
+    if (pImage->sectionCount < pImage->sectionCapacity)
+    {
+      ZydecImageSection *pSection = &pImage->pSections[pImage->sectionCount];
+
+      zydec_Image_SetSectionName(pSection, section.name, sizeof(section.name));
+      pSection->virtualAddress = imageBase + section.virtualAddress;
+      pSection->pData = pFile + section.rawDataOffset;
+      pSection->size = storedSize;
+      pSection->isExecutable = !!(section.characteristics & (ZydecPeSectionCode | ZydecPeSectionExecute));
+      pSection->isWritable = !!(section.characteristics & ZydecPeSectionWrite);
+    }
+
+    pImage->sectionCount++;
+  }
+
+  const size_t directoryCount = zydec_Pe_Read<uint32_t>(pOptionalHeader + ZydecPeOptionalHeaderDirectoryCountOffset);
+
+  for (size_t i = 0; i < directoryCount && (i + 1) * 2 * sizeof(uint32_t) <= optionalHeaderSize - ZydecPeOptionalHeaderDirectoriesOffset; i++)
+  {
+    const uint32_t address = zydec_Pe_Read<uint32_t>(pOptionalHeader + ZydecPeOptionalHeaderDirectoriesOffset + i * 2 * sizeof(uint32_t));
+    const uint32_t size = zydec_Pe_Read<uint32_t>(pOptionalHeader + ZydecPeOptionalHeaderDirectoriesOffset + i * 2 * sizeof(uint32_t) + sizeof(uint32_t));
+
+    if (address == 0 || size == 0)
+      continue;
+
+    const size_t symbolCount = pImage->symbolCount;
+    const size_t functionCount = pImage->functionCount;
+    bool success = true;
+
+    switch (i)
+    {
+    case ZydecPeDirectoryExport:
+      success = zydec_Pe_LoadExports(pImage, &view, imageBase, address, size);
       break;
 
-    case ZydecFormattingInfo::Convert:
-      newName &= 0xFFFF0000;
-      newName |= 0xE7A9; // `Con_`
+    case ZydecPeDirectoryImport:
+      success = zydec_Pe_LoadImports(pImage, &view, imageBase, address);
       break;
 
-    case ZydecFormattingInfo::DotProduct:
-      newName &= 0xFFFF0000;
-      newName |= 0xE5AA; // `Dot_`
+    case ZydecPeDirectoryException:
+      success = zydec_Pe_LoadRuntimeFunctions(pImage, &view, imageBase, address, size);
       break;
+    }
 
-    case ZydecFormattingInfo::Extract:
-      newName &= 0xFFFF0000;
-      newName |= 0xE5F4; // `Ext_`
+    // The directories only add names & boundaries, so the sections are still usable without a malformed one.
+    if (!success)
+    {
+      pImage->symbolCount = symbolCount;
+      pImage->functionCount = functionCount;
+    }
+  }
+
+  return zydec_Image_Finish(pImage);
+}
+
+bool zydec_Image_Load(ZydecImage *pImage, const uint8_t *pFile, const size_t fileSize)
+{
+  if (zydec_Image_IsElf64(pFile, fileSize))
+    return zydec_Image_LoadElf64(pImage, pFile, fileSize);
+  else if (zydec_Image_IsPe64(pFile, fileSize))
+    return zydec_Image_LoadPe64(pImage, pFile, fileSize);
+  else
+    return false;
+}
+
+const ZydecImageSection * zydec_Image_FindSection(const ZydecImage *pImage, const size_t virtualAddress)
+{
+  for (size_t i = 0; i < pImage->sectionCount; i++)
+    if (virtualAddress >= pImage->pSections[i].virtualAddress && virtualAddress - pImage->pSections[i].virtualAddress < pImage->pSections[i].size)
+      return &pImage->pSections[i];
+
+  return nullptr;
+}
+
+const ZydecImageFunction * zydec_Image_FindFunction(const ZydecImage *pImage, const size_t virtualAddress)
+{
+  // Find the first function after `virtualAddress`.
+  size_t begin = 0;
+  size_t end = pImage->functionCount;
+
+  while (begin < end)
+  {
+    const size_t mid = begin + (end - begin) / 2;
+
+    if (pImage->pFunctions[mid].virtualAddress <= virtualAddress)
+      begin = mid + 1;
+    else
+      end = mid;
+  }
+
+  if (begin == 0 || virtualAddress - pImage->pFunctions[begin - 1].virtualAddress >= pImage->pFunctions[begin - 1].size)
+    return nullptr;
+
+  return &pImage->pFunctions[begin - 1];
+}
+
+bool zydec_Image_SplitCodeAtFunctions(const ZydecImage *pImage, const size_t codeVirtualAddress, const size_t codeSize, const size_t minRangeSize, ZydecCodeRange *pRanges, const size_t rangeCapacity, size_t *pRangeCount)
+{
+  *pRangeCount = 0;
+
+  if (codeSize == 0)
+    return true;
+
+  size_t rangeStart = 0;
+
+  for (size_t i = 0; i < pImage->functionCount; i++)
+  {
+    const size_t functionAddress = pImage->pFunctions[i].virtualAddress;
+
+    if (functionAddress < codeVirtualAddress)
+      continue;
+
+    const size_t offset = functionAddress - codeVirtualAddress;
+
+    if (offset >= codeSize)
       break;
 
-    case ZydecFormattingInfo::Gather:
-      newName &= 0xFFFF0000;
-      newName |= 0xE56D; // `Gat_`
-      break;
+    if (offset - rangeStart < minRangeSize || offset == rangeStart)
+      continue;
+
+    if (*pRangeCount == rangeCapacity)
+      return false;
+
+    pRanges[*pRangeCount].offset = rangeStart;
+    pRanges[*pRangeCount].size = offset - rangeStart;
+    (*pRangeCount)++;
+
+    rangeStart = offset;
+  }
+
+  if (*pRangeCount == rangeCapacity)
+    return false;
+
+  pRanges[*pRangeCount].offset = rangeStart;
+  pRanges[*pRangeCount].size = codeSize - rangeStart;
+  (*pRangeCount)++;
+
+  return true;
+}
+
+const ZydecImageSymbol * zydec_Image_FindSymbol(const ZydecImage *pImage, const size_t virtualAddress)
+{
+  // Find the first symbol after `virtualAddress`.
+  size_t begin = 0;
+  size_t end = pImage->symbolCount;
+
+  while (begin < end)
+  {
+    const size_t mid = begin + (end - begin) / 2;
+
+    if (pImage->pSymbols[mid].virtualAddress <= virtualAddress)
+      begin = mid + 1;
+    else
+      end = mid;
+  }
+
+  for (size_t i = 0; i < ZydecImageSymbolLookBehind && begin > i; i++)
+  {
+    const ZydecImageSymbol *pSymbol = &pImage->pSymbols[begin - i - 1];
+
+    if (pSymbol->virtualAddress == virtualAddress || virtualAddress - pSymbol->virtualAddress < pSymbol->size)
+      return pSymbol;
+  }
+
+  return nullptr;
+}
+
+const ZydecImageSymbol * zydec_Image_FindSymbolByName(const ZydecImage *pImage, const char *name)
+{
+  for (size_t i = 0; i < pImage->symbolCount; i++)
+    if (strcmp(pImage->pSymbols[i].name, name) == 0)
+      return &pImage->pSymbols[i];
+
+  return nullptr;
+}
+
+bool zydec_Image_ResolveAddressToFriendlyName(const size_t virtualAddress, char *friendlyName, const size_t friendlyNameCapacity, size_t *pOffsetFromStart, void *pUserData)
+{
+  const ZydecImageSymbol *pSymbol = zydec_Image_FindSymbol(static_cast<const ZydecImage *>(pUserData), virtualAddress);
+
+  if (pSymbol == nullptr)
+    return false;
+
+  const size_t length = strlen(pSymbol->name);
+
+  if (length >= friendlyNameCapacity)
+    return false;
+
+  memcpy(friendlyName, pSymbol->name, length + 1);
+  *pOffsetFromStart = virtualAddress - pSymbol->virtualAddress;
+
+  return true;
+}
+
+bool zydec_Image_ReadConstantMemory(const size_t virtualAddress, void *pData, const size_t size, void *pMemoryUserData)
+{
+  const ZydecImage *pImage = reinterpret_cast<const ZydecImage *>(pMemoryUserData);
+  const ZydecImageSection *pSection = zydec_Image_FindSection(pImage, virtualAddress);
+
+  if (pSection == nullptr || pSection->isWritable || size > pSection->size - (virtualAddress - pSection->virtualAddress))
+    return false;
+
+  memcpy(pData, pSection->pData + (virtualAddress - pSection->virtualAddress), size);
+
+  return true;
+}
+
+void zydec_Image_AttachToFormattingInfo(const ZydecImage *pImage, ZydecFormattingInfo *pInfo)
+{
+  pInfo->pResolveAddressToFriendlyName = zydec_Image_ResolveAddressToFriendlyName;
+  pInfo->pUserData = const_cast<ZydecImage *>(pImage);
+  pInfo->pReadConstantMemory = zydec_Image_ReadConstantMemory;
+  pInfo->pMemoryUserData = const_cast<ZydecImage *>(pImage);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+struct ZydecSymbolIndexName
+{
+  const char *name; // of the symbol that has been interned first.
+  uint32_t offset;
+  uint32_t length;
+};
+
+static size_t zydec_SymbolIndex_HashName(const char *name, size_t *pLength)
+{
+  // FNV-1a.
+  uint64_t hash = 0xCBF29CE484222325ULL;
+  size_t length = 0;
+
+  for (; name[length] != '\0'; length++)
+    hash = (hash ^ (uint8_t)name[length]) * 0x100000001B3ULL;
+
+  *pLength = length;
+
+  return (size_t)hash;
+}
+
+static size_t zydec_SymbolIndex_GetCacheSlot(const size_t virtualAddress)
+{
+  return (size_t)(((uint64_t)virtualAddress * 0x9E3779B97F4A7C15ULL) >> 32) % ZydecSymbolIndexCacheSize;
+}
+
+// Fills the subtree at `node` with the entries starting at `rank` (in order), returning the rank after the last one.
+static size_t zydec_SymbolIndex_FillSearchTree(ZydecSymbolIndex *pIndex, size_t rank, const size_t node)
+{
+  if (node > pIndex->entryCount)
+    return rank;
+
+  rank = zydec_SymbolIndex_FillSearchTree(pIndex, rank, node * 2);
+
+  pIndex->pSearchKeys[node] = pIndex->pEntries[rank].virtualAddress;
+  pIndex->pSearchRanks[node] = (uint32_t)rank;
+  rank++;
+
+  return zydec_SymbolIndex_FillSearchTree(pIndex, rank, node * 2 + 1);
+}
+
+bool zydec_SymbolIndex_Build(ZydecSymbolIndex *pIndex, const ZydecImageSymbol *pSymbols, const size_t symbolCount)
+{
+  if (pIndex == nullptr || (pSymbols == nullptr && symbolCount != 0) || symbolCount >= UINT32_MAX)
+    return false;
+
+  pIndex->entryCount = 0;
+  pIndex->namesSize = 0;
+
+  for (size_t i = 0; i < ZydecSymbolIndexCacheSize; i++)
+    pIndex->cache[i].store(0, std::memory_order_relaxed);
+
+  size_t nameSlotCount = 64;
+
+  while (nameSlotCount < symbolCount * 2)
+    nameSlotCount *= 2;
 
-    case ZydecFormattingInfo::Max:
-      newName &= 0xFFFF0000;
-      newName |= 0xE972; // `Max_`
-      break;
+  ZydecImageSymbol *pSorted = static_cast<ZydecImageSymbol *>(malloc(sizeof(ZydecImageSymbol) * (symbolCount + 1)));
+  ZydecSymbolIndexName *pNameSlots = static_cast<ZydecSymbolIndexName *>(calloc(nameSlotCount, sizeof(ZydecSymbolIndexName)));
 
-    case ZydecFormattingInfo::Min:
-      newName &= 0xFFFF0000;
-      newName |= 0xDF9C; // `Min_`
-      break;
+  if (pSorted == nullptr || pNameSlots == nullptr)
+  {
+    free(pSorted);
+    free(pNameSlots);
+    return false;
+  }
 
-    case ZydecFormattingInfo::Mask:
-      newName &= 0xFFFF0000;
-      newName |= 0xE472; // `Mas_`
-      break;
+  if (symbolCount != 0)
+    memcpy(pSorted, pSymbols, sizeof(ZydecImageSymbol) * symbolCount);
 
-    case ZydecFormattingInfo::Test:
-      newName &= 0xFFFF0000;
-      newName |= 0xE48D; // `Tes_`
-      break;
+  const size_t entryCount = zydec_Image_SortSymbols(pSorted, symbolCount);
+  const bool hasEntryStorage = entryCount <= pIndex->entryCapacity;
+  bool success = true;
 
-    case ZydecFormattingInfo::Not:
-      newName &= 0xFFFF0000;
-      newName |= 0xE5B2; // `Not_`
-      break;
+  // Intern the names.
+  for (size_t i = 0; i < entryCount; i++)
+  {
+    size_t length;
+    size_t slot = zydec_SymbolIndex_HashName(pSorted[i].name, &length) & (nameSlotCount - 1);
 
-    case ZydecFormattingInfo::XNor:
-      newName &= 0xFFFF0000;
-      newName |= 0x49E9; // `x_no`
-      break;
+    while (pNameSlots[slot].name != nullptr && (pNameSlots[slot].length != length || memcmp(pNameSlots[slot].name, pSorted[i].name, length) != 0))
+      slot = (slot + 1) & (nameSlotCount - 1);
 
-    default:
-      break;
+    if (pNameSlots[slot].name == nullptr)
+    {
+      if (pIndex->namesSize + length + 1 > UINT32_MAX)
+      {
+        success = false;
+        break;
+      }
+
+      pNameSlots[slot].name = pSorted[i].name;
+      pNameSlots[slot].offset = (uint32_t)pIndex->namesSize;
+      pNameSlots[slot].length = (uint32_t)length;
+
+      pIndex->namesSize += length + 1;
+    }
+
+    if (hasEntryStorage)
+    {
+      ZydecSymbolIndexEntry *pEntry = &pIndex->pEntries[i];
+      pEntry->virtualAddress = pSorted[i].virtualAddress;
+      pEntry->size = pSorted[i].size;
+      pEntry->nameOffset = pNameSlots[slot].offset;
+      pEntry->nameLength = pNameSlots[slot].length;
     }
   }
 
-  const bool result = zydec_LinearContext_WriteRegisterName(pBufferPos, pRemainingSize, reg, newName);
+  pIndex->entryCount = entryCount;
 
-  pInfo->assignedRegister[pInfo->assignedRegisterCount] = reg;
-  pInfo->assignedRegisterValue[pInfo->assignedRegisterCount] = newName;
-  pInfo->assignedRegisterCount++;
+  if (success && hasEntryStorage && pIndex->namesSize <= pIndex->namesCapacity)
+  {
+    for (size_t i = 0; i < nameSlotCount; i++)
+      if (pNameSlots[i].name != nullptr)
+        memcpy(pIndex->pNames + pNameSlots[i].offset, pNameSlots[i].name, pNameSlots[i].length + 1);
 
-  return result;
-}
+    zydec_SymbolIndex_FillSearchTree(pIndex, 0, 1);
+  }
+  else
+  {
+    success = false;
+  }
 
-void zydec_LinearContext_HintRegister(const ZydisRegister reg, void *pUserData)
-{
-  ZydecLinearContextFormatInfo *pInfo = static_cast<ZydecLinearContextFormatInfo *>(pUserData);
-  pInfo->regHint = reg;
+  free(pSorted);
+  free(pNameSlots);
+
+  return success;
 }
 
-void zydec_LinearContext_HintValue(const int64_t value, void *pUserData)
+const ZydecSymbolIndexEntry * zydec_SymbolIndex_Find(ZydecSymbolIndex *pIndex, const size_t virtualAddress)
 {
-  ZydecLinearContextFormatInfo *pInfo = static_cast<ZydecLinearContextFormatInfo *>(pUserData);
-  pInfo->hasValHint = true;
-  pInfo->valHint = value;
+  std::atomic<uint64_t> *pCacheSlot = &pIndex->cache[zydec_SymbolIndex_GetCacheSlot(virtualAddress)];
+  const uint64_t cached = pCacheSlot->load(std::memory_order_relaxed);
+
+  // The entry has to contain the address as well, so a matching tag of a different address can't resolve to the wrong entry.
+  if ((uint32_t)cached == (uint32_t)virtualAddress && (cached >> 32) != 0)
+  {
+    const ZydecSymbolIndexEntry *pEntry = &pIndex->pEntries[(cached >> 32) - 1];
+
+    if (virtualAddress >= pEntry->virtualAddress && (virtualAddress == pEntry->virtualAddress || virtualAddress - pEntry->virtualAddress < pEntry->size))
+      return pEntry;
+  }
+
+  // Find the first entry after `virtualAddress`. The node of the last left turn is the lowest search key above it.
+  const size_t count = pIndex->entryCount;
+  size_t node = 1;
+  size_t upperNode = 0;
+
+  while (node <= count)
+  {
+    // The great-grandchildren of the node share a cache line.
+    _mm_prefetch(reinterpret_cast<const char *>(pIndex->pSearchKeys + node * 8), _MM_HINT_T0);
+
+    const bool isAbove = pIndex->pSearchKeys[node] > virtualAddress;
+    upperNode = isAbove ? node : upperNode;
+    node = node * 2 + (isAbove ? 0 : 1);
+  }
+
+  const size_t end = upperNode == 0 ? count : pIndex->pSearchRanks[upperNode];
+
+  for (size_t i = 0; i < ZydecImageSymbolLookBehind && end > i; i++)
+  {
+    const size_t entryIndex = end - i - 1;
+    const ZydecSymbolIndexEntry *pEntry = &pIndex->pEntries[entryIndex];
+
+    if (pEntry->virtualAddress == virtualAddress || virtualAddress - pEntry->virtualAddress < pEntry->size)
+    {
+      pCacheSlot->store(((uint64_t)(entryIndex + 1) << 32) | (uint32_t)virtualAddress, std::memory_order_relaxed);
+      return pEntry;
+    }
+  }
+
+  return nullptr;
 }
 
-void zydec_LinearContext_HintOperation(const ZydecFormattingInfo::HintOperation operation, void *pUserData)
+const char * zydec_SymbolIndex_GetName(const ZydecSymbolIndex *pIndex, const ZydecSymbolIndexEntry *pEntry)
 {
-  ZydecLinearContextFormatInfo *pInfo = static_cast<ZydecLinearContextFormatInfo *>(pUserData);
-  pInfo->opHint = operation;
+  return pIndex->pNames + pEntry->nameOffset;
 }
 
-bool zydec_TranslateInstructionWithLinearContext(ZydecLinearContext *pContext, const ZydisDecodedInstruction *pInstruction, const ZydisDecodedOperand *pOperands, const size_t operandCount, const size_t virtualAddress, char *buffer, const size_t bufferCapacity, bool *pHasTranslation, ZydecFormattingInfo *pInfo)
+bool zydec_SymbolIndex_ResolveAddressToFriendlyName(const size_t virtualAddress, char *friendlyName, const size_t friendlyNameCapacity, size_t *pOffsetFromStart, void *pUserData)
 {
-  ZydecLinearContextFormatInfo formatContextInfo;
-  formatContextInfo.pContext = pContext;
-  formatContextInfo.pOriginalInfo = pInfo;
-
-  ZydecFormattingInfo newInfo = *pInfo;
-  newInfo.simplifyValueSelfModification = false;
-  newInfo.pRegUserData = newInfo.pCallUserData = &formatContextInfo;
-  newInfo.pWriteRegister = zydec_LinearContext_WriteRegister;
-  newInfo.pWriteResultRegister = zydec_LinearContext_WriteResultRegister;
-  newInfo.pAfterCall = zydec_LinearContext_AfterCall;
+  ZydecSymbolIndex *pIndex = static_cast<ZydecSymbolIndex *>(pUserData);
+  const ZydecSymbolIndexEntry *pEntry = zydec_SymbolIndex_Find(pIndex, virtualAddress);
 
-  newInfo.pSetHintReg = zydec_LinearContext_HintRegister;
-  newInfo.pSetHintVal = zydec_LinearContext_HintValue;
-  newInfo.pSetHintOp = zydec_LinearContext_HintOperation;
+  if (pEntry == nullptr || pEntry->nameLength >= friendlyNameCapacity)
+    return false;
 
-  const bool result = zydec_TranslateInstructionWithoutContext(pInstruction, pOperands, operandCount, virtualAddress, buffer, bufferCapacity, pHasTranslation, &newInfo);
+  memcpy(friendlyName, pIndex->pNames + pEntry->nameOffset, pEntry->nameLength + 1);
+  *pOffsetFromStart = virtualAddress - pEntry->virtualAddress;
 
-  for (size_t i = 0; i < formatContextInfo.assignedRegisterCount; i++)
-    pContext->regInfo[formatContextInfo.assignedRegister[i]] = formatContextInfo.assignedRegisterValue[i];
+  return true;
+}
 
-  return result;
+void zydec_SymbolIndex_AttachToFormattingInfo(ZydecSymbolIndex *pIndex, ZydecFormattingInfo *pInfo)
+{
+  pInfo->pResolveAddressToFriendlyName = zydec_SymbolIndex_ResolveAddressToFriendlyName;
+  pInfo->pUserData = pIndex;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 
-static const char RegisterNameLut[][32] = {
+static constexpr ZydecLiteral RegisterNameLut[] = {
 
     "",
 
@@ -7273,7 +7087,7 @@ static const char RegisterNameLut[][32] = {
 
 ////////////////////////////////////////////////////////////////////////////////
 
-const char *zydec_ResolveRegisterPrefix(const ZydisRegister reg)
+ZydecLiteral zydec_ResolveRegisterPrefix(const ZydisRegister reg)
 {
   switch (reg)
   {
@@ -7496,7 +7310,7 @@ const char *zydec_ResolveRegisterPrefix(const ZydisRegister reg)
   }
 }
 
-const char *zydec_ResolveRegisterPostfix(const ZydisRegister reg)
+ZydecLiteral zydec_ResolveRegisterPostfix(const ZydisRegister reg)
 {
   switch (reg)
   {
@@ -7637,7 +7451,7 @@ ZydisRegister zydec_ResolveBaseRegister(const ZydisRegister reg)
 bool zydec_WriteUInt(char **pBufferPos, size_t *pRemainingSize, const uint64_t value)
 {
   if (value == 0)
-    return zydec_WriteRaw(pBufferPos, pRemainingSize, "0");
+    return zydec_WriteLiteral(pBufferPos, pRemainingSize, "0");
 
   char buffer[20];
   buffer[sizeof(buffer) - 1] = '\0';
@@ -7656,13 +7470,13 @@ bool zydec_WriteUInt(char **pBufferPos, size_t *pRemainingSize, const uint64_t v
   else
     bufFromEnd++;
 
-  return zydec_WriteRaw(pBufferPos, pRemainingSize, bufFromEnd);
+  return zydec_WriteRaw(pBufferPos, pRemainingSize, bufFromEnd, (size_t)(buffer + sizeof(buffer) - 1 - bufFromEnd));
 }
 
 bool zydec_WriteHex(char **pBufferPos, size_t *pRemainingSize, const uint64_t value)
 {
   if (value == 0)
-    return zydec_WriteRaw(pBufferPos, pRemainingSize, "0x0");
+    return zydec_WriteLiteral(pBufferPos, pRemainingSize, "0x0");
 
   char buffer[2 + 2 * 8 + 1];
   buffer[sizeof(buffer) - 1] = '\0';
@@ -7688,14 +7502,14 @@ bool zydec_WriteHex(char **pBufferPos, size_t *pRemainingSize, const uint64_t va
   bufFromEnd--;
   *bufFromEnd = '0';
 
-  return zydec_WriteRaw(pBufferPos, pRemainingSize, bufFromEnd);
+  return zydec_WriteRaw(pBufferPos, pRemainingSize, bufFromEnd, (size_t)(buffer + sizeof(buffer) - 1 - bufFromEnd));
 }
 
 bool zydec_WriteInt(char **pBufferPos, size_t *pRemainingSize, const int64_t value)
 {
   if (value < 0)
   {
-    ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, "-"));
+    ERROR_CHECK(zydec_WriteLiteral(pBufferPos, pRemainingSize, "-"));
     return zydec_WriteUInt(pBufferPos, pRemainingSize, (uint64_t)-value);
   }
   else
@@ -7704,9 +7518,59 @@ bool zydec_WriteInt(char **pBufferPos, size_t *pRemainingSize, const int64_t val
   }
 }
 
-bool zydec_WriteResultOperand(char **pBufferPos, size_t *pRemainingSize, const ZydisDecodedOperand *pOperand, const size_t virtualAddress, ZydecFormattingInfo *pInfo, const ZydecOperandFlags flags /* = zof_none */)
+// Writes the shortest representation that reads back as the same value, as a `float` or `double` literal. Infinities & NaNs aren't literals, see `zydec_WriteVectorConstant`.
+bool zydec_WriteFloat(char **pBufferPos, size_t *pRemainingSize, const uint64_t bits, const bool isDouble)
+{
+  char buffer[48];
+  int length = 0;
+
+  if (isDouble)
+  {
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+
+    for (int precision = 1; precision <= 17; precision++)
+    {
+      length = snprintf(buffer, sizeof(buffer) - 3, "%.*g", precision, value);
+
+      if (strtod(buffer, nullptr) == value)
+        break;
+    }
+  }
+  else
+  {
+    const uint32_t floatBits = (uint32_t)bits;
+    float value;
+    memcpy(&value, &floatBits, sizeof(value));
+
+    for (int precision = 1; precision <= 9; precision++)
+    {
+      length = snprintf(buffer, sizeof(buffer) - 3, "%.*g", precision, value);
+
+      if (strtof(buffer, nullptr) == value)
+        break;
+    }
+  }
+
+  if (length <= 0 || (size_t)length >= sizeof(buffer) - 3)
+    return false;
+
+  if (strpbrk(buffer, ".e") == nullptr)
+  {
+    buffer[length++] = '.';
+    buffer[length++] = '0';
+  }
+
+  if (!isDouble)
+    buffer[length++] = 'f';
+
+  return zydec_WriteRaw(pBufferPos, pRemainingSize, buffer, (size_t)length);
+}
+
+template <typename Writer>
+bool zydec_WriteResultOperand(Writer *pWriter, const ZydisDecodedOperand *pOperand, const size_t virtualAddress, ZydecFormattingInfo *pInfo, const ZydecOperandFlags flags /* = zof_none */)
 {
-  return zydec_WriteOperand(pBufferPos, pRemainingSize, pOperand, virtualAddress, pInfo, flags, true);
+  return zydec_WriteOperand(pWriter, pOperand, virtualAddress, pInfo, flags, true);
 }
 
 void zydec_HintOperand(const ZydisDecodedOperand *pOperand, ZydecFormattingInfo *pInfo)
@@ -7745,27 +7609,274 @@ void zydec_HintOp(const ZydecFormattingInfo::HintOperation op, ZydecFormattingIn
   pInfo->pSetHintOp(op, pInfo->pRegUserData);
 }
 
-bool zydec_WriteOperand(char **pBufferPos, size_t *pRemainingSize, const ZydisDecodedOperand *pOperand, const size_t virtualAddress, ZydecFormattingInfo *pInfo, const ZydecOperandFlags flags /* = zof_none */, const bool isNewResult /* = false */)
+static bool zydec_IsLiteralEqual(const char *text, const size_t length, const ZydecLiteral literal)
+{
+  return length == literal.length && memcmp(text, literal.text, length) == 0;
+}
+
+// The element type the intrinsic names (e.g. `_mm_shuffle_epi8(`), or that of the operand for the ones that don't (e.g. `_mm_and_si(`), as the latter isn't always what the instruction is used for.
+ZydecOperandFlags zydec_GetConstantFlags(const ZydecLiteral intrinsic, const ZydisDecodedOperand *pOperand)
+{
+  if (pOperand->type != ZYDIS_OPERAND_TYPE_MEMORY)
+    return zof_none;
+
+  if (intrinsic.text != nullptr)
+  {
+    size_t end = intrinsic.length;
+
+    if (end > 0 && intrinsic.text[end - 1] == '(')
+      end--;
+
+    size_t start = end;
+
+    while (start > 0 && intrinsic.text[start - 1] != '_')
+      start--;
+
+    const char *suffix = intrinsic.text + start;
+    const size_t length = end - start;
+
+    if (start > 0)
+    {
+      if (zydec_IsLiteralEqual(suffix, length, "ps"))
+        return zof_constantPs;
+      else if (zydec_IsLiteralEqual(suffix, length, "pd"))
+        return zof_constantPd;
+      else if (zydec_IsLiteralEqual(suffix, length, "epi8") || zydec_IsLiteralEqual(suffix, length, "epu8"))
+        return zof_constantEpi8;
+      else if (zydec_IsLiteralEqual(suffix, length, "epi16") || zydec_IsLiteralEqual(suffix, length, "epu16"))
+        return zof_constantEpi16;
+      else if (zydec_IsLiteralEqual(suffix, length, "epi32") || zydec_IsLiteralEqual(suffix, length, "epu32"))
+        return zof_constantEpi32;
+      else if (zydec_IsLiteralEqual(suffix, length, "epi64") || zydec_IsLiteralEqual(suffix, length, "epu64"))
+        return zof_constantEpi64;
+    }
+  }
+
+  switch (pOperand->element_type)
+  {
+  case ZYDIS_ELEMENT_TYPE_FLOAT32:
+    return zof_constantPs;
+
+  case ZYDIS_ELEMENT_TYPE_FLOAT64:
+    return zof_constantPd;
+
+  default:
+    switch (pOperand->element_size)
+    {
+    case 8: return zof_constantEpi8;
+    case 16: return zof_constantEpi16;
+    case 64: return zof_constantEpi64;
+    default: return zof_constantEpi32;
+    }
+  }
+}
+
+// Embedded broadcasts (`{1toN}`) repeat a single element of the memory operand, so the element type has to match its size.
+ZydecOperandFlags zydec_GetBroadcastFlags(const ZydisDecodedInstruction *pInstruction, const ZydisDecodedOperand *pOperand, const ZydecOperandFlags constantFlags)
+{
+  if (constantFlags == zof_none || pInstruction->avx.broadcast.is_static || pInstruction->avx.broadcast.mode < ZYDIS_BROADCAST_MODE_1_TO_2 || pInstruction->avx.broadcast.mode > ZYDIS_BROADCAST_MODE_1_TO_64)
+    return constantFlags;
+
+  ZydecOperandFlags flags;
+
+  switch (pInstruction->avx.vector_length)
+  {
+  case 128: flags = zof_broadcast128; break;
+  case 256: flags = zof_broadcast256; break;
+  case 512: flags = zof_broadcast512; break;
+  default: return constantFlags;
+  }
+
+  const bool isFloat = pOperand->element_type == ZYDIS_ELEMENT_TYPE_FLOAT32 || pOperand->element_type == ZYDIS_ELEMENT_TYPE_FLOAT64;
+
+  switch (pOperand->size)
+  {
+  case 16: return flags | zof_constantEpi16;
+  case 32: return flags | ((constantFlags & (zof_constantEpi32 | zof_constantPs)) ? constantFlags : (isFloat ? zof_constantPs : zof_constantEpi32));
+  case 64: return flags | ((constantFlags & (zof_constantEpi64 | zof_constantPd)) ? constantFlags : (isFloat ? zof_constantPd : zof_constantEpi64));
+  default: return constantFlags;
+  }
+}
+
+// Reads the whole operand if it's `rip` relative & in constant memory.
+bool zydec_ReadConstantOperand(const ZydisDecodedOperand *pOperand, const size_t virtualAddress, ZydecFormattingInfo *pInfo, uint8_t *pConstant)
+{
+  if (pInfo == nullptr || pInfo->pReadConstantMemory == nullptr)
+    return false;
+
+  if (pOperand->type != ZYDIS_OPERAND_TYPE_MEMORY || pOperand->mem.type != ZYDIS_MEMOP_TYPE_MEM || pOperand->mem.base != ZYDIS_REGISTER_RIP || pOperand->mem.index != ZYDIS_REGISTER_NONE || (pOperand->actions & ZYDIS_OPERAND_ACTION_MASK_WRITE))
+    return false;
+
+  if (pOperand->size == 0 || pOperand->size > 512 || (pOperand->size & 7) != 0)
+    return false;
+
+  const size_t ptr = virtualAddress + (size_t)pOperand->mem.disp.value;
+
+  return pInfo->pReadConstantMemory(ptr, pConstant, pOperand->size / 8, pInfo->pMemoryUserData);
+}
+
+// Reads the whole operand if it's a full width `rip` relative vector in constant memory. Broadcasts only read a single element, see `zydec_WriteBroadcast`.
+bool zydec_ReadVectorConstant(const ZydisDecodedOperand *pOperand, const size_t virtualAddress, ZydecFormattingInfo *pInfo, uint8_t *pConstant)
+{
+  if (pOperand->size != 128 && pOperand->size != 256 && pOperand->size != 512)
+    return false;
+
+  return zydec_ReadConstantOperand(pOperand, virtualAddress, pInfo, pConstant);
+}
+
+// Indexed by the vector width (128, 256 or 512 bit) & the element type in the order of `ZydecOperandFlags`.
+static constexpr ZydecLiteral VectorConstantSetLut[3][6] =
+{
+  { "_mm_set_epi8(", "_mm_set_epi16(", "_mm_set_epi32(", "_mm_set_epi64x(", "_mm_set_ps(", "_mm_set_pd(" },
+  { "_mm256_set_epi8(", "_mm256_set_epi16(", "_mm256_set_epi32(", "_mm256_set_epi64x(", "_mm256_set_ps(", "_mm256_set_pd(" },
+  { "_mm512_set_epi8(", "_mm512_set_epi16(", "_mm512_set_epi32(", "_mm512_set_epi64(", "_mm512_set_ps(", "_mm512_set_pd(" },
+};
+
+static constexpr ZydecLiteral VectorConstantSet1Lut[3][6] =
+{
+  { "_mm_set1_epi8(", "_mm_set1_epi16(", "_mm_set1_epi32(", "_mm_set1_epi64x(", "_mm_set1_ps(", "_mm_set1_pd(" },
+  { "_mm256_set1_epi8(", "_mm256_set1_epi16(", "_mm256_set1_epi32(", "_mm256_set1_epi64x(", "_mm256_set1_ps(", "_mm256_set1_pd(" },
+  { "_mm512_set1_epi8(", "_mm512_set1_epi16(", "_mm512_set1_epi32(", "_mm512_set1_epi64(", "_mm512_set1_ps(", "_mm512_set1_pd(" },
+};
+
+// Float constants containing infinities or NaNs are set as integers of the same size & cast.
+static constexpr ZydecLiteral VectorConstantCastLut[3][2] =
+{
+  { "_mm_castsi128_ps(", "_mm_castsi128_pd(" },
+  { "_mm256_castsi256_ps(", "_mm256_castsi256_pd(" },
+  { "_mm512_castsi512_ps(", "_mm512_castsi512_pd(" },
+};
+
+// The index of the element type in the order of `ZydecOperandFlags`.
+inline size_t zydec_GetConstantElementIndex(const ZydecOperandFlags flags)
+{
+  size_t elementIndex = 0;
+
+  while (elementIndex < 5 && !(flags & ((ZydecOperandFlags)zof_constantEpi8 << elementIndex)))
+    elementIndex++;
+
+  return elementIndex;
+}
+
+// Elements are listed from the highest to the lowest, like `_mm_set_*` expects them. A single element that's smaller than `vectorSize` is broadcast with `_mm_set1_*`.
+template <typename Writer>
+bool zydec_WriteVectorConstant(Writer *pWriter, const uint8_t *pConstant, const size_t size, const size_t vectorSize, const ZydecOperandFlags flags)
+{
+  const size_t widthIndex = vectorSize == 16 ? 0 : (vectorSize == 32 ? 1 : 2);
+  size_t elementIndex = zydec_GetConstantElementIndex(flags);
+
+  // The literals already name their width.
+  const uint16_t intrinsicStyle = zydec_SetIntrinsicStyle(pWriter, 0);
+
+  const bool isFloat = elementIndex >= 4;
+  const size_t elementSize = isFloat ? (elementIndex == 4 ? 4 : 8) : ((size_t)1 << elementIndex);
+  bool isCast = false;
+
+  if (isFloat)
+  {
+    for (size_t offset = 0; offset < size && !isCast; offset += elementSize)
+    {
+      uint64_t bits = 0;
+      memcpy(&bits, pConstant + offset, elementSize);
+
+      // All exponent bits set.
+      if (elementSize == 4)
+        isCast = (bits & 0x7F800000) == 0x7F800000;
+      else
+        isCast = (bits & 0x7FF0000000000000ULL) == 0x7FF0000000000000ULL;
+    }
+  }
+
+  if (isCast)
+  {
+    const ZydecLiteral cast = VectorConstantCastLut[widthIndex][elementIndex - 4];
+    ERROR_CHECK(zydec_Reserve(pWriter, cast.length));
+    zydec_WriteIntrinsic(pWriter, cast);
+
+    elementIndex = elementIndex == 4 ? 2 : 3;
+  }
+
+  const ZydecLiteral set = (size < vectorSize ? VectorConstantSet1Lut : VectorConstantSetLut)[widthIndex][elementIndex];
+  ERROR_CHECK(zydec_Reserve(pWriter, set.length));
+  zydec_WriteIntrinsic(pWriter, set);
+
+  for (size_t offset = size; offset >= elementSize; offset -= elementSize)
+  {
+    uint64_t bits = 0;
+    memcpy(&bits, pConstant + offset - elementSize, elementSize);
+
+    if (offset != size)
+      ERROR_CHECK(zydec_WriteLiteral(pWriter, ", "));
+
+    if (isFloat && !isCast)
+      ERROR_CHECK(zydec_WriteFloat(pWriter, bits, elementSize == 8));
+    else
+      ERROR_CHECK(zydec_WriteHex(pWriter, bits));
+  }
+
+  ERROR_CHECK(zydec_WriteLiteral(pWriter, isCast ? ZydecLiteral("))") : ZydecLiteral(")")));
+
+  zydec_SetIntrinsicStyle(pWriter, intrinsicStyle);
+
+  return true;
+}
+
+// Broadcasts are rendered as `_mm_set1_*` of the element in memory, or of its value if it's a constant.
+template <typename Writer>
+bool zydec_WriteBroadcast(Writer *pWriter, const ZydisDecodedOperand *pOperand, const size_t virtualAddress, ZydecFormattingInfo *pInfo, const ZydecOperandFlags flags)
+{
+  const size_t vectorSize = (flags & zof_broadcast128) ? 16 : ((flags & zof_broadcast256) ? 32 : 64);
+  uint8_t constant[64];
+
+  if (zydec_ReadConstantOperand(pOperand, virtualAddress, pInfo, constant))
+    return zydec_WriteVectorConstant(pWriter, constant, pOperand->size / 8, vectorSize, flags);
+
+  const ZydecLiteral set = VectorConstantSet1Lut[vectorSize == 16 ? 0 : (vectorSize == 32 ? 1 : 2)][zydec_GetConstantElementIndex(flags)];
+  const uint16_t intrinsicStyle = zydec_SetIntrinsicStyle(pWriter, 0);
+
+  ERROR_CHECK(zydec_Reserve(pWriter, set.length));
+  zydec_WriteIntrinsic(pWriter, set);
+
+  zydec_SetIntrinsicStyle(pWriter, intrinsicStyle);
+
+  ERROR_CHECK(zydec_WriteOperand(pWriter, pOperand, virtualAddress, pInfo, flags & ~(ZydecOperandFlags)(zof_broadcastMask | zof_constantMask)));
+
+  return zydec_WriteLiteral(pWriter, ")");
+}
+
+template <typename Writer>
+bool zydec_WriteOperand(Writer *pWriter, const ZydisDecodedOperand *pOperand, const size_t virtualAddress, ZydecFormattingInfo *pInfo, const ZydecOperandFlags flags /* = zof_none */, const bool isNewResult /* = false */)
 {
   switch (pOperand->type)
   {
   case ZYDIS_OPERAND_TYPE_REGISTER:
   {
-    ERROR_CHECK(zydec_WriteRegister(pBufferPos, pRemainingSize, pOperand->reg.value, pInfo, isNewResult));
+    ERROR_CHECK(zydec_WriteRegister(pWriter, pOperand->reg.value, pInfo, isNewResult));
     break;
   }
 
   case ZYDIS_OPERAND_TYPE_MEMORY:
   {
-    ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, (pOperand->mem.type == ZYDIS_MEMOP_TYPE_AGEN || !!(flags & zof_noAddressDeref)) ? "(" : "*("));
+    if (flags & zof_broadcastMask)
+      return zydec_WriteBroadcast(pWriter, pOperand, virtualAddress, pInfo, flags);
+
+    if (flags & zof_constantMask)
+    {
+      uint8_t constant[64];
+
+      if (zydec_ReadVectorConstant(pOperand, virtualAddress, pInfo, constant))
+        return zydec_WriteVectorConstant(pWriter, constant, pOperand->size / 8, pOperand->size / 8, flags);
+    }
+
+    ERROR_CHECK(zydec_WriteLiteral(pWriter, (pOperand->mem.type == ZYDIS_MEMOP_TYPE_AGEN || !!(flags & zof_noAddressDeref)) ? ZydecLiteral("(") : ZydecLiteral("*(")));
 
     switch (pOperand->mem.type)
     {
     case ZYDIS_MEMOP_TYPE_MEM:
     case ZYDIS_MEMOP_TYPE_VSIB:
     {
-      ERROR_CHECK(zydec_WriteRegister(pBufferPos, pRemainingSize, pOperand->mem.segment, pInfo, false));
-      ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, ": "));
+      ERROR_CHECK(zydec_WriteRegister(pWriter, pOperand->mem.segment, pInfo, false));
+      ERROR_CHECK(zydec_WriteLiteral(pWriter, ": "));
 
       if (pOperand->mem.base == ZYDIS_REGISTER_RIP && (pOperand->mem.disp.has_displacement || pOperand->mem.index == ZYDIS_REGISTER_NONE))
       {
@@ -7780,57 +7891,57 @@ bool zydec_WriteOperand(char **pBufferPos, size_t *pRemainingSize, const ZydisDe
         if (pInfo->pResolveAddressToFriendlyName != nullptr && pInfo->pResolveAddressToFriendlyName(ptr, friendlyName, sizeof(friendlyName), &friendlyNameOffset, pInfo->pUserData))
         {
           if (friendlyNameOffset != 0)
-            zydec_WriteRaw(pBufferPos, pRemainingSize, "(");
+            zydec_WriteLiteral(pWriter, "(");
 
-          ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, friendlyName));
+          ERROR_CHECK(zydec_WriteSymbol(pWriter, ptr, friendlyName));
 
           if (friendlyNameOffset != 0)
           {
-            ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, " + "));
-            ERROR_CHECK(zydec_WriteHex(pBufferPos, pRemainingSize, friendlyNameOffset));
-            ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, ")"));
+            ERROR_CHECK(zydec_WriteLiteral(pWriter, " + "));
+            ERROR_CHECK(zydec_WriteHex(pWriter, friendlyNameOffset));
+            ERROR_CHECK(zydec_WriteLiteral(pWriter, ")"));
           }
         }
         else
         {
-          ERROR_CHECK(zydec_WriteHex(pBufferPos, pRemainingSize, ptr));
+          ERROR_CHECK(zydec_WriteHex(pWriter, ptr));
         }
       }
       else
       {
         if (pOperand->mem.base != ZYDIS_REGISTER_NONE)
-          ERROR_CHECK(zydec_WriteRegister(pBufferPos, pRemainingSize, pOperand->mem.base, pInfo, false));
+          ERROR_CHECK(zydec_WriteRegister(pWriter, pOperand->mem.base, pInfo, false));
 
         if (pOperand->mem.disp.has_displacement && pOperand->mem.disp.value != 0)
         {
           if (pOperand->mem.base != ZYDIS_REGISTER_NONE)
-            ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, " "));
+            ERROR_CHECK(zydec_WriteLiteral(pWriter, " "));
 
-          ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, "+ "));
-          ERROR_CHECK(zydec_WriteInt(pBufferPos, pRemainingSize, pOperand->mem.disp.value));
+          ERROR_CHECK(zydec_WriteLiteral(pWriter, "+ "));
+          ERROR_CHECK(zydec_WriteInt(pWriter, pOperand->mem.disp.value));
         }
         else if (pOperand->mem.index != ZYDIS_REGISTER_NONE)
         {
           if (pOperand->mem.base != ZYDIS_REGISTER_NONE)
-            ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, " "));
+            ERROR_CHECK(zydec_WriteLiteral(pWriter, " "));
 
-          ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, "+ "));
+          ERROR_CHECK(zydec_WriteLiteral(pWriter, "+ "));
 
           if (pOperand->mem.scale != 1)
-            ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, "("));
+            ERROR_CHECK(zydec_WriteLiteral(pWriter, "("));
 
-          ERROR_CHECK(zydec_WriteRegister(pBufferPos, pRemainingSize, pOperand->mem.index, pInfo, false));
+          ERROR_CHECK(zydec_WriteRegister(pWriter, pOperand->mem.index, pInfo, false));
 
           if (pOperand->mem.scale != 1)
           {
-            ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, " * "));
-            ERROR_CHECK(zydec_WriteUInt(pBufferPos, pRemainingSize, pOperand->mem.scale));
-            ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, ")"));
+            ERROR_CHECK(zydec_WriteLiteral(pWriter, " * "));
+            ERROR_CHECK(zydec_WriteUInt(pWriter, pOperand->mem.scale));
+            ERROR_CHECK(zydec_WriteLiteral(pWriter, ")"));
           }
         }
       }
 
-      ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, ")"));
+      ERROR_CHECK(zydec_WriteLiteral(pWriter, ")"));
 
       break;
     }
@@ -7838,8 +7949,8 @@ bool zydec_WriteOperand(char **pBufferPos, size_t *pRemainingSize, const ZydisDe
     case ZYDIS_MEMOP_TYPE_MIB:
     case ZYDIS_MEMOP_TYPE_AGEN:
     {
-      ERROR_CHECK(zydec_WriteRegister(pBufferPos, pRemainingSize, pOperand->mem.segment, pInfo, false));
-      ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, ": "));
+      ERROR_CHECK(zydec_WriteRegister(pWriter, pOperand->mem.segment, pInfo, false));
+      ERROR_CHECK(zydec_WriteLiteral(pWriter, ": "));
 
       if (pOperand->mem.base == ZYDIS_REGISTER_RIP)
       {
@@ -7854,58 +7965,58 @@ bool zydec_WriteOperand(char **pBufferPos, size_t *pRemainingSize, const ZydisDe
         if (pInfo->pResolveAddressToFriendlyName != nullptr && pInfo->pResolveAddressToFriendlyName(ptr, friendlyName, sizeof(friendlyName), &friendlyNameOffset, pInfo->pUserData))
         {
           if (friendlyNameOffset != 0)
-            ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, "("));
+            ERROR_CHECK(zydec_WriteLiteral(pWriter, "("));
 
-          ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, friendlyName));
+          ERROR_CHECK(zydec_WriteSymbol(pWriter, ptr, friendlyName));
 
           if (friendlyNameOffset != 0)
           {
-            ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, " + "));
-            ERROR_CHECK(zydec_WriteHex(pBufferPos, pRemainingSize, friendlyNameOffset));
-            ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, ")"));
+            ERROR_CHECK(zydec_WriteLiteral(pWriter, " + "));
+            ERROR_CHECK(zydec_WriteHex(pWriter, friendlyNameOffset));
+            ERROR_CHECK(zydec_WriteLiteral(pWriter, ")"));
           }
         }
         else
         {
-          ERROR_CHECK(zydec_WriteHex(pBufferPos, pRemainingSize, ptr));
+          ERROR_CHECK(zydec_WriteHex(pWriter, ptr));
         }
         
-        ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, ")"));
+        ERROR_CHECK(zydec_WriteLiteral(pWriter, ")"));
       }
       else
       {
         if (pOperand->mem.base != ZYDIS_REGISTER_NONE)
-          ERROR_CHECK(zydec_WriteRegister(pBufferPos, pRemainingSize, pOperand->mem.base, pInfo, false));
+          ERROR_CHECK(zydec_WriteRegister(pWriter, pOperand->mem.base, pInfo, false));
 
         if (pOperand->mem.disp.has_displacement && pOperand->mem.disp.value != 0)
         {
           if (pOperand->mem.base != ZYDIS_REGISTER_NONE)
-            ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, " "));
+            ERROR_CHECK(zydec_WriteLiteral(pWriter, " "));
 
-          ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, "+ "));
-          ERROR_CHECK(zydec_WriteInt(pBufferPos, pRemainingSize, pOperand->mem.disp.value));
+          ERROR_CHECK(zydec_WriteLiteral(pWriter, "+ "));
+          ERROR_CHECK(zydec_WriteInt(pWriter, pOperand->mem.disp.value));
         }
         else if (pOperand->mem.index != ZYDIS_REGISTER_NONE)
         {
           if (pOperand->mem.base != ZYDIS_REGISTER_NONE)
-            ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, " "));
+            ERROR_CHECK(zydec_WriteLiteral(pWriter, " "));
 
-          ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, "+ "));
+          ERROR_CHECK(zydec_WriteLiteral(pWriter, "+ "));
 
           if (pOperand->mem.scale != 1)
-            ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, "("));
+            ERROR_CHECK(zydec_WriteLiteral(pWriter, "("));
 
-          ERROR_CHECK(zydec_WriteRegister(pBufferPos, pRemainingSize, pOperand->mem.index, pInfo, false));
+          ERROR_CHECK(zydec_WriteRegister(pWriter, pOperand->mem.index, pInfo, false));
 
           if (pOperand->mem.scale != 1)
           {
-            ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, " * "));
-            ERROR_CHECK(zydec_WriteUInt(pBufferPos, pRemainingSize, pOperand->mem.scale));
-            ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, ")"));
+            ERROR_CHECK(zydec_WriteLiteral(pWriter, " * "));
+            ERROR_CHECK(zydec_WriteUInt(pWriter, pOperand->mem.scale));
+            ERROR_CHECK(zydec_WriteLiteral(pWriter, ")"));
           }
         }
 
-        ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, ")"));
+        ERROR_CHECK(zydec_WriteLiteral(pWriter, ")"));
       }
 
       break;
@@ -7922,34 +8033,36 @@ bool zydec_WriteOperand(char **pBufferPos, size_t *pRemainingSize, const ZydisDe
   {
     if (pOperand->imm.is_relative)
     {
+      const uint64_t ptr = virtualAddress + pOperand->imm.value.u;
+
       char friendlyName[1024];
       size_t friendlyNameOffset = 0;
 
-      if (pInfo->pResolveAddressToFriendlyName != nullptr && pInfo->pResolveAddressToFriendlyName(virtualAddress + pOperand->imm.value.u, friendlyName, sizeof(friendlyName), &friendlyNameOffset, pInfo->pUserData))
+      if (pInfo->pResolveAddressToFriendlyName != nullptr && pInfo->pResolveAddressToFriendlyName(ptr, friendlyName, sizeof(friendlyName), &friendlyNameOffset, pInfo->pUserData))
       {
         if (friendlyNameOffset != 0)
-          ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, "("));
+          ERROR_CHECK(zydec_WriteLiteral(pWriter, "("));
 
-        ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, friendlyName));
+        ERROR_CHECK(zydec_WriteSymbol(pWriter, ptr, friendlyName));
 
         if (friendlyNameOffset != 0)
         {
-          ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, " + "));
-          ERROR_CHECK(zydec_WriteHex(pBufferPos, pRemainingSize, friendlyNameOffset));
-          ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, ")"));
+          ERROR_CHECK(zydec_WriteLiteral(pWriter, " + "));
+          ERROR_CHECK(zydec_WriteHex(pWriter, friendlyNameOffset));
+          ERROR_CHECK(zydec_WriteLiteral(pWriter, ")"));
         }
       }
       else
       {
-        ERROR_CHECK(zydec_WriteHex(pBufferPos, pRemainingSize, virtualAddress + pOperand->imm.value.u));
+        ERROR_CHECK(zydec_WriteHex(pWriter, ptr));
       }
     }
     else
     {
       if (pOperand->imm.is_signed)
-        ERROR_CHECK(zydec_WriteInt(pBufferPos, pRemainingSize, pOperand->imm.value.s));
+        ERROR_CHECK(zydec_WriteInt(pWriter, pOperand->imm.value.s));
       else
-        ERROR_CHECK(zydec_WriteUInt(pBufferPos, pRemainingSize, pOperand->imm.value.u));
+        ERROR_CHECK(zydec_WriteUInt(pWriter, pOperand->imm.value.u));
     }
 
     break;
@@ -7967,52 +8080,79 @@ bool zydec_WriteRegisterRaw(char **pBufferPos, size_t *pRemainingSize, const Zyd
   if (reg >= sizeof(RegisterNameLut) / sizeof(RegisterNameLut[0]))
     return false;
 
-  ERROR_CHECK(zydec_WriteRaw(pBufferPos, pRemainingSize, RegisterNameLut[reg]));
+  ERROR_CHECK(zydec_WriteLiteral(pBufferPos, pRemainingSize, RegisterNameLut[reg]));
 
   return true;
 }
 
-bool zydec_WriteRegister(char **pBufferPos, size_t *pRemainingSize, const ZydisRegister reg, ZydecFormattingInfo *pInfo, const bool isNewResult)
+inline bool zydec_WriteRegisterName(ZydecTextWriter *pWriter, const ZydisRegister reg, ZydecFormattingInfo *pInfo, const bool isNewResult)
 {
-  const char *pre = zydec_ResolveRegisterPrefix(reg);
-  const char *post = zydec_ResolveRegisterPostfix(reg);
-  const ZydisRegister baseReg = zydec_ResolveBaseRegister(reg);
+  if (pInfo == nullptr || (isNewResult && pInfo->pWriteResultRegister == nullptr) || (!isNewResult && pInfo->pWriteRegister == nullptr))
+    return zydec_WriteRegisterRaw(&pWriter->bufferPos, &pWriter->remainingSize, reg);
+  else if (isNewResult)
+    return pInfo->pWriteResultRegister(&pWriter->bufferPos, &pWriter->remainingSize, reg, pInfo->pRegUserData);
+  else
+    return pInfo->pWriteRegister(&pWriter->bufferPos, &pWriter->remainingSize, reg, pInfo->pRegUserData);
+}
 
-  if (pre != nullptr && !zydec_WriteRaw(pBufferPos, pRemainingSize, pre))
-    return false;
+inline bool zydec_WriteRegisterName(ZydecTokenWriter *pWriter, const ZydisRegister reg, ZydecFormattingInfo *pInfo, const bool isNewResult)
+{
+  uint32_t registerName = 0;
 
-  if (pInfo == nullptr || (isNewResult && pInfo->pWriteResultRegister == nullptr) || (!isNewResult && pInfo->pWriteRegister == nullptr))
-    if (!zydec_WriteRegisterRaw(pBufferPos, pRemainingSize, baseReg))
-      return false;
+  if (pInfo != nullptr && isNewResult && pInfo->pGetResultRegisterName != nullptr)
+    registerName = pInfo->pGetResultRegisterName(reg, pInfo->pRegUserData);
+  else if (pInfo != nullptr && !isNewResult && pInfo->pGetRegisterName != nullptr)
+    registerName = pInfo->pGetRegisterName(reg, pInfo->pRegUserData);
 
-  if (isNewResult)
-  {
-    if (!pInfo->pWriteResultRegister(pBufferPos, pRemainingSize, baseReg, pInfo->pRegUserData))
-      return false;
-  }
-  else
+  return zydec_WriteToken(pWriter, ztt_register, (uint16_t)reg, registerName, 0);
+}
+
+inline bool zydec_WriteRegisterName(ZydecNameWriter *pWriter, const ZydisRegister reg, ZydecFormattingInfo *pInfo, const bool isNewResult)
+{
+  // Without any storage, only the assignments have to happen, see `zydec_LinearSession_AdvanceInstruction`.
+  if (pWriter->pNames == nullptr)
   {
-    if (!pInfo->pWriteRegister(pBufferPos, pRemainingSize, baseReg, pInfo->pRegUserData))
-      return false;
+    if (pInfo != nullptr && isNewResult && pInfo->pGetResultRegisterName != nullptr)
+      pInfo->pGetResultRegisterName(reg, pInfo->pRegUserData);
+
+    return true;
   }
 
-  if (post != nullptr && !zydec_WriteRaw(pBufferPos, pRemainingSize, post))
-    return false;
+  uint32_t registerName = 0;
 
-  return true;
+  if (pInfo != nullptr && isNewResult && pInfo->pGetResultRegisterName != nullptr)
+    registerName = pInfo->pGetResultRegisterName(reg, pInfo->pRegUserData);
+  else if (pInfo != nullptr && !isNewResult && pInfo->pGetRegisterName != nullptr)
+    registerName = pInfo->pGetRegisterName(reg, pInfo->pRegUserData);
+
+  if (pWriter->nameCount < pWriter->nameCapacity)
+    pWriter->pNames[pWriter->nameCount] = registerName;
+
+  pWriter->nameCount++;
+
+  return pWriter->nameCount <= pWriter->nameCapacity;
 }
 
-bool zydec_WriteRaw(char **pBufferPos, size_t *pRemainingSize, const char *text)
+template <typename Writer>
+bool zydec_WriteRegister(Writer *pWriter, const ZydisRegister reg, ZydecFormattingInfo *pInfo, const bool isNewResult)
 {
-  const size_t length = strlen(text);
+  const ZydecLiteral pre = zydec_ResolveRegisterPrefix(reg);
+  const ZydecLiteral post = zydec_ResolveRegisterPostfix(reg);
+  const ZydisRegister baseReg = zydec_ResolveBaseRegister(reg);
 
-  if (length > *pRemainingSize)
+  if (pre.text != nullptr && !zydec_WriteLiteral(pWriter, pre))
     return false;
 
-  memcpy(*pBufferPos, text, length + 1);
+  if (!zydec_WriteRegisterName(pWriter, baseReg, pInfo, isNewResult))
+    return false;
 
-  (*pRemainingSize) -= length;
-  (*pBufferPos) += length;
+  if (post.text != nullptr && !zydec_WriteLiteral(pWriter, post))
+    return false;
 
   return true;
 }
+
+bool zydec_WriteRaw(char **pBufferPos, size_t *pRemainingSize, const char *text)
+{
+  return zydec_WriteRaw(pBufferPos, pRemainingSize, text, strlen(text));
+}
@@ -0,0 +1,1933 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2023, Christoph Stiller. All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation 
+//    and/or other materials provided with the distribution.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef zydec_mnemonic_lut_h__
+#define zydec_mnemonic_lut_h__
+
+#include "zydec.h"
+
+////////////////////////////////////////////////////////////////////////////////
+
+// A string with its length known up front. Implicitly constructible from string literals only, so that the length can be taken from the array type instead of `strlen`.
+struct ZydecLiteral
+{
+  const char *text;
+  size_t length;
+
+  constexpr ZydecLiteral() : text(nullptr), length(0) {}
+  constexpr ZydecLiteral(decltype(nullptr)) : text(nullptr), length(0) {}
+  constexpr ZydecLiteral(const char *string, const size_t stringLength) : text(string), length(stringLength) {}
+
+  template <size_t N>
+  constexpr ZydecLiteral(const char (&literal)[N]) : text(literal), length(N - 1) {}
+
+  template <size_t N>
+  ZydecLiteral(char (&buffer)[N]) = delete; // mutable buffers are not literals, use the explicit length constructor instead.
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+enum ZydecMnemonicShape : uint8_t
+{
+  zms_none, // no translation available.
+  zms_function, // `intrinsic` operands[0 .. param) `terminator`
+  zms_assign, // result = `intrinsic` (operands[1] if param == 1) `terminator`
+  zms_conditionalMove, // if (`intrinsic`) result = operands[1] `terminator`
+  zms_arithmetic, // result op= operands[1] `terminator` with `param` being the ZydecMnemonicOperator.
+  zms_maskArithmetic, // result = operands[1] op operands[2] `terminator` with `param` being the ZydecMnemonicOperator.
+  zms_multiply,
+  zms_divide,
+  zms_vectorMove, // _mm_(un)aligned_load/store/mov`intrinsic`operands...)
+  zms_vector, // result = `intrinsic`operands...`terminator` with `param` being the ZydecFusedOperandOrder of fused multiply-adds.
+};
+
+// Worst case length of the fixed text each shape emits around its operands, excluding `intrinsic`, `terminator` and the `, ` between operands.
+static constexpr uint8_t MnemonicShapeReserveLut[] =
+{
+  0, // zms_none
+  0, // zms_function
+  6, // zms_assign: `// nop` or ` = `
+  9, // zms_conditionalMove: `if (` `) ` ` = `
+  7, // zms_arithmetic: ` = ` + binary operator, `// nop`, ` = 0;`
+  7, // zms_maskArithmetic: ` = ` + binary operator, ` = 0;`
+  10, // zms_multiply: `[` `, ` `] = ` ` * `
+  68, // zms_divide: ` = ` ` / ` `; ` ` = ` ` % ` and both divide comments.
+  23, // zms_vectorMove: `_mm_unaligned_store` ` = ` `)`
+  3, // zms_vector: ` = `, the same register shorthands and the `);` store / load terminator are shorter than `intrinsic` and `terminator`.
+};
+
+static_assert(sizeof(MnemonicShapeReserveLut) / sizeof(MnemonicShapeReserveLut[0]) == zms_vector + 1, "MnemonicShapeReserveLut is out of sync with ZydecMnemonicShape.");
+
+enum ZydecMnemonicOperator : uint8_t
+{
+  zop_None,
+  zop_Add,
+  zop_Sub,
+  zop_And,
+  zop_AndNot,
+  zop_Or,
+  zop_XOr,
+  zop_ShL,
+  zop_ShR,
+};
+
+struct ZydecMnemonicOperatorInfo
+{
+  ZydecLiteral compoundAssignment;
+  ZydecLiteral binary;
+};
+
+static constexpr ZydecMnemonicOperatorInfo MnemonicOperatorLut[] =
+{
+  { nullptr, nullptr },
+  { " += ", " + " },
+  { " -= ", " - " },
+  { " &= ", " & " },
+  { " &= ~", " & ~" },
+  { " |= ", " | " },
+  { " ^= ", " ^ " },
+  { " <<= ", " << " },
+  { " >>= ", " >> " },
+};
+
+enum ZydecMnemonicArity : uint8_t
+{
+  zma_allOperands = 0xFF,
+};
+
+// Which operands of a fused multiply-add are multiplied (the first two digits) & which one is added (the last digit), `1` being the destination.
+enum ZydecFusedOperandOrder : uint8_t
+{
+  zfo_none,
+  zfo_132,
+  zfo_213,
+  zfo_231,
+};
+
+enum ZydecMnemonicFlags_ : uint16_t
+{
+  zmf_none = 0,
+  zmf_sameRegisterNop = 1 << 0,
+  zmf_sameRegisterAssign = 1 << 1,
+  zmf_sameRegisterZero = 1 << 2,
+  zmf_sameRegisterAllOnes = 1 << 3,
+  zmf_hintSource = 1 << 4,
+  zmf_afterCall = 1 << 5,
+  zmf_addressParam = 1 << 6,
+  zmf_noSelfReference = 1 << 7,
+  zmf_commentOnStore = 1 << 8,
+  zmf_commentOnLoad = 1 << 9,
+  zmf_aligned = 1 << 10,
+  zmf_widthSuffix = 1 << 11, // the intrinsic ends in `si(`, which is suffixed with the vector width (e.g. `_mm256_and_si256(`).
+};
+
+typedef uint16_t ZydecMnemonicFlags;
+
+// `intrinsic.text` is `nullptr` for `zms_vector` entries whose intrinsic depends on the operands.
+struct ZydecMnemonicInfo
+{
+  ZydisMnemonic mnemonic;
+  ZydecMnemonicShape shape;
+  uint8_t hint;
+  uint8_t param;
+  ZydecMnemonicFlags flags;
+  ZydecLiteral intrinsic;
+  ZydecLiteral terminator;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+static constexpr ZydecMnemonicInfo MnemonicInfoLut[] =
+{
+  { ZYDIS_MNEMONIC_INVALID, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_AAA, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_AAD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_AAM, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_AAS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_ADC, zms_arithmetic, ZydecFormattingInfo::Add, zop_Add, zmf_none, nullptr, " + carry_flag;" },
+  { ZYDIS_MNEMONIC_ADCX, zms_arithmetic, ZydecFormattingInfo::Add, zop_Add, zmf_none, nullptr, " + carry_flag; // unsigned integer add with carry_flag" },
+  { ZYDIS_MNEMONIC_ADD, zms_arithmetic, ZydecFormattingInfo::Add, zop_Add, zmf_none, nullptr, ";" },
+  { ZYDIS_MNEMONIC_ADDPD, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_add_pd(", ");" },
+  { ZYDIS_MNEMONIC_ADDPS, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_add_ps(", ");" },
+  { ZYDIS_MNEMONIC_ADDSD, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_add_sd(", ");" },
+  { ZYDIS_MNEMONIC_ADDSS, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_add_ss(", ");" },
+  { ZYDIS_MNEMONIC_ADDSUBPD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_addsub_pd(", ");" },
+  { ZYDIS_MNEMONIC_ADDSUBPS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_addsub_ps(", ");" },
+  { ZYDIS_MNEMONIC_ADOX, zms_arithmetic, ZydecFormattingInfo::Add, zop_Add, zmf_none, nullptr, " + overflow_flag; // unsigned integer add with overflow_flag" },
+  { ZYDIS_MNEMONIC_AESDEC, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_AESDEC128KL, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_AESDEC256KL, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_AESDECLAST, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_AESDECWIDE128KL, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_AESDECWIDE256KL, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_AESENC, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_AESENC128KL, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_AESENC256KL, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_AESENCLAST, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_AESENCWIDE128KL, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_AESENCWIDE256KL, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_AESIMC, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_AESKEYGENASSIST, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_AND, zms_arithmetic, ZydecFormattingInfo::And, zop_And, zmf_sameRegisterNop, nullptr, ";" },
+  { ZYDIS_MNEMONIC_ANDN, zms_arithmetic, ZydecFormattingInfo::AndNot, zop_AndNot, zmf_none, nullptr, ";" },
+  { ZYDIS_MNEMONIC_ANDNPD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_ANDNPS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_ANDPD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_ANDPS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_ARPL, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_BEXTR, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_BLCFILL, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_BLCI, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_BLCIC, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_BLCMSK, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_BLCS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_BLENDPD, zms_vector, ZydecFormattingInfo::Blend, 0, zmf_none, "_mm_blend_pd(", ");" },
+  { ZYDIS_MNEMONIC_BLENDPS, zms_vector, ZydecFormattingInfo::Blend, 0, zmf_none, "_mm_blend_ps(", ");" },
+  { ZYDIS_MNEMONIC_BLENDVPD, zms_vector, ZydecFormattingInfo::Blend, 0, zmf_none, "_mm_blendv_pd(", ");" },
+  { ZYDIS_MNEMONIC_BLENDVPS, zms_vector, ZydecFormattingInfo::Blend, 0, zmf_none, "_mm_blendv_ps(", ");" },
+  { ZYDIS_MNEMONIC_BLSFILL, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_BLSI, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_BLSIC, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_BLSMSK, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_BLSR, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_BNDCL, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_BNDCN, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_BNDCU, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_BNDLDX, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_BNDMK, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_BNDMOV, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_BNDSTX, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_BOUND, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_BSF, zms_assign, ZydecFormattingInfo::BitScanF, 1, zmf_none, "__bitscan_forward(", ");" },
+  { ZYDIS_MNEMONIC_BSR, zms_assign, ZydecFormattingInfo::BitScanR, 1, zmf_none, "__bitscan_reverse(", ");" },
+  { ZYDIS_MNEMONIC_BSWAP, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_BT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_BTC, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_BTR, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_BTS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_BZHI, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_CALL, zms_function, ZydecFormattingInfo::None, 1, zmf_afterCall, "(", ")();" },
+  { ZYDIS_MNEMONIC_CBW, zms_assign, ZydecFormattingInfo::Mov, 1, zmf_sameRegisterNop | zmf_hintSource, nullptr, ";" },
+  { ZYDIS_MNEMONIC_CDQ, zms_assign, ZydecFormattingInfo::Mov, 1, zmf_sameRegisterNop | zmf_hintSource, nullptr, ";" },
+  { ZYDIS_MNEMONIC_CDQE, zms_assign, ZydecFormattingInfo::Mov, 1, zmf_sameRegisterNop | zmf_hintSource, nullptr, ";" },
+  { ZYDIS_MNEMONIC_CLAC, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_CLC, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_CLD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_CLDEMOTE, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_CLEVICT0, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_CLEVICT1, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_CLFLUSH, zms_vector, ZydecFormattingInfo::None, 0, zmf_addressParam, "_mm_clflush(", ");" },
+  { ZYDIS_MNEMONIC_CLFLUSHOPT, zms_vector, ZydecFormattingInfo::None, 0, zmf_addressParam, "_mm_clflushopt(", ");" },
+  { ZYDIS_MNEMONIC_CLGI, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_CLI, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_CLRSSBSY, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_CLTS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_CLUI, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_CLWB, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_CLZERO, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_CMC, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_CMOVB, zms_conditionalMove, ZydecFormattingInfo::ConditionalMov, 0, zmf_none, "carry_flag", "; // if below" },
+  { ZYDIS_MNEMONIC_CMOVBE, zms_conditionalMove, ZydecFormattingInfo::ConditionalMov, 0, zmf_none, "carry_flag || zero_flag", "; // if below or equal" },
+  { ZYDIS_MNEMONIC_CMOVL, zms_conditionalMove, ZydecFormattingInfo::ConditionalMov, 0, zmf_none, "sign_flag != overflow_flag", "; // if less" },
+  { ZYDIS_MNEMONIC_CMOVLE, zms_conditionalMove, ZydecFormattingInfo::ConditionalMov, 0, zmf_none, "zero_flag || sign_flag != overflow_flag", "; // if less or equal" },
+  { ZYDIS_MNEMONIC_CMOVNB, zms_conditionalMove, ZydecFormattingInfo::ConditionalMov, 0, zmf_none, "!carry_flag", "; // if not below" },
+  { ZYDIS_MNEMONIC_CMOVNBE, zms_conditionalMove, ZydecFormattingInfo::ConditionalMov, 0, zmf_none, "!carry_flag && !zero_flag", "; // if not below or equal" },
+  { ZYDIS_MNEMONIC_CMOVNL, zms_conditionalMove, ZydecFormattingInfo::ConditionalMov, 0, zmf_none, "sign_flag == overflow_flag", "; // if not less" },
+  { ZYDIS_MNEMONIC_CMOVNLE, zms_conditionalMove, ZydecFormattingInfo::ConditionalMov, 0, zmf_none, "!zero_flag && sign_flag == overflow_flag", "; // if not less or equal" },
+  { ZYDIS_MNEMONIC_CMOVNO, zms_conditionalMove, ZydecFormattingInfo::ConditionalMov, 0, zmf_none, "!overflow_flag", ";" },
+  { ZYDIS_MNEMONIC_CMOVNP, zms_conditionalMove, ZydecFormattingInfo::ConditionalMov, 0, zmf_none, "!parity_flag", ";" },
+  { ZYDIS_MNEMONIC_CMOVNS, zms_conditionalMove, ZydecFormattingInfo::ConditionalMov, 0, zmf_none, "!sign_flag", ";" },
+  { ZYDIS_MNEMONIC_CMOVNZ, zms_conditionalMove, ZydecFormattingInfo::ConditionalMov, 0, zmf_none, "!zero_flag", "; // if not zero / not equal" },
+  { ZYDIS_MNEMONIC_CMOVO, zms_conditionalMove, ZydecFormattingInfo::ConditionalMov, 0, zmf_none, "overflow_flag", ";" },
+  { ZYDIS_MNEMONIC_CMOVP, zms_conditionalMove, ZydecFormattingInfo::ConditionalMov, 0, zmf_none, "parity_flag", ";" },
+  { ZYDIS_MNEMONIC_CMOVS, zms_conditionalMove, ZydecFormattingInfo::ConditionalMov, 0, zmf_none, "sign_flag", ";" },
+  { ZYDIS_MNEMONIC_CMOVZ, zms_conditionalMove, ZydecFormattingInfo::ConditionalMov, 0, zmf_none, "zero_flag", "; // if zero / equal" },
+  { ZYDIS_MNEMONIC_CMP, zms_function, ZydecFormattingInfo::None, 2, zmf_none, "compare(", "); // set flags: carry, overflow, signed, zero, aux_carry and parity" },
+  { ZYDIS_MNEMONIC_CMPPD, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_none, "_mm_cmp_pd(", ");" },
+  { ZYDIS_MNEMONIC_CMPPS, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_none, "_mm_cmp_ps(", ");" },
+  { ZYDIS_MNEMONIC_CMPSB, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_CMPSD, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_none, "_mm_cmp_sd(", ");" },
+  { ZYDIS_MNEMONIC_CMPSQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_CMPSS, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_none, "_mm_cmp_ss(", ");" },
+  { ZYDIS_MNEMONIC_CMPSW, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_CMPXCHG, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_CMPXCHG16B, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_CMPXCHG8B, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_COMISD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_comieq_sd(", ");" },
+  { ZYDIS_MNEMONIC_COMISS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_comieq_ss(", ");" },
+  { ZYDIS_MNEMONIC_CPUID, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_CQO, zms_assign, ZydecFormattingInfo::Mov, 1, zmf_sameRegisterNop | zmf_hintSource, nullptr, ";" },
+  { ZYDIS_MNEMONIC_CRC32, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_crc32(", ");" },
+  { ZYDIS_MNEMONIC_CVTDQ2PD, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepi32_pd(", ");" },
+  { ZYDIS_MNEMONIC_CVTDQ2PS, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepi32_ps(", ");" },
+  { ZYDIS_MNEMONIC_CVTPD2DQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtpd_epi32(", ");" },
+  { ZYDIS_MNEMONIC_CVTPD2PI, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtpd_pi32(", ");" },
+  { ZYDIS_MNEMONIC_CVTPD2PS, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtpd_ps(", ");" },
+  { ZYDIS_MNEMONIC_CVTPI2PD, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtpi32_pd(", ");" },
+  { ZYDIS_MNEMONIC_CVTPI2PS, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtpi_ps(", ");" },
+  { ZYDIS_MNEMONIC_CVTPS2DQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtps_epi32(", ");" },
+  { ZYDIS_MNEMONIC_CVTPS2PD, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtps_pd(", ");" },
+  { ZYDIS_MNEMONIC_CVTPS2PI, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtps_pi(", ");" },
+  { ZYDIS_MNEMONIC_CVTSD2SI, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtsd_si(", ");" },
+  { ZYDIS_MNEMONIC_CVTSD2SS, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtsd_ss(", ");" },
+  { ZYDIS_MNEMONIC_CVTSI2SD, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtsi_sd(", ");" },
+  { ZYDIS_MNEMONIC_CVTSI2SS, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtsi_ss(", ");" },
+  { ZYDIS_MNEMONIC_CVTSS2SD, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtss_sd(", ");" },
+  { ZYDIS_MNEMONIC_CVTSS2SI, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtss_si(", ");" },
+  { ZYDIS_MNEMONIC_CVTTPD2DQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvttpd_epi32(", ");" },
+  { ZYDIS_MNEMONIC_CVTTPD2PI, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvttpd_pi32(", ");" },
+  { ZYDIS_MNEMONIC_CVTTPS2DQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvttps_epi32(", ");" },
+  { ZYDIS_MNEMONIC_CVTTPS2PI, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvttps_pi(", ");" },
+  { ZYDIS_MNEMONIC_CVTTSD2SI, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvttsd_si(", ");" },
+  { ZYDIS_MNEMONIC_CVTTSS2SI, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, nullptr, ");" },
+  { ZYDIS_MNEMONIC_CWD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_CWDE, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_DAA, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_DAS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_DEC, zms_arithmetic, ZydecFormattingInfo::Dec, zop_None, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_DELAY, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_DIV, zms_divide, ZydecFormattingInfo::Div, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_DIVPD, zms_vector, ZydecFormattingInfo::Div, 0, zmf_none, "_mm_div_pd(", ");" },
+  { ZYDIS_MNEMONIC_DIVPS, zms_vector, ZydecFormattingInfo::Div, 0, zmf_none, "_mm_div_ps(", ");" },
+  { ZYDIS_MNEMONIC_DIVSD, zms_vector, ZydecFormattingInfo::Div, 0, zmf_none, "_mm_div_sd(", ");" },
+  { ZYDIS_MNEMONIC_DIVSS, zms_vector, ZydecFormattingInfo::Div, 0, zmf_none, "_mm_div_ss(", ");" },
+  { ZYDIS_MNEMONIC_DPPD, zms_vector, ZydecFormattingInfo::DotProduct, 0, zmf_none, "_mm_dp_pd(", ");" },
+  { ZYDIS_MNEMONIC_DPPS, zms_vector, ZydecFormattingInfo::DotProduct, 0, zmf_none, "_mm_dp_ps(", ");" },
+  { ZYDIS_MNEMONIC_EMMS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_empty(", ");" },
+  { ZYDIS_MNEMONIC_ENCLS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_ENCLU, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_ENCLV, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_ENCODEKEY128, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_ENCODEKEY256, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_ENDBR32, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_ENDBR64, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_ENQCMD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_ENQCMDS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_ENTER, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_EXTRACTPS, zms_vector, ZydecFormattingInfo::Extract, 0, zmf_none, "_mm_extract_ps(", ");" },
+  { ZYDIS_MNEMONIC_EXTRQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_F2XM1, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FABS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FADD, zms_arithmetic, ZydecFormattingInfo::Add, zop_Add, zmf_none, nullptr, ";" },
+  { ZYDIS_MNEMONIC_FADDP, zms_arithmetic, ZydecFormattingInfo::Add, zop_Add, zmf_none, nullptr, ";" },
+  { ZYDIS_MNEMONIC_FBLD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FBSTP, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FCHS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FCMOVB, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FCMOVBE, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FCMOVE, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FCMOVNB, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FCMOVNBE, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FCMOVNE, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FCMOVNU, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FCMOVU, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FCOM, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FCOMI, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FCOMIP, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FCOMP, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FCOMPP, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FCOS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FDECSTP, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FDISI8087_NOP, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FDIV, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FDIVP, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FDIVR, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FDIVRP, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FEMMS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FENI8087_NOP, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FFREE, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FFREEP, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FIADD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FICOM, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FICOMP, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FIDIV, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FIDIVR, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FILD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FIMUL, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FINCSTP, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FIST, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FISTP, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FISTTP, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FISUB, zms_arithmetic, ZydecFormattingInfo::And, zop_Sub, zmf_none, nullptr, ";" },
+  { ZYDIS_MNEMONIC_FISUBR, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FLD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FLD1, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FLDCW, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FLDENV, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FLDL2E, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FLDL2T, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FLDLG2, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FLDLN2, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FLDPI, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FLDZ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FMUL, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FMULP, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FNCLEX, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FNINIT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FNOP, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FNSAVE, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FNSTCW, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FNSTENV, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FNSTSW, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FPATAN, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FPREM, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FPREM1, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FPTAN, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FRNDINT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FRSTOR, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FSCALE, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FSETPM287_NOP, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FSIN, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FSINCOS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FSQRT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FST, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FSTP, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FSTPNCE, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FSUB, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FSUBP, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FSUBR, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FSUBRP, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FTST, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FUCOM, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FUCOMI, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FUCOMIP, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FUCOMP, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FUCOMPP, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FWAIT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FXAM, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FXCH, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FXRSTOR, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FXRSTOR64, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FXSAVE, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FXSAVE64, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FXTRACT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FYL2X, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_FYL2XP1, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_GETSEC, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_GF2P8AFFINEINVQB, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_GF2P8AFFINEQB, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_GF2P8MULB, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_HADDPD, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_hadd_pd(", ");" },
+  { ZYDIS_MNEMONIC_HADDPS, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_hadd_ps(", ");" },
+  { ZYDIS_MNEMONIC_HLT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_HRESET, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_HSUBPD, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_hsub_pd(", ");" },
+  { ZYDIS_MNEMONIC_HSUBPS, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_hsub_ps(", ");" },
+  { ZYDIS_MNEMONIC_IDIV, zms_divide, ZydecFormattingInfo::Div, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_IMUL, zms_multiply, ZydecFormattingInfo::Mul, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_IN, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_INC, zms_arithmetic, ZydecFormattingInfo::Inc, zop_None, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_INCSSPD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_INCSSPQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_INSB, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_INSD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_INSERTPS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_insert_ps(", ");" },
+  { ZYDIS_MNEMONIC_INSERTQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_INSW, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_INT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_INT1, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_INT3, zms_function, ZydecFormattingInfo::None, 0, zmf_none, "__builtin_trap(); // __debugbreak();", nullptr },
+  { ZYDIS_MNEMONIC_INTO, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_INVD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_INVEPT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_INVLPG, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_INVLPGA, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_INVLPGB, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_INVPCID, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_INVVPID, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_IRET, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_IRETD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_IRETQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_JB, zms_function, ZydecFormattingInfo::None, 1, zmf_none, "if (carry_flag) goto ", "; // if below" },
+  { ZYDIS_MNEMONIC_JBE, zms_function, ZydecFormattingInfo::None, 1, zmf_none, "if (carry_flag || zero_flag) goto ", "; // if below or equal" },
+  { ZYDIS_MNEMONIC_JCXZ, zms_function, ZydecFormattingInfo::None, 1, zmf_none, "if ((u16)c == 0) goto ", ";" },
+  { ZYDIS_MNEMONIC_JECXZ, zms_function, ZydecFormattingInfo::None, 1, zmf_none, "if ((u32)c == 0) goto ", ";" },
+  { ZYDIS_MNEMONIC_JKNZD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_JKZD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_JL, zms_function, ZydecFormattingInfo::None, 1, zmf_none, "if (sign_flag != overflow_flag) goto ", "; // if less" },
+  { ZYDIS_MNEMONIC_JLE, zms_function, ZydecFormattingInfo::None, 1, zmf_none, "if (zero_flag || sign_flag != overflow_flag) goto ", "; // if less or equal" },
+  { ZYDIS_MNEMONIC_JMP, zms_function, ZydecFormattingInfo::None, 1, zmf_none, "goto ", ";" },
+  { ZYDIS_MNEMONIC_JNB, zms_function, ZydecFormattingInfo::None, 1, zmf_none, "if (!carry_flag) goto ", "; // if not below" },
+  { ZYDIS_MNEMONIC_JNBE, zms_function, ZydecFormattingInfo::None, 1, zmf_none, "if (!carry_flag && !zero_flag) goto ", "; // if not below or equal" },
+  { ZYDIS_MNEMONIC_JNL, zms_function, ZydecFormattingInfo::None, 1, zmf_none, "if (sign_flag && overflow_flag) goto ", "; // if not less" },
+  { ZYDIS_MNEMONIC_JNLE, zms_function, ZydecFormattingInfo::None, 1, zmf_none, "if (!zero_flag && sign_flag == overflow_flag) goto ", "; // if not less or equal" },
+  { ZYDIS_MNEMONIC_JNO, zms_function, ZydecFormattingInfo::None, 1, zmf_none, "if (!overflow_flag) goto ", ";" },
+  { ZYDIS_MNEMONIC_JNP, zms_function, ZydecFormattingInfo::None, 1, zmf_none, "if (!parity_flag) goto ", ";" },
+  { ZYDIS_MNEMONIC_JNS, zms_function, ZydecFormattingInfo::None, 1, zmf_none, "if (!sign_flag) goto ", ";" },
+  { ZYDIS_MNEMONIC_JNZ, zms_function, ZydecFormattingInfo::None, 1, zmf_none, "if (!zero_flag) goto ", "; // if not zero / not equal" },
+  { ZYDIS_MNEMONIC_JO, zms_function, ZydecFormattingInfo::None, 1, zmf_none, "if (overflow_flag) goto ", ";" },
+  { ZYDIS_MNEMONIC_JP, zms_function, ZydecFormattingInfo::None, 1, zmf_none, "if (parity_flag) goto ", ";" },
+  { ZYDIS_MNEMONIC_JRCXZ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_JS, zms_function, ZydecFormattingInfo::None, 1, zmf_none, "if (sign_flag) goto ", ";" },
+  { ZYDIS_MNEMONIC_JZ, zms_function, ZydecFormattingInfo::None, 1, zmf_none, "if (zero_flag) goto ", "; // if zero / equal" },
+  { ZYDIS_MNEMONIC_KADDB, zms_maskArithmetic, ZydecFormattingInfo::Add, zop_Add, zmf_none, nullptr, ";" },
+  { ZYDIS_MNEMONIC_KADDD, zms_maskArithmetic, ZydecFormattingInfo::Add, zop_Add, zmf_none, nullptr, ";" },
+  { ZYDIS_MNEMONIC_KADDQ, zms_maskArithmetic, ZydecFormattingInfo::Add, zop_Add, zmf_none, nullptr, ";" },
+  { ZYDIS_MNEMONIC_KADDW, zms_maskArithmetic, ZydecFormattingInfo::Add, zop_Add, zmf_none, nullptr, ";" },
+  { ZYDIS_MNEMONIC_KAND, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_KANDB, zms_maskArithmetic, ZydecFormattingInfo::And, zop_And, zmf_sameRegisterAssign, nullptr, ";" },
+  { ZYDIS_MNEMONIC_KANDD, zms_maskArithmetic, ZydecFormattingInfo::And, zop_And, zmf_sameRegisterAssign, nullptr, ";" },
+  { ZYDIS_MNEMONIC_KANDN, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_KANDNB, zms_vector, ZydecFormattingInfo::AndNot, 0, zmf_none, "_kandn_mask8(", ");" },
+  { ZYDIS_MNEMONIC_KANDND, zms_vector, ZydecFormattingInfo::AndNot, 0, zmf_none, "_kandn_mask32(", ");" },
+  { ZYDIS_MNEMONIC_KANDNQ, zms_vector, ZydecFormattingInfo::AndNot, 0, zmf_none, "_kandn_mask64(", ");" },
+  { ZYDIS_MNEMONIC_KANDNR, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_KANDNW, zms_vector, ZydecFormattingInfo::AndNot, 0, zmf_none, "_kandn_mask16(", ");" },
+  { ZYDIS_MNEMONIC_KANDQ, zms_maskArithmetic, ZydecFormattingInfo::And, zop_And, zmf_sameRegisterAssign, nullptr, ";" },
+  { ZYDIS_MNEMONIC_KANDW, zms_maskArithmetic, ZydecFormattingInfo::And, zop_And, zmf_sameRegisterAssign, nullptr, ";" },
+  { ZYDIS_MNEMONIC_KCONCATH, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_KCONCATL, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_KEXTRACT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_KMERGE2L1H, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_KMERGE2L1L, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_KMOV, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_KMOVB, zms_assign, ZydecFormattingInfo::Mov, 1, zmf_sameRegisterNop | zmf_hintSource, nullptr, ";" },
+  { ZYDIS_MNEMONIC_KMOVD, zms_assign, ZydecFormattingInfo::Mov, 1, zmf_sameRegisterNop | zmf_hintSource, nullptr, ";" },
+  { ZYDIS_MNEMONIC_KMOVQ, zms_assign, ZydecFormattingInfo::Mov, 1, zmf_sameRegisterNop | zmf_hintSource, nullptr, ";" },
+  { ZYDIS_MNEMONIC_KMOVW, zms_assign, ZydecFormattingInfo::Mov, 1, zmf_sameRegisterNop | zmf_hintSource, nullptr, ";" },
+  { ZYDIS_MNEMONIC_KNOT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_KNOTB, zms_vector, ZydecFormattingInfo::Not, 0, zmf_none, "_knot_mask8(", ");" },
+  { ZYDIS_MNEMONIC_KNOTD, zms_vector, ZydecFormattingInfo::Not, 0, zmf_none, "_knot_mask32(", ");" },
+  { ZYDIS_MNEMONIC_KNOTQ, zms_vector, ZydecFormattingInfo::Not, 0, zmf_none, "_knot_mask64(", ");" },
+  { ZYDIS_MNEMONIC_KNOTW, zms_vector, ZydecFormattingInfo::Not, 0, zmf_none, "_knot_mask16(", ");" },
+  { ZYDIS_MNEMONIC_KOR, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_KORB, zms_maskArithmetic, ZydecFormattingInfo::Or, zop_Or, zmf_sameRegisterAssign, nullptr, ";" },
+  { ZYDIS_MNEMONIC_KORD, zms_maskArithmetic, ZydecFormattingInfo::Or, zop_Or, zmf_sameRegisterAssign, nullptr, ";" },
+  { ZYDIS_MNEMONIC_KORQ, zms_maskArithmetic, ZydecFormattingInfo::Or, zop_Or, zmf_sameRegisterAssign, nullptr, ";" },
+  { ZYDIS_MNEMONIC_KORTEST, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_KORTESTB, zms_function, ZydecFormattingInfo::None, 2, zmf_none, "_kortest_u8(", "); // set zero_flag & carry_flag accordingly" },
+  { ZYDIS_MNEMONIC_KORTESTD, zms_function, ZydecFormattingInfo::None, 2, zmf_none, "_kortest_u32(", "); // set zero_flag & carry_flag accordingly" },
+  { ZYDIS_MNEMONIC_KORTESTQ, zms_function, ZydecFormattingInfo::None, 2, zmf_none, "_kortest_u64(", "); // set zero_flag & carry_flag accordingly" },
+  { ZYDIS_MNEMONIC_KORTESTW, zms_function, ZydecFormattingInfo::None, 2, zmf_none, "_kortest_u16(", "); // set zero_flag & carry_flag accordingly" },
+  { ZYDIS_MNEMONIC_KORW, zms_maskArithmetic, ZydecFormattingInfo::Or, zop_Or, zmf_sameRegisterAssign, nullptr, ";" },
+  { ZYDIS_MNEMONIC_KSHIFTLB, zms_maskArithmetic, ZydecFormattingInfo::ShL, zop_ShL, zmf_none, nullptr, ";" },
+  { ZYDIS_MNEMONIC_KSHIFTLD, zms_maskArithmetic, ZydecFormattingInfo::ShL, zop_ShL, zmf_none, nullptr, ";" },
+  { ZYDIS_MNEMONIC_KSHIFTLQ, zms_maskArithmetic, ZydecFormattingInfo::ShL, zop_ShL, zmf_none, nullptr, ";" },
+  { ZYDIS_MNEMONIC_KSHIFTLW, zms_maskArithmetic, ZydecFormattingInfo::ShL, zop_ShL, zmf_none, nullptr, ";" },
+  { ZYDIS_MNEMONIC_KSHIFTRB, zms_maskArithmetic, ZydecFormattingInfo::ShR, zop_ShR, zmf_none, nullptr, ";" },
+  { ZYDIS_MNEMONIC_KSHIFTRD, zms_maskArithmetic, ZydecFormattingInfo::ShR, zop_ShR, zmf_none, nullptr, ";" },
+  { ZYDIS_MNEMONIC_KSHIFTRQ, zms_maskArithmetic, ZydecFormattingInfo::ShR, zop_ShR, zmf_none, nullptr, ";" },
+  { ZYDIS_MNEMONIC_KSHIFTRW, zms_maskArithmetic, ZydecFormattingInfo::ShR, zop_ShR, zmf_none, nullptr, ";" },
+  { ZYDIS_MNEMONIC_KTESTB, zms_function, ZydecFormattingInfo::None, 2, zmf_none, "_ktest_u8(", "); // set zero_flag & carry_flag accordingly" },
+  { ZYDIS_MNEMONIC_KTESTD, zms_function, ZydecFormattingInfo::None, 2, zmf_none, "_ktest_u32(", "); // set zero_flag & carry_flag accordingly" },
+  { ZYDIS_MNEMONIC_KTESTQ, zms_function, ZydecFormattingInfo::None, 2, zmf_none, "_ktest_u64(", "); // set zero_flag & carry_flag accordingly" },
+  { ZYDIS_MNEMONIC_KTESTW, zms_function, ZydecFormattingInfo::None, 2, zmf_none, "_ktest_u16(", "); // set zero_flag & carry_flag accordingly" },
+  { ZYDIS_MNEMONIC_KUNPCKBW, zms_vector, ZydecFormattingInfo::Unpack, 0, zmf_none, "_mm_kunpackepi8_epi16(", ");" },
+  { ZYDIS_MNEMONIC_KUNPCKDQ, zms_vector, ZydecFormattingInfo::Unpack, 0, zmf_none, "_mm_kunpackepi32_epi64(", ");" },
+  { ZYDIS_MNEMONIC_KUNPCKWD, zms_vector, ZydecFormattingInfo::Unpack, 0, zmf_none, "_mm_kunpackepi16_epi32(", ");" },
+  { ZYDIS_MNEMONIC_KXNOR, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_KXNORB, zms_vector, ZydecFormattingInfo::XNor, 0, zmf_none, "_kxnor_mask8(", ");" },
+  { ZYDIS_MNEMONIC_KXNORD, zms_vector, ZydecFormattingInfo::XNor, 0, zmf_none, "_kxnor_mask32(", ");" },
+  { ZYDIS_MNEMONIC_KXNORQ, zms_vector, ZydecFormattingInfo::XNor, 0, zmf_none, "_kxnor_mask64(", ");" },
+  { ZYDIS_MNEMONIC_KXNORW, zms_vector, ZydecFormattingInfo::XNor, 0, zmf_none, "_kxnor_mask16(", ");" },
+  { ZYDIS_MNEMONIC_KXOR, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_KXORB, zms_maskArithmetic, ZydecFormattingInfo::XOr, zop_XOr, zmf_sameRegisterZero, nullptr, ";" },
+  { ZYDIS_MNEMONIC_KXORD, zms_maskArithmetic, ZydecFormattingInfo::XOr, zop_XOr, zmf_sameRegisterZero, nullptr, ";" },
+  { ZYDIS_MNEMONIC_KXORQ, zms_maskArithmetic, ZydecFormattingInfo::XOr, zop_XOr, zmf_sameRegisterZero, nullptr, ";" },
+  { ZYDIS_MNEMONIC_KXORW, zms_maskArithmetic, ZydecFormattingInfo::XOr, zop_XOr, zmf_sameRegisterZero, nullptr, ";" },
+  { ZYDIS_MNEMONIC_LAHF, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_LAR, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_LDDQU, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_widthSuffix, "_cross_cache_line_si(", ";" },
+  { ZYDIS_MNEMONIC_LDMXCSR, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_LDS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_LDTILECFG, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_LEA, zms_assign, ZydecFormattingInfo::AddressOf, 1, zmf_hintSource, "&", ";" },
+  { ZYDIS_MNEMONIC_LEAVE, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_LES, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_LFENCE, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_lfence(", ");" },
+  { ZYDIS_MNEMONIC_LFS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_LGDT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_LGS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_LIDT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_LLDT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_LLWPCB, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_LMSW, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_LOADIWKEY, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_LODSB, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_LODSD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_LODSQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_LODSW, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_LOOP, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_LOOPE, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_LOOPNE, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_LSL, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_LSS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_LTR, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_LWPINS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_LWPVAL, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_LZCNT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_MASKMOVDQU, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_none, "_mask_si128(", ";" },
+  { ZYDIS_MNEMONIC_MASKMOVQ, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_none, "_mask_epi64(", ";" },
+  { ZYDIS_MNEMONIC_MAXPD, zms_vector, ZydecFormattingInfo::Max, 0, zmf_none, "_mm_max_pd(", ");" },
+  { ZYDIS_MNEMONIC_MAXPS, zms_vector, ZydecFormattingInfo::Max, 0, zmf_none, "_mm_max_ps(", ");" },
+  { ZYDIS_MNEMONIC_MAXSD, zms_vector, ZydecFormattingInfo::Max, 0, zmf_none, "_mm_max_sd(", ");" },
+  { ZYDIS_MNEMONIC_MAXSS, zms_vector, ZydecFormattingInfo::Max, 0, zmf_none, "_mm_max_ss(", ");" },
+  { ZYDIS_MNEMONIC_MCOMMIT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_MFENCE, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_MINPD, zms_vector, ZydecFormattingInfo::Min, 0, zmf_none, "_mm_min_pd(", ");" },
+  { ZYDIS_MNEMONIC_MINPS, zms_vector, ZydecFormattingInfo::Min, 0, zmf_none, "_mm_min_ps(", ");" },
+  { ZYDIS_MNEMONIC_MINSD, zms_vector, ZydecFormattingInfo::Min, 0, zmf_none, "_mm_min_sd(", ");" },
+  { ZYDIS_MNEMONIC_MINSS, zms_vector, ZydecFormattingInfo::Min, 0, zmf_none, "_mm_min_ss(", ");" },
+  { ZYDIS_MNEMONIC_MONITOR, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_MONITORX, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_MONTMUL, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_MOV, zms_assign, ZydecFormattingInfo::Mov, 1, zmf_sameRegisterNop | zmf_hintSource, nullptr, ";" },
+  { ZYDIS_MNEMONIC_MOVAPD, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_aligned, "_pd(", ";" },
+  { ZYDIS_MNEMONIC_MOVAPS, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_aligned, "_ps(", ";" },
+  { ZYDIS_MNEMONIC_MOVBE, zms_assign, ZydecFormattingInfo::Mov, 1, zmf_sameRegisterNop | zmf_hintSource, "__byteswap(", ");" },
+  { ZYDIS_MNEMONIC_MOVD, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_none, "_epi32(", ";" },
+  { ZYDIS_MNEMONIC_MOVDDUP, zms_vector, ZydecFormattingInfo::None, 0, zmf_addressParam, nullptr, ");" },
+  { ZYDIS_MNEMONIC_MOVDIR64B, zms_assign, ZydecFormattingInfo::Mov, 1, zmf_sameRegisterNop | zmf_hintSource, "__atomic_write(", ");" },
+  { ZYDIS_MNEMONIC_MOVDIRI, zms_assign, ZydecFormattingInfo::Mov, 1, zmf_sameRegisterNop | zmf_hintSource, "__atomic_write(", ");" },
+  { ZYDIS_MNEMONIC_MOVDQ2Q, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_none, "_pi(", ";" },
+  { ZYDIS_MNEMONIC_MOVDQA, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_aligned | zmf_widthSuffix, "_si(", ";" },
+  { ZYDIS_MNEMONIC_MOVDQU, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_widthSuffix, "_si(", ";" },
+  { ZYDIS_MNEMONIC_MOVHLPS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_movehl_ps(", ");" },
+  { ZYDIS_MNEMONIC_MOVHPD, zms_vector, ZydecFormattingInfo::Mov, 0, zmf_none, nullptr, ");" },
+  { ZYDIS_MNEMONIC_MOVHPS, zms_vector, ZydecFormattingInfo::Mov, 0, zmf_none, nullptr, ");" },
+  { ZYDIS_MNEMONIC_MOVLHPS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_movelh_ps(", ");" },
+  { ZYDIS_MNEMONIC_MOVLPD, zms_assign, ZydecFormattingInfo::Mov, 1, zmf_sameRegisterNop | zmf_hintSource, nullptr, ";" },
+  { ZYDIS_MNEMONIC_MOVLPS, zms_assign, ZydecFormattingInfo::Mov, 1, zmf_sameRegisterNop | zmf_hintSource, nullptr, ";" },
+  { ZYDIS_MNEMONIC_MOVMSKPD, zms_vector, ZydecFormattingInfo::Mask, 0, zmf_noSelfReference, "_mm_movemask_pd(", ");" },
+  { ZYDIS_MNEMONIC_MOVMSKPS, zms_vector, ZydecFormattingInfo::Mask, 0, zmf_noSelfReference, "_mm_movemask_ps(", ");" },
+  { ZYDIS_MNEMONIC_MOVNTDQ, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_aligned | zmf_widthSuffix, "_stream_si(", ";" },
+  { ZYDIS_MNEMONIC_MOVNTDQA, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_aligned | zmf_widthSuffix, "_stream_si(", ";" },
+  { ZYDIS_MNEMONIC_MOVNTI, zms_assign, ZydecFormattingInfo::Mov, 1, zmf_sameRegisterNop | zmf_hintSource, nullptr, "; // move with non-temporal hint" },
+  { ZYDIS_MNEMONIC_MOVNTPD, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_aligned, "_stream_pd(", ";" },
+  { ZYDIS_MNEMONIC_MOVNTPS, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_aligned, "_stream_ps(", ";" },
+  { ZYDIS_MNEMONIC_MOVNTQ, zms_assign, ZydecFormattingInfo::Mov, 1, zmf_sameRegisterNop | zmf_hintSource, nullptr, "; // move with non-temporal hint" },
+  { ZYDIS_MNEMONIC_MOVNTSD, zms_assign, ZydecFormattingInfo::Mov, 1, zmf_sameRegisterNop | zmf_hintSource, nullptr, "; // move with non-temporal hint" },
+  { ZYDIS_MNEMONIC_MOVNTSS, zms_assign, ZydecFormattingInfo::Mov, 1, zmf_sameRegisterNop | zmf_hintSource, nullptr, "; // move with non-temporal hint" },
+  { ZYDIS_MNEMONIC_MOVQ, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_none, "_epi64(", ";" },
+  { ZYDIS_MNEMONIC_MOVQ2DQ, zms_assign, ZydecFormattingInfo::Mov, 1, zmf_sameRegisterNop | zmf_hintSource, nullptr, ";" },
+  { ZYDIS_MNEMONIC_MOVSB, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_MOVSD, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_none, "_sd(", ";" },
+  { ZYDIS_MNEMONIC_MOVSHDUP, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_movehdup_ps(", ");" },
+  { ZYDIS_MNEMONIC_MOVSLDUP, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_moveldup_ps(", ");" },
+  { ZYDIS_MNEMONIC_MOVSQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_MOVSS, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_none, "_ss(", ";" },
+  { ZYDIS_MNEMONIC_MOVSW, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_MOVSX, zms_assign, ZydecFormattingInfo::Mov, 1, zmf_sameRegisterNop | zmf_hintSource, nullptr, "; // move with sign extension" },
+  { ZYDIS_MNEMONIC_MOVSXD, zms_assign, ZydecFormattingInfo::Mov, 1, zmf_sameRegisterNop | zmf_hintSource, nullptr, "; // move with sign extension" },
+  { ZYDIS_MNEMONIC_MOVUPD, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_none, "_pd(", ";" },
+  { ZYDIS_MNEMONIC_MOVUPS, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_none, "_ps(", ";" },
+  { ZYDIS_MNEMONIC_MOVZX, zms_assign, ZydecFormattingInfo::Mov, 1, zmf_sameRegisterNop | zmf_hintSource, nullptr, ";" },
+  { ZYDIS_MNEMONIC_MPSADBW, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_mpsadbw_epu8(", ");" },
+  { ZYDIS_MNEMONIC_MUL, zms_multiply, ZydecFormattingInfo::Mul, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_MULPD, zms_vector, ZydecFormattingInfo::Mul, 0, zmf_none, "_mm_mul_pd(", ");" },
+  { ZYDIS_MNEMONIC_MULPS, zms_vector, ZydecFormattingInfo::Mul, 0, zmf_none, "_mm_mul_ps(", ");" },
+  { ZYDIS_MNEMONIC_MULSD, zms_vector, ZydecFormattingInfo::Mul, 0, zmf_none, "_mm_mul_sd(", ");" },
+  { ZYDIS_MNEMONIC_MULSS, zms_vector, ZydecFormattingInfo::Mul, 0, zmf_none, "_mm_mul_ss(", ");" },
+  { ZYDIS_MNEMONIC_MULX, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_MWAIT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_MWAITX, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_NEG, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_NOP, zms_function, ZydecFormattingInfo::None, 0, zmf_none, "// nop", nullptr },
+  { ZYDIS_MNEMONIC_NOT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_OR, zms_arithmetic, ZydecFormattingInfo::Or, zop_Or, zmf_sameRegisterNop, nullptr, ";" },
+  { ZYDIS_MNEMONIC_ORPD, zms_vector, ZydecFormattingInfo::Or, 0, zmf_sameRegisterAssign, "_mm_or_pd(", ");" },
+  { ZYDIS_MNEMONIC_ORPS, zms_vector, ZydecFormattingInfo::Or, 0, zmf_sameRegisterAssign, "_mm_or_ps(", ");" },
+  { ZYDIS_MNEMONIC_OUT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_OUTSB, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_OUTSD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_OUTSW, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PABSB, zms_vector, ZydecFormattingInfo::Abs, 0, zmf_none, "_mm_abs_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PABSD, zms_vector, ZydecFormattingInfo::Abs, 0, zmf_none, "_mm_abs_epi32(", ");" },
+  { ZYDIS_MNEMONIC_PABSW, zms_vector, ZydecFormattingInfo::Abs, 0, zmf_none, "_mm_abs_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PACKSSDW, zms_vector, ZydecFormattingInfo::Pack, 0, zmf_none, "_mm_packs_epu32_to_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PACKSSWB, zms_vector, ZydecFormattingInfo::Pack, 0, zmf_none, "_mm_packs_epu16_to_epi8(", ");" },
+  { ZYDIS_MNEMONIC_PACKUSDW, zms_vector, ZydecFormattingInfo::Pack, 0, zmf_none, "_mm_packus_epu32_to_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PACKUSWB, zms_vector, ZydecFormattingInfo::Pack, 0, zmf_none, "_mm_packus_epu16_to_epi8(", ");" },
+  { ZYDIS_MNEMONIC_PADDB, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_add_epi8(", ");" },
+  { ZYDIS_MNEMONIC_PADDD, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_add_epi32(", ");" },
+  { ZYDIS_MNEMONIC_PADDQ, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_add_epi64(", ");" },
+  { ZYDIS_MNEMONIC_PADDSB, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_adds_epi8(", ");" },
+  { ZYDIS_MNEMONIC_PADDSW, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_adds_epi8(", ");" },
+  { ZYDIS_MNEMONIC_PADDUSB, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_adds_epu8(", ");" },
+  { ZYDIS_MNEMONIC_PADDUSW, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_adds_epu16(", ");" },
+  { ZYDIS_MNEMONIC_PADDW, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_add_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PALIGNR, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_alignr_epi8(", ");" },
+  { ZYDIS_MNEMONIC_PAND, zms_vector, ZydecFormattingInfo::And, 0, zmf_sameRegisterAssign | zmf_widthSuffix, "_mm_and_si(", ");" },
+  { ZYDIS_MNEMONIC_PANDN, zms_vector, ZydecFormattingInfo::AndNot, 0, zmf_widthSuffix, "_mm_andnot_si(", ");" },
+  { ZYDIS_MNEMONIC_PAUSE, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_pause(", ");" },
+  { ZYDIS_MNEMONIC_PAVGB, zms_vector, ZydecFormattingInfo::Abs, 0, zmf_none, "_mm_avg_epu8(", ");" },
+  { ZYDIS_MNEMONIC_PAVGUSB, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PAVGW, zms_vector, ZydecFormattingInfo::Abs, 0, zmf_none, "_mm_avg_epu16(", ");" },
+  { ZYDIS_MNEMONIC_PBLENDVB, zms_vector, ZydecFormattingInfo::Blend, 0, zmf_none, "_mm_blendv_epi8(", ");" },
+  { ZYDIS_MNEMONIC_PBLENDW, zms_vector, ZydecFormattingInfo::Blend, 0, zmf_none, "_mm_blend_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PCLMULQDQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PCMPEQB, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_sameRegisterAllOnes, "_mm_cmpeq_epi8(", ");" },
+  { ZYDIS_MNEMONIC_PCMPEQD, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_sameRegisterAllOnes, "_mm_cmpeq_epi32(", ");" },
+  { ZYDIS_MNEMONIC_PCMPEQQ, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_sameRegisterAllOnes, "_mm_cmpeq_epi64(", ");" },
+  { ZYDIS_MNEMONIC_PCMPEQW, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_sameRegisterAllOnes, "_mm_cmpeq_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PCMPESTRI, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_cmpstr(", ");" },
+  { ZYDIS_MNEMONIC_PCMPESTRM, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_cmpestrm(", ");" },
+  { ZYDIS_MNEMONIC_PCMPGTB, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_none, "_mm_cmpgt_epi8(", ");" },
+  { ZYDIS_MNEMONIC_PCMPGTD, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_none, "_mm_cmpgt_epi32(", ");" },
+  { ZYDIS_MNEMONIC_PCMPGTQ, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_none, "_mm_cmpgt_epi64(", ");" },
+  { ZYDIS_MNEMONIC_PCMPGTW, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_none, "_mm_cmpgt_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PCMPISTRI, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PCMPISTRM, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PCONFIG, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PDEP, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PEXT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PEXTRB, zms_vector, ZydecFormattingInfo::Extract, 0, zmf_none, "_mm_extract_epi8(", ");" },
+  { ZYDIS_MNEMONIC_PEXTRD, zms_vector, ZydecFormattingInfo::Extract, 0, zmf_none, "_mm_extract_epi32(", ");" },
+  { ZYDIS_MNEMONIC_PEXTRQ, zms_vector, ZydecFormattingInfo::Extract, 0, zmf_none, "_mm_extract_epi64(", ");" },
+  { ZYDIS_MNEMONIC_PEXTRW, zms_vector, ZydecFormattingInfo::Extract, 0, zmf_none, "_mm_extract_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PF2ID, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PF2IW, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PFACC, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PFADD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PFCMPEQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PFCMPGE, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PFCMPGT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PFCPIT1, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PFMAX, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PFMIN, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PFMUL, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PFNACC, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PFPNACC, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PFRCP, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PFRCPIT2, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PFRSQIT1, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PFSQRT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PFSUB, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PFSUBR, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PHADDD, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_hadd_epi32(", ");" },
+  { ZYDIS_MNEMONIC_PHADDSW, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_hadds_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PHADDW, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_hadd_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PHMINPOSUW, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_minpos_epu16(", ");" },
+  { ZYDIS_MNEMONIC_PHSUBD, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_hsub_epi32(", ");" },
+  { ZYDIS_MNEMONIC_PHSUBSW, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_hsubs_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PHSUBW, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_hsub_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PI2FD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PI2FW, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PINSRB, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_insert_epi8(", ");" },
+  { ZYDIS_MNEMONIC_PINSRD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_insert_epi32(", ");" },
+  { ZYDIS_MNEMONIC_PINSRQ, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_insert_epi64(", ");" },
+  { ZYDIS_MNEMONIC_PINSRW, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_insert_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PMADDUBSW, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_maddubs_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PMADDWD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_pmadd_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PMAXSB, zms_vector, ZydecFormattingInfo::Max, 0, zmf_none, "_mm_max_epi8(", ");" },
+  { ZYDIS_MNEMONIC_PMAXSD, zms_vector, ZydecFormattingInfo::Max, 0, zmf_none, "_mm_max_epi32(", ");" },
+  { ZYDIS_MNEMONIC_PMAXSW, zms_vector, ZydecFormattingInfo::Max, 0, zmf_none, "_mm_max_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PMAXUB, zms_vector, ZydecFormattingInfo::Max, 0, zmf_none, "_mm_max_epu8(", ");" },
+  { ZYDIS_MNEMONIC_PMAXUD, zms_vector, ZydecFormattingInfo::Max, 0, zmf_none, "_mm_max_epu32(", ");" },
+  { ZYDIS_MNEMONIC_PMAXUW, zms_vector, ZydecFormattingInfo::Max, 0, zmf_none, "_mm_max_epu16(", ");" },
+  { ZYDIS_MNEMONIC_PMINSB, zms_vector, ZydecFormattingInfo::Min, 0, zmf_none, "_mm_min_epi8(", ");" },
+  { ZYDIS_MNEMONIC_PMINSD, zms_vector, ZydecFormattingInfo::Min, 0, zmf_none, "_mm_min_epi32(", ");" },
+  { ZYDIS_MNEMONIC_PMINSW, zms_vector, ZydecFormattingInfo::Min, 0, zmf_none, "_mm_min_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PMINUB, zms_vector, ZydecFormattingInfo::Min, 0, zmf_none, "_mm_min_epu8(", ");" },
+  { ZYDIS_MNEMONIC_PMINUD, zms_vector, ZydecFormattingInfo::Min, 0, zmf_none, "_mm_min_epu32(", ");" },
+  { ZYDIS_MNEMONIC_PMINUW, zms_vector, ZydecFormattingInfo::Min, 0, zmf_none, "_mm_min_epu16(", ");" },
+  { ZYDIS_MNEMONIC_PMOVMSKB, zms_vector, ZydecFormattingInfo::Mask, 0, zmf_noSelfReference, "_mm_movemask_epi8(", ");" },
+  { ZYDIS_MNEMONIC_PMOVSXBD, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepi8_epi32(", ");" },
+  { ZYDIS_MNEMONIC_PMOVSXBQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepi8_epi64(", ");" },
+  { ZYDIS_MNEMONIC_PMOVSXBW, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepi8_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PMOVSXDQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepi32_epi64(", ");" },
+  { ZYDIS_MNEMONIC_PMOVSXWD, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepi16_epi32(", ");" },
+  { ZYDIS_MNEMONIC_PMOVSXWQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepi16_epi64(", ");" },
+  { ZYDIS_MNEMONIC_PMOVZXBD, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepu8_epi32(", ");" },
+  { ZYDIS_MNEMONIC_PMOVZXBQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepu8_epi64(", ");" },
+  { ZYDIS_MNEMONIC_PMOVZXBW, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepu8_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PMOVZXDQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepu32_epi64(", ");" },
+  { ZYDIS_MNEMONIC_PMOVZXWD, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepu16_epi32(", ");" },
+  { ZYDIS_MNEMONIC_PMOVZXWQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepu16_epi64(", ");" },
+  { ZYDIS_MNEMONIC_PMULDQ, zms_vector, ZydecFormattingInfo::Mul, 0, zmf_none, "_mm_mul_epi32(", ");" },
+  { ZYDIS_MNEMONIC_PMULHRSW, zms_vector, ZydecFormattingInfo::Mul, 0, zmf_none, "_mm_mulhrs_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PMULHRW, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PMULHUW, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PMULHW, zms_vector, ZydecFormattingInfo::Mul, 0, zmf_none, "_mm_mulhi_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PMULLD, zms_vector, ZydecFormattingInfo::Mul, 0, zmf_none, "_mm_mullo_epi32(", ");" },
+  { ZYDIS_MNEMONIC_PMULLW, zms_vector, ZydecFormattingInfo::Mul, 0, zmf_none, "_mm_mullo_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PMULUDQ, zms_vector, ZydecFormattingInfo::Mul, 0, zmf_none, "_mm_mul_epu32(", ");" },
+  { ZYDIS_MNEMONIC_POP, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_POPA, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_POPAD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_POPCNT, zms_assign, ZydecFormattingInfo::PopCnt, 1, zmf_none, "__popcnt(", ");" },
+  { ZYDIS_MNEMONIC_POPF, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_POPFD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_POPFQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_POR, zms_vector, ZydecFormattingInfo::Or, 0, zmf_sameRegisterAssign | zmf_widthSuffix, "_mm_or_si(", ");" },
+  { ZYDIS_MNEMONIC_PREFETCH, zms_function, ZydecFormattingInfo::None, 1, zmf_none, "_mm_prefetch(", ");" },
+  { ZYDIS_MNEMONIC_PREFETCHNTA, zms_function, ZydecFormattingInfo::None, 1, zmf_none, "_mm_prefetch(", ");" },
+  { ZYDIS_MNEMONIC_PREFETCHT0, zms_function, ZydecFormattingInfo::None, 1, zmf_none, "_mm_prefetch(", ");" },
+  { ZYDIS_MNEMONIC_PREFETCHT1, zms_function, ZydecFormattingInfo::None, 1, zmf_none, "_mm_prefetch(", ");" },
+  { ZYDIS_MNEMONIC_PREFETCHT2, zms_function, ZydecFormattingInfo::None, 1, zmf_none, "_mm_prefetch(", ");" },
+  { ZYDIS_MNEMONIC_PREFETCHW, zms_function, ZydecFormattingInfo::None, 1, zmf_none, "_mm_prefetch(", ");" },
+  { ZYDIS_MNEMONIC_PREFETCHWT1, zms_function, ZydecFormattingInfo::None, 1, zmf_none, "_mm_prefetch(", ");" },
+  { ZYDIS_MNEMONIC_PSADBW, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_sad_epu8(", ");" },
+  { ZYDIS_MNEMONIC_PSHUFB, zms_vector, ZydecFormattingInfo::Shuffle, 0, zmf_none, "_mm_shuffle_epi8(", ");" },
+  { ZYDIS_MNEMONIC_PSHUFD, zms_vector, ZydecFormattingInfo::Shuffle, 0, zmf_none, "_mm_shuffle_epi32(", ");" },
+  { ZYDIS_MNEMONIC_PSHUFHW, zms_vector, ZydecFormattingInfo::Shuffle, 0, zmf_none, "_mm_shufflehi_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PSHUFLW, zms_vector, ZydecFormattingInfo::Shuffle, 0, zmf_none, "_mm_shufflelo_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PSHUFW, zms_vector, ZydecFormattingInfo::Shuffle, 0, zmf_none, "_mm_shuffle_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PSIGNB, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_sign_epi8(", ");" },
+  { ZYDIS_MNEMONIC_PSIGND, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_sign_epi32(", ");" },
+  { ZYDIS_MNEMONIC_PSIGNW, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_sign_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PSLLD, zms_vector, ZydecFormattingInfo::ShL, 0, zmf_none, "_mm_sll_epi32(", ");" },
+  { ZYDIS_MNEMONIC_PSLLDQ, zms_vector, ZydecFormattingInfo::ShL, 0, zmf_none, "_mm_bslli_epi128(", " * 8); // byte shift left in 128 bit lanes" },
+  { ZYDIS_MNEMONIC_PSLLQ, zms_vector, ZydecFormattingInfo::ShL, 0, zmf_none, "_mm_sll_epi64(", ");" },
+  { ZYDIS_MNEMONIC_PSLLW, zms_vector, ZydecFormattingInfo::ShL, 0, zmf_none, "_mm_sll_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PSMASH, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PSRAD, zms_vector, ZydecFormattingInfo::ShR, 0, zmf_none, "_mm_sra_epi32(", ");" },
+  { ZYDIS_MNEMONIC_PSRAW, zms_vector, ZydecFormattingInfo::ShR, 0, zmf_none, "_mm_sra_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PSRLD, zms_vector, ZydecFormattingInfo::ShR, 0, zmf_none, "_mm_srl_epi32(", ");" },
+  { ZYDIS_MNEMONIC_PSRLDQ, zms_vector, ZydecFormattingInfo::ShR, 0, zmf_none, "_mm_bsrli_epi128(", " * 8); // byte shift right in 128 bit lanes" },
+  { ZYDIS_MNEMONIC_PSRLQ, zms_vector, ZydecFormattingInfo::ShR, 0, zmf_none, "_mm_srl_epi64(", ");" },
+  { ZYDIS_MNEMONIC_PSRLW, zms_vector, ZydecFormattingInfo::ShR, 0, zmf_none, "_mm_srl_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PSUBB, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_sub_epi8(", ");" },
+  { ZYDIS_MNEMONIC_PSUBD, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_sub_epi32(", ");" },
+  { ZYDIS_MNEMONIC_PSUBQ, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_sub_epi64(", ");" },
+  { ZYDIS_MNEMONIC_PSUBSB, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_subs_epi8(", ");" },
+  { ZYDIS_MNEMONIC_PSUBSW, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_subs_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PSUBUSB, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PSUBUSW, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PSUBW, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_sub_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PSWAPD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PTEST, zms_vector, ZydecFormattingInfo::Test, 0, zmf_none, "_mm_test(", ");" },
+  { ZYDIS_MNEMONIC_PTWRITE, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PUNPCKHBW, zms_vector, ZydecFormattingInfo::Unpack, 0, zmf_none, "_mm_unpackhi_epi8(", ");" },
+  { ZYDIS_MNEMONIC_PUNPCKHDQ, zms_vector, ZydecFormattingInfo::Unpack, 0, zmf_none, "_mm_unpackhi_epi32(", ");" },
+  { ZYDIS_MNEMONIC_PUNPCKHQDQ, zms_vector, ZydecFormattingInfo::Unpack, 0, zmf_none, "_mm_unpackhi_epi64(", ");" },
+  { ZYDIS_MNEMONIC_PUNPCKHWD, zms_vector, ZydecFormattingInfo::Unpack, 0, zmf_none, "_mm_unpackhi_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PUNPCKLBW, zms_vector, ZydecFormattingInfo::Unpack, 0, zmf_none, "_mm_unpacklo_epi8(", ");" },
+  { ZYDIS_MNEMONIC_PUNPCKLDQ, zms_vector, ZydecFormattingInfo::Unpack, 0, zmf_none, "_mm_unpacklo_epi32(", ");" },
+  { ZYDIS_MNEMONIC_PUNPCKLQDQ, zms_vector, ZydecFormattingInfo::Unpack, 0, zmf_none, "_mm_unpacklo_epi64(", ");" },
+  { ZYDIS_MNEMONIC_PUNPCKLWD, zms_vector, ZydecFormattingInfo::Unpack, 0, zmf_none, "_mm_unpacklo_epi16(", ");" },
+  { ZYDIS_MNEMONIC_PUSH, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PUSHA, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PUSHAD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PUSHF, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PUSHFD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PUSHFQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PVALIDATE, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_PXOR, zms_vector, ZydecFormattingInfo::XOr, 0, zmf_sameRegisterZero | zmf_widthSuffix, "_mm_xor_si(", ");" },
+  { ZYDIS_MNEMONIC_RCL, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_RCPPS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rcp_ps(", ");" },
+  { ZYDIS_MNEMONIC_RCPSS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rcp_ss(", ");" },
+  { ZYDIS_MNEMONIC_RCR, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_RDFSBASE, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_RDGSBASE, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_RDMSR, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_RDPID, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_RDPKRU, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_RDPMC, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_RDPRU, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_RDRAND, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_RDSEED, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_RDSSPD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_RDSSPQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_RDTSC, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_RDTSCP, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_RET, zms_function, ZydecFormattingInfo::None, 0, zmf_none, "return", ";" },
+  { ZYDIS_MNEMONIC_RMPADJUST, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_RMPUPDATE, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_ROL, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_ROR, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_RORX, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_ROUNDPD, zms_vector, ZydecFormattingInfo::Round, 0, zmf_none, "_mm_round_pd(", ");" },
+  { ZYDIS_MNEMONIC_ROUNDPS, zms_vector, ZydecFormattingInfo::Round, 0, zmf_none, "_mm_round_ps(", ");" },
+  { ZYDIS_MNEMONIC_ROUNDSD, zms_vector, ZydecFormattingInfo::Round, 0, zmf_none, "_mm_round_sd(", ");" },
+  { ZYDIS_MNEMONIC_ROUNDSS, zms_vector, ZydecFormattingInfo::Round, 0, zmf_none, "_mm_round_ss(", ");" },
+  { ZYDIS_MNEMONIC_RSM, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_RSQRTPS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rsqrt_ps(", ");" },
+  { ZYDIS_MNEMONIC_RSQRTSS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rsqrt_ss(", ");" },
+  { ZYDIS_MNEMONIC_RSTORSSP, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SAHF, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SALC, zms_arithmetic, ZydecFormattingInfo::ShL, zop_ShL, zmf_none, nullptr, ";" },
+  { ZYDIS_MNEMONIC_SAR, zms_arithmetic, ZydecFormattingInfo::ShR, zop_ShR, zmf_none, nullptr, ";" },
+  { ZYDIS_MNEMONIC_SARX, zms_arithmetic, ZydecFormattingInfo::ShR, zop_ShR, zmf_none, nullptr, ";" },
+  { ZYDIS_MNEMONIC_SAVEPREVSSP, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SBB, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SCASB, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SCASD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SCASQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SCASW, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SEAMCALL, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SEAMOPS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SEAMRET, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SENDUIPI, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SERIALIZE, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SETB, zms_assign, ZydecFormattingInfo::Set, 0, zmf_none, "(carry_flag ? 1 : 0)", "; // if below" },
+  { ZYDIS_MNEMONIC_SETBE, zms_assign, ZydecFormattingInfo::Set, 0, zmf_none, "((carry_flag || zero_flag) ? 1 : 0)", "; // if below or equal" },
+  { ZYDIS_MNEMONIC_SETL, zms_assign, ZydecFormattingInfo::Set, 0, zmf_none, "(sign_flag != overflow_flag ? 1 : 0)", "; // if less" },
+  { ZYDIS_MNEMONIC_SETLE, zms_assign, ZydecFormattingInfo::Set, 0, zmf_none, "((zero_flag || sign_flag != overflow_flag) ? 1 : 0)", "; // if less or equal" },
+  { ZYDIS_MNEMONIC_SETNB, zms_assign, ZydecFormattingInfo::Set, 0, zmf_none, "(!carry_flag ? 1 : 0)", "; // if not below" },
+  { ZYDIS_MNEMONIC_SETNBE, zms_assign, ZydecFormattingInfo::Set, 0, zmf_none, "((!carry_flag && !zero_flag) ? 1 : 0)", "; // if not below or equal" },
+  { ZYDIS_MNEMONIC_SETNL, zms_assign, ZydecFormattingInfo::Set, 0, zmf_none, "(sign_flag == overflow_flag ? 1 : 0)", "; // if not less" },
+  { ZYDIS_MNEMONIC_SETNLE, zms_assign, ZydecFormattingInfo::Set, 0, zmf_none, "((!zero_flag && sign_flag == overflow_flag) ? 1 : 0)", "; // if not less or equal" },
+  { ZYDIS_MNEMONIC_SETNO, zms_assign, ZydecFormattingInfo::Set, 0, zmf_none, "(!overflow_flag ? 1 : 0)", ";" },
+  { ZYDIS_MNEMONIC_SETNP, zms_assign, ZydecFormattingInfo::Set, 0, zmf_none, "(!parity_flag ? 1 : 0)", ";" },
+  { ZYDIS_MNEMONIC_SETNS, zms_assign, ZydecFormattingInfo::Set, 0, zmf_none, "(!sign_flag ? 1 : 0)", ";" },
+  { ZYDIS_MNEMONIC_SETNZ, zms_assign, ZydecFormattingInfo::Set, 0, zmf_none, "(!zero_flag ? 1 : 0)", "; // if not zero / not equal" },
+  { ZYDIS_MNEMONIC_SETO, zms_assign, ZydecFormattingInfo::Set, 0, zmf_none, "(overflow_flag ? 1 : 0)", ";" },
+  { ZYDIS_MNEMONIC_SETP, zms_assign, ZydecFormattingInfo::Set, 0, zmf_none, "(parity_flag ? 1 : 0)", ";" },
+  { ZYDIS_MNEMONIC_SETS, zms_assign, ZydecFormattingInfo::Set, 0, zmf_none, "(sign_flag ? 1 : 0)", ";" },
+  { ZYDIS_MNEMONIC_SETSSBSY, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SETZ, zms_assign, ZydecFormattingInfo::Set, 0, zmf_none, "(zero_flag ? 1 : 0)", "; // if zero / equal" },
+  { ZYDIS_MNEMONIC_SFENCE, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_sfence(", ");" },
+  { ZYDIS_MNEMONIC_SGDT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SHA1MSG1, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SHA1MSG2, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SHA1NEXTE, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SHA1RNDS4, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SHA256MSG1, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SHA256MSG2, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SHA256RNDS2, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SHL, zms_arithmetic, ZydecFormattingInfo::ShL, zop_ShL, zmf_none, nullptr, ";" },
+  { ZYDIS_MNEMONIC_SHLD, zms_arithmetic, ZydecFormattingInfo::ShL, zop_ShL, zmf_none, nullptr, ";" },
+  { ZYDIS_MNEMONIC_SHLX, zms_arithmetic, ZydecFormattingInfo::ShL, zop_ShL, zmf_none, nullptr, ";" },
+  { ZYDIS_MNEMONIC_SHR, zms_arithmetic, ZydecFormattingInfo::ShR, zop_ShR, zmf_none, nullptr, ";" },
+  { ZYDIS_MNEMONIC_SHRD, zms_arithmetic, ZydecFormattingInfo::ShR, zop_ShR, zmf_none, nullptr, ";" },
+  { ZYDIS_MNEMONIC_SHRX, zms_arithmetic, ZydecFormattingInfo::ShR, zop_ShR, zmf_none, nullptr, ";" },
+  { ZYDIS_MNEMONIC_SHUFPD, zms_vector, ZydecFormattingInfo::Shuffle, 0, zmf_none, "_mm_shuffle_pd(", ");" },
+  { ZYDIS_MNEMONIC_SHUFPS, zms_vector, ZydecFormattingInfo::Shuffle, 0, zmf_none, "_mm_shuffle_ps(", ");" },
+  { ZYDIS_MNEMONIC_SIDT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SKINIT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SLDT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SLWPCB, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SMSW, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SPFLT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SQRTPD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_sqrt_pd(", ");" },
+  { ZYDIS_MNEMONIC_SQRTPS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_sqrt_ps(", ");" },
+  { ZYDIS_MNEMONIC_SQRTSD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_sqrt_sd(", ");" },
+  { ZYDIS_MNEMONIC_SQRTSS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_sqrt_ss(", ");" },
+  { ZYDIS_MNEMONIC_STAC, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_STC, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_STD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_STGI, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_STI, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_STMXCSR, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_getcsr(", ");" },
+  { ZYDIS_MNEMONIC_STOSB, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_STOSD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_STOSQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_STOSW, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_STR, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_STTILECFG, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_STUI, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SUB, zms_arithmetic, ZydecFormattingInfo::And, zop_Sub, zmf_none, nullptr, ";" },
+  { ZYDIS_MNEMONIC_SUBPD, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_sub_pd(", ");" },
+  { ZYDIS_MNEMONIC_SUBPS, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_sub_ps(", ");" },
+  { ZYDIS_MNEMONIC_SUBSD, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_sub_sd(", ");" },
+  { ZYDIS_MNEMONIC_SUBSS, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_sub_ss(", ");" },
+  { ZYDIS_MNEMONIC_SWAPGS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SYSCALL, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SYSENTER, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SYSEXIT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_SYSRET, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_T1MSKC, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_TDCALL, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_TDPBF16PS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_TDPBSSD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_TDPBSUD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_TDPBUSD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_TDPBUUD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_TEST, zms_function, ZydecFormattingInfo::None, 2, zmf_none, "compare(", "); // set flags: carry, parity, zero" },
+  { ZYDIS_MNEMONIC_TESTUI, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_TILELOADD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_TILELOADDT1, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_TILERELEASE, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_TILESTORED, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_TILEZERO, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_TLBSYNC, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_TPAUSE, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_TZCNT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_TZCNTI, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_TZMSK, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_UCOMISD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_ucomi_sd(", ");" },
+  { ZYDIS_MNEMONIC_UCOMISS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_ucomi_ss(", ");" },
+  { ZYDIS_MNEMONIC_UD0, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_UD1, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_UD2, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_UIRET, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_UMONITOR, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_UMWAIT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_UNPCKHPD, zms_vector, ZydecFormattingInfo::Unpack, 0, zmf_none, "_mm_unpackhi_pd(", ");" },
+  { ZYDIS_MNEMONIC_UNPCKHPS, zms_vector, ZydecFormattingInfo::Unpack, 0, zmf_none, "_mm_unpackhi_ps(", ");" },
+  { ZYDIS_MNEMONIC_UNPCKLPD, zms_vector, ZydecFormattingInfo::Unpack, 0, zmf_none, "_mm_unpacklo_pd(", ");" },
+  { ZYDIS_MNEMONIC_UNPCKLPS, zms_vector, ZydecFormattingInfo::Unpack, 0, zmf_none, "_mm_unpacklo_ps(", ");" },
+  { ZYDIS_MNEMONIC_V4FMADDPS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_4fmadd_ps(", ");" },
+  { ZYDIS_MNEMONIC_V4FMADDSS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_4fmadd_ss(", ");" },
+  { ZYDIS_MNEMONIC_V4FNMADDPS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_4fnmadd_ps(", ");" },
+  { ZYDIS_MNEMONIC_V4FNMADDSS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_4fnmadd_ss(", ");" },
+  { ZYDIS_MNEMONIC_VADDNPD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VADDNPS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VADDPD, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_add_pd(", ");" },
+  { ZYDIS_MNEMONIC_VADDPH, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_add_ph(", ");" },
+  { ZYDIS_MNEMONIC_VADDPS, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_add_ps(", ");" },
+  { ZYDIS_MNEMONIC_VADDSD, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_add_sd(", ");" },
+  { ZYDIS_MNEMONIC_VADDSETSPS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VADDSH, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_add_sh(", ");" },
+  { ZYDIS_MNEMONIC_VADDSS, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_add_ss(", ");" },
+  { ZYDIS_MNEMONIC_VADDSUBPD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_addsub_pd(", ");" },
+  { ZYDIS_MNEMONIC_VADDSUBPS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_addsub_ps(", ");" },
+  { ZYDIS_MNEMONIC_VAESDEC, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VAESDECLAST, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VAESENC, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VAESENCLAST, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VAESIMC, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VAESKEYGENASSIST, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VALIGND, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_alignr_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VALIGNQ, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_alignr_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VANDNPD, zms_vector, ZydecFormattingInfo::AndNot, 0, zmf_none, "_mm_andnot_pd(", ");" },
+  { ZYDIS_MNEMONIC_VANDNPS, zms_vector, ZydecFormattingInfo::AndNot, 0, zmf_none, "_mm_andnot_ps(", ");" },
+  { ZYDIS_MNEMONIC_VANDPD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VANDPS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VBLENDMPD, zms_vector, ZydecFormattingInfo::Blend, 0, zmf_none, "_mm_blend_pd(", ");" },
+  { ZYDIS_MNEMONIC_VBLENDMPS, zms_vector, ZydecFormattingInfo::Blend, 0, zmf_none, "_mm_blend_ps(", ");" },
+  { ZYDIS_MNEMONIC_VBLENDPD, zms_vector, ZydecFormattingInfo::Blend, 0, zmf_none, "_mm_blend_pd(", ");" },
+  { ZYDIS_MNEMONIC_VBLENDPS, zms_vector, ZydecFormattingInfo::Blend, 0, zmf_none, "_mm_blend_ps(", ");" },
+  { ZYDIS_MNEMONIC_VBLENDVPD, zms_vector, ZydecFormattingInfo::Blend, 0, zmf_none, "_mm_blendv_pd(", ");" },
+  { ZYDIS_MNEMONIC_VBLENDVPS, zms_vector, ZydecFormattingInfo::Blend, 0, zmf_none, "_mm_blendv_ps(", ");" },
+  { ZYDIS_MNEMONIC_VBROADCASTF128, zms_vector, ZydecFormattingInfo::Broadcast, 0, zmf_none, "_mm_broadcast_f128(", ");" },
+  { ZYDIS_MNEMONIC_VBROADCASTF32X2, zms_vector, ZydecFormattingInfo::Broadcast, 0, zmf_none, "_mm_broadcast_f32x2(", ");" },
+  { ZYDIS_MNEMONIC_VBROADCASTF32X4, zms_vector, ZydecFormattingInfo::Broadcast, 0, zmf_none, "_mm_broadcast_f32x4(", ");" },
+  { ZYDIS_MNEMONIC_VBROADCASTF32X8, zms_vector, ZydecFormattingInfo::Broadcast, 0, zmf_none, "_mm_broadcast_f32x8(", ");" },
+  { ZYDIS_MNEMONIC_VBROADCASTF64X2, zms_vector, ZydecFormattingInfo::Broadcast, 0, zmf_none, "_mm_broadcast_f64x2(", ");" },
+  { ZYDIS_MNEMONIC_VBROADCASTF64X4, zms_vector, ZydecFormattingInfo::Broadcast, 0, zmf_none, "_mm_broadcast_f64x4(", ");" },
+  { ZYDIS_MNEMONIC_VBROADCASTI128, zms_vector, ZydecFormattingInfo::Broadcast, 0, zmf_none, "_mm_broadcastsi128_si256(", ");" },
+  { ZYDIS_MNEMONIC_VBROADCASTI32X2, zms_vector, ZydecFormattingInfo::Broadcast, 0, zmf_none, "_mm_broadcast_i32x2(", ");" },
+  { ZYDIS_MNEMONIC_VBROADCASTI32X4, zms_vector, ZydecFormattingInfo::Broadcast, 0, zmf_none, "_mm_broadcast_i32x4(", ");" },
+  { ZYDIS_MNEMONIC_VBROADCASTI32X8, zms_vector, ZydecFormattingInfo::Broadcast, 0, zmf_none, "_mm_broadcast_i32x8(", ");" },
+  { ZYDIS_MNEMONIC_VBROADCASTI64X2, zms_vector, ZydecFormattingInfo::Broadcast, 0, zmf_none, "_mm_broadcast_i64x2(", ");" },
+  { ZYDIS_MNEMONIC_VBROADCASTI64X4, zms_vector, ZydecFormattingInfo::Broadcast, 0, zmf_none, "_mm_broadcast_i64x4(", ");" },
+  { ZYDIS_MNEMONIC_VBROADCASTSD, zms_vector, ZydecFormattingInfo::Broadcast, 0, zmf_none, "_mm_broadcast_sd(", ");" },
+  { ZYDIS_MNEMONIC_VBROADCASTSS, zms_vector, ZydecFormattingInfo::Broadcast, 0, zmf_none, "_mm_broadcast_ss(", ");" },
+  { ZYDIS_MNEMONIC_VCMPPD, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_none, "_mm_cmp_pd(", ");" },
+  { ZYDIS_MNEMONIC_VCMPPH, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_none, "_mm_cmp_ph_mask(", ");" },
+  { ZYDIS_MNEMONIC_VCMPPS, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_none, "_mm_cmp_ps(", ");" },
+  { ZYDIS_MNEMONIC_VCMPSD, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_none, "_mm_cmp_sd(", ");" },
+  { ZYDIS_MNEMONIC_VCMPSH, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_none, "_mm_cmp_sh(", ");" },
+  { ZYDIS_MNEMONIC_VCMPSS, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_none, "_mm_cmp_ss(", ");" },
+  { ZYDIS_MNEMONIC_VCOMISD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_comieq_sd(", ");" },
+  { ZYDIS_MNEMONIC_VCOMISH, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_comieq_sh(", ");" },
+  { ZYDIS_MNEMONIC_VCOMISS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_comieq_ss(", ");" },
+  { ZYDIS_MNEMONIC_VCOMPRESSPD, zms_vector, ZydecFormattingInfo::None, 0, zmf_commentOnStore, "_mm_compress_pd(", "); // with unaligned store" },
+  { ZYDIS_MNEMONIC_VCOMPRESSPS, zms_vector, ZydecFormattingInfo::None, 0, zmf_commentOnStore, "_mm_compress_ps(", "); // with unaligned store" },
+  { ZYDIS_MNEMONIC_VCVTDQ2PD, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepi32_pd(", ");" },
+  { ZYDIS_MNEMONIC_VCVTDQ2PH, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepi32_ph(", ");" },
+  { ZYDIS_MNEMONIC_VCVTDQ2PS, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepi32_ps(", ");" },
+  { ZYDIS_MNEMONIC_VCVTFXPNTDQ2PS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VCVTFXPNTPD2DQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VCVTFXPNTPD2UDQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VCVTFXPNTPS2DQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VCVTFXPNTPS2UDQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VCVTFXPNTUDQ2PS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VCVTNE2PS2BF16, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtne2ps_pbh(", ");" },
+  { ZYDIS_MNEMONIC_VCVTNEPS2BF16, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtneps_pbh(", ");" },
+  { ZYDIS_MNEMONIC_VCVTPD2DQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtpd_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VCVTPD2PH, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtpd_ph(", ");" },
+  { ZYDIS_MNEMONIC_VCVTPD2PS, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtpd_ps(", ");" },
+  { ZYDIS_MNEMONIC_VCVTPD2QQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtpd_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VCVTPD2UDQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtpd_epu32(", ");" },
+  { ZYDIS_MNEMONIC_VCVTPD2UQQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtpd_epu64(", ");" },
+  { ZYDIS_MNEMONIC_VCVTPH2DQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtph_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VCVTPH2PD, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtph_pd(", ");" },
+  { ZYDIS_MNEMONIC_VCVTPH2PS, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtph_ps(", ");" },
+  { ZYDIS_MNEMONIC_VCVTPH2PSX, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtxph_ps(", ");" },
+  { ZYDIS_MNEMONIC_VCVTPH2QQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtph_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VCVTPH2UDQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtph_epu32(", ");" },
+  { ZYDIS_MNEMONIC_VCVTPH2UQQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtph_epu64(", ");" },
+  { ZYDIS_MNEMONIC_VCVTPH2UW, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtph_epu16(", ");" },
+  { ZYDIS_MNEMONIC_VCVTPH2W, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtph_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VCVTPS2DQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtps_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VCVTPS2PD, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtps_pd(", ");" },
+  { ZYDIS_MNEMONIC_VCVTPS2PH, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtps_ph(", ");" },
+  { ZYDIS_MNEMONIC_VCVTPS2PHX, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtxps_ph(", ");" },
+  { ZYDIS_MNEMONIC_VCVTPS2QQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtps_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VCVTPS2UDQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtps_epu32(", ");" },
+  { ZYDIS_MNEMONIC_VCVTPS2UQQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtps_epu64(", ");" },
+  { ZYDIS_MNEMONIC_VCVTQQ2PD, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepi64_pd(", ");" },
+  { ZYDIS_MNEMONIC_VCVTQQ2PH, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepi64_ph(", ");" },
+  { ZYDIS_MNEMONIC_VCVTQQ2PS, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepi64_ps(", ");" },
+  { ZYDIS_MNEMONIC_VCVTSD2SH, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtsd_sh(", ");" },
+  { ZYDIS_MNEMONIC_VCVTSD2SI, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtsd_si(", ");" },
+  { ZYDIS_MNEMONIC_VCVTSD2SS, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtsd_ss(", ");" },
+  { ZYDIS_MNEMONIC_VCVTSD2USI, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, nullptr, ");" },
+  { ZYDIS_MNEMONIC_VCVTSH2SD, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtsh_sd(", ");" },
+  { ZYDIS_MNEMONIC_VCVTSH2SI, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, nullptr, ");" },
+  { ZYDIS_MNEMONIC_VCVTSH2SS, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtsh_ss(", ");" },
+  { ZYDIS_MNEMONIC_VCVTSH2USI, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, nullptr, ");" },
+  { ZYDIS_MNEMONIC_VCVTSI2SD, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtsi_sd(", ");" },
+  { ZYDIS_MNEMONIC_VCVTSI2SH, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, nullptr, ");" },
+  { ZYDIS_MNEMONIC_VCVTSI2SS, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtsi_ss(", ");" },
+  { ZYDIS_MNEMONIC_VCVTSS2SD, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtss_sd(", ");" },
+  { ZYDIS_MNEMONIC_VCVTSS2SH, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtss_sh(", ");" },
+  { ZYDIS_MNEMONIC_VCVTSS2SI, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtss_si(", ");" },
+  { ZYDIS_MNEMONIC_VCVTSS2USI, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, nullptr, ");" },
+  { ZYDIS_MNEMONIC_VCVTTPD2DQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvttpd_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VCVTTPD2QQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvttpd_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VCVTTPD2UDQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvttpd_epu64(", ");" },
+  { ZYDIS_MNEMONIC_VCVTTPD2UQQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvttpd_epu64(", ");" },
+  { ZYDIS_MNEMONIC_VCVTTPH2DQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvttph_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VCVTTPH2QQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvttph_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VCVTTPH2UDQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvttph_epu32(", ");" },
+  { ZYDIS_MNEMONIC_VCVTTPH2UQQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvttph_epu64(", ");" },
+  { ZYDIS_MNEMONIC_VCVTTPH2UW, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvttph_epu16(", ");" },
+  { ZYDIS_MNEMONIC_VCVTTPH2W, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvttph_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VCVTTPS2DQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvttps_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VCVTTPS2QQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvttps_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VCVTTPS2UDQ, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_cvttps_epu64(", ");" },
+  { ZYDIS_MNEMONIC_VCVTTPS2UQQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvttps_epu64(", ");" },
+  { ZYDIS_MNEMONIC_VCVTTSD2SI, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, nullptr, ");" },
+  { ZYDIS_MNEMONIC_VCVTTSD2USI, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, nullptr, ");" },
+  { ZYDIS_MNEMONIC_VCVTTSH2SI, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, nullptr, ");" },
+  { ZYDIS_MNEMONIC_VCVTTSH2USI, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, nullptr, ");" },
+  { ZYDIS_MNEMONIC_VCVTTSS2SI, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, nullptr, ");" },
+  { ZYDIS_MNEMONIC_VCVTTSS2USI, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, nullptr, ");" },
+  { ZYDIS_MNEMONIC_VCVTUDQ2PD, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepu32_pd(", ");" },
+  { ZYDIS_MNEMONIC_VCVTUDQ2PH, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepu32_ph(", ");" },
+  { ZYDIS_MNEMONIC_VCVTUDQ2PS, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepu32_ps(", ");" },
+  { ZYDIS_MNEMONIC_VCVTUQQ2PD, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepu64_pd(", ");" },
+  { ZYDIS_MNEMONIC_VCVTUQQ2PH, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepu64_ph(", ");" },
+  { ZYDIS_MNEMONIC_VCVTUQQ2PS, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepu64_ps(", ");" },
+  { ZYDIS_MNEMONIC_VCVTUSI2SD, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, nullptr, ");" },
+  { ZYDIS_MNEMONIC_VCVTUSI2SH, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, nullptr, ");" },
+  { ZYDIS_MNEMONIC_VCVTUSI2SS, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, nullptr, ");" },
+  { ZYDIS_MNEMONIC_VCVTUW2PH, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepu16_ph(", ");" },
+  { ZYDIS_MNEMONIC_VCVTW2PH, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepi16_ph(", ");" },
+  { ZYDIS_MNEMONIC_VDBPSADBW, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_dbsad_epu8(", ");" },
+  { ZYDIS_MNEMONIC_VDIVPD, zms_vector, ZydecFormattingInfo::Div, 0, zmf_none, "_mm_div_pd(", ");" },
+  { ZYDIS_MNEMONIC_VDIVPH, zms_vector, ZydecFormattingInfo::Div, 0, zmf_none, "_mm_div_ph(", ");" },
+  { ZYDIS_MNEMONIC_VDIVPS, zms_vector, ZydecFormattingInfo::Div, 0, zmf_none, "_mm_div_ps(", ");" },
+  { ZYDIS_MNEMONIC_VDIVSD, zms_vector, ZydecFormattingInfo::Div, 0, zmf_none, "_mm_div_sd(", ");" },
+  { ZYDIS_MNEMONIC_VDIVSH, zms_vector, ZydecFormattingInfo::Div, 0, zmf_none, "_mm_div_sh(", ");" },
+  { ZYDIS_MNEMONIC_VDIVSS, zms_vector, ZydecFormattingInfo::Div, 0, zmf_none, "_mm_div_ss(", ");" },
+  { ZYDIS_MNEMONIC_VDPBF16PS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_dpbf16_ps(", ");" },
+  { ZYDIS_MNEMONIC_VDPPD, zms_vector, ZydecFormattingInfo::DotProduct, 0, zmf_none, "_mm_dp_pd(", ");" },
+  { ZYDIS_MNEMONIC_VDPPS, zms_vector, ZydecFormattingInfo::DotProduct, 0, zmf_none, "_mm_dp_ps(", ");" },
+  { ZYDIS_MNEMONIC_VERR, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VERW, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VEXP223PS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VEXP2PD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_exp2a23_pd(", ");" },
+  { ZYDIS_MNEMONIC_VEXP2PS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_exp2a23_ps(", ");" },
+  { ZYDIS_MNEMONIC_VEXPANDPD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_expand_pd(", ");" },
+  { ZYDIS_MNEMONIC_VEXPANDPS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_expand_ps(", ");" },
+  { ZYDIS_MNEMONIC_VEXTRACTF128, zms_vector, ZydecFormattingInfo::Extract, 0, zmf_none, "_mm_extract_f128(", ");" },
+  { ZYDIS_MNEMONIC_VEXTRACTF32X4, zms_vector, ZydecFormattingInfo::Extract, 0, zmf_none, "_mm_extractf32x4_ps(", ");" },
+  { ZYDIS_MNEMONIC_VEXTRACTF32X8, zms_vector, ZydecFormattingInfo::Extract, 0, zmf_none, "_mm_extractf32x8_ps(", ");" },
+  { ZYDIS_MNEMONIC_VEXTRACTF64X2, zms_vector, ZydecFormattingInfo::Extract, 0, zmf_none, "_mm_extractf64x2_pd(", ");" },
+  { ZYDIS_MNEMONIC_VEXTRACTF64X4, zms_vector, ZydecFormattingInfo::Extract, 0, zmf_none, "_mm_extractf64x4_pd(", ");" },
+  { ZYDIS_MNEMONIC_VEXTRACTI128, zms_vector, ZydecFormattingInfo::Extract, 0, zmf_none, "_mm_extract_i128(", ");" },
+  { ZYDIS_MNEMONIC_VEXTRACTI32X4, zms_vector, ZydecFormattingInfo::Extract, 0, zmf_none, "_mm_extracti32x4_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VEXTRACTI32X8, zms_vector, ZydecFormattingInfo::Extract, 0, zmf_none, "_mm_extracti32x8_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VEXTRACTI64X2, zms_vector, ZydecFormattingInfo::Extract, 0, zmf_none, "_mm_extracti64x2_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VEXTRACTI64X4, zms_vector, ZydecFormattingInfo::Extract, 0, zmf_none, "_mm_extracti64x4_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VEXTRACTPS, zms_vector, ZydecFormattingInfo::Extract, 0, zmf_none, "_mm_extract_ps(", ");" },
+  { ZYDIS_MNEMONIC_VFCMADDCPH, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_fcmadd_pch(", ");" },
+  { ZYDIS_MNEMONIC_VFCMADDCSH, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_fcmadd_sch(", ");" },
+  { ZYDIS_MNEMONIC_VFCMULCPH, zms_vector, ZydecFormattingInfo::Mul, 0, zmf_none, "_mm_cmul_pch(", ");" },
+  { ZYDIS_MNEMONIC_VFCMULCSH, zms_vector, ZydecFormattingInfo::Mul, 0, zmf_none, "_mm_cmul_sch(", ");" },
+  { ZYDIS_MNEMONIC_VFIXUPIMMPD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_fixupimm_pd(", ");" },
+  { ZYDIS_MNEMONIC_VFIXUPIMMPS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_fixupimm_ps(", ");" },
+  { ZYDIS_MNEMONIC_VFIXUPIMMSD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_fixupimm_sd(", ");" },
+  { ZYDIS_MNEMONIC_VFIXUPIMMSS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_fixupimm_ss(", ");" },
+  { ZYDIS_MNEMONIC_VFIXUPNANPD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VFIXUPNANPS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VFMADD132PD, zms_vector, ZydecFormattingInfo::None, zfo_132, zmf_none, "_mm_fmadd_pd(", "); // part 1 / 3" },
+  { ZYDIS_MNEMONIC_VFMADD132PH, zms_vector, ZydecFormattingInfo::None, zfo_132, zmf_none, "_mm_fmadd_ph(", "); // part 1 / 3" },
+  { ZYDIS_MNEMONIC_VFMADD132PS, zms_vector, ZydecFormattingInfo::None, zfo_132, zmf_none, "_mm_fmadd_ps(", "); // part 1 / 3" },
+  { ZYDIS_MNEMONIC_VFMADD132SD, zms_vector, ZydecFormattingInfo::None, zfo_132, zmf_none, "_mm_fmadd_sd(", "); // part 1 / 3" },
+  { ZYDIS_MNEMONIC_VFMADD132SH, zms_vector, ZydecFormattingInfo::None, zfo_132, zmf_none, "_mm_fmadd_sh(", "); // part 1 / 3" },
+  { ZYDIS_MNEMONIC_VFMADD132SS, zms_vector, ZydecFormattingInfo::None, zfo_132, zmf_none, "_mm_fmadd_ss(", "); // part 1 / 3" },
+  { ZYDIS_MNEMONIC_VFMADD213PD, zms_vector, ZydecFormattingInfo::None, zfo_213, zmf_none, "_mm_fmadd_pd(", "); // part 2 / 3" },
+  { ZYDIS_MNEMONIC_VFMADD213PH, zms_vector, ZydecFormattingInfo::None, zfo_213, zmf_none, "_mm_fmadd_ph(", "); // part 2 / 3" },
+  { ZYDIS_MNEMONIC_VFMADD213PS, zms_vector, ZydecFormattingInfo::None, zfo_213, zmf_none, "_mm_fmadd_ps(", "); // part 2 / 3" },
+  { ZYDIS_MNEMONIC_VFMADD213SD, zms_vector, ZydecFormattingInfo::None, zfo_213, zmf_none, "_mm_fmadd_sd(", "); // part 2 / 3" },
+  { ZYDIS_MNEMONIC_VFMADD213SH, zms_vector, ZydecFormattingInfo::None, zfo_213, zmf_none, "_mm_fmadd_sh(", "); // part 2 / 3" },
+  { ZYDIS_MNEMONIC_VFMADD213SS, zms_vector, ZydecFormattingInfo::None, zfo_213, zmf_none, "_mm_fmadd_ss(", "); // part 2 / 3" },
+  { ZYDIS_MNEMONIC_VFMADD231PD, zms_vector, ZydecFormattingInfo::None, zfo_231, zmf_none, "_mm_fmadd_pd(", "); // part 3 / 3" },
+  { ZYDIS_MNEMONIC_VFMADD231PH, zms_vector, ZydecFormattingInfo::None, zfo_231, zmf_none, "_mm_fmadd_ph(", "); // part 3 / 3" },
+  { ZYDIS_MNEMONIC_VFMADD231PS, zms_vector, ZydecFormattingInfo::None, zfo_231, zmf_none, "_mm_fmadd_ps(", "); // part 3 / 3" },
+  { ZYDIS_MNEMONIC_VFMADD231SD, zms_vector, ZydecFormattingInfo::None, zfo_231, zmf_none, "_mm_fmadd_sd(", "); // part 3 / 3" },
+  { ZYDIS_MNEMONIC_VFMADD231SH, zms_vector, ZydecFormattingInfo::None, zfo_231, zmf_none, "_mm_fmadd_sh(", "); // part 3 / 3" },
+  { ZYDIS_MNEMONIC_VFMADD231SS, zms_vector, ZydecFormattingInfo::None, zfo_231, zmf_none, "_mm_fmadd_ss(", "); // part 3 / 3" },
+  { ZYDIS_MNEMONIC_VFMADD233PS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VFMADDCPH, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_fmadd_pch(", ");" },
+  { ZYDIS_MNEMONIC_VFMADDCSH, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_fmadd_sch(", ");" },
+  { ZYDIS_MNEMONIC_VFMADDPD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VFMADDPS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VFMADDSD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VFMADDSS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VFMADDSUB132PD, zms_vector, ZydecFormattingInfo::None, zfo_132, zmf_none, "_mm_fmaddsub_pd(", "); // part 1 / 3" },
+  { ZYDIS_MNEMONIC_VFMADDSUB132PH, zms_vector, ZydecFormattingInfo::None, zfo_132, zmf_none, "_mm_fmaddsub_ph(", "); // part 1 / 3" },
+  { ZYDIS_MNEMONIC_VFMADDSUB132PS, zms_vector, ZydecFormattingInfo::None, zfo_132, zmf_none, "_mm_fmaddsub_ps(", "); // part 1 / 3" },
+  { ZYDIS_MNEMONIC_VFMADDSUB213PD, zms_vector, ZydecFormattingInfo::None, zfo_213, zmf_none, "_mm_fmaddsub_pd(", "); // part 2 / 3" },
+  { ZYDIS_MNEMONIC_VFMADDSUB213PH, zms_vector, ZydecFormattingInfo::None, zfo_213, zmf_none, "_mm_fmaddsub_ph(", "); // part 2 / 3" },
+  { ZYDIS_MNEMONIC_VFMADDSUB213PS, zms_vector, ZydecFormattingInfo::None, zfo_213, zmf_none, "_mm_fmaddsub_ps(", "); // part 2 / 3" },
+  { ZYDIS_MNEMONIC_VFMADDSUB231PD, zms_vector, ZydecFormattingInfo::None, zfo_231, zmf_none, "_mm_fmaddsub_pd(", "); // part 3 / 3" },
+  { ZYDIS_MNEMONIC_VFMADDSUB231PH, zms_vector, ZydecFormattingInfo::None, zfo_231, zmf_none, "_mm_fmaddsub_ph(", "); // part 3 / 3" },
+  { ZYDIS_MNEMONIC_VFMADDSUB231PS, zms_vector, ZydecFormattingInfo::None, zfo_231, zmf_none, "_mm_fmaddsub_ps(", "); // part 3 / 3" },
+  { ZYDIS_MNEMONIC_VFMADDSUBPD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VFMADDSUBPS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VFMSUB132PD, zms_vector, ZydecFormattingInfo::None, zfo_132, zmf_none, "_mm_fmsub_pd(", "); // part 1 / 3" },
+  { ZYDIS_MNEMONIC_VFMSUB132PH, zms_vector, ZydecFormattingInfo::None, zfo_132, zmf_none, "_mm_fmsub_ph(", "); // part 1 / 3" },
+  { ZYDIS_MNEMONIC_VFMSUB132PS, zms_vector, ZydecFormattingInfo::None, zfo_132, zmf_none, "_mm_fmsub_ps(", "); // part 1 / 3" },
+  { ZYDIS_MNEMONIC_VFMSUB132SD, zms_vector, ZydecFormattingInfo::None, zfo_132, zmf_none, "_mm_fmsub_sd(", "); // part 1 / 3" },
+  { ZYDIS_MNEMONIC_VFMSUB132SH, zms_vector, ZydecFormattingInfo::None, zfo_132, zmf_none, "_mm_fmsub_sh(", "); // part 1 / 3" },
+  { ZYDIS_MNEMONIC_VFMSUB132SS, zms_vector, ZydecFormattingInfo::None, zfo_132, zmf_none, "_mm_fmsub_ss(", "); // part 1 / 3" },
+  { ZYDIS_MNEMONIC_VFMSUB213PD, zms_vector, ZydecFormattingInfo::None, zfo_213, zmf_none, "_mm_fmsub_pd(", "); // part 2 / 3" },
+  { ZYDIS_MNEMONIC_VFMSUB213PH, zms_vector, ZydecFormattingInfo::None, zfo_213, zmf_none, "_mm_fmsub_ph(", "); // part 2 / 3" },
+  { ZYDIS_MNEMONIC_VFMSUB213PS, zms_vector, ZydecFormattingInfo::None, zfo_213, zmf_none, "_mm_fmsub_ps(", "); // part 2 / 3" },
+  { ZYDIS_MNEMONIC_VFMSUB213SD, zms_vector, ZydecFormattingInfo::None, zfo_213, zmf_none, "_mm_fmsub_sd(", "); // part 2 / 3" },
+  { ZYDIS_MNEMONIC_VFMSUB213SH, zms_vector, ZydecFormattingInfo::None, zfo_213, zmf_none, "_mm_fmsub_sh(", "); // part 2 / 3" },
+  { ZYDIS_MNEMONIC_VFMSUB213SS, zms_vector, ZydecFormattingInfo::None, zfo_213, zmf_none, "_mm_fmsub_ss(", "); // part 2 / 3" },
+  { ZYDIS_MNEMONIC_VFMSUB231PD, zms_vector, ZydecFormattingInfo::None, zfo_231, zmf_none, "_mm_fmsub_pd(", "); // part 3 / 3" },
+  { ZYDIS_MNEMONIC_VFMSUB231PH, zms_vector, ZydecFormattingInfo::None, zfo_231, zmf_none, "_mm_fmsub_ph(", "); // part 3 / 3" },
+  { ZYDIS_MNEMONIC_VFMSUB231PS, zms_vector, ZydecFormattingInfo::None, zfo_231, zmf_none, "_mm_fmsub_ps(", "); // part 3 / 3" },
+  { ZYDIS_MNEMONIC_VFMSUB231SD, zms_vector, ZydecFormattingInfo::None, zfo_231, zmf_none, "_mm_fmsub_sd(", "); // part 3 / 3" },
+  { ZYDIS_MNEMONIC_VFMSUB231SH, zms_vector, ZydecFormattingInfo::None, zfo_231, zmf_none, "_mm_fmsub_sh(", "); // part 3 / 3" },
+  { ZYDIS_MNEMONIC_VFMSUB231SS, zms_vector, ZydecFormattingInfo::None, zfo_231, zmf_none, "_mm_fmsub_ss(", "); // part 3 / 3" },
+  { ZYDIS_MNEMONIC_VFMSUBADD132PD, zms_vector, ZydecFormattingInfo::None, zfo_132, zmf_none, "_mm_fmsubadd_pd(", "); // part 1 / 3" },
+  { ZYDIS_MNEMONIC_VFMSUBADD132PH, zms_vector, ZydecFormattingInfo::None, zfo_132, zmf_none, "_mm_fmsubadd_ph(", "); // part 1 / 3" },
+  { ZYDIS_MNEMONIC_VFMSUBADD132PS, zms_vector, ZydecFormattingInfo::None, zfo_132, zmf_none, "_mm_fmsubadd_ps(", "); // part 1 / 3" },
+  { ZYDIS_MNEMONIC_VFMSUBADD213PD, zms_vector, ZydecFormattingInfo::None, zfo_213, zmf_none, "_mm_fmsubadd_pd(", "); // part 2 / 3" },
+  { ZYDIS_MNEMONIC_VFMSUBADD213PH, zms_vector, ZydecFormattingInfo::None, zfo_213, zmf_none, "_mm_fmsubadd_ph(", "); // part 2 / 3" },
+  { ZYDIS_MNEMONIC_VFMSUBADD213PS, zms_vector, ZydecFormattingInfo::None, zfo_213, zmf_none, "_mm_fmsubadd_ps(", "); // part 2 / 3" },
+  { ZYDIS_MNEMONIC_VFMSUBADD231PD, zms_vector, ZydecFormattingInfo::None, zfo_231, zmf_none, "_mm_fmsubadd_pd(", "); // part 3 / 3" },
+  { ZYDIS_MNEMONIC_VFMSUBADD231PH, zms_vector, ZydecFormattingInfo::None, zfo_231, zmf_none, "_mm_fmsubadd_ph(", "); // part 3 / 3" },
+  { ZYDIS_MNEMONIC_VFMSUBADD231PS, zms_vector, ZydecFormattingInfo::None, zfo_231, zmf_none, "_mm_fmsubadd_ps(", "); // part 3 / 3" },
+  { ZYDIS_MNEMONIC_VFMSUBADDPD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VFMSUBADDPS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VFMSUBPD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VFMSUBPS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VFMSUBSD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VFMSUBSS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VFMULCPH, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_fmul_pch(", ");" },
+  { ZYDIS_MNEMONIC_VFMULCSH, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_fmul_sch(", ");" },
+  { ZYDIS_MNEMONIC_VFNMADD132PD, zms_vector, ZydecFormattingInfo::None, zfo_132, zmf_none, "_mm_fnmadd_pd(", "); // part 1 / 3" },
+  { ZYDIS_MNEMONIC_VFNMADD132PH, zms_vector, ZydecFormattingInfo::None, zfo_132, zmf_none, "_mm_fnmadd_ph(", "); // part 1 / 3" },
+  { ZYDIS_MNEMONIC_VFNMADD132PS, zms_vector, ZydecFormattingInfo::None, zfo_132, zmf_none, "_mm_fnmadd_ps(", "); // part 1 / 3" },
+  { ZYDIS_MNEMONIC_VFNMADD132SD, zms_vector, ZydecFormattingInfo::None, zfo_132, zmf_none, "_mm_fnmadd_sd(", "); // part 1 / 3" },
+  { ZYDIS_MNEMONIC_VFNMADD132SH, zms_vector, ZydecFormattingInfo::None, zfo_132, zmf_none, "_mm_fnmadd_sh(", "); // part 1 / 3" },
+  { ZYDIS_MNEMONIC_VFNMADD132SS, zms_vector, ZydecFormattingInfo::None, zfo_132, zmf_none, "_mm_fnmadd_ss(", "); // part 1 / 3" },
+  { ZYDIS_MNEMONIC_VFNMADD213PD, zms_vector, ZydecFormattingInfo::None, zfo_213, zmf_none, "_mm_fnmadd_pd(", "); // part 2 / 3" },
+  { ZYDIS_MNEMONIC_VFNMADD213PH, zms_vector, ZydecFormattingInfo::None, zfo_213, zmf_none, "_mm_fnmadd_ph(", "); // part 2 / 3" },
+  { ZYDIS_MNEMONIC_VFNMADD213PS, zms_vector, ZydecFormattingInfo::None, zfo_213, zmf_none, "_mm_fnmadd_ps(", "); // part 2 / 3" },
+  { ZYDIS_MNEMONIC_VFNMADD213SD, zms_vector, ZydecFormattingInfo::None, zfo_213, zmf_none, "_mm_fnmadd_sd(", "); // part 2 / 3" },
+  { ZYDIS_MNEMONIC_VFNMADD213SH, zms_vector, ZydecFormattingInfo::None, zfo_213, zmf_none, "_mm_fnmadd_sh(", "); // part 2 / 3" },
+  { ZYDIS_MNEMONIC_VFNMADD213SS, zms_vector, ZydecFormattingInfo::None, zfo_213, zmf_none, "_mm_fnmadd_ss(", "); // part 2 / 3" },
+  { ZYDIS_MNEMONIC_VFNMADD231PD, zms_vector, ZydecFormattingInfo::None, zfo_231, zmf_none, "_mm_fnmadd_pd(", "); // part 3 / 3" },
+  { ZYDIS_MNEMONIC_VFNMADD231PH, zms_vector, ZydecFormattingInfo::None, zfo_231, zmf_none, "_mm_fnmadd_ph(", "); // part 3 / 3" },
+  { ZYDIS_MNEMONIC_VFNMADD231PS, zms_vector, ZydecFormattingInfo::None, zfo_231, zmf_none, "_mm_fnmadd_ps(", "); // part 3 / 3" },
+  { ZYDIS_MNEMONIC_VFNMADD231SD, zms_vector, ZydecFormattingInfo::None, zfo_231, zmf_none, "_mm_fnmadd_sd(", "); // part 3 / 3" },
+  { ZYDIS_MNEMONIC_VFNMADD231SH, zms_vector, ZydecFormattingInfo::None, zfo_231, zmf_none, "_mm_fnmadd_sh(", "); // part 3 / 3" },
+  { ZYDIS_MNEMONIC_VFNMADD231SS, zms_vector, ZydecFormattingInfo::None, zfo_231, zmf_none, "_mm_fnmadd_ss(", "); // part 3 / 3" },
+  { ZYDIS_MNEMONIC_VFNMADDPD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VFNMADDPS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VFNMADDSD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VFNMADDSS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VFNMSUB132PD, zms_vector, ZydecFormattingInfo::None, zfo_132, zmf_none, "_mm_fnmsub_pd(", "); // part 1 / 3" },
+  { ZYDIS_MNEMONIC_VFNMSUB132PH, zms_vector, ZydecFormattingInfo::None, zfo_132, zmf_none, "_mm_fnmsub_ph(", "); // part 1 / 3" },
+  { ZYDIS_MNEMONIC_VFNMSUB132PS, zms_vector, ZydecFormattingInfo::None, zfo_132, zmf_none, "_mm_fnmsub_ps(", "); // part 1 / 3" },
+  { ZYDIS_MNEMONIC_VFNMSUB132SD, zms_vector, ZydecFormattingInfo::None, zfo_132, zmf_none, "_mm_fnmsub_sd(", "); // part 1 / 3" },
+  { ZYDIS_MNEMONIC_VFNMSUB132SH, zms_vector, ZydecFormattingInfo::None, zfo_132, zmf_none, "_mm_fnmsub_sh(", "); // part 1 / 3" },
+  { ZYDIS_MNEMONIC_VFNMSUB132SS, zms_vector, ZydecFormattingInfo::None, zfo_132, zmf_none, "_mm_fnmsub_ss(", "); // part 1 / 3" },
+  { ZYDIS_MNEMONIC_VFNMSUB213PD, zms_vector, ZydecFormattingInfo::None, zfo_213, zmf_none, "_mm_fnmsub_pd(", "); // part 2 / 3" },
+  { ZYDIS_MNEMONIC_VFNMSUB213PH, zms_vector, ZydecFormattingInfo::None, zfo_213, zmf_none, "_mm_fnmsub_ph(", "); // part 2 / 3" },
+  { ZYDIS_MNEMONIC_VFNMSUB213PS, zms_vector, ZydecFormattingInfo::None, zfo_213, zmf_none, "_mm_fnmsub_ps(", "); // part 2 / 3" },
+  { ZYDIS_MNEMONIC_VFNMSUB213SD, zms_vector, ZydecFormattingInfo::None, zfo_213, zmf_none, "_mm_fnmsub_sd(", "); // part 2 / 3" },
+  { ZYDIS_MNEMONIC_VFNMSUB213SH, zms_vector, ZydecFormattingInfo::None, zfo_213, zmf_none, "_mm_fnmsub_sh(", "); // part 2 / 3" },
+  { ZYDIS_MNEMONIC_VFNMSUB213SS, zms_vector, ZydecFormattingInfo::None, zfo_213, zmf_none, "_mm_fnmsub_ss(", "); // part 2 / 3" },
+  { ZYDIS_MNEMONIC_VFNMSUB231PD, zms_vector, ZydecFormattingInfo::None, zfo_231, zmf_none, "_mm_fnmsub_pd(", "); // part 3 / 3" },
+  { ZYDIS_MNEMONIC_VFNMSUB231PH, zms_vector, ZydecFormattingInfo::None, zfo_231, zmf_none, "_mm_fnmsub_ph(", "); // part 3 / 3" },
+  { ZYDIS_MNEMONIC_VFNMSUB231PS, zms_vector, ZydecFormattingInfo::None, zfo_231, zmf_none, "_mm_fnmsub_ps(", "); // part 3 / 3" },
+  { ZYDIS_MNEMONIC_VFNMSUB231SD, zms_vector, ZydecFormattingInfo::None, zfo_231, zmf_none, "_mm_fnmsub_sd(", "); // part 3 / 3" },
+  { ZYDIS_MNEMONIC_VFNMSUB231SH, zms_vector, ZydecFormattingInfo::None, zfo_231, zmf_none, "_mm_fnmsub_sh(", "); // part 3 / 3" },
+  { ZYDIS_MNEMONIC_VFNMSUB231SS, zms_vector, ZydecFormattingInfo::None, zfo_231, zmf_none, "_mm_fnmsub_ss(", "); // part 3 / 3" },
+  { ZYDIS_MNEMONIC_VFNMSUBPD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VFNMSUBPS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VFNMSUBSD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VFNMSUBSS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VFPCLASSPD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_fpclass_pd_mask(", ");" },
+  { ZYDIS_MNEMONIC_VFPCLASSPH, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_fpclass_ph_mask(", ");" },
+  { ZYDIS_MNEMONIC_VFPCLASSPS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_fpclass_ps_mask(", ");" },
+  { ZYDIS_MNEMONIC_VFPCLASSSD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VFPCLASSSH, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VFPCLASSSS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VFRCZPD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VFRCZPS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VFRCZSD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VFRCZSS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VGATHERDPD, zms_vector, ZydecFormattingInfo::Gather, 0, zmf_addressParam, "_mm_i32gather_pd(", ");" },
+  { ZYDIS_MNEMONIC_VGATHERDPS, zms_vector, ZydecFormattingInfo::Gather, 0, zmf_addressParam, "_mm_i32gather_ps(", ");" },
+  { ZYDIS_MNEMONIC_VGATHERPF0DPD, zms_function, ZydecFormattingInfo::None, zma_allOperands, zmf_none, "_mm_prefetch_i32extgather_pd(", "); // part 1 / 2" },
+  { ZYDIS_MNEMONIC_VGATHERPF0DPS, zms_function, ZydecFormattingInfo::None, zma_allOperands, zmf_none, "_mm_prefetch_i32extgather_ps(", "); // part 1 / 2" },
+  { ZYDIS_MNEMONIC_VGATHERPF0HINTDPD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VGATHERPF0HINTDPS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VGATHERPF0QPD, zms_function, ZydecFormattingInfo::None, zma_allOperands, zmf_none, "_mm_prefetch_i64gather_pd(", "); // part 1 / 2" },
+  { ZYDIS_MNEMONIC_VGATHERPF0QPS, zms_function, ZydecFormattingInfo::None, zma_allOperands, zmf_none, "_mm_prefetch_i64gather_ps(", "); // part 1 / 2" },
+  { ZYDIS_MNEMONIC_VGATHERPF1DPD, zms_function, ZydecFormattingInfo::None, zma_allOperands, zmf_none, "_mm_prefetch_i32extgather_pd(", "); // part 2 / 2" },
+  { ZYDIS_MNEMONIC_VGATHERPF1DPS, zms_function, ZydecFormattingInfo::None, zma_allOperands, zmf_none, "_mm_prefetch_i32extgather_ps(", "); // part 2 / 2" },
+  { ZYDIS_MNEMONIC_VGATHERPF1QPD, zms_function, ZydecFormattingInfo::None, zma_allOperands, zmf_none, "_mm_prefetch_i64gather_pd(", "); // part 2 / 2" },
+  { ZYDIS_MNEMONIC_VGATHERPF1QPS, zms_function, ZydecFormattingInfo::None, zma_allOperands, zmf_none, "_mm_prefetch_i64gather_ps(", "); // part 2 / 2" },
+  { ZYDIS_MNEMONIC_VGATHERQPD, zms_vector, ZydecFormattingInfo::Gather, 0, zmf_addressParam, "_mm_i64gather_pd(", ");" },
+  { ZYDIS_MNEMONIC_VGATHERQPS, zms_vector, ZydecFormattingInfo::Gather, 0, zmf_addressParam, "_mm_i64gather_ps(", ");" },
+  { ZYDIS_MNEMONIC_VGETEXPPD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_getexp_pd(", ");" },
+  { ZYDIS_MNEMONIC_VGETEXPPH, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_getexp_ph(", ");" },
+  { ZYDIS_MNEMONIC_VGETEXPPS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_getexp_ps(", ");" },
+  { ZYDIS_MNEMONIC_VGETEXPSD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_getexp_sd(", ");" },
+  { ZYDIS_MNEMONIC_VGETEXPSH, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_getexp_sh(", ");" },
+  { ZYDIS_MNEMONIC_VGETEXPSS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_getexp_ss(", ");" },
+  { ZYDIS_MNEMONIC_VGETMANTPD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_getmant_pd(", ");" },
+  { ZYDIS_MNEMONIC_VGETMANTPH, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_getmant_ph(", ");" },
+  { ZYDIS_MNEMONIC_VGETMANTPS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_getmant_ps(", ");" },
+  { ZYDIS_MNEMONIC_VGETMANTSD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_getmant_sd(", ");" },
+  { ZYDIS_MNEMONIC_VGETMANTSH, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_getmant_sh(", ");" },
+  { ZYDIS_MNEMONIC_VGETMANTSS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_getmant_ss(", ");" },
+  { ZYDIS_MNEMONIC_VGF2P8AFFINEINVQB, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VGF2P8AFFINEQB, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VGF2P8MULB, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VGMAXABSPS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VGMAXPD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VGMAXPS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VGMINPD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VGMINPS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VHADDPD, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_hadd_pd(", ");" },
+  { ZYDIS_MNEMONIC_VHADDPS, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_hadd_ps(", ");" },
+  { ZYDIS_MNEMONIC_VHSUBPD, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_hsub_pd(", ");" },
+  { ZYDIS_MNEMONIC_VHSUBPS, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_hsub_ps(", ");" },
+  { ZYDIS_MNEMONIC_VINSERTF128, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_insert_f128(", ");" },
+  { ZYDIS_MNEMONIC_VINSERTF32X4, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_insertf32x4(", ");" },
+  { ZYDIS_MNEMONIC_VINSERTF32X8, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_insertf32x8(", ");" },
+  { ZYDIS_MNEMONIC_VINSERTF64X2, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_insertf64x2(", ");" },
+  { ZYDIS_MNEMONIC_VINSERTF64X4, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_insertf64x4(", ");" },
+  { ZYDIS_MNEMONIC_VINSERTI128, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_insert_i128(", ");" },
+  { ZYDIS_MNEMONIC_VINSERTI32X4, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_inserti32x4(", ");" },
+  { ZYDIS_MNEMONIC_VINSERTI32X8, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_inserti32x8(", ");" },
+  { ZYDIS_MNEMONIC_VINSERTI64X2, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_inserti64x2(", ");" },
+  { ZYDIS_MNEMONIC_VINSERTI64X4, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_inserti64x4(", ");" },
+  { ZYDIS_MNEMONIC_VINSERTPS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_insert_ps(", ");" },
+  { ZYDIS_MNEMONIC_VLDDQU, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VLDMXCSR, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VLOADUNPACKHD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VLOADUNPACKHPD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VLOADUNPACKHPS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VLOADUNPACKHQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VLOADUNPACKLD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VLOADUNPACKLPD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VLOADUNPACKLPS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VLOADUNPACKLQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VLOG2PS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VMASKMOVDQU, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VMASKMOVPD, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_none, "_mask_pd(", ";" },
+  { ZYDIS_MNEMONIC_VMASKMOVPS, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_none, "_mask_ps(", ";" },
+  { ZYDIS_MNEMONIC_VMAXPD, zms_vector, ZydecFormattingInfo::Max, 0, zmf_none, "_mm_max_pd(", ");" },
+  { ZYDIS_MNEMONIC_VMAXPH, zms_vector, ZydecFormattingInfo::Max, 0, zmf_none, "_mm_max_ph(", ");" },
+  { ZYDIS_MNEMONIC_VMAXPS, zms_vector, ZydecFormattingInfo::Max, 0, zmf_none, "_mm_max_ps(", ");" },
+  { ZYDIS_MNEMONIC_VMAXSD, zms_vector, ZydecFormattingInfo::Max, 0, zmf_none, "_mm_max_sd(", ");" },
+  { ZYDIS_MNEMONIC_VMAXSH, zms_vector, ZydecFormattingInfo::Max, 0, zmf_none, "_mm_max_sh(", ");" },
+  { ZYDIS_MNEMONIC_VMAXSS, zms_vector, ZydecFormattingInfo::Max, 0, zmf_none, "_mm_max_ss(", ");" },
+  { ZYDIS_MNEMONIC_VMCALL, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VMCLEAR, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VMFUNC, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VMINPD, zms_vector, ZydecFormattingInfo::Min, 0, zmf_none, "_mm_min_pd(", ");" },
+  { ZYDIS_MNEMONIC_VMINPH, zms_vector, ZydecFormattingInfo::Min, 0, zmf_none, "_mm_min_ph(", ");" },
+  { ZYDIS_MNEMONIC_VMINPS, zms_vector, ZydecFormattingInfo::Min, 0, zmf_none, "_mm_min_ps(", ");" },
+  { ZYDIS_MNEMONIC_VMINSD, zms_vector, ZydecFormattingInfo::Min, 0, zmf_none, "_mm_min_sd(", ");" },
+  { ZYDIS_MNEMONIC_VMINSH, zms_vector, ZydecFormattingInfo::Min, 0, zmf_none, "_mm_min_sh(", ");" },
+  { ZYDIS_MNEMONIC_VMINSS, zms_vector, ZydecFormattingInfo::Min, 0, zmf_none, "_mm_min_ss(", ");" },
+  { ZYDIS_MNEMONIC_VMLAUNCH, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VMLOAD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VMMCALL, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VMOVAPD, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_aligned, "(", ";" },
+  { ZYDIS_MNEMONIC_VMOVAPS, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_aligned, "(", ";" },
+  { ZYDIS_MNEMONIC_VMOVD, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_none, "_epi32(", ";" },
+  { ZYDIS_MNEMONIC_VMOVDDUP, zms_vector, ZydecFormattingInfo::None, 0, zmf_addressParam, nullptr, ");" },
+  { ZYDIS_MNEMONIC_VMOVDQA, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_aligned | zmf_widthSuffix, "_si(", ";" },
+  { ZYDIS_MNEMONIC_VMOVDQA32, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_aligned, "_epi32(", ";" },
+  { ZYDIS_MNEMONIC_VMOVDQA64, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_aligned, "_epi64(", ";" },
+  { ZYDIS_MNEMONIC_VMOVDQU, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_widthSuffix, "_si(", ";" },
+  { ZYDIS_MNEMONIC_VMOVDQU16, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_none, "_epi16(", ";" },
+  { ZYDIS_MNEMONIC_VMOVDQU32, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_none, "_epi32(", ";" },
+  { ZYDIS_MNEMONIC_VMOVDQU64, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_none, "_epi64(", ";" },
+  { ZYDIS_MNEMONIC_VMOVDQU8, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_none, "_epi8(", ";" },
+  { ZYDIS_MNEMONIC_VMOVHLPS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_movehl_ps(", ");" },
+  { ZYDIS_MNEMONIC_VMOVHPD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VMOVHPS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VMOVLHPS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_movelh_ps(", ");" },
+  { ZYDIS_MNEMONIC_VMOVLPD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VMOVLPS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VMOVMSKPD, zms_vector, ZydecFormattingInfo::Mask, 0, zmf_noSelfReference, "_mm_movemask_pd(", ");" },
+  { ZYDIS_MNEMONIC_VMOVMSKPS, zms_vector, ZydecFormattingInfo::Mask, 0, zmf_noSelfReference, "_mm_movemask_ps(", ");" },
+  { ZYDIS_MNEMONIC_VMOVNRAPD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VMOVNRAPS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VMOVNRNGOAPD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VMOVNRNGOAPS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VMOVNTDQ, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_aligned | zmf_widthSuffix, "_stream_si(", ";" },
+  { ZYDIS_MNEMONIC_VMOVNTDQA, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_aligned | zmf_widthSuffix, "_stream_si(", ";" },
+  { ZYDIS_MNEMONIC_VMOVNTPD, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_aligned, "_stream_pd(", ";" },
+  { ZYDIS_MNEMONIC_VMOVNTPS, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_aligned, "_stream_ps(", ";" },
+  { ZYDIS_MNEMONIC_VMOVQ, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_none, "_epi64(", ";" },
+  { ZYDIS_MNEMONIC_VMOVSD, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_none, "_sd(", ";" },
+  { ZYDIS_MNEMONIC_VMOVSH, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_none, "_sh(", ";" },
+  { ZYDIS_MNEMONIC_VMOVSHDUP, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_movehdup_ps(", ");" },
+  { ZYDIS_MNEMONIC_VMOVSLDUP, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_moveldup_ps(", ");" },
+  { ZYDIS_MNEMONIC_VMOVSS, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_none, "_ss(", ";" },
+  { ZYDIS_MNEMONIC_VMOVUPD, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_none, "(", ";" },
+  { ZYDIS_MNEMONIC_VMOVUPS, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_none, "(", ";" },
+  { ZYDIS_MNEMONIC_VMOVW, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VMPSADBW, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_mpsadbw_epu8(", ");" },
+  { ZYDIS_MNEMONIC_VMPTRLD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VMPTRST, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VMREAD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VMRESUME, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VMRUN, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VMSAVE, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VMULPD, zms_vector, ZydecFormattingInfo::Mul, 0, zmf_none, "_mm_mul_pd(", ");" },
+  { ZYDIS_MNEMONIC_VMULPH, zms_vector, ZydecFormattingInfo::Mul, 0, zmf_none, "_mm_mul_ph(", ");" },
+  { ZYDIS_MNEMONIC_VMULPS, zms_vector, ZydecFormattingInfo::Mul, 0, zmf_none, "_mm_mul_ps(", ");" },
+  { ZYDIS_MNEMONIC_VMULSD, zms_vector, ZydecFormattingInfo::Mul, 0, zmf_none, "_mm_mul_sd(", ");" },
+  { ZYDIS_MNEMONIC_VMULSH, zms_vector, ZydecFormattingInfo::Mul, 0, zmf_none, "_mm_mul_sh(", ");" },
+  { ZYDIS_MNEMONIC_VMULSS, zms_vector, ZydecFormattingInfo::Mul, 0, zmf_none, "_mm_mul_ss(", ");" },
+  { ZYDIS_MNEMONIC_VMWRITE, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VMXOFF, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VMXON, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VORPD, zms_vector, ZydecFormattingInfo::Or, 0, zmf_sameRegisterAssign, "_mm_or_pd(", ");" },
+  { ZYDIS_MNEMONIC_VORPS, zms_vector, ZydecFormattingInfo::Or, 0, zmf_sameRegisterAssign, "_mm_or_ps(", ");" },
+  { ZYDIS_MNEMONIC_VP2INTERSECTD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_2intersect_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VP2INTERSECTQ, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_2intersect_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VP4DPWSSD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_4dpwssd_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VP4DPWSSDS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_4dpwssds_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPABSB, zms_vector, ZydecFormattingInfo::Abs, 0, zmf_none, "_mm_abs_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPABSD, zms_vector, ZydecFormattingInfo::Abs, 0, zmf_none, "_mm_abs_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPABSQ, zms_vector, ZydecFormattingInfo::Abs, 0, zmf_none, "_mm_abs_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPABSW, zms_vector, ZydecFormattingInfo::Abs, 0, zmf_none, "_mm_abs_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPACKSSDW, zms_vector, ZydecFormattingInfo::Pack, 0, zmf_none, "_mm_packs_epu32_to_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPACKSSWB, zms_vector, ZydecFormattingInfo::Pack, 0, zmf_none, "_mm_packs_epu16_to_epi8(", ");" },
+  { ZYDIS_MNEMONIC_VPACKSTOREHD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPACKSTOREHPD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPACKSTOREHPS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPACKSTOREHQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPACKSTORELD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPACKSTORELPD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPACKSTORELPS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPACKSTORELQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPACKUSDW, zms_vector, ZydecFormattingInfo::Pack, 0, zmf_none, "_mm_packus_epu32_to_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPACKUSWB, zms_vector, ZydecFormattingInfo::Pack, 0, zmf_none, "_mm_packus_epu16_to_epi8(", ");" },
+  { ZYDIS_MNEMONIC_VPADCD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPADDB, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_add_epi8(", ");" },
+  { ZYDIS_MNEMONIC_VPADDD, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_add_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPADDQ, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_add_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPADDSB, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_adds_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPADDSETCD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPADDSETSD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPADDSW, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_adds_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPADDUSB, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_adds_epu8(", ");" },
+  { ZYDIS_MNEMONIC_VPADDUSW, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_adds_epu16(", ");" },
+  { ZYDIS_MNEMONIC_VPADDW, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_add_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPALIGNR, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_alignr_epi8(", ");" },
+  { ZYDIS_MNEMONIC_VPAND, zms_vector, ZydecFormattingInfo::And, 0, zmf_sameRegisterAssign | zmf_widthSuffix, "_mm_and_si(", ");" },
+  { ZYDIS_MNEMONIC_VPANDD, zms_vector, ZydecFormattingInfo::And, 0, zmf_sameRegisterAssign, "_mm_and_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPANDN, zms_vector, ZydecFormattingInfo::AndNot, 0, zmf_widthSuffix, "_mm_andnot_si(", ");" },
+  { ZYDIS_MNEMONIC_VPANDND, zms_vector, ZydecFormattingInfo::AndNot, 0, zmf_none, "_mm_andnot_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPANDNQ, zms_vector, ZydecFormattingInfo::AndNot, 0, zmf_none, "_mm_andnot_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPANDQ, zms_vector, ZydecFormattingInfo::And, 0, zmf_sameRegisterAssign, "_mm_and_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPAVGB, zms_vector, ZydecFormattingInfo::Abs, 0, zmf_none, "_mm_avg_epu8(", ");" },
+  { ZYDIS_MNEMONIC_VPAVGW, zms_vector, ZydecFormattingInfo::Abs, 0, zmf_none, "_mm_avg_epu16(", ");" },
+  { ZYDIS_MNEMONIC_VPBLENDD, zms_vector, ZydecFormattingInfo::Blend, 0, zmf_none, "_mm_blend_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPBLENDMB, zms_vector, ZydecFormattingInfo::Blend, 0, zmf_none, "_mm_blend_epi8(", ");" },
+  { ZYDIS_MNEMONIC_VPBLENDMD, zms_vector, ZydecFormattingInfo::Blend, 0, zmf_none, "_mm_blend_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPBLENDMQ, zms_vector, ZydecFormattingInfo::Blend, 0, zmf_none, "_mm_blend_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPBLENDMW, zms_vector, ZydecFormattingInfo::Blend, 0, zmf_none, "_mm_blend_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPBLENDVB, zms_vector, ZydecFormattingInfo::Blend, 0, zmf_none, "_mm_blendv_epi8(", ");" },
+  { ZYDIS_MNEMONIC_VPBLENDW, zms_vector, ZydecFormattingInfo::Blend, 0, zmf_none, "_mm_blend_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPBROADCASTB, zms_vector, ZydecFormattingInfo::Broadcast, 0, zmf_none, "_mm_broadcast_epi8(", ");" },
+  { ZYDIS_MNEMONIC_VPBROADCASTD, zms_vector, ZydecFormattingInfo::Broadcast, 0, zmf_none, "_mm_broadcast_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPBROADCASTMB2Q, zms_vector, ZydecFormattingInfo::Broadcast, 0, zmf_none, "_mm_broadcastmb_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPBROADCASTMW2D, zms_vector, ZydecFormattingInfo::Broadcast, 0, zmf_none, "_mm_broadcastmw_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPBROADCASTQ, zms_vector, ZydecFormattingInfo::Broadcast, 0, zmf_none, "_mm_broadcast_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPBROADCASTW, zms_vector, ZydecFormattingInfo::Broadcast, 0, zmf_none, "_mm_broadcast_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPCLMULQDQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPCMOV, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPCMPB, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_none, "_mm_cmp_epi8_mask(", ");" },
+  { ZYDIS_MNEMONIC_VPCMPD, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_none, "_mm_cmp_epi32_mask(", ");" },
+  { ZYDIS_MNEMONIC_VPCMPEQB, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_sameRegisterAllOnes, "_mm_cmpeq_epi8(", ");" },
+  { ZYDIS_MNEMONIC_VPCMPEQD, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_sameRegisterAllOnes, "_mm_cmpeq_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPCMPEQQ, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_sameRegisterAllOnes, "_mm_cmpeq_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPCMPEQW, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_sameRegisterAllOnes, "_mm_cmpeq_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPCMPESTRI, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPCMPESTRM, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPCMPGTB, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_none, "_mm_cmpgt_epi8(", ");" },
+  { ZYDIS_MNEMONIC_VPCMPGTD, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_none, "_mm_cmpgt_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPCMPGTQ, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_none, "_mm_cmpgt_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPCMPGTW, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_none, "_mm_cmpgt_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPCMPISTRI, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPCMPISTRM, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPCMPLTD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPCMPQ, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_none, "_mm_cmp_epi64_mask(", ");" },
+  { ZYDIS_MNEMONIC_VPCMPUB, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_none, "_mm_cmp_epu8_mask(", ");" },
+  { ZYDIS_MNEMONIC_VPCMPUD, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_none, "_mm_cmp_epu32_mask(", ");" },
+  { ZYDIS_MNEMONIC_VPCMPUQ, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_none, "_mm_cmp_epu64_mask(", ");" },
+  { ZYDIS_MNEMONIC_VPCMPUW, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_none, "_mm_cmp_epu16_mask(", ");" },
+  { ZYDIS_MNEMONIC_VPCMPW, zms_vector, ZydecFormattingInfo::Cmp, 0, zmf_none, "_mm_cmp_epi16_mask(", ");" },
+  { ZYDIS_MNEMONIC_VPCOMB, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPCOMD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPCOMPRESSB, zms_vector, ZydecFormattingInfo::None, 0, zmf_commentOnStore, "_mm_compress_epi8(", "); // with unaligned store" },
+  { ZYDIS_MNEMONIC_VPCOMPRESSD, zms_vector, ZydecFormattingInfo::None, 0, zmf_commentOnStore, "_mm_compress_epi32(", "); // with unaligned store" },
+  { ZYDIS_MNEMONIC_VPCOMPRESSQ, zms_vector, ZydecFormattingInfo::None, 0, zmf_commentOnStore, "_mm_compress_epi64(", "); // with unaligned store" },
+  { ZYDIS_MNEMONIC_VPCOMPRESSW, zms_vector, ZydecFormattingInfo::None, 0, zmf_commentOnStore, "_mm_compress_epi16(", "); // with unaligned store" },
+  { ZYDIS_MNEMONIC_VPCOMQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPCOMUB, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPCOMUD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPCOMUQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPCOMUW, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPCOMW, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPCONFLICTD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_conflict_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPCONFLICTQ, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_conflict_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPDPBUSD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_dpbusd_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPDPBUSDS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_dpbusds_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPDPWSSD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_dpwssd_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPDPWSSDS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_dpwssds_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPERM2F128, zms_vector, ZydecFormattingInfo::Permute, 0, zmf_none, "_mm_permute_2f128(", ");" },
+  { ZYDIS_MNEMONIC_VPERM2I128, zms_vector, ZydecFormattingInfo::Permute, 0, zmf_none, "_mm_permute_2i128(", ");" },
+  { ZYDIS_MNEMONIC_VPERMB, zms_vector, ZydecFormattingInfo::Permute, 0, zmf_none, "_mm_permutexvar_epi8(", ");" },
+  { ZYDIS_MNEMONIC_VPERMD, zms_vector, ZydecFormattingInfo::Permute, 0, zmf_none, "_mm_permutevar_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPERMF32X4, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPERMI2B, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPERMI2D, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPERMI2PD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPERMI2PS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPERMI2Q, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPERMI2W, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPERMIL2PD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPERMIL2PS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPERMILPD, zms_vector, ZydecFormattingInfo::Permute, 0, zmf_none, "_mm_permute_pd(", ");" },
+  { ZYDIS_MNEMONIC_VPERMILPS, zms_vector, ZydecFormattingInfo::Permute, 0, zmf_none, "_mm_permute_ps(", ");" },
+  { ZYDIS_MNEMONIC_VPERMPD, zms_vector, ZydecFormattingInfo::Permute, 0, zmf_none, "_mm_permute4x64_pd(", ");" },
+  { ZYDIS_MNEMONIC_VPERMPS, zms_vector, ZydecFormattingInfo::Permute, 0, zmf_none, "_mm_permutevar8x32_ps(", ");" },
+  { ZYDIS_MNEMONIC_VPERMQ, zms_vector, ZydecFormattingInfo::Permute, 0, zmf_none, "_mm_permute4x64_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPERMT2B, zms_vector, ZydecFormattingInfo::Permute, 0, zmf_none, "_mm_permutex2var_epi8(", ");" },
+  { ZYDIS_MNEMONIC_VPERMT2D, zms_vector, ZydecFormattingInfo::Permute, 0, zmf_none, "_mm_permutex2var_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPERMT2PD, zms_vector, ZydecFormattingInfo::Permute, 0, zmf_none, "_mm_permutex2var_pd(", ");" },
+  { ZYDIS_MNEMONIC_VPERMT2PS, zms_vector, ZydecFormattingInfo::Permute, 0, zmf_none, "_mm_permutex2var_ps(", ");" },
+  { ZYDIS_MNEMONIC_VPERMT2Q, zms_vector, ZydecFormattingInfo::Permute, 0, zmf_none, "_mm_permutex2var_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPERMT2W, zms_vector, ZydecFormattingInfo::Permute, 0, zmf_none, "_mm_permutex2var_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPERMW, zms_vector, ZydecFormattingInfo::Permute, 0, zmf_none, "_mm_permutexvar_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPEXPANDB, zms_vector, ZydecFormattingInfo::None, 0, zmf_commentOnLoad, "_mm_expand_epi8(", "); // with unaligned load" },
+  { ZYDIS_MNEMONIC_VPEXPANDD, zms_vector, ZydecFormattingInfo::None, 0, zmf_commentOnLoad, "_mm_expand_epi32(", "); // with unaligned load" },
+  { ZYDIS_MNEMONIC_VPEXPANDQ, zms_vector, ZydecFormattingInfo::None, 0, zmf_commentOnLoad, "_mm_expand_epi64(", "); // with unaligned load" },
+  { ZYDIS_MNEMONIC_VPEXPANDW, zms_vector, ZydecFormattingInfo::None, 0, zmf_commentOnLoad, "_mm_expand_epi16(", "); // with unaligned load" },
+  { ZYDIS_MNEMONIC_VPEXTRB, zms_vector, ZydecFormattingInfo::Extract, 0, zmf_none, "_mm_extract_epi8(", ");" },
+  { ZYDIS_MNEMONIC_VPEXTRD, zms_vector, ZydecFormattingInfo::Extract, 0, zmf_none, "_mm_extract_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPEXTRQ, zms_vector, ZydecFormattingInfo::Extract, 0, zmf_none, "_mm_extract_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPEXTRW, zms_vector, ZydecFormattingInfo::Extract, 0, zmf_none, "_mm_extract_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPGATHERDD, zms_vector, ZydecFormattingInfo::Gather, 0, zmf_addressParam, "_mm_i32gather_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPGATHERDQ, zms_vector, ZydecFormattingInfo::Gather, 0, zmf_addressParam, "_mm_i32gather_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPGATHERQD, zms_vector, ZydecFormattingInfo::Gather, 0, zmf_addressParam, "_mm_i64gather_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPGATHERQQ, zms_vector, ZydecFormattingInfo::Gather, 0, zmf_addressParam, "_mm_i64gather_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPHADDBD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPHADDBQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPHADDBW, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPHADDD, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_hadd_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPHADDDQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPHADDSW, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_hadds_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPHADDUBD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPHADDUBQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPHADDUBW, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPHADDUDQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPHADDUWD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPHADDUWQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPHADDW, zms_vector, ZydecFormattingInfo::Add, 0, zmf_none, "_mm_hadd_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPHADDWD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPHADDWQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPHMINPOSUW, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_minpos_epu16(", ");" },
+  { ZYDIS_MNEMONIC_VPHSUBBW, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPHSUBD, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_hsub_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPHSUBDQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPHSUBSW, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_hsubs_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPHSUBW, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_hsub_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPHSUBWD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPINSRB, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_insert_epi8(", ");" },
+  { ZYDIS_MNEMONIC_VPINSRD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_insert_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPINSRQ, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_insert_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPINSRW, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_insert_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPLZCNTD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_lzcnt_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPLZCNTQ, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_lzcnt_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPMACSDD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPMACSDQH, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPMACSDQL, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPMACSSDD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPMACSSDQH, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPMACSSDQL, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPMACSSWD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPMACSSWW, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPMACSWD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPMACSWW, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPMADCSSWD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPMADCSWD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPMADD231D, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPMADD233D, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPMADD52HUQ, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_madd52hi_epu64(", ");" },
+  { ZYDIS_MNEMONIC_VPMADD52LUQ, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_madd52lo_epu64(", ");" },
+  { ZYDIS_MNEMONIC_VPMADDUBSW, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_maddubs_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPMADDWD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_pmadd_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPMASKMOVD, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_none, "_mask_epi32(", ";" },
+  { ZYDIS_MNEMONIC_VPMASKMOVQ, zms_vectorMove, ZydecFormattingInfo::Mov, 0, zmf_none, "_mask_epi64(", ";" },
+  { ZYDIS_MNEMONIC_VPMAXSB, zms_vector, ZydecFormattingInfo::Max, 0, zmf_none, "_mm_max_epi8(", ");" },
+  { ZYDIS_MNEMONIC_VPMAXSD, zms_vector, ZydecFormattingInfo::Max, 0, zmf_none, "_mm_max_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPMAXSQ, zms_vector, ZydecFormattingInfo::Max, 0, zmf_none, "_mm_max_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPMAXSW, zms_vector, ZydecFormattingInfo::Max, 0, zmf_none, "_mm_max_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPMAXUB, zms_vector, ZydecFormattingInfo::Max, 0, zmf_none, "_mm_max_epu8(", ");" },
+  { ZYDIS_MNEMONIC_VPMAXUD, zms_vector, ZydecFormattingInfo::Max, 0, zmf_none, "_mm_max_epu32(", ");" },
+  { ZYDIS_MNEMONIC_VPMAXUQ, zms_vector, ZydecFormattingInfo::Max, 0, zmf_none, "_mm_max_epu64(", ");" },
+  { ZYDIS_MNEMONIC_VPMAXUW, zms_vector, ZydecFormattingInfo::Max, 0, zmf_none, "_mm_max_epu16(", ");" },
+  { ZYDIS_MNEMONIC_VPMINSB, zms_vector, ZydecFormattingInfo::Min, 0, zmf_none, "_mm_min_epi8(", ");" },
+  { ZYDIS_MNEMONIC_VPMINSD, zms_vector, ZydecFormattingInfo::Min, 0, zmf_none, "_mm_min_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPMINSQ, zms_vector, ZydecFormattingInfo::Min, 0, zmf_none, "_mm_min_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPMINSW, zms_vector, ZydecFormattingInfo::Min, 0, zmf_none, "_mm_min_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPMINUB, zms_vector, ZydecFormattingInfo::Min, 0, zmf_none, "_mm_min_epu8(", ");" },
+  { ZYDIS_MNEMONIC_VPMINUD, zms_vector, ZydecFormattingInfo::Min, 0, zmf_none, "_mm_min_epu32(", ");" },
+  { ZYDIS_MNEMONIC_VPMINUQ, zms_vector, ZydecFormattingInfo::Min, 0, zmf_none, "_mm_min_epu64(", ");" },
+  { ZYDIS_MNEMONIC_VPMINUW, zms_vector, ZydecFormattingInfo::Min, 0, zmf_none, "_mm_min_epu16(", ");" },
+  { ZYDIS_MNEMONIC_VPMOVB2M, zms_vector, ZydecFormattingInfo::Mask, 0, zmf_none, "_mm_movepi8_mask(", ");" },
+  { ZYDIS_MNEMONIC_VPMOVD2M, zms_vector, ZydecFormattingInfo::Mask, 0, zmf_none, "_mm_movepi32_mask(", ");" },
+  { ZYDIS_MNEMONIC_VPMOVDB, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_commentOnStore, "_mm_cvtepi32_epi8(", "); // with unaligned store" },
+  { ZYDIS_MNEMONIC_VPMOVDW, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_commentOnStore, "_mm_cvtepi32_epi16(", "); // with unaligned store" },
+  { ZYDIS_MNEMONIC_VPMOVM2B, zms_vector, ZydecFormattingInfo::Mask, 0, zmf_none, "_mm_movm_epi8(", ");" },
+  { ZYDIS_MNEMONIC_VPMOVM2D, zms_vector, ZydecFormattingInfo::Mask, 0, zmf_none, "_mm_movm_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPMOVM2Q, zms_vector, ZydecFormattingInfo::Mask, 0, zmf_none, "_mm_movm_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPMOVM2W, zms_vector, ZydecFormattingInfo::Mask, 0, zmf_none, "_mm_movm_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPMOVMSKB, zms_vector, ZydecFormattingInfo::Mask, 0, zmf_noSelfReference, "_mm_movemask_epi8(", ");" },
+  { ZYDIS_MNEMONIC_VPMOVQ2M, zms_vector, ZydecFormattingInfo::Mask, 0, zmf_none, "_mm_movepi64_mask(", ");" },
+  { ZYDIS_MNEMONIC_VPMOVQB, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_commentOnStore, "_mm_cvtepi64_epi8(", "); // with unaligned store" },
+  { ZYDIS_MNEMONIC_VPMOVQD, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_commentOnStore, "_mm_cvtepi64_epi32(", "); // with unaligned store" },
+  { ZYDIS_MNEMONIC_VPMOVQW, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_commentOnStore, "_mm_cvtepi64_epi16(", "); // with unaligned store" },
+  { ZYDIS_MNEMONIC_VPMOVSDB, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_commentOnStore, "_mm_cvtsepi32_epi8(", "); // with unaligned store" },
+  { ZYDIS_MNEMONIC_VPMOVSDW, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_commentOnStore, "_mm_cvtsepi32_epi16(", "); // with unaligned store" },
+  { ZYDIS_MNEMONIC_VPMOVSQB, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_commentOnStore, "_mm_cvtsepi64_epi8(", "); // with unaligned store" },
+  { ZYDIS_MNEMONIC_VPMOVSQD, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_commentOnStore, "_mm_cvtsepi64_epi32(", "); // with unaligned store" },
+  { ZYDIS_MNEMONIC_VPMOVSQW, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_commentOnStore, "_mm_cvtsepi64_epi16(", "); // with unaligned store" },
+  { ZYDIS_MNEMONIC_VPMOVSWB, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_commentOnStore, "_mm_cvtsepi16_epi8(", "); // with unaligned store" },
+  { ZYDIS_MNEMONIC_VPMOVSXBD, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepi8_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPMOVSXBQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepi8_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPMOVSXBW, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepi8_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPMOVSXDQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepi32_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPMOVSXWD, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepi16_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPMOVSXWQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepi16_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPMOVUSDB, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtusepi32_epi8(", ");" },
+  { ZYDIS_MNEMONIC_VPMOVUSDW, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtusepi32_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPMOVUSQB, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtusepi64_epi8(", ");" },
+  { ZYDIS_MNEMONIC_VPMOVUSQD, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtusepi64_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPMOVUSQW, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtusepi64_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPMOVUSWB, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtusepi16_epi8(", ");" },
+  { ZYDIS_MNEMONIC_VPMOVW2M, zms_vector, ZydecFormattingInfo::Mask, 0, zmf_none, "_mm_movepi16_mask(", ");" },
+  { ZYDIS_MNEMONIC_VPMOVWB, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_commentOnStore, "_mm_cvtepi16_epi8(", "); // with unaligned store" },
+  { ZYDIS_MNEMONIC_VPMOVZXBD, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepu8_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPMOVZXBQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepu8_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPMOVZXBW, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepu8_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPMOVZXDQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepu32_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPMOVZXWD, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepu16_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPMOVZXWQ, zms_vector, ZydecFormattingInfo::Convert, 0, zmf_none, "_mm_cvtepu16_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPMULDQ, zms_vector, ZydecFormattingInfo::Mul, 0, zmf_none, "_mm_mul_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPMULHD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPMULHRSW, zms_vector, ZydecFormattingInfo::Mul, 0, zmf_none, "_mm_mulhrs_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPMULHUD, zms_vector, ZydecFormattingInfo::Mul, 0, zmf_none, "_mm_mulhi_epu32(", ");" },
+  { ZYDIS_MNEMONIC_VPMULHUW, zms_vector, ZydecFormattingInfo::Mul, 0, zmf_none, "_mm_mulhi_epu16(", ");" },
+  { ZYDIS_MNEMONIC_VPMULHW, zms_vector, ZydecFormattingInfo::Mul, 0, zmf_none, "_mm_mulhi_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPMULLD, zms_vector, ZydecFormattingInfo::Mul, 0, zmf_none, "_mm_mullo_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPMULLQ, zms_vector, ZydecFormattingInfo::Mul, 0, zmf_none, "_mm_mullo_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPMULLW, zms_vector, ZydecFormattingInfo::Mul, 0, zmf_none, "_mm_mullo_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPMULTISHIFTQB, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_multishift_epi64_epi8(", ");" },
+  { ZYDIS_MNEMONIC_VPMULUDQ, zms_vector, ZydecFormattingInfo::Mul, 0, zmf_none, "_mm_mul_epu32(", ");" },
+  { ZYDIS_MNEMONIC_VPOPCNTB, zms_vector, ZydecFormattingInfo::PopCnt, 0, zmf_none, "_mm_popcnt_epi8(", ");" },
+  { ZYDIS_MNEMONIC_VPOPCNTD, zms_vector, ZydecFormattingInfo::PopCnt, 0, zmf_none, "_mm_popcnt_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPOPCNTQ, zms_vector, ZydecFormattingInfo::PopCnt, 0, zmf_none, "_mm_popcnt_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPOPCNTW, zms_vector, ZydecFormattingInfo::PopCnt, 0, zmf_none, "_mm_popcnt_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPOR, zms_vector, ZydecFormattingInfo::Or, 0, zmf_sameRegisterAssign | zmf_widthSuffix, "_mm_or_si(", ");" },
+  { ZYDIS_MNEMONIC_VPORD, zms_vector, ZydecFormattingInfo::Or, 0, zmf_sameRegisterAssign, "_mm_or_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPORQ, zms_vector, ZydecFormattingInfo::Or, 0, zmf_sameRegisterAssign, "_mm_or_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPPERM, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPREFETCH0, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPREFETCH1, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPREFETCH2, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPREFETCHE0, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPREFETCHE1, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPREFETCHE2, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPREFETCHENTA, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPREFETCHNTA, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPROLD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rol_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPROLQ, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rol_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPROLVD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rolv_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPROLVQ, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rolv_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPRORD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_ror_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPRORQ, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_ror_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPRORVD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rorv_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPRORVQ, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rorv_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPROTB, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPROTD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPROTQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPROTW, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPSADBW, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_sad_epu8(", ");" },
+  { ZYDIS_MNEMONIC_VPSBBD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPSBBRD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPSCATTERDD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_i32scatter_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPSCATTERDQ, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_i32scatter_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPSCATTERQD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_i64scatter_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPSCATTERQQ, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_i64scatter_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPSHAB, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPSHAD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPSHAQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPSHAW, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPSHLB, zms_vector, ZydecFormattingInfo::ShL, 0, zmf_none, "_mm_shl_epi8(", ");" },
+  { ZYDIS_MNEMONIC_VPSHLD, zms_vector, ZydecFormattingInfo::ShL, 0, zmf_none, "_mm_shl_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPSHLDD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_shldi_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPSHLDQ, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_shldi_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPSHLDVD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_shldv_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPSHLDVQ, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_shldv_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPSHLDVW, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_shldv_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPSHLDW, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_shldi_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPSHLQ, zms_vector, ZydecFormattingInfo::ShL, 0, zmf_none, "_mm_shl_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPSHLW, zms_vector, ZydecFormattingInfo::ShL, 0, zmf_none, "_mm_shl_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPSHRDD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_shrdi_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPSHRDQ, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_shrdi_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPSHRDVD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_shrdv_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPSHRDVQ, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_shrdv_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPSHRDVW, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_shrdv_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPSHRDW, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_shrdi_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPSHUFB, zms_vector, ZydecFormattingInfo::Shuffle, 0, zmf_none, "_mm_shuffle_epi8(", ");" },
+  { ZYDIS_MNEMONIC_VPSHUFBITQMB, zms_vector, ZydecFormattingInfo::Shuffle, 0, zmf_none, "_mm_bitshuffle_epi64_mask(", ");" },
+  { ZYDIS_MNEMONIC_VPSHUFD, zms_vector, ZydecFormattingInfo::Shuffle, 0, zmf_none, "_mm_shuffle_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPSHUFHW, zms_vector, ZydecFormattingInfo::Shuffle, 0, zmf_none, "_mm_shufflehi_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPSHUFLW, zms_vector, ZydecFormattingInfo::Shuffle, 0, zmf_none, "_mm_shufflelo_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPSIGNB, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_sign_epi8(", ");" },
+  { ZYDIS_MNEMONIC_VPSIGND, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_sign_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPSIGNW, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_sign_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPSLLD, zms_vector, ZydecFormattingInfo::ShL, 0, zmf_none, "_mm_sll_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPSLLDQ, zms_vector, ZydecFormattingInfo::ShL, 0, zmf_none, "_mm_bslli_epi128(", " * 8); // byte shift left in 128 bit lanes" },
+  { ZYDIS_MNEMONIC_VPSLLQ, zms_vector, ZydecFormattingInfo::ShL, 0, zmf_none, "_mm_sll_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPSLLVD, zms_vector, ZydecFormattingInfo::ShL, 0, zmf_none, "_mm_sllv_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPSLLVQ, zms_vector, ZydecFormattingInfo::ShL, 0, zmf_none, "_mm_sllv_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPSLLVW, zms_vector, ZydecFormattingInfo::ShL, 0, zmf_none, "_mm_sllv_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPSLLW, zms_vector, ZydecFormattingInfo::ShL, 0, zmf_none, "_mm_sll_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPSRAD, zms_vector, ZydecFormattingInfo::ShR, 0, zmf_none, "_mm_sra_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPSRAQ, zms_vector, ZydecFormattingInfo::ShR, 0, zmf_none, "_mm_sra_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPSRAVD, zms_vector, ZydecFormattingInfo::ShR, 0, zmf_none, "_mm_srav_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPSRAVQ, zms_vector, ZydecFormattingInfo::ShR, 0, zmf_none, "_mm_srav_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPSRAVW, zms_vector, ZydecFormattingInfo::ShR, 0, zmf_none, "_mm_srav_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPSRAW, zms_vector, ZydecFormattingInfo::ShR, 0, zmf_none, "_mm_sra_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPSRLD, zms_vector, ZydecFormattingInfo::ShR, 0, zmf_none, "_mm_srl_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPSRLDQ, zms_vector, ZydecFormattingInfo::ShR, 0, zmf_none, "_mm_bsrli_epi128(", " * 8); // byte shift right in 128 bit lanes" },
+  { ZYDIS_MNEMONIC_VPSRLQ, zms_vector, ZydecFormattingInfo::ShR, 0, zmf_none, "_mm_srl_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPSRLVD, zms_vector, ZydecFormattingInfo::ShR, 0, zmf_none, "_mm_srlv_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPSRLVQ, zms_vector, ZydecFormattingInfo::ShR, 0, zmf_none, "_mm_srlv_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPSRLVW, zms_vector, ZydecFormattingInfo::ShR, 0, zmf_none, "_mm_srlv_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPSRLW, zms_vector, ZydecFormattingInfo::ShR, 0, zmf_none, "_mm_srl_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPSUBB, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_sub_epi8(", ");" },
+  { ZYDIS_MNEMONIC_VPSUBD, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_sub_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPSUBQ, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_sub_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPSUBRD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_??_(", ");" },
+  { ZYDIS_MNEMONIC_VPSUBRSETBD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPSUBSB, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_subs_epi8(", ");" },
+  { ZYDIS_MNEMONIC_VPSUBSETBD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VPSUBSW, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_subs_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPSUBUSB, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_subs_epu8(", ");" },
+  { ZYDIS_MNEMONIC_VPSUBUSW, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_subs_epu16(", ");" },
+  { ZYDIS_MNEMONIC_VPSUBW, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_sub_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPTERNLOGD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_ternarylogic_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPTERNLOGQ, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_ternarylogic_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPTEST, zms_vector, ZydecFormattingInfo::Test, 0, zmf_none, "_mm_test(", ");" },
+  { ZYDIS_MNEMONIC_VPTESTMB, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_test_epi8_mask(", ");" },
+  { ZYDIS_MNEMONIC_VPTESTMD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_test_epi32_mask(", ");" },
+  { ZYDIS_MNEMONIC_VPTESTMQ, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_test_epi64_mask(", ");" },
+  { ZYDIS_MNEMONIC_VPTESTMW, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_test_epi16_mask(", ");" },
+  { ZYDIS_MNEMONIC_VPTESTNMB, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_testn_epi8_mask(", ");" },
+  { ZYDIS_MNEMONIC_VPTESTNMD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_testn_epi32_mask(", ");" },
+  { ZYDIS_MNEMONIC_VPTESTNMQ, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_testn_epi64_mask(", ");" },
+  { ZYDIS_MNEMONIC_VPTESTNMW, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_testn_epi16_mask(", ");" },
+  { ZYDIS_MNEMONIC_VPUNPCKHBW, zms_vector, ZydecFormattingInfo::Unpack, 0, zmf_none, "_mm_unpackhi_epi8(", ");" },
+  { ZYDIS_MNEMONIC_VPUNPCKHDQ, zms_vector, ZydecFormattingInfo::Unpack, 0, zmf_none, "_mm_unpackhi_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPUNPCKHQDQ, zms_vector, ZydecFormattingInfo::Unpack, 0, zmf_none, "_mm_unpackhi_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPUNPCKHWD, zms_vector, ZydecFormattingInfo::Unpack, 0, zmf_none, "_mm_unpackhi_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPUNPCKLBW, zms_vector, ZydecFormattingInfo::Unpack, 0, zmf_none, "_mm_unpacklo_epi8(", ");" },
+  { ZYDIS_MNEMONIC_VPUNPCKLDQ, zms_vector, ZydecFormattingInfo::Unpack, 0, zmf_none, "_mm_unpacklo_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPUNPCKLQDQ, zms_vector, ZydecFormattingInfo::Unpack, 0, zmf_none, "_mm_unpacklo_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VPUNPCKLWD, zms_vector, ZydecFormattingInfo::Unpack, 0, zmf_none, "_mm_unpacklo_epi16(", ");" },
+  { ZYDIS_MNEMONIC_VPXOR, zms_vector, ZydecFormattingInfo::XOr, 0, zmf_sameRegisterZero | zmf_widthSuffix, "_mm_xor_si(", ");" },
+  { ZYDIS_MNEMONIC_VPXORD, zms_vector, ZydecFormattingInfo::XOr, 0, zmf_sameRegisterZero, "_mm_xor_epi32(", ");" },
+  { ZYDIS_MNEMONIC_VPXORQ, zms_vector, ZydecFormattingInfo::XOr, 0, zmf_sameRegisterZero, "_mm_xor_epi64(", ");" },
+  { ZYDIS_MNEMONIC_VRANGEPD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_range_pd(", ");" },
+  { ZYDIS_MNEMONIC_VRANGEPS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_range_ps(", ");" },
+  { ZYDIS_MNEMONIC_VRANGESD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_range_sd(", ");" },
+  { ZYDIS_MNEMONIC_VRANGESS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_range_ss(", ");" },
+  { ZYDIS_MNEMONIC_VRCP14PD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rcp14_pd(", ");" },
+  { ZYDIS_MNEMONIC_VRCP14PS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rcp14_ps(", ");" },
+  { ZYDIS_MNEMONIC_VRCP14SD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rcp14_sd(", ");" },
+  { ZYDIS_MNEMONIC_VRCP14SS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rcp14_ss(", ");" },
+  { ZYDIS_MNEMONIC_VRCP23PS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VRCP28PD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rcp28_pd(", ");" },
+  { ZYDIS_MNEMONIC_VRCP28PS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rcp28_ps(", ");" },
+  { ZYDIS_MNEMONIC_VRCP28SD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rcp28_sd(", ");" },
+  { ZYDIS_MNEMONIC_VRCP28SS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rcp28_ss(", ");" },
+  { ZYDIS_MNEMONIC_VRCPPH, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rcp_ph(", ");" },
+  { ZYDIS_MNEMONIC_VRCPPS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rcp_ps(", ");" },
+  { ZYDIS_MNEMONIC_VRCPSH, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rcp_sh(", ");" },
+  { ZYDIS_MNEMONIC_VRCPSS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rcp_ss(", ");" },
+  { ZYDIS_MNEMONIC_VREDUCEPD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_reduce_pd(", ");" },
+  { ZYDIS_MNEMONIC_VREDUCEPH, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_reduce_ph(", ");" },
+  { ZYDIS_MNEMONIC_VREDUCEPS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_reduce_ps(", ");" },
+  { ZYDIS_MNEMONIC_VREDUCESD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_reduce_sd(", ");" },
+  { ZYDIS_MNEMONIC_VREDUCESH, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_reduce_sh(", ");" },
+  { ZYDIS_MNEMONIC_VREDUCESS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_reduce_ss(", ");" },
+  { ZYDIS_MNEMONIC_VRNDFXPNTPD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VRNDFXPNTPS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VRNDSCALEPD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_roundscale_pd(", ");" },
+  { ZYDIS_MNEMONIC_VRNDSCALEPH, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_roundscale_ph(", ");" },
+  { ZYDIS_MNEMONIC_VRNDSCALEPS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_roundscale_ps(", ");" },
+  { ZYDIS_MNEMONIC_VRNDSCALESD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_roundscale_sd(", ");" },
+  { ZYDIS_MNEMONIC_VRNDSCALESH, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_roundscale_sh(", ");" },
+  { ZYDIS_MNEMONIC_VRNDSCALESS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_roundscale_ss(", ");" },
+  { ZYDIS_MNEMONIC_VROUNDPD, zms_vector, ZydecFormattingInfo::Round, 0, zmf_none, "_mm_round_pd(", ");" },
+  { ZYDIS_MNEMONIC_VROUNDPS, zms_vector, ZydecFormattingInfo::Round, 0, zmf_none, "_mm_round_ps(", ");" },
+  { ZYDIS_MNEMONIC_VROUNDSD, zms_vector, ZydecFormattingInfo::Round, 0, zmf_none, "_mm_round_sd(", ");" },
+  { ZYDIS_MNEMONIC_VROUNDSS, zms_vector, ZydecFormattingInfo::Round, 0, zmf_none, "_mm_round_ss(", ");" },
+  { ZYDIS_MNEMONIC_VRSQRT14PD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rsqrt14_pd(", ");" },
+  { ZYDIS_MNEMONIC_VRSQRT14PS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rsqrt14_ps(", ");" },
+  { ZYDIS_MNEMONIC_VRSQRT14SD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rsqrt14_sd(", ");" },
+  { ZYDIS_MNEMONIC_VRSQRT14SS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rsqrt14_ss(", ");" },
+  { ZYDIS_MNEMONIC_VRSQRT23PS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VRSQRT28PD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rsqrt28_pd(", ");" },
+  { ZYDIS_MNEMONIC_VRSQRT28PS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rsqrt28_ps(", ");" },
+  { ZYDIS_MNEMONIC_VRSQRT28SD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rsqrt28_sd(", ");" },
+  { ZYDIS_MNEMONIC_VRSQRT28SS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rsqrt28_ss(", ");" },
+  { ZYDIS_MNEMONIC_VRSQRTPH, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rsqrt_ph(", ");" },
+  { ZYDIS_MNEMONIC_VRSQRTPS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rsqrt_ps(", ");" },
+  { ZYDIS_MNEMONIC_VRSQRTSH, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rsqrt_sh(", ");" },
+  { ZYDIS_MNEMONIC_VRSQRTSS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_rsqrt_ss(", ");" },
+  { ZYDIS_MNEMONIC_VSCALEFPD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_scalef_pd(", ");" },
+  { ZYDIS_MNEMONIC_VSCALEFPH, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_scalef_ph(", ");" },
+  { ZYDIS_MNEMONIC_VSCALEFPS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_scalef_ps(", ");" },
+  { ZYDIS_MNEMONIC_VSCALEFSD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_scalef_sd(", ");" },
+  { ZYDIS_MNEMONIC_VSCALEFSH, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_scalef_sh(", ");" },
+  { ZYDIS_MNEMONIC_VSCALEFSS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_scalef_ss(", ");" },
+  { ZYDIS_MNEMONIC_VSCALEPS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VSCATTERDPD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_i32scatter_pd(", ");" },
+  { ZYDIS_MNEMONIC_VSCATTERDPS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_i32scatter_ps(", ");" },
+  { ZYDIS_MNEMONIC_VSCATTERPF0DPD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VSCATTERPF0DPS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VSCATTERPF0HINTDPD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VSCATTERPF0HINTDPS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VSCATTERPF0QPD, zms_function, ZydecFormattingInfo::None, zma_allOperands, zmf_none, "_mm_prefetch_i64scatter_pd(", "); // part 1 / 2" },
+  { ZYDIS_MNEMONIC_VSCATTERPF0QPS, zms_function, ZydecFormattingInfo::None, zma_allOperands, zmf_none, "_mm_prefetch_i64scatter_ps(", "); // part 1 / 2" },
+  { ZYDIS_MNEMONIC_VSCATTERPF1DPD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VSCATTERPF1DPS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VSCATTERPF1QPD, zms_function, ZydecFormattingInfo::None, zma_allOperands, zmf_none, "_mm_prefetch_i64scatter_pd(", "); // part 2 / 2" },
+  { ZYDIS_MNEMONIC_VSCATTERPF1QPS, zms_function, ZydecFormattingInfo::None, zma_allOperands, zmf_none, "_mm_prefetch_i64scatter_ps(", "); // part 2 / 2" },
+  { ZYDIS_MNEMONIC_VSCATTERQPD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_i64scatter_pd(", ");" },
+  { ZYDIS_MNEMONIC_VSCATTERQPS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_i64scatter_ps(", ");" },
+  { ZYDIS_MNEMONIC_VSHUFF32X4, zms_vector, ZydecFormattingInfo::Shuffle, 0, zmf_none, "_mm_shuffle_f32x4(", ");" },
+  { ZYDIS_MNEMONIC_VSHUFF64X2, zms_vector, ZydecFormattingInfo::Shuffle, 0, zmf_none, "_mm_shuffle_f64x2(", ");" },
+  { ZYDIS_MNEMONIC_VSHUFI32X4, zms_vector, ZydecFormattingInfo::Shuffle, 0, zmf_none, "_mm_shuffle_i32x4(", ");" },
+  { ZYDIS_MNEMONIC_VSHUFI64X2, zms_vector, ZydecFormattingInfo::Shuffle, 0, zmf_none, "_mm_shuffle_i64x2(", ");" },
+  { ZYDIS_MNEMONIC_VSHUFPD, zms_vector, ZydecFormattingInfo::Shuffle, 0, zmf_none, "_mm_shuffle_pd(", ");" },
+  { ZYDIS_MNEMONIC_VSHUFPS, zms_vector, ZydecFormattingInfo::Shuffle, 0, zmf_none, "_mm_shuffle_ps(", ");" },
+  { ZYDIS_MNEMONIC_VSQRTPD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_sqrt_pd(", ");" },
+  { ZYDIS_MNEMONIC_VSQRTPH, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_sqrt_ph(", ");" },
+  { ZYDIS_MNEMONIC_VSQRTPS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_sqrt_ps(", ");" },
+  { ZYDIS_MNEMONIC_VSQRTSD, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_sqrt_sd(", ");" },
+  { ZYDIS_MNEMONIC_VSQRTSH, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_sqrt_sh(", ");" },
+  { ZYDIS_MNEMONIC_VSQRTSS, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_sqrt_ss(", ");" },
+  { ZYDIS_MNEMONIC_VSTMXCSR, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VSUBPD, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_sub_pd(", ");" },
+  { ZYDIS_MNEMONIC_VSUBPH, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_sub_ph(", ");" },
+  { ZYDIS_MNEMONIC_VSUBPS, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_sub_ps(", ");" },
+  { ZYDIS_MNEMONIC_VSUBRPD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VSUBRPS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VSUBSD, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_sub_sd(", ");" },
+  { ZYDIS_MNEMONIC_VSUBSH, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_sub_sh(", ");" },
+  { ZYDIS_MNEMONIC_VSUBSS, zms_vector, ZydecFormattingInfo::Sub, 0, zmf_none, "_mm_sub_ss(", ");" },
+  { ZYDIS_MNEMONIC_VTESTPD, zms_vector, ZydecFormattingInfo::Test, 0, zmf_none, "_mm_test_pd(", ");" },
+  { ZYDIS_MNEMONIC_VTESTPS, zms_vector, ZydecFormattingInfo::Test, 0, zmf_none, "_mm_test_ps(", ");" },
+  { ZYDIS_MNEMONIC_VUCOMISD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VUCOMISH, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_ucomi_sh(", ");" },
+  { ZYDIS_MNEMONIC_VUCOMISS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_VUNPCKHPD, zms_vector, ZydecFormattingInfo::Unpack, 0, zmf_none, "_mm_unpackhi_pd(", ");" },
+  { ZYDIS_MNEMONIC_VUNPCKHPS, zms_vector, ZydecFormattingInfo::Unpack, 0, zmf_none, "_mm_unpackhi_ps(", ");" },
+  { ZYDIS_MNEMONIC_VUNPCKLPD, zms_vector, ZydecFormattingInfo::Unpack, 0, zmf_none, "_mm_unpacklo_pd(", ");" },
+  { ZYDIS_MNEMONIC_VUNPCKLPS, zms_vector, ZydecFormattingInfo::Unpack, 0, zmf_none, "_mm_unpacklo_ps(", ");" },
+  { ZYDIS_MNEMONIC_VXORPD, zms_vector, ZydecFormattingInfo::XOr, 0, zmf_sameRegisterZero, "_mm_xor_pd(", ");" },
+  { ZYDIS_MNEMONIC_VXORPS, zms_vector, ZydecFormattingInfo::XOr, 0, zmf_sameRegisterZero, "_mm_xor_ps(", ");" },
+  { ZYDIS_MNEMONIC_VZEROALL, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_zeroall(", ");" },
+  { ZYDIS_MNEMONIC_VZEROUPPER, zms_vector, ZydecFormattingInfo::None, 0, zmf_none, "_mm_zeroupper(", ");" },
+  { ZYDIS_MNEMONIC_WBINVD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_WRFSBASE, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_WRGSBASE, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_WRMSR, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_WRPKRU, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_WRSSD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_WRSSQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_WRUSSD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_WRUSSQ, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_XABORT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_XADD, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_XBEGIN, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_XCHG, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_XCRYPT_CBC, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_XCRYPT_CFB, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_XCRYPT_CTR, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_XCRYPT_ECB, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_XCRYPT_OFB, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_XEND, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_XGETBV, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_XLAT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_XOR, zms_arithmetic, ZydecFormattingInfo::XOr, zop_XOr, zmf_sameRegisterZero, nullptr, ";" },
+  { ZYDIS_MNEMONIC_XORPD, zms_vector, ZydecFormattingInfo::XOr, 0, zmf_sameRegisterZero, "_mm_xor_pd(", ");" },
+  { ZYDIS_MNEMONIC_XORPS, zms_vector, ZydecFormattingInfo::XOr, 0, zmf_sameRegisterZero, "_mm_xor_ps(", ");" },
+  { ZYDIS_MNEMONIC_XRESLDTRK, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_XRSTOR, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_XRSTOR64, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_XRSTORS, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_XRSTORS64, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_XSAVE, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_XSAVE64, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_XSAVEC, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_XSAVEC64, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_XSAVEOPT, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_XSAVEOPT64, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_XSAVES, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_XSAVES64, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_XSETBV, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_XSHA1, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_XSHA256, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_XSTORE, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_XSUSLDTRK, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+  { ZYDIS_MNEMONIC_XTEST, zms_none, ZydecFormattingInfo::None, 0, zmf_none, nullptr, nullptr },
+};
+
+static_assert(sizeof(MnemonicInfoLut) / sizeof(MnemonicInfoLut[0]) == ZYDIS_MNEMONIC_MAX_VALUE + 1, "MnemonicInfoLut is out of sync with ZydisMnemonic.");
+
+constexpr bool zydec_MnemonicInfoLut_IsOrdered(const size_t first, const size_t last)
+{
+  return first == last ? (size_t)MnemonicInfoLut[first].mnemonic == first : (zydec_MnemonicInfoLut_IsOrdered(first, (first + last) / 2) && zydec_MnemonicInfoLut_IsOrdered((first + last) / 2 + 1, last));
+}
+
+static_assert(zydec_MnemonicInfoLut_IsOrdered(0, ZYDIS_MNEMONIC_MAX_VALUE), "MnemonicInfoLut must be indexable by ZydisMnemonic.");
+
+#endif // zydec_mnemonic_lut_h__